@@ -0,0 +1,83 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_BENCH_BATCHNORM_BASE_BATCHNORM_FIXTURE_H_
+#define SYCLDNN_BENCH_BATCHNORM_BASE_BATCHNORM_FIXTURE_H_
+
+#include <benchmark/benchmark.h>
+
+#include "sycldnn/batchnorm/operation.h"
+#include "sycldnn/batchnorm/params.h"
+
+#include <type_traits>
+
+extern const char* commit_date;
+extern const char* commit_hash;
+
+class BaseBatchNormBenchmark : public benchmark::Fixture {
+ private:
+  using State = benchmark::State;
+  using BatchNormParams = sycldnn::batchnorm::BatchNormParams;
+
+ public:
+  // Adds the batchnorm parameters to the counter set.
+  void add_param_counters(State& state, BatchNormParams const& params);
+
+  // Adds theoretical best-case bandwidth requirements to the counter set.
+  template <typename T, typename Operation>
+  void add_bandwidth_counters(State& state, BatchNormParams const& params);
+
+  // Records the number of elements processed to the counter set.
+  inline void set_items_processed(State& state, BatchNormParams const& params);
+};
+
+// Add a full set of counters corresponding to the batchnorm parameters.
+void BaseBatchNormBenchmark::add_param_counters(
+    benchmark::State& state, BatchNormParams const& params) {
+  state.counters["batch"] = params.batch;
+  state.counters["rows"] = params.rows;
+  state.counters["cols"] = params.cols;
+  state.counters["channels"] = params.channels;
+}
+
+// Calculate the optimal bandwidth requirements, and add corresponding counters.
+// Training reads the input once to compute the batch statistics and again to
+// normalise it, while a frozen batchnorm only reads the input once. The
+// per-channel parameters are small enough to be ignored.
+template <typename ElementType, typename Operation>
+void BaseBatchNormBenchmark::add_bandwidth_counters(
+    benchmark::State& state, BatchNormParams const& params) {
+  // Compute the size of each element in bytes.
+  auto element_bytes = sizeof(ElementType);
+  auto tensor_size = static_cast<size_t>(params.batch) * params.rows *
+                     params.cols * params.channels;
+  auto input_reads =
+      std::is_same<Operation, sycldnn::batchnorm::Training>::value ? 2 : 1;
+
+  state.counters["bytes_read"] = input_reads * tensor_size * element_bytes;
+  state.counters["bytes_written"] = tensor_size * element_bytes;
+}
+
+// Records the number of elements processed to the counter set. We define items
+// processed as the size of the input tensor.
+inline void BaseBatchNormBenchmark::set_items_processed(
+    benchmark::State& state, BatchNormParams const& params) {
+  auto tensor_size = static_cast<size_t>(params.batch) * params.rows *
+                     params.cols * params.channels;
+
+  state.SetItemsProcessed(state.iterations() * tensor_size);
+}
+
+#endif  // SYCLDNN_BENCH_BATCHNORM_BASE_BATCHNORM_FIXTURE_H_
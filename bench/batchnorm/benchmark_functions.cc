@@ -0,0 +1,31 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "snn_fixture.h"
+
+#include "src/backend/snn_backend_provider.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/batchnorm/operation.h"
+
+#define BM_WITH_OPERATION_AND_DTYPE(OPERATION, DTYPE)                         \
+  BATCHNORM_BENCHMARK(OPERATION##_##SNNBackend, sycldnn::backend::SNNBackend, \
+                      DTYPE, sycldnn::batchnorm::OPERATION)
+
+// Frozen only normalises the input, so comparing it with Training gives the
+// cost of computing the batch statistics.
+BM_WITH_OPERATION_AND_DTYPE(Training, float)
+BM_WITH_OPERATION_AND_DTYPE(Frozen, float)
@@ -0,0 +1,206 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_BENCH_BATCHNORM_SNN_BATCHNORM_EXECUTOR_H_
+#define SYCLDNN_BENCH_BATCHNORM_SNN_BATCHNORM_EXECUTOR_H_
+
+#include <benchmark/benchmark.h>
+
+#include "sycldnn/helpers/handle_exception.h"
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "sycldnn/batchnorm/direction.h"
+#include "sycldnn/batchnorm/launch.h"
+#include "sycldnn/batchnorm/operation.h"
+#include "sycldnn/batchnorm/params.h"
+
+#include "bench/fixture/base_executor.h"
+
+#include <vector>
+
+namespace sycldnn {
+namespace bench {
+namespace internal {
+
+/** Helper to launch a forward batchnorm for the given Operation. */
+template <typename Operation>
+struct BatchNormLauncher;
+
+/** Launch a forward training batchnorm. */
+template <>
+struct BatchNormLauncher<batchnorm::Training> {
+  template <typename Backend, typename Pointer>
+  static SNNStatus launch(Pointer input, Pointer beta, Pointer gamma,
+                          Pointer mean, Pointer variance, Pointer running_mean,
+                          Pointer running_variance, Pointer output,
+                          batchnorm::BatchNormParams const& params,
+                          Backend& backend) {
+    return batchnorm::launch_forward<float, Backend, batchnorm::Forward,
+                                     batchnorm::Training>(
+        input, beta, gamma, mean, variance, running_mean, running_variance,
+        output, params, backend);
+  }
+};
+
+/** Launch a forward frozen batchnorm, which ignores the running statistics. */
+template <>
+struct BatchNormLauncher<batchnorm::Frozen> {
+  template <typename Backend, typename Pointer>
+  static SNNStatus launch(Pointer input, Pointer beta, Pointer gamma,
+                          Pointer mean, Pointer variance, Pointer, Pointer,
+                          Pointer output,
+                          batchnorm::BatchNormParams const& params,
+                          Backend& backend) {
+    return batchnorm::launch_forward<float, Backend, batchnorm::Forward,
+                                     batchnorm::Frozen>(
+        input, beta, gamma, mean, variance, output, params, backend);
+  }
+};
+
+}  // namespace internal
+
+/**
+ * Executor to perform the forward batchnorm benchmark using SYCL-DNN.
+ *
+ * Training computes the batch statistics and updates the running statistics
+ * before normalising the input, while Frozen normalises the input with the
+ * given statistics, so comparing the two gives the cost of the statistics.
+ */
+template <typename Benchmark, typename Operation>
+struct SNNBatchNormExecutor : public BaseExecutor {
+ private:
+  using State = ::benchmark::State;
+  using BatchNormParams = batchnorm::BatchNormParams;
+  using Launcher = internal::BatchNormLauncher<Operation>;
+
+  /** Get a reference to the underlying benchmark fixture. */
+  Benchmark& underlying_benchmark() { return static_cast<Benchmark&>(*this); }
+
+ public:
+  /** Execute the batchnorm benchmark for the given parameters. */
+  void execute(State& state, BatchNormParams const& params) {
+    auto& benchmark = underlying_benchmark();
+    auto& backend = benchmark.get_backend();
+
+    size_t const tensor_size = static_cast<size_t>(params.batch) *
+                               params.rows * params.cols * params.channels;
+    size_t const channels = params.channels;
+
+    std::vector<float> inp_vec(tensor_size);
+    std::vector<float> beta_vec(channels, 0.f);
+    std::vector<float> gamma_vec(channels, 1.f);
+    std::vector<float> mean_vec(channels, 0.f);
+    std::vector<float> variance_vec(channels, 1.f);
+    std::vector<float> out_vec(tensor_size);
+
+    auto inp_gpu =
+        benchmark.get_initialised_device_memory(inp_vec.size(), inp_vec);
+    auto beta_gpu =
+        benchmark.get_initialised_device_memory(beta_vec.size(), beta_vec);
+    auto gamma_gpu =
+        benchmark.get_initialised_device_memory(gamma_vec.size(), gamma_vec);
+    auto mean_gpu =
+        benchmark.get_initialised_device_memory(mean_vec.size(), mean_vec);
+    auto variance_gpu = benchmark.get_initialised_device_memory(
+        variance_vec.size(), variance_vec);
+    auto running_mean_gpu =
+        benchmark.get_initialised_device_memory(mean_vec.size(), mean_vec);
+    auto running_variance_gpu = benchmark.get_initialised_device_memory(
+        variance_vec.size(), variance_vec);
+    auto out_gpu =
+        benchmark.get_initialised_device_memory(out_vec.size(), out_vec);
+
+    SNN_ON_SCOPE_EXIT {
+      benchmark.deallocate_ptr(out_gpu);
+      benchmark.deallocate_ptr(running_variance_gpu);
+      benchmark.deallocate_ptr(running_mean_gpu);
+      benchmark.deallocate_ptr(variance_gpu);
+      benchmark.deallocate_ptr(mean_gpu);
+      benchmark.deallocate_ptr(gamma_gpu);
+      benchmark.deallocate_ptr(beta_gpu);
+      benchmark.deallocate_ptr(inp_gpu);
+    };
+
+    {  // Ensure the kernel is built before benchmarking
+      SNNStatus status;
+      try {
+        status = Launcher::launch(inp_gpu, beta_gpu, gamma_gpu, mean_gpu,
+                                  variance_gpu, running_mean_gpu,
+                                  running_variance_gpu, out_gpu, params,
+                                  backend);
+      } catch (cl::sycl::exception const& e) {
+        helpers::handle_exception(e, [&](std::string& msg) {
+          state.SkipWithError((msg + UnexpectedFailure).c_str());
+        });
+        return;
+      }
+
+      if (sycldnn::StatusCode::OK != status.status) {
+        state.SkipWithError(UnsupportedFailure);
+        return;
+      }
+
+      try {
+        status.event.wait_and_throw();
+      } catch (cl::sycl::exception const& e) {
+        helpers::handle_exception(e, [&](std::string& msg) {
+          state.SkipWithError((msg + UnexpectedFailure).c_str());
+        });
+        return;
+      } catch (std::exception const& e) {
+        helpers::handle_exception(e, [&](std::string& msg) {
+          state.SkipWithError((msg + UnexpectedFailure).c_str());
+        });
+        return;
+      }
+    }
+
+    for (auto _ : state) {
+      this->start_timing();
+      try {
+        auto status = Launcher::launch(inp_gpu, beta_gpu, gamma_gpu,
+                                       mean_gpu, variance_gpu,
+                                       running_mean_gpu, running_variance_gpu,
+                                       out_gpu, params, backend);
+
+        status.event.wait_and_throw();
+      } catch (cl::sycl::exception const& e) {
+        helpers::handle_exception(e, [&](std::string& msg) {
+          state.SkipWithError((msg + UnexpectedFailure).c_str());
+        });
+        return;
+      } catch (std::exception const& e) {
+        helpers::handle_exception(e, [&](std::string& msg) {
+          state.SkipWithError((msg + UnexpectedFailure).c_str());
+        });
+        return;
+      }
+
+      this->end_timing();
+      this->set_iteration_time(state);
+    }
+
+    benchmark.set_items_processed(state, params);
+    benchmark.add_param_counters(state, params);
+    benchmark.template add_bandwidth_counters<float, Operation>(state, params);
+
+    this->finish_benchmark(state);
+  }
+};
+
+}  // namespace bench
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_BENCH_BATCHNORM_SNN_BATCHNORM_EXECUTOR_H_
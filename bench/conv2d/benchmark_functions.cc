@@ -38,6 +38,7 @@
 
 #include "sycldnn/conv2d/selector/direct_selector.h"
 #include "sycldnn/conv2d/selector/im2col_selector.h"
+#include "sycldnn/conv2d/selector/implicit_gemm_selector.h"
 #include "sycldnn/conv2d/selector/matmul_selector.h"
 #include "sycldnn/conv2d/selector/tiled_selector.h"
 #include "sycldnn/conv2d/selector/winograd_selector.h"
@@ -50,6 +51,12 @@
 #define BM_WITH_ALGO_DIR_BACK(ALGO, DIR, BACK) \
   BM_WITH_ALGO_DIR_BACK_DTYPE(ALGO, DIR, BACK, float)
 
+#define BM_WITH_ALGO_DIR_BACK_HALF(ALGO, DIR, BACK)             \
+  CONVOLUTION_BENCHMARK(ALGO##_##DIR##_##BACK##_half,           \
+                        sycldnn::backend::BACK, cl::sycl::half, \
+                        sycldnn::conv2d::conv_type::DIR,        \
+                        sycldnn::conv2d::ALGO##Selector)
+
 #ifdef SNN_BENCH_EIGEN
 #define BM_WITH_EIGEN(ALGO, DIR) BM_WITH_ALGO_DIR_BACK(ALGO, DIR, EigenBackend)
 #else
@@ -95,8 +102,16 @@
 
 BM_ALGO_WITH_SNNBACKEND(Direct)
 BM_ALGO_WITH_SNNBACKEND(Tiled)
+BM_ALGO_WITH_SNNBACKEND(ImplicitGemm)
 
 BM_WITH_ALGO(Im2col);
 BM_WITH_ALGO(Winograd);
 BM_WITH_ALGO(WinogradLarge);
 BM_WITH_ALGO(Matmul);
+
+#ifdef SNN_USE_HALF
+BM_WITH_ALGO_DIR_BACK_HALF(Tiled, Forward, SNNBackend)
+BM_WITH_ALGO_DIR_BACK_HALF(Winograd, Forward, SNNBackend)
+BM_WITH_ALGO_DIR_BACK_HALF(WinogradLarge, Forward, SNNBackend)
+BM_WITH_ALGO_DIR_BACK_HALF(Matmul, Forward, SNNBackend)
+#endif  // SNN_USE_HALF
@@ -42,7 +42,7 @@ inline void wait_for_event(cl::sycl::event& ev, cl::sycl::queue q) {
 }
 
 /** Executor to perform the Conv2d benchmark using SYCL-DNN.  */
-template <typename Benchmark, typename ConvType>
+template <typename Benchmark, typename ConvType, typename DataType = float>
 struct SNNConv2DExecutor : public BaseExecutor {
  private:
   using State = ::benchmark::State;
@@ -60,9 +60,9 @@ struct SNNConv2DExecutor : public BaseExecutor {
 
     auto conv_sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
 
-    std::vector<float> inp_vec(conv_sizes.input_size);
-    std::vector<float> fil_vec(conv_sizes.filter_size);
-    std::vector<float> out_vec(conv_sizes.output_size);
+    std::vector<DataType> inp_vec(conv_sizes.input_size);
+    std::vector<DataType> fil_vec(conv_sizes.filter_size);
+    std::vector<DataType> out_vec(conv_sizes.output_size);
 
     auto inp_gpu =
         benchmark.get_initialised_device_memory(inp_vec.size(), inp_vec);
@@ -79,9 +79,9 @@ struct SNNConv2DExecutor : public BaseExecutor {
 
     auto workspace_size = compute_workspace_size(
         params, backend.get_queue().get_device(), selector);
-    std::vector<float> workspace_vals(workspace_size);
+    std::vector<DataType> workspace_vals(workspace_size);
 
-    typename Benchmark::template Pointer<float> workspace{};
+    typename Benchmark::template Pointer<DataType> workspace{};
     try {
       workspace = benchmark.get_initialised_device_memory(workspace_size,
                                                           workspace_vals);
@@ -94,7 +94,7 @@ struct SNNConv2DExecutor : public BaseExecutor {
     {  // Ensure the kernel is built before benchmarking
       SNNStatus status;
       try {
-        status = sycldnn::conv2d::launch<float, ConvType>(
+        status = sycldnn::conv2d::launch<DataType, ConvType>(
             inp_gpu, fil_gpu, out_gpu, params, selector, backend, workspace,
             workspace_size);
       } catch (cl::sycl::exception const& e) {
@@ -127,7 +127,7 @@ struct SNNConv2DExecutor : public BaseExecutor {
     for (auto _ : state) {
       this->start_timing();
       try {
-        auto status = sycldnn::conv2d::launch<float, ConvType>(
+        auto status = sycldnn::conv2d::launch<DataType, ConvType>(
             inp_gpu, fil_gpu, out_gpu, params, selector, backend, workspace,
             workspace_size);
 
@@ -150,7 +150,7 @@ struct SNNConv2DExecutor : public BaseExecutor {
 
     benchmark.template set_items_processed<ConvType>(state, params);
     benchmark.add_param_counters(state, params);
-    benchmark.template add_bandwidth_counters<float>(state, conv_sizes);
+    benchmark.template add_bandwidth_counters<DataType>(state, conv_sizes);
 
     this->finish_benchmark(state);
   }
@@ -37,7 +37,7 @@ template <typename Backend, typename DataType, typename ConvType,
 class SNNConvolutionBenchmark
     : public sycldnn::bench::SNNConv2DExecutor<
           SNNConvolutionBenchmark<Backend, DataType, ConvType, Selector>,
-          ConvType>,
+          ConvType, DataType>,
       public sycldnn::backend::BackendProvider<Backend>,
       public sycldnn::bench::StringReporter,
       public BaseConvolutionBenchmark {
@@ -16,9 +16,9 @@
 #ifndef SYCLDNN_BENCH_FIXTURE_ADD_DATATYPE_INFO_H_
 #define SYCLDNN_BENCH_FIXTURE_ADD_DATATYPE_INFO_H_
 
-#ifdef SNN_ENABLE_HALF
+#ifdef SNN_USE_HALF
 #include <CL/sycl.hpp>
-#endif  // SNN_ENABLE_HALF
+#endif  // SNN_USE_HALF
 
 #include "string_reporter.h"
 
@@ -44,12 +44,12 @@ inline void add_datatype_info<double>(StringReporter& reporter) {
   reporter.add_to_label("@datatype", "double");
 }
 
-#ifdef SNN_ENABLE_HALF
+#ifdef SNN_USE_HALF
 template <>
 inline void add_datatype_info<cl::sycl::half>(StringReporter& reporter) {
   reporter.add_to_label("@datatype", "sycl::half");
 }
-#endif  // SNN_ENABLE_HALF
+#endif  // SNN_USE_HALF
 
 }  // namespace datatype_info
 }  // namespace bench
@@ -16,6 +16,7 @@
 #ifndef SYCLDNN_BENCH_FIXTURE_TYPENAMES_H_
 #define SYCLDNN_BENCH_FIXTURE_TYPENAMES_H_
 
+#include "sycldnn/batchnorm/operation.h"
 #include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/pointwise/direction.h"
 #include "sycldnn/pooling/operators.h"
@@ -51,6 +52,14 @@ constexpr const char* TypeName<sycldnn::pointwise::Gradient>::name = "Gradient";
 template <>
 constexpr const char* TypeName<sycldnn::pointwise::GradGrad>::name = "GradGrad";
 
+// Operation for Batchnorm
+template <>
+constexpr const char* TypeName<sycldnn::batchnorm::Training>::name =
+    "Training";
+
+template <>
+constexpr const char* TypeName<sycldnn::batchnorm::Frozen>::name = "Frozen";
+
 // Types of convolution
 template <>
 constexpr const char* TypeName<sycldnn::conv2d::conv_type::Forward>::name =
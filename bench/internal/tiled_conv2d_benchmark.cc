@@ -15,24 +15,22 @@
  */
 #include <benchmark/benchmark.h>
 
-#include "sycldnn/accessor_types.h"
 #include "sycldnn/mem_object.h"
 #include "sycldnn/padding_mode.h"
 #include "sycldnn/status.h"
 
 #include "sycldnn/backend/snn_backend.h"
 
-#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
-#include "sycldnn/conv2d/selector/selector.h"
+#include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/conv2d/tiled_config.h"
+
+#include "sycldnn/conv2d/implementation/tiled.h"
 
 #include "sycldnn/helpers/padding.h"
 #include "sycldnn/helpers/scope_exit.h"
 
-#include "src/conv2d/tiled/kernel_params.h"
-#include "src/conv2d/tiled/queue_tiled_kernel_impl.h"
-#include "src/conv2d/tiled/tile_info.h"
-
 #include "bench/conv2d/base_convolution_fixture.h"
 
 #include "src/backend/backend_provider.h"
@@ -44,39 +42,17 @@
 #include "bench/fixture/statistic.h"
 #include "bench/fixture/string_reporter.h"
 
-namespace {
-
-template <typename T, typename Index, typename ConvType, int TileRows,
-          int TileCols, int ChannelVectorWidth, int FeatureVectorWidth,
-          bool UseFastDiv, int WindowRows, int WindowCols, int Stride,
-          typename Backend>
-sycldnn::SNNStatus launch_kernel(
-    typename Backend::template pointer_type<const T> input,
-    typename Backend::template pointer_type<const T> filter,
-    typename Backend::template pointer_type<T> output,
-    sycldnn::conv2d::Conv2DParams const& params,
-    sycldnn::conv2d::ConvSizes const& sizes, Backend& backend) {
-  auto in_acc = backend.get_mem_object(input, sizes.input_size);
-  auto fil_acc = backend.get_mem_object(filter, sizes.filter_size);
-  auto out_acc = backend.get_mem_object(output, sizes.output_size);
-
-  auto queue = backend.get_queue();
-  auto tile_info = sycldnn::conv2d::internal::tiled::get_tile_info<ConvType>(
-      params, TileRows, TileCols, ChannelVectorWidth, FeatureVectorWidth);
+#include <string>
+#include <vector>
 
-  auto kernel_params =
-      sycldnn::conv2d::internal::get_kernel_params<ConvType>(params);
-
-  auto status = sycldnn::conv2d::internal::queue_tiled_kernel<
-      T, Index, ConvType, TileRows, TileCols, ChannelVectorWidth,
-      FeatureVectorWidth, UseFastDiv, WindowRows, WindowCols, Stride>(
-      in_acc, fil_acc, out_acc, kernel_params, tile_info, queue);
-  return status;
-}
+namespace {
 
-template <typename Backend, typename ParamGen, typename ConvType, int TileRows,
-          int TileCols, int ChannelVectorWidth, int FeatureVectorWidth,
-          bool UseFastDiv, int WindowRows, int WindowCols, int Stride>
+/**
+ * Benchmark a tiled convolution using one of the tile configurations compiled
+ * into the library. The benchmarks are registered at runtime, one for each
+ * configuration returned by sycldnn::conv2d::get_tiled_configs.
+ */
+template <typename Backend, typename ConvType>
 class TiledConvolutionBenchmark
     : public sycldnn::backend::BackendProvider<Backend>,
       public sycldnn::bench::StringReporter,
@@ -85,37 +61,39 @@ class TiledConvolutionBenchmark
  private:
   using State = benchmark::State;
   using Conv2DParams = sycldnn::conv2d::Conv2DParams;
+  using TiledConfig = sycldnn::conv2d::TiledConfig;
+
+ public:
+  TiledConvolutionBenchmark(std::string const& name,
+                            Conv2DParams const& params,
+                            TiledConfig const& config)
+      : params_(params), config_(config) {
+    this->SetName(name.c_str());
+  }
 
  protected:
-  void execute(State& state, Conv2DParams const& params);
-
-  void run(State& state) {
-    auto params = ParamGen()();
+  void BenchmarkCase(State& state) override {
     this->add_statistic(std::unique_ptr<sycldnn::bench::Statistic>{
         new sycldnn::bench::MaxStatistic{}});
     this->add_statistic(std::unique_ptr<sycldnn::bench::Statistic>{
         new sycldnn::bench::MinStatistic{}});
     this->add_statistic(std::unique_ptr<sycldnn::bench::Statistic>{
         new sycldnn::bench::StdDevStatistic{}});
-    if (params.window_rows != WindowRows || params.window_cols != WindowCols ||
-        params.stride_rows != Stride || params.stride_cols != Stride) {
-      state.SkipWithError(
-          "Runtime paramters don't match the compile time kernel sizes.");
-      return;
-    }
-    this->execute(state, params);
-  };
+    this->execute(state);
+  }
+
+ private:
+  void execute(State& state);
+
+  Conv2DParams params_;
+  TiledConfig config_;
 };
 
-template <typename Backend, typename ParamGen, typename ConvType, int TileRows,
-          int TileCols, int ChannelVectorWidth, int FeatureVectorWidth,
-          bool UseFastDiv, int WindowRows, int WindowCols, int Stride>
-void TiledConvolutionBenchmark<
-    Backend, ParamGen, ConvType, TileRows, TileCols, ChannelVectorWidth,
-    FeatureVectorWidth, UseFastDiv, WindowRows, WindowCols,
-    Stride>::execute(benchmark::State& state,
-                     sycldnn::conv2d::Conv2DParams const& params) {
+template <typename Backend, typename ConvType>
+void TiledConvolutionBenchmark<Backend, ConvType>::execute(
+    benchmark::State& state) {
   auto& backend = this->get_backend();
+  auto const& params = params_;
 
   auto conv_sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
 
@@ -133,11 +111,8 @@ void TiledConvolutionBenchmark<
   };
 
   {  // Ensure the kernel is built before benchmarking
-    auto status = launch_kernel<float, int, ConvType, TileRows, TileCols,
-                                ChannelVectorWidth, FeatureVectorWidth,
-                                UseFastDiv, WindowRows, WindowCols, Stride>(
-        inp_gpu, fil_gpu, out_gpu, params, conv_sizes, backend);
-    status.event.wait_and_throw();
+    auto status = sycldnn::conv2d::launch_tiled<float, ConvType>(
+        inp_gpu, fil_gpu, out_gpu, params, config_, backend);
 
     if (sycldnn::StatusCode::OK != status.status) {
       state.SkipWithError(
@@ -145,14 +120,13 @@ void TiledConvolutionBenchmark<
           "This may be expected behaviour and does not indicate a problem.");
       return;
     }
+    status.event.wait_and_throw();
   }
 
   for (auto _ : state) {
     this->start_timing();
-    auto status = launch_kernel<float, int, ConvType, TileRows, TileCols,
-                                ChannelVectorWidth, FeatureVectorWidth,
-                                UseFastDiv, WindowRows, WindowCols, Stride>(
-        inp_gpu, fil_gpu, out_gpu, params, conv_sizes, backend);
+    auto status = sycldnn::conv2d::launch_tiled<float, ConvType>(
+        inp_gpu, fil_gpu, out_gpu, params, config_, backend);
 
     status.event.wait_and_throw();
     this->end_timing();
@@ -165,11 +139,10 @@ void TiledConvolutionBenchmark<
 
   set_items_processed<ConvType>(state, params);
   add_param_counters(state, params);
-  state.counters["tile_rows"] = TileRows;
-  state.counters["tile_cols"] = TileCols;
-  state.counters["ch_vect"] = ChannelVectorWidth;
-  state.counters["feat_vect"] = FeatureVectorWidth;
-  state.counters["fast_div"] = UseFastDiv;
+  state.counters["tile_rows"] = config_.tile_rows;
+  state.counters["tile_cols"] = config_.tile_cols;
+  state.counters["ch_vect"] = config_.channel_vector_width;
+  state.counters["feat_vect"] = config_.feature_vector_width;
   add_bandwidth_counters<float>(state, conv_sizes);
 
   add_to_label("@selector", "TiledSelector");
@@ -180,131 +153,54 @@ void TiledConvolutionBenchmark<
   this->finish_benchmark(state);
 }
 
-template <int WindowRows, int WindowCols, int Stride>
-struct ParamGenerator {
-  sycldnn::conv2d::Conv2DParams operator()() {
-    sycldnn::conv2d::Conv2DParams params;
-    params.channels = 196;
-    params.features = 384;
-    params.batch = 4;
-    params.in_rows = 27;
-    params.in_cols = 27;
-    params.window_rows = WindowCols;
-    params.window_cols = WindowRows;
-    params.stride_rows = Stride;
-    params.stride_cols = Stride;
-    params.dilation_rows = 1;
-    params.dilation_cols = 1;
-    return sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::SAME);
+sycldnn::conv2d::Conv2DParams get_params(int window, int stride) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 196;
+  params.features = 384;
+  params.batch = 4;
+  params.in_rows = 27;
+  params.in_cols = 27;
+  params.window_rows = window;
+  params.window_cols = window;
+  params.stride_rows = stride;
+  params.stride_cols = stride;
+  params.dilation_rows = 1;
+  params.dilation_cols = 1;
+  return sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::SAME);
+}
+
+/** Register a benchmark for every available tile size for the convolution. */
+template <typename ConvType>
+void register_tiled_benchmarks(char const* direction, int window, int stride) {
+  using Benchmark =
+      TiledConvolutionBenchmark<sycldnn::backend::SNNBackend, ConvType>;
+  auto params = get_params(window, stride);
+  for (auto const& config :
+       sycldnn::conv2d::get_tiled_configs<ConvType>(params)) {
+    auto name = std::string{direction} + "_" + std::to_string(window) + "x" +
+                std::to_string(window) + "s" + std::to_string(stride) + "_" +
+                std::to_string(config.tile_rows) + "_" +
+                std::to_string(config.tile_cols) + "_" +
+                std::to_string(config.channel_vector_width) + "_" +
+                std::to_string(config.feature_vector_width);
+    ::benchmark::internal::RegisterBenchmarkInternal(
+        new Benchmark(name, params, config))
+        ->UseManualTime()
+        ->Unit(benchmark::kNanosecond);
   }
-};
+}
 
 }  // namespace
 
-#define TILED_BENCHMARK(name, ...)                                          \
-  BENCHMARK_TEMPLATE_DEFINE_F(TiledConvolutionBenchmark, name, __VA_ARGS__) \
-  (benchmark::State & state) { this->run(state); }                          \
-  BENCHMARK_REGISTER_F(TiledConvolutionBenchmark, name)                     \
-      ->UseManualTime()                                                     \
-      ->Unit(benchmark::kNanosecond);
-
-#define PARAM_BENCHMARK(name, direction, tile_row, tile_col, ch_vect,        \
-                        feat_vect, fast_div, window_row, window_col, stride) \
-  TILED_BENCHMARK(                                                           \
-      name##_##tile_row##_##tile_col##_##ch_vect##_##feat_vect##_##fast_div, \
-      sycldnn::backend::SNNBackend,                                          \
-      ParamGenerator<window_row, window_col, stride>, direction, tile_row,   \
-      tile_col, ch_vect, feat_vect, fast_div, window_row, window_col, stride);
-
-#define BENCH_WITH_TILES(name, direction, tile_row, tile_col, fast_div, \
-                         window_row, window_col, stride)                \
-  PARAM_BENCHMARK(name, direction, tile_row, tile_col, 1, 1, fast_div,  \
-                  window_row, window_col, stride)                       \
-  PARAM_BENCHMARK(name, direction, tile_row, tile_col, 1, 2, fast_div,  \
-                  window_row, window_col, stride)                       \
-  PARAM_BENCHMARK(name, direction, tile_row, tile_col, 1, 4, fast_div,  \
-                  window_row, window_col, stride)                       \
-  PARAM_BENCHMARK(name, direction, tile_row, tile_col, 1, 8, fast_div,  \
-                  window_row, window_col, stride)                       \
-  PARAM_BENCHMARK(name, direction, tile_row, tile_col, 2, 1, fast_div,  \
-                  window_row, window_col, stride)                       \
-  PARAM_BENCHMARK(name, direction, tile_row, tile_col, 2, 2, fast_div,  \
-                  window_row, window_col, stride)                       \
-  PARAM_BENCHMARK(name, direction, tile_row, tile_col, 2, 4, fast_div,  \
-                  window_row, window_col, stride)                       \
-  PARAM_BENCHMARK(name, direction, tile_row, tile_col, 2, 8, fast_div,  \
-                  window_row, window_col, stride)                       \
-  PARAM_BENCHMARK(name, direction, tile_row, tile_col, 4, 1, fast_div,  \
-                  window_row, window_col, stride)                       \
-  PARAM_BENCHMARK(name, direction, tile_row, tile_col, 4, 2, fast_div,  \
-                  window_row, window_col, stride)                       \
-  PARAM_BENCHMARK(name, direction, tile_row, tile_col, 4, 4, fast_div,  \
-                  window_row, window_col, stride)                       \
-  PARAM_BENCHMARK(name, direction, tile_row, tile_col, 4, 8, fast_div,  \
-                  window_row, window_col, stride)                       \
-  PARAM_BENCHMARK(name, direction, tile_row, tile_col, 8, 1, fast_div,  \
-                  window_row, window_col, stride)                       \
-  PARAM_BENCHMARK(name, direction, tile_row, tile_col, 8, 2, fast_div,  \
-                  window_row, window_col, stride)                       \
-  PARAM_BENCHMARK(name, direction, tile_row, tile_col, 8, 4, fast_div,  \
-                  window_row, window_col, stride)                       \
-  PARAM_BENCHMARK(name, direction, tile_row, tile_col, 8, 8, fast_div,  \
-                  window_row, window_col, stride)
-
-#define BENCH_WITH_FAST_DIV(name, direction, fast_div, window_row, window_col, \
-                            stride)                                            \
-  BENCH_WITH_TILES(name, direction, 1, 1, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 1, 2, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 1, 3, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 1, 4, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 1, 5, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 2, 1, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 2, 2, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 2, 3, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 2, 4, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 2, 5, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 3, 1, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 3, 2, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 3, 3, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 3, 4, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 3, 5, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 4, 1, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 4, 2, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 4, 3, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 4, 4, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 4, 5, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 5, 1, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 5, 2, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 5, 3, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 5, 4, fast_div, window_row, window_col,    \
-                   stride)                                                     \
-  BENCH_WITH_TILES(name, direction, 5, 5, fast_div, window_row, window_col,    \
-                   stride)
-
-#define BENCH_BASE(name, direction, window_row, window_col, stride) \
-  BENCH_WITH_FAST_DIV(name, direction, true, window_row, window_col, stride)
-
-BENCH_BASE(Forward, sycldnn::conv2d::conv_type::Forward, 3, 3, 1);
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  for (int window : {1, 3, 5}) {
+    for (int stride : {1, 2}) {
+      register_tiled_benchmarks<sycldnn::conv2d::conv_type::Forward>(
+          "Forward", window, stride);
+      register_tiled_benchmarks<sycldnn::conv2d::conv_type::InputBackprop>(
+          "InputBackprop", window, stride);
+    }
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -38,6 +38,9 @@
 #define BM_INSTANTIATE(BACK, DTYPE) \
   MATMUL_BENCHMARK(BACK, sycldnn::backend::BACK, DTYPE)
 
+#define BM_INSTANTIATE_HALF(BACK) \
+  MATMUL_BENCHMARK(BACK##_half, sycldnn::backend::BACK, cl::sycl::half)
+
 #define BM_WITH_BACKEND(BACK) BM_INSTANTIATE(BACK, float)
 
 #ifdef SNN_BENCH_EIGEN
@@ -55,3 +58,7 @@ BM_WITH_BACKEND(CLBlastBackend);
 #ifdef SNN_BENCH_SNNBACKEND
 BM_WITH_BACKEND(SNNBackend);
 #endif
+
+#if defined(SNN_BENCH_SNNBACKEND) && defined(SNN_USE_HALF)
+BM_INSTANTIATE_HALF(SNNBackend);
+#endif
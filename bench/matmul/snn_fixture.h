@@ -36,7 +36,7 @@ extern const char* commit_hash;
 
 template <typename Backend, typename DataType>
 class SNNMatmulBenchmark : public sycldnn::bench::SNNMatmulExecutor<
-                               SNNMatmulBenchmark<Backend, DataType>>,
+                               SNNMatmulBenchmark<Backend, DataType>, DataType>,
                            public sycldnn::backend::BackendProvider<Backend>,
                            public sycldnn::bench::StringReporter,
                            public benchmark::Fixture {
@@ -39,7 +39,7 @@ inline void wait_for_event(cl::sycl::event& ev, cl::sycl::queue q) {
 }
 
 /** Executor to perform a matrix multiply benchmark using SYCL-DNN.  */
-template <typename Benchmark>
+template <typename Benchmark, typename DataType = float>
 struct SNNMatmulExecutor : public BaseExecutor {
  private:
   using State = ::benchmark::State;
@@ -58,9 +58,9 @@ struct SNNMatmulExecutor : public BaseExecutor {
     auto rhs_size = batch * k * n;
     auto out_size = batch * m * n;
 
-    std::vector<float> lhs_vec(lhs_size);
-    std::vector<float> rhs_vec(rhs_size);
-    std::vector<float> out_vec(out_size);
+    std::vector<DataType> lhs_vec(lhs_size);
+    std::vector<DataType> rhs_vec(rhs_size);
+    std::vector<DataType> out_vec(out_size);
 
     auto lhs_gpu =
         benchmark.get_initialised_device_memory(lhs_vec.size(), lhs_vec);
@@ -77,16 +77,16 @@ struct SNNMatmulExecutor : public BaseExecutor {
 
     auto do_matmul = [&]() {
       if (!transpose_lhs && !transpose_rhs) {
-        return backend.template batch_matmul<false, false, float>(
+        return backend.template batch_matmul<false, false, DataType>(
             lhs_gpu, rhs_gpu, out_gpu, batch, m, k, n);
       } else if (transpose_lhs && !transpose_rhs) {
-        return backend.template batch_matmul<true, false, float>(
+        return backend.template batch_matmul<true, false, DataType>(
             lhs_gpu, rhs_gpu, out_gpu, batch, m, k, n);
       } else if (!transpose_lhs && transpose_rhs) {
-        return backend.template batch_matmul<false, true, float>(
+        return backend.template batch_matmul<false, true, DataType>(
             lhs_gpu, rhs_gpu, out_gpu, batch, m, k, n);
       } else {  // transpose_lhs && transpose_rhs
-        return backend.template batch_matmul<true, true, float>(
+        return backend.template batch_matmul<true, true, DataType>(
             lhs_gpu, rhs_gpu, out_gpu, batch, m, k, n);
       }
     };
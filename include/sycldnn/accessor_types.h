@@ -35,6 +35,10 @@ using LocalAccessor =
  *
  * Provides a simple constructor for accessors, and a unified way of ensuring
  * that offsets into buffers are included in kernels.
+ *
+ * When USM support is enabled the wrapper can instead hold a raw device
+ * pointer, in which case no SYCL accessor is requested and the kernels use the
+ * raw pointer directly.
  */
 template <typename T, cl::sycl::access::mode Mode>
 struct BaseAccessor {
@@ -67,11 +71,41 @@ struct BaseAccessor {
         extent_{extent},
         offset_{offset} {}
 
+#ifdef SNN_USE_USM
+  /**
+   * Construct a BaseAccessor from a USM device pointer.
+   * \param ptr    The USM pointer to the start of the memory to access.
+   * \param extent The number of elements available from the pointer.
+   */
+  BaseAccessor(T* ptr, size_t extent)
+      : acc_{}, usm_ptr_{ptr}, extent_{extent}, offset_{0} {}
+
+  /**
+   * Check whether this accessor wraps a USM pointer rather than a SYCL
+   * accessor.
+   * \return Whether the accessor holds a USM pointer.
+   */
+  bool is_usm() const { return usm_ptr_ != nullptr; }
+
+  /**
+   * Get the USM pointer wrapped by this accessor.
+   * \return The USM pointer, or nullptr if a SYCL accessor is used.
+   */
+  T* get_usm_pointer() const { return usm_ptr_; }
+#endif  // SNN_USE_USM
+
   /**
    * Get the underlying pointer from the accessor.
    * \return A global pointer to the underlying memory.
    */
-  MultiPtr get_pointer() const { return acc_.get_pointer() + offset_; }
+  MultiPtr get_pointer() const {
+#ifdef SNN_USE_USM
+    if (usm_ptr_) {
+      return MultiPtr{usm_ptr_};
+    }
+#endif  // SNN_USE_USM
+    return acc_.get_pointer() + offset_;
+  }
 
   /**
    * Get a reference to the underlying SYCL accessor.
@@ -95,6 +129,11 @@ struct BaseAccessor {
   /** The SYCL accessor. */
   Accessor acc_;
 
+#ifdef SNN_USE_USM
+  /** The USM pointer, or nullptr if the SYCL accessor is used. */
+  T* usm_ptr_ = nullptr;
+#endif  // SNN_USE_USM
+
   /**
    * The number of elements in the buffer to provide access to.
    */
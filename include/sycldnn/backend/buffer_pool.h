@@ -0,0 +1,190 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_BACKEND_BUFFER_POOL_H_
+#define SYCLDNN_INCLUDE_BACKEND_BUFFER_POOL_H_
+
+#include "sycldnn/helpers/macros.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+/**
+ * \file
+ * Contains the BufferPool class, which caches the SYCL buffers used for
+ * temporary allocations so they can be reused across operation launches.
+ */
+
+namespace sycldnn {
+namespace backend {
+
+/** Statistics describing the usage of a \ref BufferPool. */
+struct BufferPoolStats {
+  /** The number of allocations served from a cached buffer. */
+  size_t hits = 0;
+
+  /** The number of allocations which required a new buffer. */
+  size_t misses = 0;
+
+  /** The number of bytes in buffers currently handed out by the pool. */
+  size_t bytes_in_use = 0;
+
+  /** The number of bytes in buffers cached by the pool, ready for reuse. */
+  size_t bytes_cached = 0;
+
+  /** The maximum number of bytes held by the pool at any one time. */
+  size_t peak_bytes = 0;
+};
+
+/**
+ * A thread-safe pool of SYCL buffers used for temporary allocations.
+ *
+ * Allocations are rounded up to a power of two number of bytes, and each size
+ * bucket holds a list of buffers which have been returned to the pool. A
+ * request is served from the matching bucket if possible, and otherwise a new
+ * buffer is created.
+ *
+ * A buffer can be returned to the pool as soon as the last kernel using it has
+ * been submitted. The SYCL runtime tracks the accessors requested on a buffer,
+ * so any kernel which later reuses the buffer is scheduled after the kernels
+ * still using it have completed.
+ *
+ * The buffers are stored as bytes and reinterpreted to the requested type, so
+ * a buffer used for one data type can be reused for another.
+ */
+class BufferPool {
+  using ByteBuffer = cl::sycl::buffer<uint8_t, 1>;
+
+ public:
+  /** The smallest size in bytes of any buffer allocated by the pool. */
+  static constexpr size_t min_bucket_size = 256;
+
+  BufferPool() = default;
+
+  SNN_DISABLE_COPY(BufferPool);
+  SNN_DISABLE_MOVE(BufferPool);
+
+  /**
+   * Get a buffer holding at least the requested number of elements.
+   *
+   * \param n_elems The number of elements required in the buffer.
+   * \return A buffer of at least n_elems elements.
+   */
+  template <typename T>
+  cl::sycl::buffer<T, 1> allocate(size_t n_elems) {
+    size_t const bucket = bucket_size(n_elems * sizeof(T));
+    if (bucket % sizeof(T) != 0) {
+      // Cannot reinterpret a pooled buffer to this type, so do not pool it.
+      return cl::sycl::buffer<T, 1>{cl::sycl::range<1>{n_elems}};
+    }
+    ByteBuffer buffer = get_or_create(bucket);
+    return buffer.template reinterpret<T, 1>(
+        cl::sycl::range<1>{bucket / sizeof(T)});
+  }
+
+  /**
+   * Return a buffer previously allocated from this pool, so that it can be
+   * reused by later allocations.
+   *
+   * \param buffer The buffer to return to the pool.
+   */
+  template <typename T>
+  void deallocate(cl::sycl::buffer<T, 1> const& buffer) {
+    size_t const n_bytes = buffer.get_count() * sizeof(T);
+    if (n_bytes != bucket_size(n_bytes)) {
+      // Not allocated by the pool, so let the buffer be released.
+      return;
+    }
+    ByteBuffer bytes =
+        buffer.template reinterpret<uint8_t, 1>(cl::sycl::range<1>{n_bytes});
+    std::lock_guard<std::mutex> lock{mutex_};
+    free_buffers_[n_bytes].push_back(std::move(bytes));
+    stats_.bytes_in_use -= std::min(stats_.bytes_in_use, n_bytes);
+    stats_.bytes_cached += n_bytes;
+  }
+
+  /**
+   * Release all cached buffers. Buffers which are currently in use are not
+   * affected, and will be cached when they are returned to the pool.
+   */
+  void clear() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    free_buffers_.clear();
+    stats_.bytes_cached = 0;
+  }
+
+  /**
+   * Get the current usage statistics of the pool.
+   * \return A copy of the pool statistics.
+   */
+  BufferPoolStats get_stats() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return stats_;
+  }
+
+  /**
+   * Get the size in bytes of the buffer which will be allocated for a request
+   * of the given size.
+   *
+   * \param n_bytes The number of bytes requested.
+   * \return The number of bytes in the bucket used for the request.
+   */
+  static size_t bucket_size(size_t n_bytes) {
+    size_t bucket = min_bucket_size;
+    while (bucket < n_bytes) {
+      bucket *= 2;
+    }
+    return bucket;
+  }
+
+ private:
+  ByteBuffer get_or_create(size_t bucket) {
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      auto it = free_buffers_.find(bucket);
+      if (it != free_buffers_.end() && !it->second.empty()) {
+        ByteBuffer buffer = std::move(it->second.back());
+        it->second.pop_back();
+        ++stats_.hits;
+        stats_.bytes_cached -= bucket;
+        stats_.bytes_in_use += bucket;
+        return buffer;
+      }
+    }
+    // Create the buffer outside of the lock, as this may be slow.
+    ByteBuffer buffer{cl::sycl::range<1>{bucket}};
+    std::lock_guard<std::mutex> lock{mutex_};
+    ++stats_.misses;
+    stats_.bytes_in_use += bucket;
+    stats_.peak_bytes = std::max(stats_.peak_bytes,
+                                 stats_.bytes_in_use + stats_.bytes_cached);
+    return buffer;
+  }
+
+  mutable std::mutex mutex_;
+  std::map<size_t, std::vector<ByteBuffer>> free_buffers_;
+  BufferPoolStats stats_;
+};
+
+}  // namespace backend
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_BACKEND_BUFFER_POOL_H_
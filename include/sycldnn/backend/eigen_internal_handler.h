@@ -71,6 +71,15 @@ struct EigenInternalHandler
     eigen_device.deallocate(ptr);
   }
 
+  /**
+   * Check whether deallocate() returns without waiting for the kernels using
+   * the allocation to complete. Eigen may destroy the underlying buffer,
+   * which blocks until those kernels have finished.
+   *
+   * eturn Always false.
+   */
+  bool deallocate_is_async() const { return false; }
+
   /**
    * Get a MemObject containing the buffer corresponding to a given pointer.
    * \param ptr     A pointer referring to a SYCL buffer with some offset.
@@ -36,6 +36,10 @@ struct InternalBackend {
   using pointer_type =
       typename BackendTraits<Backend>::template internal_pointer_type<T>;
 
+  /** The internal pointer type is the same as the pointer type. */
+  template <typename T>
+  using internal_pointer_type = pointer_type<T>;
+
   /**
    * Construct a InternalBackend which forwards buffer access calls to the
    * provided backend.
@@ -59,6 +63,44 @@ struct InternalBackend {
     return underlying_backend.get_mem_object(ptr, n_elems);
   }
 
+  /**
+   * Get the buffer corresponding to a temporary allocation. The pointer types
+   * used by this backend are already the internal pointer types, so this is
+   * the same as get_mem_object().
+   *
+   * \param [in] ptr Pointer returned by allocate().
+   * \param [in] n_elems Number of elements expected to be in the buffer.
+   * \return Buffer corresponding to the provided pointer.
+   */
+  template <typename T>
+  auto get_mem_object_internal(pointer_type<T> ptr, size_t n_elems)
+      -> decltype(std::declval<Backend>().get_mem_object_internal(ptr,
+                                                                  n_elems)) {
+    return underlying_backend.get_mem_object_internal(ptr, n_elems);
+  }
+
+  /**
+   * Allocate a temporary buffer using the underlying backend.
+   *
+   * \param [in] n_bytes The size of the allocation, in the units expected by
+   *                     the underlying backend.
+   * \return Pointer to the allocation.
+   */
+  template <typename T>
+  pointer_type<T> allocate(size_t n_bytes) {
+    return underlying_backend.template allocate<T>(n_bytes);
+  }
+
+  /**
+   * Deallocate a temporary buffer using the underlying backend.
+   *
+   * \param [in] ptr Pointer returned by allocate().
+   */
+  template <typename Pointer>
+  void deallocate(Pointer ptr) {
+    underlying_backend.deallocate(ptr);
+  }
+
   /**
    * \brief Get the underlying queue
    *
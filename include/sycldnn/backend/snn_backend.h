@@ -16,12 +16,16 @@
 #ifndef SYCLDNN_INCLUDE_BACKEND_SNN_BACKEND_H_
 #define SYCLDNN_INCLUDE_BACKEND_SNN_BACKEND_H_
 
+#include "sycldnn/backend/buffer_pool.h"
 #include "sycldnn/backend/device_mem_pointer.h"
 #include "sycldnn/backend/snn_matmul_provider.h"
 #include "sycldnn/backend/snn_reduce_provider.h"
 
 #include <SYCL/codeplay.hpp>
+#include <memory>
 #include <numeric>
+#include <utility>
+#include <vector>
 
 namespace sycldnn {
 namespace backend {
@@ -76,28 +80,69 @@ struct SNNBackend final : public SNNMatmulProvider<SNNBackend>,
    */
   SNNBackend(cl::sycl::queue queue) : queue_{std::move(queue)} {}
 
+  /**
+   * Construct an SNNBackend with the given queue, which allocates temporary
+   * buffers from the given buffer pool.
+   *
+   * The pool is shared between copies of the backend, and can be shared
+   * between backends using the same SYCL context.
+   *
+   * \param queue The SYCL queue to use with this backend.
+   * \param pool  The pool to allocate temporary buffers from.
+   */
+  SNNBackend(cl::sycl::queue queue, std::shared_ptr<BufferPool> pool)
+      : queue_{std::move(queue)}, pool_{std::move(pool)} {}
+
   /**
    * Allocate a tensor to be used internally.
+   *
+   * If the backend has a buffer pool then the allocation will reuse a cached
+   * buffer where possible.
+   *
    * \param n_elems The size of the allocation in number of elements.
    * \return Returns a pointer to allocation, using the internal pointer
    *         representation.
    * */
   template <typename T>
   internal_pointer_type<T> allocate(size_t n_elems) {
+    if (pool_) {
+      return internal_pointer_type<T>{pool_->template allocate<T>(n_elems), 0};
+    }
     return internal_pointer_type<T>{n_elems};
   }
 
   /**
    * Deallocate an internal tensor.
+   *
+   * If the backend has a buffer pool then the buffer is returned to the pool
+   * to be reused by later allocations.
+   *
    * \param ptr A pointer to the allocation to deallocate.
    */
   template <typename T>
   void deallocate(internal_pointer_type<T> ptr) {
-    SNN_UNUSED_VAR(ptr)
+    if (pool_) {
+      pool_->deallocate(ptr.get_buffer());
+    }
   }
 
+  /**
+   * Check whether deallocate() returns without waiting for the kernels using
+   * the allocation to complete.
+   *
+   * Without a buffer pool the deallocated buffer is destroyed, which blocks
+   * until all kernels using it have finished.
+   *
+   * eturn Whether the backend has a buffer pool.
+   */
+  bool deallocate_is_async() const { return pool_ != nullptr; }
+
   /**
    * Get a MemObject containing the buffer corresponding to a given pointer.
+   *
+   * Any kernels using the MemObject will also depend on the events set by
+   * set_dependencies().
+   *
    * \param ptr     A pointer referring to a SYCL buffer with some offset.
    * \param n_elems The number of elements required within the MemObject.
    * \return Returns a MemObject corresponding to the pointer.
@@ -106,7 +151,8 @@ struct SNNBackend final : public SNNMatmulProvider<SNNBackend>,
   auto get_mem_object(pointer_type<T> ptr, size_t n_elems)
       -> decltype(make_mem_object(ptr.get_buffer(), n_elems,
                                   ptr.get_offset())) {
-    return make_mem_object(ptr.get_buffer(), n_elems, ptr.get_offset());
+    return make_mem_object(ptr.get_buffer(), n_elems, ptr.get_offset(),
+                           dependencies_);
   }
 
   /** \copydoc get_mem_object */
@@ -114,7 +160,8 @@ struct SNNBackend final : public SNNMatmulProvider<SNNBackend>,
   auto get_mem_object_internal(internal_pointer_type<T> ptr, size_t n_elems)
       -> decltype(make_mem_object(ptr.get_buffer(), n_elems,
                                   ptr.get_offset())) {
-    return make_mem_object(ptr.get_buffer(), n_elems, ptr.get_offset());
+    return make_mem_object(ptr.get_buffer(), n_elems, ptr.get_offset(),
+                           dependencies_);
   }
 
   /**
@@ -143,12 +190,39 @@ struct SNNBackend final : public SNNMatmulProvider<SNNBackend>,
     SNN_UNUSED_VAR(ptr);
   }
 
+  /**
+   * Set the events which any subsequently launched operations must wait for,
+   * in addition to the buffer dependencies tracked by the SYCL runtime.
+   *
+   * This requires support for handler::depends_on, see SNN_HAS_DEPENDS_ON.
+   *
+   * \param dependencies The events to depend on.
+   */
+  void set_dependencies(std::vector<cl::sycl::event> dependencies) {
+    dependencies_ = std::move(dependencies);
+  }
+
+  /**
+   * Get the events which launched operations must wait for.
+   * \return The list of dependencies.
+   */
+  std::vector<cl::sycl::event> const& get_dependencies() const {
+    return dependencies_;
+  }
+
   /**
    * Gets the SYCL queue that the backend is bound to.
    * \return Returns the SYCL queue that the backend is bound to.
    */
   cl::sycl::queue& get_queue() { return queue_; }
 
+  /**
+   * Gets the buffer pool used for temporary allocations.
+   * \return Returns a pointer to the buffer pool, or nullptr if the backend
+   *         does not use a pool.
+   */
+  BufferPool* get_buffer_pool() { return pool_.get(); }
+
   /**
    * Gets a descriptive name for this backend.
    * \return a descriptive name for this backend.
@@ -157,6 +231,8 @@ struct SNNBackend final : public SNNMatmulProvider<SNNBackend>,
 
  private:
   cl::sycl::queue queue_;
+  std::shared_ptr<BufferPool> pool_;
+  std::vector<cl::sycl::event> dependencies_;
 };
 
 }  // namespace backend
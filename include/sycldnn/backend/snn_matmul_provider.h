@@ -25,6 +25,7 @@
 
 #include "sycldnn/backend/backend_traits.h"
 #include "sycldnn/backend/internal_backend.h"
+#include "sycldnn/internal/helpers/allocated_pointer.h"
 #include "sycldnn/matmul/launch.h"
 
 namespace sycldnn {
@@ -42,6 +43,47 @@ struct SNNMatmulProvider {
   using internal_pointer_type =
       typename BackendTraits<Backend>::template internal_pointer_type<T>;
 
+  /**
+   * Launch a matrix multiply, splitting the accumulation dimension if the
+   * output is too small to occupy the device, otherwise using the local memory
+   * kernel if the device has dedicated local memory and the matrices are large
+   * enough to benefit.
+   *
+   * The split-K workspace is a temporary allocation, so split-K is only used
+   * if the backend can release it without blocking until the kernels finish,
+   * such as an SNNBackend with a buffer pool.
+   */
+  template <typename T, bool TransposeLHS, bool TransposeRHS>
+  SNNStatus launch(internal_pointer_type<const T> const lhs,
+                   internal_pointer_type<const T> const rhs,
+                   internal_pointer_type<T> const output, int batches, int m,
+                   int k, int n, T beta) {
+    auto& underlying_backend = static_cast<Backend&>(*this);
+    internal::InternalBackend<Backend> internal_backend{underlying_backend};
+    int const n_splits = underlying_backend.deallocate_is_async()
+                             ? matmul::get_split_k_count(batches, m, k, n)
+                             : 1;
+    if (n_splits > 1) {
+      using Partial = typename matmul::internal::PartialType<T>::type;
+      using AllocatedPointer =
+          sycldnn::internal::helpers::AllocatedPointer<Partial, Backend>;
+      size_t const workspace_size =
+          matmul::get_split_k_workspace_size(batches, m, n, n_splits);
+      AllocatedPointer workspace{workspace_size * sizeof(Partial),
+                                 underlying_backend};
+      return matmul::launch_split_k<T, TransposeLHS, TransposeRHS>(
+          lhs, rhs, output, workspace.get(), batches, m, k, n, beta, n_splits,
+          internal_backend);
+    }
+    auto device = internal_backend.get_queue().get_device();
+    if (matmul::use_local_mem_kernel<T>(device, batches, m, k, n)) {
+      return matmul::launch_local_mem<T, TransposeLHS, TransposeRHS>(
+          lhs, rhs, output, batches, m, k, n, beta, internal_backend);
+    }
+    return matmul::launch<T, TransposeLHS, TransposeRHS>(
+        lhs, rhs, output, batches, m, k, n, beta, internal_backend);
+  }
+
  public:
   /**
    * A wrapper around a call to GEMM.
@@ -70,10 +112,8 @@ struct SNNMatmulProvider {
                          internal_pointer_type<const T> const rhs,
                          internal_pointer_type<T> const output, T const beta,
                          Index const m, Index const k, Index const n) {
-    auto& underlying_backend = static_cast<Backend&>(*this);
-    internal::InternalBackend<Backend> internal_backend{underlying_backend};
-    auto status = matmul::launch<T, TransposeLHS, TransposeRHS>(
-        lhs, rhs, output, 1, m, k, n, beta, internal_backend);
+    auto status = launch<T, TransposeLHS, TransposeRHS>(lhs, rhs, output, 1, m,
+                                                        k, n, beta);
     SNN_ASSERT(status.status == StatusCode::OK,
                "Error launching matmul kernel.");
     return status.event;
@@ -108,10 +148,8 @@ struct SNNMatmulProvider {
                                internal_pointer_type<T> const output,
                                Index const n_batches, Index const m,
                                Index const k, Index const n) {
-    auto& underlying_backend = static_cast<Backend&>(*this);
-    internal::InternalBackend<Backend> internal_backend{underlying_backend};
-    auto status = matmul::launch<T, TransposeLHS, TransposeRHS>(
-        lhs, rhs, output, n_batches, m, k, n, T{0}, internal_backend);
+    auto status = launch<T, TransposeLHS, TransposeRHS>(
+        lhs, rhs, output, n_batches, m, k, n, T{0});
     SNN_ASSERT(status.status == StatusCode::OK,
                "Error launching matmul kernel.");
     return status.event;
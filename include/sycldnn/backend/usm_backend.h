@@ -0,0 +1,227 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_BACKEND_USM_BACKEND_H_
+#define SYCLDNN_INCLUDE_BACKEND_USM_BACKEND_H_
+
+/**
+ * \file
+ * Contains the implementation of \ref sycldnn::backend::USMBackend, which
+ * provides SYCL-DNN with raw USM device pointers rather than SYCL buffers.
+ *
+ * This backend is only available when SYCL-DNN is built with USM support, as
+ * it requires a SYCL 2020 implementation.
+ */
+#ifndef SNN_USE_USM
+#error "The USMBackend requires SYCL-DNN to be built with SNN_ENABLE_USM=ON."
+#endif
+
+#include "sycldnn/mem_object.h"
+
+#include "sycldnn/backend/backend_traits.h"
+#include "sycldnn/backend/snn_matmul_provider.h"
+#include "sycldnn/backend/snn_reduce_provider.h"
+
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace backend {
+
+// Forward declaration to allow the BackendTraits specialisation.
+struct USMBackend;
+
+/**
+ * The template specialisation of \ref
+ * sycldnn::backend::BackendTraits<USMBackend>.
+ *
+ * Provides the pointer types for the USMBackend.
+ */
+template <>
+struct BackendTraits<USMBackend> {
+  /**
+   * The external pointer type for USMBackend.
+   */
+  template <typename T>
+  using pointer_type = T*;
+
+  /**
+   * The internal pointer type for USMBackend.
+   */
+  template <typename T>
+  using internal_pointer_type = T*;
+};
+
+/**
+ * Backend using USM device allocations.
+ *
+ * The kernels access the memory through raw pointers, so no SYCL accessors
+ * are created and the SYCL runtime does not need to track any dependencies
+ * between kernels. This reduces the host overhead of each kernel submission.
+ *
+ * As no dependencies are tracked, the backend requires an in-order queue so
+ * that the kernels submitted by an operation, and by consecutive operations,
+ * execute in order. Any other dependencies, such as work submitted to a
+ * different queue, must be provided explicitly with set_dependencies() before
+ * launching an operation.
+ *
+ * Provides matrix multiplies and reduce using our internal kernels.
+ */
+struct USMBackend final : public SNNMatmulProvider<USMBackend>,
+                          public SNNReduceProvider<USMBackend> {
+  /** The pointer type used in interface of the USMBackend. */
+  template <typename T>
+  using pointer_type =
+      typename BackendTraits<USMBackend>::template pointer_type<T>;
+
+  /** The internal pointer type used internally by the USMBackend. */
+  template <typename T>
+  using internal_pointer_type =
+      typename BackendTraits<USMBackend>::template internal_pointer_type<T>;
+
+  /**
+   * Construct a USMBackend with the given queue. All SYCL-DNN operations
+   * launched with this backend will be submitted to this queue.
+   *
+   * \param queue The in-order SYCL queue to use with this backend.
+   */
+  USMBackend(cl::sycl::queue queue) : queue_{std::move(queue)} {
+    SNN_ASSERT(queue_.is_in_order(), "The USMBackend needs an in-order queue");
+  }
+
+  /**
+   * Allocate a tensor to be used internally.
+   * \param n_elems The size of the allocation in number of elements.
+   * \return Returns a USM device pointer to the allocation.
+   */
+  template <typename T>
+  internal_pointer_type<T> allocate(size_t n_elems) {
+    return cl::sycl::malloc_device<T>(n_elems, queue_);
+  }
+
+  /**
+   * Deallocate an internal tensor.
+   *
+   * Kernels using the allocation may not have completed yet, so the memory is
+   * freed by a host task which runs once all work previously submitted to the
+   * queue has finished.
+   *
+   * \param ptr A pointer to the allocation to deallocate.
+   */
+  template <typename T>
+  void deallocate(internal_pointer_type<T> ptr) {
+    auto context = queue_.get_context();
+    queue_.submit([&](cl::sycl::handler& cgh) {
+      cgh.host_task([=]() { cl::sycl::free(ptr, context); });
+    });
+  }
+
+  /**
+   * Check whether deallocate() returns without waiting for the kernels using
+   * the allocation to complete. This is always the case, as the memory is
+   * freed by a host task.
+   *
+   * eturn Always true.
+   */
+  bool deallocate_is_async() const { return true; }
+
+  /**
+   * Get a USMMemObject corresponding to a given pointer. Any kernel using the
+   * memory object will depend on the events set by set_dependencies().
+   *
+   * \param ptr     A USM device pointer.
+   * \param n_elems The number of elements required within the MemObject.
+   * \return Returns a USMMemObject corresponding to the pointer.
+   */
+  template <typename T>
+  USMMemObject<T> get_mem_object(pointer_type<T> ptr, size_t n_elems) {
+    return make_usm_mem_object(ptr, n_elems, dependencies_);
+  }
+
+  /** \copydoc get_mem_object */
+  template <typename T>
+  USMMemObject<T> get_mem_object_internal(internal_pointer_type<T> ptr,
+                                          size_t n_elems) {
+    return make_usm_mem_object(ptr, n_elems, dependencies_);
+  }
+
+  /**
+   * Maps from external to internal pointer representations. This is a no-op for
+   * the USM backend.
+   * \param ptr The external pointer to transform to the corresponding internal
+   *            pointer representation.
+   * \return Returns an internal pointer representation compatible with \ref
+   *         sycldnn::backend::USMBackend.
+   */
+  template <typename T>
+  internal_pointer_type<T> to_internal_pointer(pointer_type<T> ptr) {
+    return ptr;
+  }
+
+  /**
+   * Release the internal pointer, which has previously been returned from \ref
+   * sycldnn::backend::USMBackend::to_internal_pointer.
+   *
+   * In this case it is a no-op.
+   *
+   * \param ptr The internal pointer to release.
+   */
+  template <typename T>
+  void release_internal_pointer(internal_pointer_type<T> ptr) {
+    SNN_UNUSED_VAR(ptr);
+  }
+
+  /**
+   * Set the events which any subsequently launched operations must wait for.
+   *
+   * Work submitted to this backend's queue is already ordered, so this is
+   * only needed for dependencies on other queues or on host operations.
+   *
+   * \param dependencies The events to depend on.
+   */
+  void set_dependencies(std::vector<cl::sycl::event> dependencies) {
+    dependencies_ = std::move(dependencies);
+  }
+
+  /**
+   * Get the events which launched operations must wait for.
+   * \return The list of dependencies.
+   */
+  std::vector<cl::sycl::event> const& get_dependencies() const {
+    return dependencies_;
+  }
+
+  /**
+   * Gets the SYCL queue that the backend is bound to.
+   * \return Returns the SYCL queue that the backend is bound to.
+   */
+  cl::sycl::queue& get_queue() { return queue_; }
+
+  /**
+   * Gets a descriptive name for this backend.
+   * \return a descriptive name for this backend.
+   */
+  static char const* name() { return "USMBackend"; }
+
+ private:
+  cl::sycl::queue queue_;
+  std::vector<cl::sycl::event> dependencies_;
+};
+
+}  // namespace backend
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_BACKEND_USM_BACKEND_H_
@@ -0,0 +1,235 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_BATCHNORM_FOLD_H_
+#define SYCLDNN_INCLUDE_BATCHNORM_FOLD_H_
+
+/**
+ * \file
+ * Implements the \ref sycldnn::batchnorm::fold_into_conv2d() function, which
+ * folds the parameters of a frozen batchnorm into the filter and bias of the
+ * convolution that precedes it.
+ */
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "sycldnn/internal/batchnorm/launch_batchnorm.h"
+#include "sycldnn/internal/helpers/scoped_dependencies.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace sycldnn {
+namespace batchnorm {
+namespace internal {
+
+/**
+ * Validate that the convolution parameters can be folded with a frozen
+ * batchnorm.
+ *
+ * \param params  Convolution parameters to validate.
+ * \param epsilon The batchnorm epsilon.
+ * \return        A SNNStatus object containing either \ref StatusCode::OK if
+ * all parameters are valid, or \ref StatusCode::InvalidParameter otherwise.
+ */
+SNNStatus inline validate_fold_params(conv2d::Conv2DParams const& params,
+                                      float epsilon) {
+  SNN_VALIDATE_PARAM(params.features > 0,
+                     "The number of features must be positive.");
+  SNN_VALIDATE_PARAM(params.channels > 0,
+                     "The number of channels must be positive.");
+  SNN_VALIDATE_PARAM(params.window_rows > 0,
+                     "The number of window rows must be positive.");
+  SNN_VALIDATE_PARAM(params.window_cols > 0,
+                     "The number of window columns must be positive.");
+  SNN_VALIDATE_PARAM(params.groups > 0,
+                     "The number of groups must be positive.");
+  SNN_VALIDATE_PARAM(params.features % params.groups == 0,
+                     "The number of features must be divisible by the number "
+                     "of groups.");
+  SNN_VALIDATE_PARAM(params.channels % params.groups == 0,
+                     "The number of channels must be divisible by the number "
+                     "of groups.");
+  SNN_VALIDATE_PARAM(epsilon > 0.f,
+                     "The epsilon parameter must be greater than 0.");
+  return StatusCode::OK;
+}
+
+/**
+ * Fold a frozen batchnorm into a convolution filter and optional bias. If
+ * use_bias is false then the convolution bias is treated as zero and the bias
+ * pointer is not read. The kernels wait for the given dependencies.
+ */
+template <typename T, typename Backend>
+SNNStatus fold_into_conv2d(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T const> bias,
+    typename Backend::template pointer_type<T const> beta,
+    typename Backend::template pointer_type<T const> gamma,
+    typename Backend::template pointer_type<T const> mean,
+    typename Backend::template pointer_type<T const> variance,
+    typename Backend::template pointer_type<T> folded_filter,
+    typename Backend::template pointer_type<T> folded_bias,
+    conv2d::Conv2DParams const& params, float epsilon, bool use_bias,
+    Backend& backend, std::vector<cl::sycl::event> const& dependencies) {
+  auto validation_status = validate_fold_params(params, epsilon);
+  if (validation_status.status != StatusCode::OK) {
+    return validation_status;
+  }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
+
+  auto const filter_size =
+      conv2d::get_sizes<conv2d::conv_type::Forward>(params).filter_size;
+  if (filter_size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+    return StatusCode::IndexExceeded;
+  }
+  auto const n_filter_items = static_cast<int32_t>(filter_size);
+  auto const n_features = static_cast<int32_t>(params.features);
+  // The features are the innermost dimension of HWCF filters and the
+  // outermost dimension of FCHW filters.
+  int32_t const feature_stride =
+      params.filter_format == sycldnn::FilterFormat::FCHW
+          ? n_filter_items / n_features
+          : 1;
+
+  auto queue = backend.get_queue();
+
+  auto filter_mem = backend.get_mem_object(filter, filter_size);
+  auto bias_mem = backend.get_mem_object(bias, params.features);
+  auto beta_mem = backend.get_mem_object(beta, params.features);
+  auto gamma_mem = backend.get_mem_object(gamma, params.features);
+  auto mean_mem = backend.get_mem_object(mean, params.features);
+  auto variance_mem = backend.get_mem_object(variance, params.features);
+  auto folded_filter_mem = backend.get_mem_object(folded_filter, filter_size);
+  auto folded_bias_mem = backend.get_mem_object(folded_bias, params.features);
+
+  return launch_fold_into_conv2d<T>(
+      filter_mem, bias_mem, beta_mem, gamma_mem, mean_mem, variance_mem,
+      folded_filter_mem, folded_bias_mem, n_filter_items, n_features,
+      feature_stride, use_bias, epsilon, queue);
+}
+
+}  // namespace internal
+
+/**
+ * Fold a frozen batchnorm into the filter and bias of the convolution that
+ * produces its input, so that the convolution computes the batchnorm output
+ * directly:
+ *
+ *   scale = gamma / sqrt(variance + epsilon)
+ *   folded_filter = filter * scale
+ *   folded_bias = (bias - mean) * scale + beta
+ *
+ * where the scale is broadcast along the feature dimension of the filter. The
+ * folded bias must then be added to the convolution output, for example as
+ * the bias term of a fused convolution epilogue.
+ *
+ * This is only valid for inference, when the batchnorm mean and variance are
+ * fixed. The folded tensors must not alias the original tensors.
+ *
+ * \tparam T             The data type of the tensors.
+ * \tparam Backend       The type of backend.
+ * \param filter         A pointer to the convolution filter.
+ * \param bias           A pointer to the convolution bias.
+ * \param beta           A pointer to the batchnorm beta tensor.
+ * \param gamma          A pointer to the batchnorm gamma tensor.
+ * \param mean           A pointer to the batchnorm mean tensor.
+ * \param variance       A pointer to the batchnorm variance tensor.
+ * \param folded_filter  A pointer to memory for the folded filter, with the
+ *                       same size and layout as the filter.
+ * \param folded_bias    A pointer to memory for the folded bias.
+ * \param params         The convolution parameters.
+ * \param epsilon        The batchnorm epsilon.
+ * \param backend        The backend for mapping between pointer
+ *                       representations.
+ * \param dependencies   Optional list of events which must complete before the
+ *                       operation's kernels can start.
+ * \return               Returns a SNNStatus containing the SYCL event tied to
+ *                       the kernel launches and a StatusCode enum showing if
+ *                       the launch was OK or whether it encountered some
+ *                       problem.
+ */
+template <typename T, typename Backend>
+SNNStatus fold_into_conv2d(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T const> bias,
+    typename Backend::template pointer_type<T const> beta,
+    typename Backend::template pointer_type<T const> gamma,
+    typename Backend::template pointer_type<T const> mean,
+    typename Backend::template pointer_type<T const> variance,
+    typename Backend::template pointer_type<T> folded_filter,
+    typename Backend::template pointer_type<T> folded_bias,
+    conv2d::Conv2DParams const& params, float epsilon, Backend& backend,
+    std::vector<cl::sycl::event> const& dependencies = {}) {
+  return internal::fold_into_conv2d<T>(filter, bias, beta, gamma, mean,
+                                       variance, folded_filter, folded_bias,
+                                       params, epsilon, true, backend,
+                                       dependencies);
+}
+
+/**
+ * Fold a frozen batchnorm into the filter of a convolution without a bias,
+ * producing a folded filter and bias. The convolution bias is treated as zero,
+ * so folded_bias = beta - mean * scale.
+ *
+ * \tparam T             The data type of the tensors.
+ * \tparam Backend       The type of backend.
+ * \param filter         A pointer to the convolution filter.
+ * \param beta           A pointer to the batchnorm beta tensor.
+ * \param gamma          A pointer to the batchnorm gamma tensor.
+ * \param mean           A pointer to the batchnorm mean tensor.
+ * \param variance       A pointer to the batchnorm variance tensor.
+ * \param folded_filter  A pointer to memory for the folded filter.
+ * \param folded_bias    A pointer to memory for the folded bias.
+ * \param params         The convolution parameters.
+ * \param epsilon        The batchnorm epsilon.
+ * \param backend        The backend for mapping between pointer
+ *                       representations.
+ * \param dependencies   Optional list of events which must complete before the
+ *                       operation's kernels can start.
+ * \return               Returns a SNNStatus containing the SYCL event tied to
+ *                       the kernel launches and a StatusCode enum showing if
+ *                       the launch was OK or whether it encountered some
+ *                       problem.
+ */
+template <typename T, typename Backend>
+SNNStatus fold_into_conv2d(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T const> beta,
+    typename Backend::template pointer_type<T const> gamma,
+    typename Backend::template pointer_type<T const> mean,
+    typename Backend::template pointer_type<T const> variance,
+    typename Backend::template pointer_type<T> folded_filter,
+    typename Backend::template pointer_type<T> folded_bias,
+    conv2d::Conv2DParams const& params, float epsilon, Backend& backend,
+    std::vector<cl::sycl::event> const& dependencies = {}) {
+  // The mean is passed in place of the bias, but is never read as the bias.
+  return internal::fold_into_conv2d<T>(filter, mean, beta, gamma, mean,
+                                       variance, folded_filter, folded_bias,
+                                       params, epsilon, false, backend,
+                                       dependencies);
+}
+
+}  // namespace batchnorm
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_BATCHNORM_FOLD_H_
@@ -26,11 +26,16 @@
 
 #include "sycldnn/batchnorm/operation.h"
 #include "sycldnn/batchnorm/params.h"
+#include "sycldnn/batchnorm/workspace_size.h"
 
 #include "sycldnn/internal/batchnorm/launch_internal.h"
+#include "sycldnn/internal/helpers/scoped_dependencies.h"
 
 #include "sycldnn/helpers/macros.h"
 
+#include <cstddef>
+#include <vector>
+
 namespace sycldnn {
 /** Namespace containing the batchnorm operator. */
 namespace batchnorm {
@@ -95,6 +100,65 @@ SNNStatus inline validate_params(BatchNormParams const& params) {
  * \param output       A pointer to memory representing the output tensor.
  * \param params       The batchnorm parameters.
  * \param backend      The backend for mapping between pointer representations.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
+ * \return             Returns a SNNStatus containing the SYCL event tied to
+ *                     the kernel launches and a StatusCode enum showing if the
+ *                     launch was OK or whether it encountered some problem.
+ */
+template <typename T, typename Backend, typename Direction, typename Operation,
+          typename = internal::EnableIf_Forward_Training<Direction, Operation>>
+SNNStatus launch_forward(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> beta,
+    typename Backend::template pointer_type<T const> gamma,
+    typename Backend::template pointer_type<T const> input_mean,
+    typename Backend::template pointer_type<T const> input_variance,
+    typename Backend::template pointer_type<T> running_mean,
+    typename Backend::template pointer_type<T> running_variance,
+    typename Backend::template pointer_type<T> output,
+    BatchNormParams const& params, Backend& backend,
+    std::vector<cl::sycl::event> const& dependencies = {}) {
+  auto validation_status = internal::validate_params(params);
+  if (validation_status.status != StatusCode::OK) {
+    return validation_status;
+  }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
+
+  return internal::launch_forward<T, Backend, Direction, Operation>(
+      input, beta, gamma, input_mean, input_variance, running_mean,
+      running_variance, output, {}, 0, params, backend);
+}
+
+/**
+ * Launch the batchnorm operation kernel in the forward direction when computing
+ * the Mean and Variance for Batchnorm Computation, using a user provided
+ * workspace to hold the intermediate statistics.
+ *
+ * The workspace must hold at least the number of elements given by
+ * \ref sycldnn::batchnorm::query_training_workspace_size(). Its elements are
+ * of type internal::StatisticType<T>::type, which is single precision when T
+ * is half precision.
+ *
+ * \tparam T           The data type of the input tensor.
+ * \tparam Backend     The type of backend.
+ * \tparam Direction   Either Forward or Gradient.
+ * \tparam Operation   Either Training or Frozen.
+ * \param input        A pointer to memory representing the input tensor.
+ * \param beta         A pointer to memory representing the beta tensor.
+ * \param gamma        A pointer to memory representing the gamma tensor.
+ * \param input_mean   A pointer to memory for input mean tensor.
+ * \param input_variance A pointer to memory for input variance tensor.
+ * \param running_mean  A pointer to memory for output mean tensor.
+ * \param running_variance A pointer to memory for output variance tensor.
+ * \param output       A pointer to memory representing the output tensor.
+ * \param workspace    A pointer to a workspace buffer for the statistics.
+ * \param workspace_size The number of elements available in the workspace.
+ * \param params       The batchnorm parameters.
+ * \param backend      The backend for mapping between pointer representations.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
  * \return             Returns a SNNStatus containing the SYCL event tied to
  *                     the kernel launches and a StatusCode enum showing if the
  *                     launch was OK or whether it encountered some problem.
@@ -110,15 +174,21 @@ SNNStatus launch_forward(
     typename Backend::template pointer_type<T> running_mean,
     typename Backend::template pointer_type<T> running_variance,
     typename Backend::template pointer_type<T> output,
-    BatchNormParams const& params, Backend& backend) {
+    typename Backend::template pointer_type<
+        typename internal::StatisticType<T>::type>
+        workspace,
+    size_t workspace_size, BatchNormParams const& params, Backend& backend,
+    std::vector<cl::sycl::event> const& dependencies = {}) {
   auto validation_status = internal::validate_params(params);
   if (validation_status.status != StatusCode::OK) {
     return validation_status;
   }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
 
   return internal::launch_forward<T, Backend, Direction, Operation>(
       input, beta, gamma, input_mean, input_variance, running_mean,
-      running_variance, output, params, backend);
+      running_variance, output, workspace, workspace_size, params, backend);
 }
 
 /**
@@ -137,6 +207,8 @@ SNNStatus launch_forward(
  * \param output       A pointer to memory representing the output tensor.
  * \param params       The batchnorm parameters.
  * \param backend      The backend for mapping between pointer representations.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
  * \return             Returns a SNNStatus containing the SYCL event tied to
  *                     the kernel launches and a StatusCode enum showing if the
  *                     launch was OK or whether it encountered some problem.
@@ -151,11 +223,14 @@ SNNStatus launch_forward(
     typename Backend::template pointer_type<T const> input_mean,
     typename Backend::template pointer_type<T const> input_variance,
     typename Backend::template pointer_type<T> output,
-    BatchNormParams const& params, Backend& backend) {
+    BatchNormParams const& params, Backend& backend,
+    std::vector<cl::sycl::event> const& dependencies = {}) {
   auto validation_status = internal::validate_params(params);
   if (validation_status.status != StatusCode::OK) {
     return validation_status;
   }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
 
   auto n_items = params.batch * params.channels * params.rows * params.cols;
 
@@ -191,6 +266,8 @@ SNNStatus launch_forward(
  * \param output       A pointer to memory representing the output tensor.
  * \param params       The batchnorm parameters.
  * \param backend      The backend for mapping between pointer representations.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
  * \return             Returns a SNNStatus containing the SYCL event tied to
  *                     the kernel launches and a StatusCode enum showing if the
  *                     launch was OK or whether it encountered some problem.
@@ -204,11 +281,14 @@ SNNStatus launch_grad(typename Backend::template pointer_type<T const> input,
                       typename Backend::template pointer_type<T> beta_grad,
                       typename Backend::template pointer_type<T> gamma_grad,
                       typename Backend::template pointer_type<T> output,
-                      BatchNormParams const& params, Backend& backend) {
+                      BatchNormParams const& params, Backend& backend,
+                      std::vector<cl::sycl::event> const& dependencies = {}) {
   auto validation_status = internal::validate_params(params);
   if (validation_status.status != StatusCode::OK) {
     return validation_status;
   }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
 
   return internal::launch_grad<T, Backend, Direction, Operation>(
       input, gradient, gamma, workspace, beta_grad, gamma_grad, output, params,
@@ -233,6 +313,8 @@ SNNStatus launch_grad(typename Backend::template pointer_type<T const> input,
  * \param output       A pointer to memory representing the output tensor.
  * \param params       The batchnorm parameters.
  * \param backend      The backend for mapping between pointer representations.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
  * \return             Returns a SNNStatus containing the SYCL event tied to
  *                     the kernel launches and a StatusCode enum showing if the
  *                     launch was OK or whether it encountered some problem.
@@ -249,11 +331,14 @@ SNNStatus launch_grad(
     typename Backend::template pointer_type<T> beta_grad,
     typename Backend::template pointer_type<T> gamma_grad,
     typename Backend::template pointer_type<T> output,
-    BatchNormParams const& params, Backend& backend) {
+    BatchNormParams const& params, Backend& backend,
+    std::vector<cl::sycl::event> const& dependencies = {}) {
   auto validation_status = internal::validate_params(params);
   if (validation_status.status != StatusCode::OK) {
     return validation_status;
   }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
 
   return internal::launch_grad<T, Backend, Direction, Operation>(
       input, gradient, gamma, pop_mean, pop_variance, beta_grad, gamma_grad,
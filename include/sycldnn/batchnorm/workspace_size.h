@@ -0,0 +1,53 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_BATCHNORM_WORKSPACE_SIZE_H_
+#define SYCLDNN_INCLUDE_BATCHNORM_WORKSPACE_SIZE_H_
+
+/**
+ * \file
+ * Contains the \ref sycldnn::batchnorm::query_training_workspace_size()
+ * function, giving the size of the workspace used by a forward training
+ * batchnorm.
+ */
+#include "sycldnn/batchnorm/params.h"
+
+#include "sycldnn/internal/batchnorm/launch_batchnorm.h"
+
+#include <cstddef>
+
+namespace sycldnn {
+namespace batchnorm {
+
+/**
+ * Query the number of elements that a workspace buffer must hold in order to be
+ * used in a forward training batchnorm.
+ *
+ * The workspace holds the mean and variance of each slice of the positions of
+ * each channel, so is much smaller than the input. Providing a workspace
+ * avoids allocating a temporary buffer on every launch.
+ *
+ * \param params The batchnorm parameters describing the computation.
+ * \return The number of elements the workspace must hold.
+ */
+inline size_t query_training_workspace_size(BatchNormParams const& params) {
+  int const n_slices = internal::get_mean_variance_split_count(params);
+  return internal::get_mean_variance_workspace_size(params, n_slices);
+}
+
+}  // namespace batchnorm
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_BATCHNORM_WORKSPACE_SIZE_H_
@@ -32,6 +32,9 @@
 #include "sycldnn/binaryop/params.h"
 
 #include "sycldnn/internal/binaryop/launch.h"
+#include "sycldnn/internal/helpers/scoped_dependencies.h"
+
+#include <vector>
 
 namespace sycldnn {
 /** Namespace containing all binary elementwise operations. */
@@ -73,6 +76,8 @@ SNNStatus inline validate_params(BinaryParams const& params) {
  * \param [in]  params       The parameters of the binary operation.
  * \param [in]  backend  The backend that provides access to the SYCL buffers
  *                       corresponding to the input and output pointers.
+ * \param [in]  dependencies Optional list of events which must complete before
+ *                           the operation's kernels can start.
  * \return An \ref SNNStatus containing the SYCL event tied to the kernel
  *         launches and a \ref StatusCode enum showing if the launch was OK or
  *         whether it encountered some problem.
@@ -81,11 +86,14 @@ template <typename T, typename Op, typename Backend>
 SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
                  typename Backend::template pointer_type<T const> rhs,
                  typename Backend::template pointer_type<T> output,
-                 const BinaryParams& params, Backend& backend) {
+                 const BinaryParams& params, Backend& backend,
+                 std::vector<cl::sycl::event> const& dependencies = {}) {
   auto validation_status = internal::validate_params(params);
   if (validation_status.status != StatusCode::OK) {
     return validation_status;
   }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
 
   auto inp1_mem =
       backend.get_mem_object(lhs, static_cast<size_t>(params.lhs_items));
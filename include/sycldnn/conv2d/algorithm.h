@@ -42,6 +42,8 @@ enum class Algorithm {
   WinogradLarge,
   /** Use a matmul for 1x1 NHWC convolutions. */
   Matmul,
+  /** Im2col style matrix multiply without a temporary buffer. */
+  ImplicitGemm,
 };
 }  // namespace conv2d
 }  // namespace sycldnn
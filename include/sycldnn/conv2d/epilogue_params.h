@@ -0,0 +1,76 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_EPILOGUE_PARAMS_H_
+#define SYCLDNN_INCLUDE_CONV2D_EPILOGUE_PARAMS_H_
+
+/**
+ * \file
+ * Contains the declaration of the \ref sycldnn::conv2d::EpilogueParams
+ * structure, which describes the operations fused onto the end of a forward
+ * convolution, along with the \ref sycldnn::conv2d::Activation enum.
+ */
+namespace sycldnn {
+namespace conv2d {
+
+/** The activation functions which can be fused into a convolution. */
+enum class Activation {
+  /** No activation, the convolution output is stored unchanged. */
+  None,
+  /** Rectified linear unit, max(x, 0). */
+  Relu,
+  /** Rectified linear unit clamped to 6, min(max(x, 0), 6). */
+  Relu6,
+  /** Hyperbolic tangent. */
+  Tanh
+};
+
+/**
+ * Parameter struct describing the epilogue of a fused forward convolution.
+ *
+ * The epilogue is applied to each output value just before it is stored, so
+ * that for output feature f the stored value is:
+ *
+ *   activation(conv(input, filter) + bias[f] + residual)
+ *
+ * where the bias and residual terms are only added when enabled. The bias
+ * tensor holds one value per feature, and the residual tensor has the same
+ * shape and layout as the output.
+ */
+struct EpilogueParams {
+  /** Whether to add a per-feature bias. */
+  bool bias = false;
+
+  /** Whether to add a residual tensor of the same shape as the output. */
+  bool residual = false;
+
+  /** The activation function to apply after the bias and residual. */
+  Activation activation = Activation::None;
+};
+
+/**
+ * Check whether an epilogue leaves the convolution output unchanged.
+ *
+ * \param epilogue The epilogue parameters to check.
+ * \return Whether the epilogue does not need to be applied.
+ */
+inline bool is_identity(EpilogueParams const& epilogue) {
+  return !epilogue.bias && !epilogue.residual &&
+         epilogue.activation == Activation::None;
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_CONV2D_EPILOGUE_PARAMS_H_
@@ -21,6 +21,7 @@
 #include "sycldnn/conv2d/sizes.h"
 
 #include "sycldnn/internal/conv2d/direct.h"
+#include "sycldnn/internal/conv2d/epilogue.h"
 
 namespace sycldnn {
 namespace conv2d {
@@ -28,7 +29,8 @@ namespace conv2d {
  * Launch the direct implementation of a 2D convolution.
  *
  * Will extract the SYCL buffers and SYCL queue from the backend and forward
- * these on to the precompiled kernels.
+ * these on to the precompiled kernels. The epilogue is applied by the
+ * forward kernels before storing each output value.
  *
  * Returns an SNNStatus containing the SYCL event tied to the kernel launch.
  */
@@ -37,16 +39,24 @@ inline SNNStatus launch_direct(
     typename Backend::template pointer_type<T const> input,
     typename Backend::template pointer_type<T const> filter,
     typename Backend::template pointer_type<T> output,
-    Conv2DParams const& params, Backend& backend) {
+    Conv2DParams const& params,
+    internal::EpiloguePointers<T, Backend> const& epilogue, Backend& backend) {
   auto conv_sizes = get_sizes<ConvType>(params);
 
   auto inp_access = backend.get_mem_object(input, conv_sizes.input_size);
   auto fil_access = backend.get_mem_object(filter, conv_sizes.filter_size);
   auto out_access = backend.get_mem_object(output, conv_sizes.output_size);
+  auto bias_access = backend.get_mem_object(
+      epilogue.bias, internal::epilogue_bias_size(epilogue.params, params));
+  auto res_access = backend.get_mem_object(
+      epilogue.residual,
+      internal::epilogue_residual_size(epilogue.params, params));
 
+  internal::EpilogueMem<T> epilogue_mem{epilogue.params, &bias_access,
+                                        &res_access};
   cl::sycl::queue queue = backend.get_queue();
-  return internal::launch_direct<T, ConvType>(inp_access, fil_access,
-                                              out_access, params, queue);
+  return internal::launch_direct<T, ConvType>(
+      inp_access, fil_access, out_access, params, epilogue_mem, queue);
 }
 }  // namespace conv2d
 }  // namespace sycldnn
@@ -16,9 +16,14 @@
 #ifndef SYCLDNN_INCLUDE_CONV2D_IMPLEMENTATION_MATMUL_H_
 #define SYCLDNN_INCLUDE_CONV2D_IMPLEMENTATION_MATMUL_H_
 
+#include "sycldnn/data_format.h"
+#include "sycldnn/status.h"
+
 #include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
 
+#include <CL/sycl.hpp>
+
 namespace sycldnn {
 namespace conv2d {
 
@@ -35,6 +40,19 @@ struct MatmulLauncher<conv_type::Forward> {
       typename Backend::template pointer_type<T const> filter,
       typename Backend::template pointer_type<T> output,
       Conv2DParams const& params, Backend& backend) {
+    if (params.input_format == DataFormat::NCHW) {
+      // Each NCHW image is a [channels x pixels] matrix, so multiply each
+      // image by the [features x channels] FCHW filter.
+      auto image_size = params.in_rows * params.in_cols;
+      cl::sycl::event event;
+      for (int i = 0; i < params.batch; ++i) {
+        event = backend.template matmul<false, false>(
+            filter, input + i * params.channels * image_size,
+            output + i * params.features * image_size, T{0}, params.features,
+            params.channels, image_size);
+      }
+      return {event, StatusCode::OK};
+    }
     auto conv_width = params.batch * params.in_rows * params.in_cols;
     auto event = backend.template matmul<false, false>(
         input, filter, output, T{0}, conv_width, params.channels,
@@ -51,6 +69,17 @@ struct MatmulLauncher<conv_type::InputBackprop> {
       typename Backend::template pointer_type<T const> filter,
       typename Backend::template pointer_type<T> output,
       Conv2DParams const& params, Backend& backend) {
+    if (params.input_format == DataFormat::NCHW) {
+      auto image_size = params.in_rows * params.in_cols;
+      cl::sycl::event event;
+      for (int i = 0; i < params.batch; ++i) {
+        event = backend.template matmul<true, false>(
+            filter, input + i * params.features * image_size,
+            output + i * params.channels * image_size, T{0}, params.channels,
+            params.features, image_size);
+      }
+      return {event, StatusCode::OK};
+    }
     auto conv_width = params.batch * params.in_rows * params.in_cols;
     auto event = backend.template matmul<false, true>(
         input, filter, output, T{0}, conv_width, params.features,
@@ -67,6 +96,19 @@ struct MatmulLauncher<conv_type::FilterBackprop> {
       typename Backend::template pointer_type<T const> filter,
       typename Backend::template pointer_type<T> output,
       Conv2DParams const& params, Backend& backend) {
+    if (params.input_format == DataFormat::NCHW) {
+      // Accumulate the [features x channels] filter backprop over the images.
+      auto image_size = params.in_rows * params.in_cols;
+      cl::sycl::event event;
+      for (int i = 0; i < params.batch; ++i) {
+        event = backend.template matmul<false, true>(
+            filter + i * params.features * image_size,
+            input + i * params.channels * image_size, output,
+            i == 0 ? T{0} : T{1}, params.features, image_size,
+            params.channels);
+      }
+      return {event, StatusCode::OK};
+    }
     auto conv_width = params.batch * params.in_rows * params.in_cols;
     auto event = backend.template matmul<true, false>(
         input, filter, output, T{0}, params.channels, conv_width,
@@ -91,9 +133,9 @@ inline SNNStatus launch_matmul(
     typename Backend::template pointer_type<T> output,
     Conv2DParams const& params, Backend& backend) {
   SNN_VALIDATE_PARAM(params.window_rows == 1,
-                     "Matmul can only be used for 1x1 NHWC convolutions.");
+                     "Matmul can only be used for 1x1 convolutions.");
   SNN_VALIDATE_PARAM(params.window_cols == 1,
-                     "Matmul can only be used for 1x1 NHWC convolutions.");
+                     "Matmul can only be used for 1x1 convolutions.");
   SNN_VALIDATE_PARAM(params.stride_rows == 1,
                      "Matmul can only be used with stride 1.");
   SNN_VALIDATE_PARAM(params.stride_cols == 1,
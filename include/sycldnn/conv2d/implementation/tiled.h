@@ -19,16 +19,19 @@
 #include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
 #include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/conv2d/tiled_config.h"
 
+#include "sycldnn/internal/conv2d/epilogue.h"
 #include "sycldnn/internal/conv2d/tiled.h"
 
 namespace sycldnn {
 namespace conv2d {
 /**
- * Launch the direct implementation of a 2D convolution.
+ * Launch the tiled implementation of a 2D convolution.
  *
  * Will extract the SYCL buffers and SYCL queue from the backend and forward
- * these on to the precompiled kernels.
+ * these on to the precompiled kernels. The epilogue is applied by the
+ * forward kernels before storing each output tile.
  *
  * Returns an SNNStatus containing the SYCL event tied to the kernel launch.
  */
@@ -37,16 +40,61 @@ inline SNNStatus launch_tiled(
     typename Backend::template pointer_type<T const> input,
     typename Backend::template pointer_type<T const> filter,
     typename Backend::template pointer_type<T> output,
-    Conv2DParams const& params, Backend& backend) {
+    Conv2DParams const& params,
+    internal::EpiloguePointers<T, Backend> const& epilogue, Backend& backend) {
   auto conv_sizes = get_sizes<ConvType>(params);
 
   auto inp_access = backend.get_mem_object(input, conv_sizes.input_size);
   auto fil_access = backend.get_mem_object(filter, conv_sizes.filter_size);
   auto out_access = backend.get_mem_object(output, conv_sizes.output_size);
+  auto bias_access = backend.get_mem_object(
+      epilogue.bias, internal::epilogue_bias_size(epilogue.params, params));
+  auto res_access = backend.get_mem_object(
+      epilogue.residual,
+      internal::epilogue_residual_size(epilogue.params, params));
 
+  internal::EpilogueMem<T> epilogue_mem{epilogue.params, &bias_access,
+                                        &res_access};
   cl::sycl::queue queue = backend.get_queue();
-  return internal::launch_tiled<T, ConvType>(inp_access, fil_access, out_access,
-                                             params, queue);
+  return internal::launch_tiled<T, ConvType>(
+      inp_access, fil_access, out_access, params, epilogue_mem, queue);
+}
+
+/**
+ * Launch the tiled implementation of a 2D convolution using the specified tile
+ * sizes, as returned by \ref sycldnn::conv2d::get_tiled_configs or a tuner.
+ *
+ * Returns an SNNStatus containing the SYCL event tied to the kernel launch, or
+ * StatusCode::InvalidAlgorithm if the tile sizes are not available.
+ */
+template <typename T, typename ConvType, typename Backend>
+inline SNNStatus launch_tiled(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, TiledConfig const& config, Backend& backend) {
+  auto conv_sizes = get_sizes<ConvType>(params);
+
+  auto inp_access = backend.get_mem_object(input, conv_sizes.input_size);
+  auto fil_access = backend.get_mem_object(filter, conv_sizes.filter_size);
+  auto out_access = backend.get_mem_object(output, conv_sizes.output_size);
+
+  cl::sycl::queue queue = backend.get_queue();
+  return internal::launch_tiled<T, ConvType>(
+      inp_access, fil_access, out_access, params,
+      internal::no_epilogue<BaseMemObject<T const>*>(&inp_access), config,
+      queue);
+}
+
+/**
+ * Get the tile sizes available in the library for the given convolution.
+ *
+ * \param params The convolution parameters.
+ * \return A list of tile configurations which can be passed to launch_tiled.
+ */
+template <typename ConvType>
+inline std::vector<TiledConfig> get_tiled_configs(Conv2DParams const& params) {
+  return internal::get_tiled_configs<ConvType>(params);
 }
 }  // namespace conv2d
 }  // namespace sycldnn
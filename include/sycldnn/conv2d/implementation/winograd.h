@@ -18,6 +18,7 @@
 
 #include "sycldnn/conv2d/params.h"
 
+#include "sycldnn/internal/conv2d/epilogue.h"
 #include "sycldnn/internal/conv2d/winograd/launch.h"
 
 namespace sycldnn {
@@ -27,14 +28,18 @@ namespace conv2d {
  * Launch the 2D convolution using the Winograd implementation.
  *
  * Will extract the SYCL buffers and SYCL queue from the backend and forward
- * these on to the precompiled kernels.
+ * these on to the precompiled kernels. The epilogue is applied in the output
+ * transform.
  *
- * \param input   Pointer to the input buffer
- * \param filter  Pointer to the filter buffer
- * \param output  Pointer to the output buffer
- * \param params  Convolution parameters
- * \param backend Backend to use to allocate temporary buffers and compute
- *                matrix multiplies
+ * \param input          Pointer to the input buffer
+ * \param filter         Pointer to the filter buffer
+ * \param output         Pointer to the output buffer
+ * \param workspace      Pointer to the workspace buffer
+ * \param params         Convolution parameters
+ * \param epilogue       Epilogue to apply to the convolution output
+ * \param workspace_size Number of elements available in the workspace
+ * \param backend        Backend to use to allocate temporary buffers and
+ *                       compute matrix multiplies
  * \return An SNNStatus containing the SYCL event tied to the kernel launch.
  */
 template <typename T, typename ConvType, typename Backend>
@@ -43,9 +48,12 @@ inline SNNStatus launch_winograd(
     typename Backend::template pointer_type<T const> filter,
     typename Backend::template pointer_type<T> output,
     typename Backend::template pointer_type<T> workspace,
-    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+    Conv2DParams const& params,
+    internal::EpiloguePointers<T, Backend> const& epilogue,
+    size_t workspace_size, Backend& backend) {
   return internal::winograd::launch<T, ConvType>(
-      input, filter, output, workspace, params, workspace_size, backend);
+      input, filter, output, workspace, params, epilogue, workspace_size,
+      backend);
 }
 /**
  * Special launcher to use larger tile sizes for Winograd.
@@ -58,9 +66,12 @@ inline SNNStatus launch_winograd_large(
     typename Backend::template pointer_type<T const> filter,
     typename Backend::template pointer_type<T> output,
     typename Backend::template pointer_type<T> workspace,
-    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+    Conv2DParams const& params,
+    internal::EpiloguePointers<T, Backend> const& epilogue,
+    size_t workspace_size, Backend& backend) {
   return internal::winograd::launch_large<T, ConvType>(
-      input, filter, output, workspace, params, workspace_size, backend);
+      input, filter, output, workspace, params, epilogue, workspace_size,
+      backend);
 }
 
 }  // namespace conv2d
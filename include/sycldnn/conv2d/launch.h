@@ -24,51 +24,41 @@
 #include "sycldnn/status.h"
 
 #include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/epilogue_params.h"
 #include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/transformed_filter.h"
 
 #include "sycldnn/conv2d/implementation/direct.h"
 #include "sycldnn/conv2d/implementation/im2col.h"
+#include "sycldnn/conv2d/implementation/implicit_gemm.h"
 #include "sycldnn/conv2d/implementation/matmul.h"
 #include "sycldnn/conv2d/implementation/tiled.h"
 #include "sycldnn/conv2d/implementation/winograd.h"
 #include "sycldnn/conv2d/selector/selector.h"
 
+#include "sycldnn/internal/conv2d/epilogue.h"
+#include "sycldnn/internal/helpers/scoped_dependencies.h"
+
+#include <type_traits>
+#include <vector>
+
 namespace sycldnn {
 namespace conv2d {
+namespace internal {
+
 /**
- * Launch a 2D convolution, with the implementation chosen by the Selector.
+ * Validate that the user provided convolution parameters are consistent with
+ * what is expected by SYCL-DNN.
  *
- * The selector will be used to select which implementation to use, and the
- * corresponding kernels will be launched. If any additional temporary memory is
- * required then it will be allocated through the backend.
+ * If compiled with asserts, any invalid parameter will fail an assert.
+ * Otherwise a status code \ref StatusCode::InvalidParameter will be returned.
  *
- * \param input A pointer to the memory representing the input tensor.
- * \param filter A pointer to the memory representing the tensor of filter
- *               coefficients.
- * \param output A pointer to the memory representing the output tensor.
- * \param params The convolution parameters, which describe the tensor shapes
- *               and convolution strides.
- * \param selector An instance of \ref sycldnn::conv2d::Selector, used to guide
- *                 the selection of the most appropriate convolution algorithm
- *                 for a specific target platform or problem size.
- * \param backend The backend implementation, used to provide optimized matrix
- *                multiplies and to map between pointer representations.
- * \param workspace Optional pointer to a workspace buffer for use whenever
- *                  temporary memory is required.
- * \param workspace_size The number of elements available in the workspace
- *                       buffer.
- * \return Returns an SNNStatus containing the SYCL event tied to the kernel
- * launches and a StatusCode enum showing if the launch was OK or whether it
- * encountered some problem.
+ * \param params User provided parameters to validate
+ * \return An SNNStatus object containing either \ref StatusCode::OK if all
+ *         parameters are valid, or \ref StatusCode::InvalidParameter otherwise.
  */
-template <typename T, typename ConvType, typename Backend>
-SNNStatus launch(typename Backend::template pointer_type<T const> input,
-                 typename Backend::template pointer_type<T const> filter,
-                 typename Backend::template pointer_type<T> output,
-                 Conv2DParams const& params, Selector& selector,
-                 Backend& backend,
-                 typename Backend::template pointer_type<T> workspace = {},
-                 size_t workspace_size = 0) {
+inline SNNStatus validate_params(Conv2DParams const& params) {
   SNN_VALIDATE_PARAM(params.batch > 0,
                      "The number of batches must be positive.");
   SNN_VALIDATE_PARAM(params.channels > 0,
@@ -96,10 +86,171 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
   SNN_VALIDATE_PARAM(
       params.pad_cols >= 0,
       "The padding in the column direction must be non-negative.");
-  SNN_VALIDATE_PARAM(params.dilation_rows == 1,
-                     "Currently SYCL-DNN only supports dilation 1.");
-  SNN_VALIDATE_PARAM(params.dilation_cols == 1,
-                     "Currently SYCL-DNN only supports dilation 1.");
+  SNN_VALIDATE_PARAM(params.dilation_rows > 0,
+                     "The dilation in the row direction must be positive.");
+  SNN_VALIDATE_PARAM(params.dilation_cols > 0,
+                     "The dilation in the column direction must be positive.");
+  SNN_VALIDATE_PARAM(params.groups > 0,
+                     "The number of groups must be positive.");
+  SNN_VALIDATE_PARAM(params.channels % params.groups == 0,
+                     "The number of channels must be divisible by the number "
+                     "of groups.");
+  SNN_VALIDATE_PARAM(params.features % params.groups == 0,
+                     "The number of features must be divisible by the number "
+                     "of groups.");
+  return StatusCode::OK;
+}
+
+/**
+ * Check whether an algorithm can compute a dilated convolution.
+ *
+ * The direct kernels and the im2col input transforms support any dilation for
+ * every convolution type. The tiled forward kernels support dilated
+ * convolutions with unit stride. All other algorithms require dilation 1.
+ *
+ * \param algo The algorithm to check.
+ * \return Whether the algorithm supports dilations other than 1.
+ */
+template <typename ConvType>
+inline bool supports_dilation(Algorithm algo) {
+  switch (algo) {
+    case Algorithm::Direct:
+    case Algorithm::Im2col:
+      return true;
+    case Algorithm::Tiled:
+      return std::is_same<ConvType, conv_type::Forward>::value;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Check whether the convolution parameters use a dilation other than 1.
+ *
+ * \param params The convolution parameters.
+ * \return Whether the convolution is dilated.
+ */
+inline bool is_dilated(Conv2DParams const& params) {
+  return params.dilation_rows != 1 || params.dilation_cols != 1;
+}
+
+/**
+ * Check whether an algorithm can compute a grouped convolution.
+ *
+ * The direct kernels support groups for every convolution type, and the
+ * tiled kernels offset their channel and feature loops to the group for the
+ * forward and input backprop passes. Im2col supports groups in the forward
+ * pass by computing each group's matrix multiply in a single batched matrix
+ * multiply. All other algorithms require a single group.
+ *
+ * \param algo The algorithm to check.
+ * \return Whether the algorithm supports more than one group.
+ */
+template <typename ConvType>
+inline bool supports_groups(Algorithm algo) {
+  switch (algo) {
+    case Algorithm::Direct:
+      return true;
+    case Algorithm::Tiled:
+      return !std::is_same<ConvType, conv_type::FilterBackprop>::value;
+    case Algorithm::Im2col:
+      return std::is_same<ConvType, conv_type::Forward>::value;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Check whether the convolution parameters use more than one group.
+ *
+ * \param params The convolution parameters.
+ * \return Whether the convolution is grouped.
+ */
+inline bool is_grouped(Conv2DParams const& params) {
+  return params.groups != 1;
+}
+
+/**
+ * Check whether an algorithm can compute a convolution on NCHW tensors.
+ *
+ * The direct kernels support both layouts. Im2col extracts its tiles from NCHW
+ * tensors in the same order as the FCHW filter, and the matmul computes a 1x1
+ * NCHW convolution as a matrix multiply for each image. The Winograd
+ * transforms read and write NCHW tensors one channel at a time, as the
+ * transformed tiles are independent of the layout. The tiled forward kernel
+ * has an NCHW variant which is vectorised along the columns. Implicit GEMM
+ * vectorizes across the channels, so requires NHWC tensors.
+ *
+ * \param algo The algorithm to check.
+ * \return Whether the algorithm supports the NCHW layout.
+ */
+template <typename ConvType>
+inline bool supports_nchw(Algorithm algo) {
+  switch (algo) {
+    case Algorithm::Direct:
+    case Algorithm::Im2col:
+    case Algorithm::Matmul:
+    case Algorithm::Winograd:
+    case Algorithm::WinogradLarge:
+      return true;
+    case Algorithm::Tiled:
+      return std::is_same<ConvType, conv_type::Forward>::value;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Apply an epilogue in a separate kernel, for the algorithms which finish with
+ * a backend matrix multiply and so cannot apply the epilogue when storing
+ * their output.
+ *
+ * \param conv_status The status returned by the convolution launcher.
+ * \param epilogue    The epilogue to apply.
+ * \param output      The convolution output, updated in place.
+ * \param params      The convolution parameters.
+ * \param backend     The backend used to launch the convolution.
+ * \return The convolution status if it failed or the epilogue is an identity,
+ *         otherwise the convolution status followed by that of the epilogue
+ *         kernel.
+ */
+template <typename T, typename Backend>
+SNNStatus launch_separate_epilogue(
+    SNNStatus const& conv_status, EpiloguePointers<T, Backend> const& epilogue,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Backend& backend) {
+  if (conv_status.status != StatusCode::OK || is_identity(epilogue.params)) {
+    return conv_status;
+  }
+  SNNStatus status = conv_status;
+  return status.append(launch_epilogue<T>(epilogue, output, params, backend));
+}
+
+/**
+ * Launch a 2D convolution followed by the given epilogue, with the
+ * implementation chosen by the Selector.
+ *
+ * The direct, tiled and Winograd algorithms apply the epilogue as they store
+ * their output, while the remaining algorithms apply it in a separate kernel.
+ *
+ * \copydetails sycldnn::conv2d::launch()
+ * \param epilogue The epilogue to apply to the convolution output.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch_with_epilogue(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, EpiloguePointers<T, Backend> const& epilogue,
+    Selector& selector, Backend& backend,
+    typename Backend::template pointer_type<T> workspace,
+    size_t workspace_size, std::vector<cl::sycl::event> const& dependencies) {
+  auto validation_status = validate_params(params);
+  if (validation_status.status != StatusCode::OK) {
+    return validation_status;
+  }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
 
   Algorithm algo_tag = selector.select<ConvType>(params);
   auto implies = [](bool x, bool y) { return !x || (x && y); };
@@ -110,31 +261,236 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
                              params.filter_format == FilterFormat::FCHW),
                      "Unsupported layout combination.");
   if (params.input_format == DataFormat::NCHW &&
-      algo_tag != Algorithm::Direct) {
+      !supports_nchw<ConvType>(algo_tag)) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  if (is_dilated(params) && !supports_dilation<ConvType>(algo_tag)) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  if (is_grouped(params) && !supports_groups<ConvType>(algo_tag)) {
     return StatusCode::InvalidAlgorithm;
   }
 
+  // The algorithm launchers are qualified, as the internal namespace holds
+  // memory object launchers with the same names.
   switch (algo_tag) {
     case Algorithm::Direct:
-      return launch_direct<T, ConvType>(input, filter, output, params, backend);
+      return conv2d::launch_direct<T, ConvType>(input, filter, output, params,
+                                                epilogue, backend);
     case Algorithm::Tiled:
-      return launch_tiled<T, ConvType>(input, filter, output, params, backend);
+      return conv2d::launch_tiled<T, ConvType>(input, filter, output, params,
+                                               epilogue, backend);
     case Algorithm::Im2col:
-      return launch_im2col<T, ConvType>(input, filter, output, workspace,
-                                        params, workspace_size, backend);
+      return launch_separate_epilogue<T>(
+          conv2d::launch_im2col<T, ConvType>(input, filter, output, workspace,
+                                             params, workspace_size, backend),
+          epilogue, output, params, backend);
     case Algorithm::Winograd:
-      return launch_winograd<T, ConvType>(input, filter, output, workspace,
-                                          params, workspace_size, backend);
+      return conv2d::launch_winograd<T, ConvType>(input, filter, output,
+                                                  workspace, params, epilogue,
+                                                  workspace_size, backend);
     case Algorithm::WinogradLarge:
-      return launch_winograd_large<T, ConvType>(
-          input, filter, output, workspace, params, workspace_size, backend);
+      return conv2d::launch_winograd_large<T, ConvType>(
+          input, filter, output, workspace, params, epilogue, workspace_size,
+          backend);
     case Algorithm::Matmul:
-      return launch_matmul<T, ConvType>(input, filter, output, params, backend);
+      return launch_separate_epilogue<T>(
+          conv2d::launch_matmul<T, ConvType>(input, filter, output, params,
+                                             backend),
+          epilogue, output, params, backend);
+    case Algorithm::ImplicitGemm:
+      return launch_separate_epilogue<T>(
+          conv2d::launch_implicit_gemm<T, ConvType>(input, filter, output,
+                                                    params, backend),
+          epilogue, output, params, backend);
     case Algorithm::NotSupported:
     default:
       return StatusCode::InvalidAlgorithm;
   }
 }
+
+}  // namespace internal
+
+/**
+ * Launch a 2D convolution, with the implementation chosen by the Selector.
+ *
+ * The selector will be used to select which implementation to use, and the
+ * corresponding kernels will be launched. If any additional temporary memory is
+ * required then it will be allocated through the backend.
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param filter A pointer to the memory representing the tensor of filter
+ *               coefficients.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param selector An instance of \ref sycldnn::conv2d::Selector, used to guide
+ *                 the selection of the most appropriate convolution algorithm
+ *                 for a specific target platform or problem size.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Optional pointer to a workspace buffer for use whenever
+ *                  temporary memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer.
+ * \param dependencies Optional list of events which must complete before any
+ *                     of the convolution kernels can start.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 typename Backend::template pointer_type<T const> filter,
+                 typename Backend::template pointer_type<T> output,
+                 Conv2DParams const& params, Selector& selector,
+                 Backend& backend,
+                 typename Backend::template pointer_type<T> workspace = {},
+                 size_t workspace_size = 0,
+                 std::vector<cl::sycl::event> const& dependencies = {}) {
+  return internal::launch_with_epilogue<T, ConvType>(
+      input, filter, output, params, internal::no_epilogue(input), selector,
+      backend, workspace, workspace_size, dependencies);
+}
+
+/**
+ * Launch a forward 2D convolution and fuse a bias addition, residual addition
+ * and activation into the store of the convolution output, computing
+ *
+ *     output = activation(conv(input, filter) + bias[feature] + residual)
+ *
+ * This avoids separate passes over the output tensor for each of these
+ * operations, which are memory bound.
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param filter A pointer to the memory representing the tensor of filter
+ *               coefficients.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param bias A pointer to the bias tensor, holding one value per feature.
+ *             Only used if epilogue.bias is set.
+ * \param residual A pointer to the residual tensor, with the same shape as the
+ *                 output tensor. Only used if epilogue.residual is set.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param epilogue The operations to apply to the convolution output.
+ * \param selector An instance of \ref sycldnn::conv2d::Selector, used to guide
+ *                 the selection of the most appropriate convolution algorithm
+ *                 for a specific target platform or problem size.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Optional pointer to a workspace buffer for use whenever
+ *                  temporary memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer.
+ * \param dependencies Optional list of events which must complete before any
+ *                     of the convolution kernels can start.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 typename Backend::template pointer_type<T const> filter,
+                 typename Backend::template pointer_type<T> output,
+                 typename Backend::template pointer_type<T const> bias,
+                 typename Backend::template pointer_type<T const> residual,
+                 Conv2DParams const& params, EpilogueParams const& epilogue,
+                 Selector& selector, Backend& backend,
+                 typename Backend::template pointer_type<T> workspace = {},
+                 size_t workspace_size = 0,
+                 std::vector<cl::sycl::event> const& dependencies = {}) {
+  static_assert(std::is_same<ConvType, conv_type::Forward>::value,
+                "A convolution epilogue can only be applied to a forward "
+                "convolution.");
+  // Disabled terms are never read, but the kernels still bind a buffer for
+  // them so use the input in their place.
+  internal::EpiloguePointers<T, Backend> epilogue_pointers{
+      epilogue, epilogue.bias ? bias : input,
+      epilogue.residual ? residual : input};
+  return internal::launch_with_epilogue<T, ConvType>(
+      input, filter, output, params, epilogue_pointers, selector, backend,
+      workspace, workspace_size, dependencies);
+}
+
+/**
+ * Launch a 2D convolution using a filter which has already been transformed
+ * with \ref transform_filter().
+ *
+ * The algorithm is fixed by the transformed filter, and the filter transform
+ * kernel is not launched. This avoids repeatedly transforming the same filter
+ * when the filter values do not change between convolutions, for example when
+ * running inference.
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param filter The handle to the transformed filter.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The convolution parameters. The channels, features, groups
+ *               and window sizes must match those used to transform the
+ *               filter.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Optional pointer to a workspace buffer for use whenever
+ *                  temporary memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer.
+ * \param dependencies Optional list of events which must complete before any
+ *                     of the convolution kernels can start.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch(typename Backend::template pointer_type<T const> input,
+                 TransformedFilter<T, ConvType, Backend> const& filter,
+                 typename Backend::template pointer_type<T> output,
+                 Conv2DParams const& params, Backend& backend,
+                 typename Backend::template pointer_type<T> workspace = {},
+                 size_t workspace_size = 0,
+                 std::vector<cl::sycl::event> const& dependencies = {}) {
+  auto validation_status = internal::validate_params(params);
+  if (validation_status.status != StatusCode::OK) {
+    return validation_status;
+  }
+  SNN_VALIDATE_PARAM(internal::is_compatible_filter(filter.params, params),
+                     "The filter was transformed for a convolution with "
+                     "different channels, features, groups or window "
+                     "sizes.");
+  if (params.input_format != DataFormat::NHWC) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  if (internal::is_dilated(params) &&
+      !internal::supports_dilation<ConvType>(filter.algorithm)) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  if (internal::is_grouped(params) &&
+      !internal::supports_groups<ConvType>(filter.algorithm)) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  bool const is_winograd = filter.algorithm == Algorithm::Winograd ||
+                           filter.algorithm == Algorithm::WinogradLarge;
+  if (is_winograd && (params.stride_rows != 1 || params.stride_cols != 1)) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
+
+  switch (filter.algorithm) {
+    case Algorithm::Winograd:
+      return internal::winograd::launch_pretransformed<T, ConvType>(
+          input, filter.data, output, workspace, params, filter.params,
+          workspace_size, false, backend);
+    case Algorithm::WinogradLarge:
+      return internal::winograd::launch_pretransformed<T, ConvType>(
+          input, filter.data, output, workspace, params, filter.params,
+          workspace_size, true, backend);
+    case Algorithm::Im2col:
+      return internal::launch_im2col_pretransformed<T, ConvType>(
+          input, filter.data, output, workspace, params, workspace_size,
+          backend);
+    default:
+      return StatusCode::InvalidAlgorithm;
+  }
+}
 }  // namespace conv2d
 }  // namespace sycldnn
 #endif  // SYCLDNN_INCLUDE_CONV2D_LAUNCH_H_
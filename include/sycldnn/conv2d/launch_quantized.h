@@ -0,0 +1,125 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_LAUNCH_QUANTIZED_H_
+#define SYCLDNN_INCLUDE_CONV2D_LAUNCH_QUANTIZED_H_
+
+/**
+ * \file
+ * Implements the \ref sycldnn::conv2d::launch_quantized() function, which
+ * asynchronously dispatches the SYCL kernels to compute an int8 quantized 2D
+ * convolution.
+ */
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "sycldnn/quantize/launch.h"
+#include "sycldnn/quantize/params.h"
+
+#include "sycldnn/internal/conv2d/quantized.h"
+#include "sycldnn/internal/helpers/scoped_dependencies.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace sycldnn {
+namespace conv2d {
+
+/**
+ * Launch a forward int8 quantized 2D convolution.
+ *
+ * The int8 input and filter values are offset by their zero points and their
+ * products accumulated in int32, along with the int32 bias. Each output
+ * feature f is then requantized to int8 as
+ *
+ *     output = clamp(round(acc * scales[f]) + zero_points[f], min, max)
+ *
+ * using the activation bounds in the requantization parameters.
+ *
+ * Only NHWC inputs and HWCF filters are supported. Strides, padding, dilation
+ * and groups are supported as for floating point convolutions.
+ *
+ * \param input A pointer to the memory representing the int8 input tensor.
+ * \param filter A pointer to the memory representing the int8 filter tensor.
+ * \param bias A pointer to the int32 bias tensor, holding one value per
+ *             feature.
+ * \param scales A pointer to the per-feature requantization scales.
+ * \param zero_points A pointer to the per-feature output zero points.
+ * \param output A pointer to the memory representing the int8 output tensor.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param requantize_params The zero points of the input and filter, and the
+ *                          bounds of the quantized output.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename Backend>
+SNNStatus launch_quantized(
+    typename Backend::template pointer_type<int8_t const> input,
+    typename Backend::template pointer_type<int8_t const> filter,
+    typename Backend::template pointer_type<int32_t const> bias,
+    typename Backend::template pointer_type<float const> scales,
+    typename Backend::template pointer_type<int32_t const> zero_points,
+    typename Backend::template pointer_type<int8_t> output,
+    Conv2DParams const& params,
+    quantize::RequantizeParams const& requantize_params, Backend& backend,
+    std::vector<cl::sycl::event> const& dependencies = {}) {
+  auto validation_status = internal::validate_params(params);
+  if (validation_status.status != StatusCode::OK) {
+    return validation_status;
+  }
+  validation_status = quantize::internal::validate_params(requantize_params);
+  if (validation_status.status != StatusCode::OK) {
+    return validation_status;
+  }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
+  SNN_VALIDATE_PARAM(params.input_format == sycldnn::DataFormat::NHWC,
+                     "Quantized convolutions only support the NHWC data "
+                     "format.");
+  SNN_VALIDATE_PARAM(params.filter_format == sycldnn::FilterFormat::HWCF,
+                     "Quantized convolutions only support the HWCF filter "
+                     "format.");
+
+  auto conv_sizes = get_sizes<conv_type::Forward>(params);
+
+  auto inp_mem = backend.get_mem_object(input, conv_sizes.input_size);
+  auto fil_mem = backend.get_mem_object(filter, conv_sizes.filter_size);
+  auto bias_mem = backend.get_mem_object(bias, params.features);
+  auto scale_mem = backend.get_mem_object(scales, params.features);
+  auto zero_point_mem = backend.get_mem_object(zero_points, params.features);
+  auto out_mem = backend.get_mem_object(output, conv_sizes.output_size);
+
+  auto queue = backend.get_queue();
+  return internal::launch_quantized(inp_mem, fil_mem, bias_mem, scale_mem,
+                                    zero_point_mem, out_mem, params,
+                                    requantize_params, queue);
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_CONV2D_LAUNCH_QUANTIZED_H_
@@ -94,6 +94,14 @@ struct Conv2DParams {
    */
   Index dilation_cols = 1;
 
+  /**
+   * The number of groups to split the channels and features into. Each group
+   * of features is only computed from the corresponding group of channels, so
+   * the filter tensor holds channels / groups channels for each feature. Both
+   * the channels and features must be divisible by the number of groups.
+   */
+  Index groups = 1;
+
   /** The data format used in the input and output tensors. */
   sycldnn::DataFormat input_format = sycldnn::DataFormat::NHWC;
 
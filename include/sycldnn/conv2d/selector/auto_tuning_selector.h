@@ -0,0 +1,335 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_SELECTOR_AUTO_TUNING_SELECTOR_H_
+#define SYCLDNN_INCLUDE_CONV2D_SELECTOR_AUTO_TUNING_SELECTOR_H_
+
+/**
+ * \file
+ * Contains the definition of the \ref sycldnn::conv2d::AutoTuningSelector
+ * class. This \ref sycldnn::conv2d::Selector times every applicable
+ * convolution algorithm on the target device the first time it sees a set of
+ * convolution parameters, and then selects the fastest one.
+ */
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "sycldnn/conv2d/selector/selector.h"
+#include "sycldnn/conv2d/selector/tuning_cache.h"
+
+#include "sycldnn/internal/helpers/allocated_pointer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <string>
+#include <type_traits>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Check whether an algorithm supports the given convolution.
+ *
+ * This mirrors the checks made in each of the algorithm launchers, so that
+ * unsupported configurations are never launched during tuning.
+ *
+ * \param params The convolution parameters.
+ * \param algo   The algorithm to check.
+ * \return Whether the algorithm can be used to compute the convolution.
+ */
+template <typename ConvType>
+bool can_use_algorithm(Conv2DParams const& params, Algorithm algo) {
+  bool const is_nhwc = params.input_format == DataFormat::NHWC;
+  bool const is_stride_one = params.stride_rows == 1 && params.stride_cols == 1;
+  bool const is_square = params.window_rows == params.window_cols &&
+                         params.stride_rows == params.stride_cols;
+  bool const is_5x5 = params.window_rows == 5 && params.window_cols == 5;
+  bool const is_filter_backprop =
+      std::is_same<ConvType, conv_type::FilterBackprop>::value;
+  if (is_dilated(params) && !supports_dilation<ConvType>(algo)) {
+    return false;
+  }
+  if (is_grouped(params) && !supports_groups<ConvType>(algo)) {
+    return false;
+  }
+  if (!is_nhwc && !supports_nchw<ConvType>(algo)) {
+    return false;
+  }
+  switch (algo) {
+    case Algorithm::Direct:
+      return true;
+    case Algorithm::Tiled:
+      return is_square && !is_filter_backprop &&
+             (params.window_rows == 1 || params.window_rows == 3 ||
+              params.window_rows == 5) &&
+             (params.stride_rows == 1 || params.stride_rows == 2) &&
+             (is_stride_one || !is_dilated(params)) &&
+             (is_nhwc || !is_dilated(params));
+    case Algorithm::Im2col:
+      return is_nhwc || !is_grouped(params);
+    case Algorithm::Winograd:
+      return is_stride_one &&
+             ((params.window_rows == 3 && params.window_cols == 3) ||
+              (params.window_rows == 1 && params.window_cols == 3) ||
+              (params.window_rows == 3 && params.window_cols == 1) ||
+              (is_5x5 && !is_filter_backprop));
+    case Algorithm::WinogradLarge:
+      return is_stride_one &&
+             ((params.window_rows == 3 && params.window_cols == 3) ||
+              (is_5x5 && !is_filter_backprop));
+    case Algorithm::Matmul:
+      return is_stride_one && params.window_rows == 1 &&
+             params.window_cols == 1 && params.pad_rows == 0 &&
+             params.pad_cols == 0;
+    case Algorithm::ImplicitGemm:
+      return is_nhwc;
+    case Algorithm::NotSupported:
+    default:
+      return false;
+  }
+}
+
+/**
+ * A selector which always returns the algorithm provided at runtime. Used to
+ * force a specific algorithm while tuning.
+ */
+class FixedSelector final : public Selector {
+ public:
+  /**
+   * Construct a selector which will always return the given algorithm.
+   * \param algo The algorithm to select.
+   */
+  explicit FixedSelector(Algorithm algo) : algo_{algo} {}
+
+  /** \copydoc Selector::select_forward */
+  Algorithm select_forward(Conv2DParams const& params) override {
+    SNN_UNUSED_VAR(params)
+    return algo_;
+  }
+
+  /** \copydoc Selector::select_input_backprop */
+  Algorithm select_input_backprop(Conv2DParams const& params) override {
+    SNN_UNUSED_VAR(params)
+    return algo_;
+  }
+
+  /** \copydoc Selector::select_filter_backprop */
+  Algorithm select_filter_backprop(Conv2DParams const& params) override {
+    SNN_UNUSED_VAR(params)
+    return algo_;
+  }
+
+  /** \copydoc Selector::name */
+  char const* name() const override { return "FixedSelector"; }
+
+ private:
+  Algorithm algo_;
+};
+
+}  // namespace internal
+
+/**
+ * A selector which empirically chooses the fastest convolution algorithm.
+ *
+ * The first time a set of convolution parameters is seen, every applicable
+ * algorithm is launched on temporary buffers allocated through the backend and
+ * timed. The fastest algorithm is stored in a \ref TuningCache, and if a cache
+ * directory is provided the results are saved to a file specific to the device
+ * and driver version so that later runs do not need to re-tune.
+ *
+ * Tuning submits kernels to the backend's queue and waits for them to
+ * complete, so the first selection for each new convolution is expensive.
+ */
+template <typename T, typename Backend>
+class AutoTuningSelector final : public Selector {
+  static_assert(
+      std::is_same<typename Backend::template pointer_type<T>,
+                   typename Backend::template internal_pointer_type<T>>::value,
+      "The AutoTuningSelector requires a backend where the internal and "
+      "external pointer types match, as temporary buffers are allocated "
+      "through the backend and passed to the convolution launchers.");
+
+ public:
+  /**
+   * Construct an AutoTuningSelector.
+   *
+   * \param backend   Backend used to allocate temporary buffers and launch
+   *                  the candidate convolutions.
+   * \param cache_dir Directory to load and save tuning results in. If empty
+   *                  then results are only held in memory.
+   * \param n_runs    Number of timed launches of each candidate algorithm. The
+   *                  fastest of these runs is used to compare algorithms.
+   */
+  explicit AutoTuningSelector(Backend& backend,
+                              std::string const& cache_dir = "",
+                              int n_runs = 3)
+      : backend_(backend),
+        cache_{get_cache_path(backend, cache_dir)},
+        n_runs_{n_runs} {}
+
+  /**
+   * Select the fastest algorithm for a forward convolution, tuning if needed.
+   * \copydoc Selector::select_forward
+   */
+  Algorithm select_forward(Conv2DParams const& params) override {
+    return select_or_tune<conv_type::Forward>(params);
+  }
+
+  /**
+   * Select the fastest algorithm for an input backprop convolution, tuning if
+   * needed.
+   * \copydoc Selector::select_input_backprop
+   */
+  Algorithm select_input_backprop(Conv2DParams const& params) override {
+    return select_or_tune<conv_type::InputBackprop>(params);
+  }
+
+  /**
+   * Select the fastest algorithm for a filter backprop convolution, tuning if
+   * needed.
+   * \copydoc Selector::select_filter_backprop
+   */
+  Algorithm select_filter_backprop(Conv2DParams const& params) override {
+    return select_or_tune<conv_type::FilterBackprop>(params);
+  }
+
+  /** \copydoc Selector::name */
+  char const* name() const override { return "AutoTuningSelector"; }
+
+  /**
+   * Get the cache of tuning results.
+   * \return A reference to the tuning cache used by this selector.
+   */
+  TuningCache const& get_cache() const { return cache_; }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+  using Seconds = std::chrono::duration<double>;
+  using Pointer = typename Backend::template pointer_type<T>;
+  using AllocatedPointer =
+      ::sycldnn::internal::helpers::AllocatedPointer<T, Backend>;
+
+  static std::string get_cache_path(Backend& backend,
+                                    std::string const& cache_dir) {
+    if (cache_dir.empty()) {
+      return "";
+    }
+    return cache_dir + "/" +
+           TuningCache::file_name_for(backend.get_queue().get_device());
+  }
+
+  template <typename ConvType>
+  Algorithm select_or_tune(Conv2DParams const& params) {
+    Algorithm algo;
+    if (cache_.template lookup<ConvType>(params, algo)) {
+      return algo;
+    }
+    algo = tune<ConvType>(params);
+    if (algo == Algorithm::NotSupported) {
+      // Nothing could be timed, so don't store anything and let the direct
+      // convolution report any problem when it is launched.
+      return Algorithm::Direct;
+    }
+    cache_.template insert<ConvType>(params, algo);
+    cache_.save();
+    return algo;
+  }
+
+  template <typename ConvType>
+  Algorithm tune(Conv2DParams const& params) {
+    Algorithm const candidates[] = {
+        Algorithm::Direct,   Algorithm::Tiled,         Algorithm::Im2col,
+        Algorithm::Winograd, Algorithm::WinogradLarge, Algorithm::Matmul,
+        Algorithm::ImplicitGemm};
+    auto const sizes = get_sizes<ConvType>(params);
+    try {
+      AllocatedPointer input{sizeof(T) * sizes.input_size, backend_};
+      AllocatedPointer filter{sizeof(T) * sizes.filter_size, backend_};
+      AllocatedPointer output{sizeof(T) * sizes.output_size, backend_};
+
+      Algorithm best_algo = Algorithm::NotSupported;
+      double best_time = 0.;
+      for (Algorithm algo : candidates) {
+        if (!internal::can_use_algorithm<ConvType>(params, algo)) {
+          continue;
+        }
+        double time;
+        if (time_algorithm<ConvType>(algo, params, input.get(), filter.get(),
+                                     output.get(), time) &&
+            (best_algo == Algorithm::NotSupported || time < best_time)) {
+          best_algo = algo;
+          best_time = time;
+        }
+      }
+      return best_algo;
+    } catch (std::exception const&) {
+      // The temporary buffers could not be allocated.
+      return Algorithm::NotSupported;
+    }
+  }
+
+  /**
+   * Time the given algorithm, returning false if the algorithm could not be
+   * launched. The first launch is not timed, to ensure that any kernel
+   * compilation is not included in the measurement.
+   */
+  template <typename ConvType>
+  bool time_algorithm(Algorithm algo, Conv2DParams const& params,
+                      Pointer input, Pointer filter, Pointer output,
+                      double& time) {
+    internal::FixedSelector selector{algo};
+    try {
+      auto status = launch<T, ConvType>(input, filter, output, params,
+                                        selector, backend_);
+      if (status.status != StatusCode::OK) {
+        return false;
+      }
+      status.event.wait_and_throw();
+
+      auto fastest = Seconds::max();
+      for (int i = 0; i < n_runs_; ++i) {
+        auto start = Clock::now();
+        status = launch<T, ConvType>(input, filter, output, params, selector,
+                                     backend_);
+        status.event.wait_and_throw();
+        auto end = Clock::now();
+        fastest = std::min<Seconds>(fastest, end - start);
+      }
+      time = fastest.count();
+      return true;
+    } catch (std::exception const&) {
+      // Treat any runtime failure, e.g. failing to allocate a workspace, as
+      // the algorithm being unsuitable for this device.
+      return false;
+    }
+  }
+
+  Backend& backend_;
+  TuningCache cache_;
+  int n_runs_;
+};
+
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_CONV2D_SELECTOR_AUTO_TUNING_SELECTOR_H_
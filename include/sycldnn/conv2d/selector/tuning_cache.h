@@ -0,0 +1,153 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_SELECTOR_TUNING_CACHE_H_
+#define SYCLDNN_INCLUDE_CONV2D_SELECTOR_TUNING_CACHE_H_
+
+/**
+ * \file
+ * Contains the declaration of the \ref sycldnn::conv2d::TuningCache class,
+ * which stores the results of convolution algorithm tuning and can persist
+ * them to disk between runs.
+ */
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+
+#include <string>
+#include <unordered_map>
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/** Get a short descriptive name for a convolution type. */
+template <typename ConvType>
+inline char const* conv_type_name();
+
+/** \copydoc conv_type_name() */
+template <>
+inline char const* conv_type_name<conv_type::Forward>() {
+  return "Forward";
+}
+
+/** \copydoc conv_type_name() */
+template <>
+inline char const* conv_type_name<conv_type::InputBackprop>() {
+  return "InputBackprop";
+}
+
+/** \copydoc conv_type_name() */
+template <>
+inline char const* conv_type_name<conv_type::FilterBackprop>() {
+  return "FilterBackprop";
+}
+
+}  // namespace internal
+
+/**
+ * Map from convolution parameters to the fastest measured algorithm.
+ *
+ * The cache can optionally be backed by a file, in which case previously
+ * measured results are loaded on construction and can be written back with
+ * \ref TuningCache::save. Cache files are tied to a specific device and driver
+ * through \ref TuningCache::file_name_for.
+ */
+class SNN_EXPORT TuningCache {
+ public:
+  /**
+   * Construct a cache which is only held in memory.
+   */
+  TuningCache() = default;
+
+  /**
+   * Construct a cache backed by the given file. Any entries already stored in
+   * the file are loaded.
+   *
+   * \param file_path Path to the cache file. The file does not need to exist.
+   */
+  explicit TuningCache(std::string file_path);
+
+  /**
+   * Look up the stored algorithm for a convolution.
+   *
+   * \param params The convolution parameters.
+   * \param algo   Set to the stored algorithm if one is found.
+   * \return Whether an entry exists for the parameters.
+   */
+  template <typename ConvType>
+  bool lookup(Conv2DParams const& params, Algorithm& algo) const {
+    return lookup(internal::conv_type_name<ConvType>(), params, algo);
+  }
+
+  /**
+   * Store the algorithm to use for a convolution, replacing any existing
+   * entry.
+   *
+   * \param params The convolution parameters.
+   * \param algo   The algorithm to store.
+   */
+  template <typename ConvType>
+  void insert(Conv2DParams const& params, Algorithm algo) {
+    insert(internal::conv_type_name<ConvType>(), params, algo);
+  }
+
+  /**
+   * Write all entries to the backing file.
+   *
+   * \return Whether the file was successfully written. Always false for a
+   *         cache without a backing file.
+   */
+  bool save() const;
+
+  /**
+   * Get the number of entries in the cache.
+   * \return The number of stored entries.
+   */
+  size_t size() const { return entries_.size(); }
+
+  /**
+   * Get the path of the backing file.
+   * \return The file path, or an empty string if the cache is in memory only.
+   */
+  std::string const& file_path() const { return file_path_; }
+
+  /**
+   * Get a file name which uniquely identifies a device and its driver, so that
+   * results measured on one device are never applied to another.
+   *
+   * \param device The SYCL device that the results were measured on.
+   * \return A file name, without any directory component.
+   */
+  static std::string file_name_for(cl::sycl::device const& device);
+
+ private:
+  bool lookup(char const* conv_type, Conv2DParams const& params,
+              Algorithm& algo) const;
+  void insert(char const* conv_type, Conv2DParams const& params,
+              Algorithm algo);
+  void load();
+
+  std::string file_path_;
+  std::unordered_map<std::string, Algorithm> entries_;
+};
+
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_CONV2D_SELECTOR_TUNING_CACHE_H_
@@ -132,6 +132,9 @@ class WinogradLargeSelector final : public Selector {
     if (params.window_rows == 3 && params.window_cols == 3) {
       return Algorithm::WinogradLarge;
     }
+    if (params.window_rows == 5 && params.window_cols == 5) {
+      return Algorithm::WinogradLarge;
+    }
     return Algorithm::NotSupported;
   }
 
@@ -151,6 +154,9 @@ class WinogradLargeSelector final : public Selector {
     if (params.window_rows == 3 && params.window_cols == 3) {
       return Algorithm::WinogradLarge;
     }
+    if (params.window_rows == 5 && params.window_cols == 5) {
+      return Algorithm::WinogradLarge;
+    }
     return Algorithm::NotSupported;
   }
 
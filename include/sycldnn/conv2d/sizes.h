@@ -125,7 +125,7 @@ template <>
 inline ConvSizes get_channel_sizes<conv_type::Forward>(
     Conv2DParams const& params) {
   size_t inp_size = params.channels;
-  size_t fil_size = params.channels * params.features;
+  size_t fil_size = params.channels / params.groups * params.features;
   size_t out_size = params.features;
   ConvSizes sizes{inp_size, fil_size, out_size};
   return sizes;
@@ -136,7 +136,7 @@ template <>
 inline ConvSizes get_channel_sizes<conv_type::InputBackprop>(
     Conv2DParams const& params) {
   size_t inp_size = params.features;
-  size_t fil_size = params.channels * params.features;
+  size_t fil_size = params.channels / params.groups * params.features;
   size_t out_size = params.channels;
   ConvSizes sizes{inp_size, fil_size, out_size};
   return sizes;
@@ -148,7 +148,7 @@ inline ConvSizes get_channel_sizes<conv_type::FilterBackprop>(
     Conv2DParams const& params) {
   size_t inp_size = params.channels;
   size_t fil_size = params.features;
-  size_t out_size = params.channels * params.features;
+  size_t out_size = params.channels / params.groups * params.features;
   ConvSizes sizes{inp_size, fil_size, out_size};
   return sizes;
 }
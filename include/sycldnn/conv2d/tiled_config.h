@@ -0,0 +1,58 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_TILED_CONFIG_H_
+#define SYCLDNN_INCLUDE_CONV2D_TILED_CONFIG_H_
+
+/**
+ * \file
+ * Contains the declaration of the \ref sycldnn::conv2d::TiledConfig structure,
+ * which describes the tile sizes used by a tiled convolution kernel.
+ */
+namespace sycldnn {
+namespace conv2d {
+
+/** The tile sizes computed by each work item in a tiled convolution. */
+struct TiledConfig {
+  /** The number of output rows computed by each work item. */
+  int tile_rows;
+  /** The number of output columns computed by each work item. */
+  int tile_cols;
+  /** The vector width used to load and store channels. */
+  int channel_vector_width;
+  /** The vector width used to load and store features. */
+  int feature_vector_width;
+};
+
+/**
+ * Compare two tile configurations.
+ * \param lhs The first configuration.
+ * \param rhs The second configuration.
+ * \return Whether all tile sizes match.
+ */
+inline bool operator==(TiledConfig const& lhs, TiledConfig const& rhs) {
+  return lhs.tile_rows == rhs.tile_rows && lhs.tile_cols == rhs.tile_cols &&
+         lhs.channel_vector_width == rhs.channel_vector_width &&
+         lhs.feature_vector_width == rhs.feature_vector_width;
+}
+
+/** \copydoc operator==() */
+inline bool operator!=(TiledConfig const& lhs, TiledConfig const& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_CONV2D_TILED_CONFIG_H_
@@ -0,0 +1,141 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_TILED_TUNER_H_
+#define SYCLDNN_INCLUDE_CONV2D_TILED_TUNER_H_
+
+/**
+ * \file
+ * Contains helpers to time the tile sizes available for the tiled convolution
+ * on the target device, and choose the fastest.
+ */
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/tiled_config.h"
+
+#include "sycldnn/conv2d/implementation/tiled.h"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <vector>
+
+namespace sycldnn {
+namespace conv2d {
+
+/** The measured runtime of a tiled convolution with a given tile size. */
+struct TiledTiming {
+  /** The tile sizes used in the convolution. */
+  TiledConfig config;
+  /** The fastest measured runtime in seconds. */
+  double seconds;
+};
+
+/** The result of tuning the tile sizes of a tiled convolution. */
+struct TiledTuningResult {
+  /**
+   * StatusCode::OK if a configuration was found, otherwise
+   * StatusCode::InvalidAlgorithm.
+   */
+  StatusCode status;
+  /** The fastest tile configuration. */
+  TiledConfig config;
+  /** The fastest measured runtime in seconds. */
+  double seconds;
+};
+
+/**
+ * Time every tile configuration available for the given convolution.
+ *
+ * Each configuration is launched once to ensure any kernel compilation is not
+ * included in the measurements, then timed n_runs times. Configurations which
+ * fail to launch on the device are not included in the results.
+ *
+ * \param input   Pointer to the input tensor.
+ * \param filter  Pointer to the filter tensor.
+ * \param output  Pointer to the output tensor, which will be overwritten.
+ * \param params  The convolution parameters.
+ * \param backend The backend used to launch the kernels.
+ * \param n_runs  The number of timed launches of each configuration.
+ * \return The fastest measured time for each usable configuration.
+ */
+template <typename T, typename ConvType, typename Backend>
+std::vector<TiledTiming> time_tiled_configs(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Backend& backend, int n_runs = 3) {
+  using Clock = std::chrono::steady_clock;
+  using Seconds = std::chrono::duration<double>;
+
+  std::vector<TiledTiming> timings;
+  for (auto const& config : get_tiled_configs<ConvType>(params)) {
+    try {
+      auto status = launch_tiled<T, ConvType>(input, filter, output, params,
+                                              config, backend);
+      if (status.status != StatusCode::OK) {
+        continue;
+      }
+      status.event.wait_and_throw();
+
+      auto fastest = Seconds::max();
+      for (int i = 0; i < n_runs; ++i) {
+        auto start = Clock::now();
+        status = launch_tiled<T, ConvType>(input, filter, output, params,
+                                           config, backend);
+        status.event.wait_and_throw();
+        auto end = Clock::now();
+        fastest = std::min<Seconds>(fastest, end - start);
+      }
+      timings.push_back(TiledTiming{config, fastest.count()});
+    } catch (std::exception const&) {
+      // Kernels which cannot run on this device, for example due to exceeding
+      // the available registers, are skipped.
+      continue;
+    }
+  }
+  return timings;
+}
+
+/**
+ * Find the fastest tile configuration for the given convolution.
+ *
+ * \copydetails time_tiled_configs
+ * \return The fastest configuration, or a status of
+ *         StatusCode::InvalidAlgorithm if no configuration could be used.
+ */
+template <typename T, typename ConvType, typename Backend>
+TiledTuningResult tune_tiled(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Backend& backend, int n_runs = 3) {
+  auto timings = time_tiled_configs<T, ConvType>(input, filter, output, params,
+                                                 backend, n_runs);
+  if (timings.empty()) {
+    return TiledTuningResult{StatusCode::InvalidAlgorithm, TiledConfig{}, 0.};
+  }
+  auto fastest = std::min_element(
+      timings.begin(), timings.end(),
+      [](TiledTiming const& lhs, TiledTiming const& rhs) {
+        return lhs.seconds < rhs.seconds;
+      });
+  return TiledTuningResult{StatusCode::OK, fastest->config, fastest->seconds};
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_CONV2D_TILED_TUNER_H_
@@ -0,0 +1,167 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_TRANSFORMED_FILTER_H_
+#define SYCLDNN_INCLUDE_CONV2D_TRANSFORMED_FILTER_H_
+
+/**
+ * \file
+ * Contains the \ref sycldnn::conv2d::TransformedFilter handle, along with
+ * \ref sycldnn::conv2d::query_transformed_filter_size() and
+ * \ref sycldnn::conv2d::transform_filter() which are used to transform a
+ * filter once so that it can be reused across many convolutions.
+ */
+#include "sycldnn/helpers/macros.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/internal/conv2d/im2col.h"
+#include "sycldnn/internal/conv2d/winograd/launch_pretransformed.h"
+#include "sycldnn/internal/helpers/scoped_dependencies.h"
+
+#include <stddef.h>
+#include <type_traits>
+#include <vector>
+
+namespace sycldnn {
+namespace conv2d {
+
+/**
+ * Handle to a filter which has been transformed ahead of time for a specific
+ * convolution algorithm.
+ *
+ * The transformed filter data is held in a buffer provided by the user, which
+ * must hold at least \ref query_transformed_filter_size() elements and must
+ * outlive any convolutions launched with the handle. Once the buffer has been
+ * filled with \ref transform_filter(), the handle can be passed to
+ * \ref launch() in place of the filter for any convolution with the same
+ * channels, features and window, regardless of batch size or image size.
+ *
+ * The filter backprop treats the output gradient as the filter, which changes
+ * on every call, so cannot be used with a transformed filter.
+ */
+template <typename T, typename ConvType, typename Backend>
+struct TransformedFilter {
+  static_assert(!std::is_same<ConvType, conv_type::FilterBackprop>::value,
+                "The filter backprop cannot use a pre-transformed filter.");
+
+  /** Pointer to the buffer holding the transformed filter. */
+  typename Backend::template pointer_type<T> data;
+  /** The convolution parameters used to transform the filter. */
+  Conv2DParams params;
+  /** The algorithm that the filter was transformed for. */
+  Algorithm algorithm;
+};
+
+namespace internal {
+
+/**
+ * Check whether a filter transformed using one set of convolution parameters
+ * can be used in a convolution with a different set of parameters.
+ */
+inline bool is_compatible_filter(Conv2DParams const& transformed,
+                                 Conv2DParams const& params) {
+  return transformed.channels == params.channels &&
+         transformed.features == params.features &&
+         transformed.window_rows == params.window_rows &&
+         transformed.window_cols == params.window_cols &&
+         transformed.groups == params.groups &&
+         transformed.input_format == params.input_format &&
+         transformed.filter_format == params.filter_format;
+}
+
+}  // namespace internal
+
+/**
+ * Query the number of elements required to hold a transformed filter.
+ *
+ * \param params The convolution parameters.
+ * \param algo   The algorithm to transform the filter for.
+ * \return The number of elements the transformed filter buffer must hold. This
+ *         is zero if the algorithm does not support pre-transformed filters
+ *         for the given parameters, which is the case for any algorithm that
+ *         uses the filter without transforming it.
+ */
+template <typename ConvType>
+size_t query_transformed_filter_size(Conv2DParams const& params,
+                                     Algorithm algo) {
+  if (params.input_format != DataFormat::NHWC || params.groups != 1) {
+    return 0;
+  }
+  switch (algo) {
+    case Algorithm::Winograd:
+      return internal::winograd::filter_transform_size<ConvType>(params,
+                                                                 false);
+    case Algorithm::WinogradLarge:
+      return internal::winograd::filter_transform_size<ConvType>(params, true);
+    case Algorithm::Im2col:
+      return internal::im2col::filter_transform_size<ConvType>(params);
+    default:
+      return 0;
+  }
+}
+
+/**
+ * Transform a filter into the buffer referenced by a \ref TransformedFilter.
+ *
+ * \param filter      A pointer to the filter tensor to transform.
+ * \param transformed The handle to fill, giving the buffer to write the
+ *                    transformed filter to along with the convolution
+ *                    parameters and algorithm to transform the filter for.
+ * \param backend     The backend implementation, used to map between pointer
+ *                    representations.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
+ * \return An SNNStatus containing the SYCL event tied to the filter transform
+ *         kernel, or \ref StatusCode::InvalidAlgorithm if the algorithm does
+ *         not support pre-transformed filters.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus transform_filter(
+    typename Backend::template pointer_type<T const> filter,
+    TransformedFilter<T, ConvType, Backend> const& transformed,
+    Backend& backend, std::vector<cl::sycl::event> const& dependencies = {}) {
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
+  auto const& params = transformed.params;
+  SNN_VALIDATE_PARAM(params.channels > 0,
+                     "The number of channels must be positive.");
+  SNN_VALIDATE_PARAM(params.features > 0,
+                     "The number of features must be positive.");
+  if (query_transformed_filter_size<ConvType>(params, transformed.algorithm) ==
+      0) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  switch (transformed.algorithm) {
+    case Algorithm::Winograd:
+      return internal::winograd::transform_filter<T, ConvType>(
+          filter, transformed.data, params, false, backend);
+    case Algorithm::WinogradLarge:
+      return internal::winograd::transform_filter<T, ConvType>(
+          filter, transformed.data, params, true, backend);
+    case Algorithm::Im2col:
+      return internal::im2col::transform_filter<T, ConvType>(
+          filter, transformed.data, params, backend);
+    default:
+      return StatusCode::InvalidAlgorithm;
+  }
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_CONV2D_TRANSFORMED_FILTER_H_
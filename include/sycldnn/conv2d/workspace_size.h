@@ -78,6 +78,8 @@ WorkspaceSize workspace_size_for_winograd(Conv2DParams const& params) {
   // src/conv2d/winoograd/launch.cc
   if (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
     return winograd_impl_workspace_size<ConvType, 3, 3, 2, 2>(params);
+  } else if (params.window_rows == 5 && params.window_cols == 5) {
+    return winograd_impl_workspace_size<ConvType, 2, 2, 5, 5>(params);
   } else {
     return winograd_impl_workspace_size<ConvType, 2, 2, 3, 3>(params);
   }
@@ -90,6 +92,10 @@ WorkspaceSize workspace_size_for_winograd_large(Conv2DParams const& params) {
   // src/conv2d/winoograd/launch.cc
   if (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
     return winograd_impl_workspace_size<ConvType, 3, 3, 3, 3>(params);
+  } else if (params.window_rows == 5 && params.window_cols == 5) {
+    return winograd_impl_workspace_size<ConvType, 4, 4, 5, 5>(params);
+  } else if (winograd::use_6x6_tiles<ConvType>(params)) {
+    return winograd_impl_workspace_size<ConvType, 6, 6, 3, 3>(params);
   } else {
     return winograd_impl_workspace_size<ConvType, 4, 4, 3, 3>(params);
   }
@@ -98,6 +104,12 @@ WorkspaceSize workspace_size_for_winograd_large(Conv2DParams const& params) {
 /** Get the workspace sizes needed for the Im2col transform tensors. */
 template <typename ConvType>
 WorkspaceSize workspace_size_for_im2col(Conv2DParams const& params) {
+  if (std::is_same<ConvType, conv_type::Forward>::value && params.groups > 1) {
+    size_t filter_size = im2col::get_grouped_filter_size(params);
+    size_t size_per_image = im2col::get_grouped_size_per_image(params);
+    return {size_per_image + filter_size,
+            params.batch * size_per_image + filter_size};
+  }
   auto const tile_info = im2col::get_tile_info<ConvType>(params);
   size_t filter_size = std::is_same<ConvType, conv_type::InputBackprop>::value
                            ? params.window_rows * params.window_cols *
@@ -126,6 +138,7 @@ WorkspaceSize query_workspace_size(Conv2DParams const& params,
     case Algorithm::Direct:
     case Algorithm::Tiled:
     case Algorithm::Matmul:
+    case Algorithm::ImplicitGemm:
     case Algorithm::NotSupported:
       return {0, 0};
   }
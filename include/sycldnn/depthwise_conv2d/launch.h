@@ -31,6 +31,9 @@
 #include "sycldnn/helpers/macros.h"
 
 #include "sycldnn/internal/depthwise_conv2d/launch.h"
+#include "sycldnn/internal/helpers/scoped_dependencies.h"
+
+#include <vector>
 
 namespace sycldnn {
 namespace depthwise_conv2d {
@@ -46,6 +49,8 @@ namespace depthwise_conv2d {
  *               and convolution strides.
  * \param backend The backend implementation, used to provide optimized matrix
  *                multiplies and to map between pointer represntations.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
  * \return Returns an SNNStatus containing the SYCL event tied to the kernel
  * launches and a StatusCode enum showing if the launch was OK or whether it
  * encountered some problem.
@@ -54,7 +59,10 @@ template <typename T, typename ConvType, typename Backend>
 SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T const> filter,
                  typename Backend::template pointer_type<T> output,
-                 DepthwiseConv2DParams const& params, Backend& backend) {
+                 DepthwiseConv2DParams const& params, Backend& backend,
+                 std::vector<cl::sycl::event> const& dependencies = {}) {
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
   SNN_VALIDATE_PARAM(params.batch > 0,
                      "The number of batches must be positive.");
   SNN_VALIDATE_PARAM(params.channels > 0,
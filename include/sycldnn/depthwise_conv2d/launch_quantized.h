@@ -0,0 +1,149 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_DEPTHWISE_CONV2D_LAUNCH_QUANTIZED_H_
+#define SYCLDNN_INCLUDE_DEPTHWISE_CONV2D_LAUNCH_QUANTIZED_H_
+
+/**
+ * \file
+ * Implements the \ref sycldnn::depthwise_conv2d::launch_quantized() function,
+ * which asynchronously dispatches the SYCL kernels required to perform an int8
+ * quantized 2D depthwise convolution.
+ */
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+
+#include "sycldnn/depthwise_conv2d/params.h"
+#include "sycldnn/depthwise_conv2d/sizes.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "sycldnn/quantize/launch.h"
+#include "sycldnn/quantize/params.h"
+
+#include "sycldnn/internal/depthwise_conv2d/launch.h"
+#include "sycldnn/internal/helpers/scoped_dependencies.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace sycldnn {
+namespace depthwise_conv2d {
+
+/**
+ * Launch a forward int8 quantized 2D depthwise convolution.
+ *
+ * The int8 input and filter values are offset by their zero points and their
+ * products accumulated in int32, along with the int32 bias. Each output
+ * feature f is then requantized to int8 as
+ *
+ *     output = clamp(round(acc * scales[f]) + zero_points[f], min, max)
+ *
+ * using the activation bounds in the requantization parameters.
+ *
+ * \param input A pointer to the memory representing the int8 input tensor.
+ * \param filter A pointer to the memory representing the int8 filter tensor.
+ * \param bias A pointer to the int32 bias tensor, holding one value per
+ *             feature.
+ * \param scales A pointer to the per-feature requantization scales.
+ * \param zero_points A pointer to the per-feature output zero points.
+ * \param output A pointer to the memory representing the int8 output tensor.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param requantize_params The zero points of the input and filter, and the
+ *                          bounds of the quantized output.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename Backend>
+SNNStatus launch_quantized(
+    typename Backend::template pointer_type<int8_t const> input,
+    typename Backend::template pointer_type<int8_t const> filter,
+    typename Backend::template pointer_type<int32_t const> bias,
+    typename Backend::template pointer_type<float const> scales,
+    typename Backend::template pointer_type<int32_t const> zero_points,
+    typename Backend::template pointer_type<int8_t> output,
+    DepthwiseConv2DParams const& params,
+    quantize::RequantizeParams const& requantize_params, Backend& backend,
+    std::vector<cl::sycl::event> const& dependencies = {}) {
+  SNN_VALIDATE_PARAM(params.batch > 0,
+                     "The number of batches must be positive.");
+  SNN_VALIDATE_PARAM(params.channels > 0,
+                     "The number of channels must be positive.");
+  SNN_VALIDATE_PARAM(params.channel_multiplier > 0,
+                     "The channel multiplier must be positive.");
+  SNN_VALIDATE_PARAM(params.in_rows > 0,
+                     "The number of input rows must be positive.");
+  SNN_VALIDATE_PARAM(params.in_cols > 0,
+                     "The number of input columns must be positive.");
+  SNN_VALIDATE_PARAM(params.out_rows > 0,
+                     "The number of output rows must be positive.");
+  SNN_VALIDATE_PARAM(params.out_cols > 0,
+                     "The number of output columns must be positive.");
+  SNN_VALIDATE_PARAM(params.window_rows > 0,
+                     "The number of window rows must be positive.");
+  SNN_VALIDATE_PARAM(params.window_cols > 0,
+                     "The number of window columns must be positive.");
+  SNN_VALIDATE_PARAM(params.stride_rows > 0,
+                     "The stride in the row direction must be positive.");
+  SNN_VALIDATE_PARAM(params.stride_cols > 0,
+                     "The stride in the column direction must be positive.");
+  SNN_VALIDATE_PARAM(params.pad_rows >= 0,
+                     "The padding in the row direction must be non-negative.");
+  SNN_VALIDATE_PARAM(
+      params.pad_cols >= 0,
+      "The padding in the column direction must be non-negative.");
+  SNN_VALIDATE_PARAM(params.input_format == sycldnn::DataFormat::NHWC,
+                     "Currently SYCL-DNN only supports the NHWC data format.");
+  SNN_VALIDATE_PARAM(
+      params.filter_format == sycldnn::FilterFormat::HWCF,
+      "Currently SYCL-DNN only supports the HWCF filter format.");
+  auto validation_status =
+      quantize::internal::validate_params(requantize_params);
+  if (validation_status.status != StatusCode::OK) {
+    return validation_status;
+  }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
+
+  auto conv_sizes = get_sizes<conv2d::conv_type::Forward>(params);
+  auto const features = params.channels * params.channel_multiplier;
+
+  auto inp_access = backend.get_mem_object(input, conv_sizes.input_size);
+  auto fil_access = backend.get_mem_object(filter, conv_sizes.filter_size);
+  auto bias_access = backend.get_mem_object(bias, features);
+  auto scale_access = backend.get_mem_object(scales, features);
+  auto zero_point_access = backend.get_mem_object(zero_points, features);
+  auto out_access = backend.get_mem_object(output, conv_sizes.output_size);
+
+  cl::sycl::queue queue = backend.get_queue();
+
+  return internal::launch_quantized(inp_access, fil_access, bias_access,
+                                    scale_access, zero_point_access,
+                                    out_access, params, requantize_params,
+                                    queue);
+}
+
+}  // namespace depthwise_conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_DEPTHWISE_CONV2D_LAUNCH_QUANTIZED_H_
@@ -0,0 +1,72 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_HELPERS_DEPENDENCIES_H_
+#define SYCLDNN_INCLUDE_HELPERS_DEPENDENCIES_H_
+
+/**
+ * \file
+ * Provides helpers to make SYCL command groups depend on a list of events.
+ */
+#include "sycldnn/helpers/macros.h"
+
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+/**
+ * \def SNN_HAS_DEPENDS_ON
+ * Set to 1 if the SYCL implementation supports handler::depends_on, which was
+ * added in SYCL 2020, and 0 otherwise. USM support requires SYCL 2020, so
+ * depends_on is always available when USM is enabled.
+ */
+#ifndef SNN_HAS_DEPENDS_ON
+#if defined(SNN_USE_USM) || \
+    (defined(SYCL_LANGUAGE_VERSION) && SYCL_LANGUAGE_VERSION >= 202001)
+#define SNN_HAS_DEPENDS_ON 1
+#else
+#define SNN_HAS_DEPENDS_ON 0
+#endif
+#endif  // SNN_HAS_DEPENDS_ON
+
+namespace sycldnn {
+namespace helpers {
+
+/**
+ * Make a command group depend on the given events, so that the command group
+ * does not start executing until all of the events have completed.
+ *
+ * Without SYCL 2020 support this is a no-op, and the caller is responsible for
+ * ensuring the dependencies have completed.
+ *
+ * \param cgh          The SYCL command group handler.
+ * \param dependencies The events to depend on.
+ */
+inline void add_dependencies(
+    cl::sycl::handler& cgh, std::vector<cl::sycl::event> const& dependencies) {
+#if SNN_HAS_DEPENDS_ON
+  if (!dependencies.empty()) {
+    cgh.depends_on(dependencies);
+  }
+#else
+  SNN_UNUSED_VAR(cgh)
+  SNN_UNUSED_VAR(dependencies)
+#endif
+}
+
+}  // namespace helpers
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_HELPERS_DEPENDENCIES_H_
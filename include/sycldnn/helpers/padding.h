@@ -23,6 +23,8 @@
  */
 #include "sycldnn/padding_mode.h"
 
+#include "sycldnn/conv2d/params.h"
+
 #include "sycldnn/helpers/ratio.h"
 
 namespace sycldnn {
@@ -45,11 +47,15 @@ struct PaddingAndOutput {
  *               the input.
  * \param stride The stride that the window will be advanced by.
  * \param type The type of padding that will be applied.
+ * \param dilation The spacing between elements of the input that the window
+ *                 is applied to.
  * \return The padding and new size of the tensor as a pair (POD struct).
  */
 template <typename Index>
 PaddingAndOutput<Index> calculate_padding(Index input, Index window,
-                                          Index stride, PaddingMode type) {
+                                          Index stride, PaddingMode type,
+                                          Index dilation = 1) {
+  window = (window - 1) * dilation + 1;
   switch (type) {
     case PaddingMode::VALID: {
       Index output = round_ratio_up(input - window + 1, stride);
@@ -91,6 +97,31 @@ Params add_padding_to(Params params, PaddingMode type) {
   return params;
 }
 
+/**
+ * Add the padding and output sizes to a convolution parameter struct from the
+ * input sizes, window sizes, strides and dilations.
+ * \param params The parameters that the output will be based on.
+ * \param type The type of padding that should be used to calculate the actual
+ *             size of padding to be used in the convolution.
+ * \return The original params, modified with the padding sizes required.
+ */
+inline conv2d::Conv2DParams add_padding_to(conv2d::Conv2DParams params,
+                                           PaddingMode type) {
+  auto row_padding = sycldnn::helpers::calculate_padding(
+      params.in_rows, params.window_rows, params.stride_rows, type,
+      params.dilation_rows);
+  params.out_rows = row_padding.output;
+  params.pad_rows = row_padding.padding;
+
+  auto col_padding = sycldnn::helpers::calculate_padding(
+      params.in_cols, params.window_cols, params.stride_cols, type,
+      params.dilation_cols);
+  params.out_cols = col_padding.output;
+  params.pad_cols = col_padding.padding;
+
+  return params;
+}
+
 }  // namespace helpers
 }  // namespace sycldnn
 
@@ -17,8 +17,16 @@
 #ifndef SYCLDNN_INCLUDE_INTERNAL_BATCHNORM_LAUNCH_VARIANCE_INTERNAL_H_
 #define SYCLDNN_INCLUDE_INTERNAL_BATCHNORM_LAUNCH_VARIANCE_INTERNAL_H_
 
+#include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
+#include "sycldnn/batchnorm/params.h"
+
+#include <CL/sycl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
 #include "sycldnn/export.h"
 
 namespace sycldnn {
@@ -26,33 +34,92 @@ namespace batchnorm {
 namespace internal {
 
 /**
- * The internal launcher for computing variance.
+ * The type of the per slice statistics held in the workspace of the mean and
+ * variance launchers. This matches the type used to accumulate values of type
+ * T in the kernels, so half precision statistics are kept in single precision.
  */
 template <typename T>
-SNN_EXPORT SNNStatus launch_variance(BaseMemObject<T const>& input,
-                                     BaseMemObject<T const>& current_mean,
-                                     BaseMemObject<T>& current_variance,
-                                     BatchNormParams const& params,
-                                     cl::sycl::queue& queue);
+struct StatisticType {
+  /** The type of each statistic. */
+  using type = T;
+};
+#ifdef SNN_USE_HALF
+/** Half precision statistics are stored in single precision. */
+template <>
+struct StatisticType<cl::sycl::half> {
+  /** The type of each statistic. */
+  using type = float;
+};
+#endif  // SNN_USE_HALF
 
 /**
- * The internal launcher for computing batchnorm.
+ * Choose the number of slices to split the positions of each channel into
+ * when computing the mean and variance.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ *
+ * \param params The batchnorm parameters.
+ * \return The number of slices, which is at most the number of positions.
+ */
+SNN_EXPORT int get_mean_variance_split_count(BatchNormParams const& params);
+
+/**
+ * Get the number of elements needed in the workspace of the mean and variance
+ * launchers, which hold a mean and a variance for each channel of each slice.
+ *
+ * \param params   The batchnorm parameters.
+ * \param n_slices The number of slices the positions are split into.
+ * \return The number of elements needed in the workspace.
+ */
+inline size_t get_mean_variance_workspace_size(BatchNormParams const& params,
+                                               int n_slices) {
+  return 2 * static_cast<size_t>(n_slices) * params.channels;
+}
+
+/**
+ * The internal launcher for computing the mean and variance of each channel
+ * of the input in a single pass.
+ *
+ * The positions of each channel are split into n_slices slices, and the
+ * statistics of each slice are written to the workspace before a second
+ * kernel combines them. The workspace must hold at least
+ * get_mean_variance_workspace_size() elements.
  */
 template <typename T>
-SNN_EXPORT SNNStatus launch_batchnorm(
-    BaseMemObject<T const>& input, BaseMemObject<T const>& beta,
-    BaseMemObject<T const>& gamma, BaseMemObject<T const>& current_mean,
-    BaseMemObject<T const>& current_variance, BaseMemObject<T>& output,
+SNN_EXPORT SNNStatus launch_mean_variance(
+    BaseMemObject<T const>& input,
+    BaseMemObject<typename StatisticType<T>::type>& workspace,
+    BaseMemObject<T>& mean, BaseMemObject<T>& variance, int n_slices,
     BatchNormParams const& params, cl::sycl::queue& queue);
 
 /**
- * The internal launcher for computing running mean and running variance.
+ * The internal launcher for computing batchnorm when training, using the batch
+ * mean and variance of each channel.
+ *
+ * The statistics of each slice of the input are written to the workspace as in
+ * launch_mean_variance(), then a second kernel combines them, normalises the
+ * input and writes the running mean and variance, given by combining the batch
+ * statistics with input_mean and input_variance using the momentum.
  */
 template <typename T>
-SNN_EXPORT SNNStatus launch_running_mean_variance(
+SNN_EXPORT SNNStatus launch_batchnorm_training(
+    BaseMemObject<T const>& input,
+    BaseMemObject<typename StatisticType<T>::type>& workspace,
+    BaseMemObject<T const>& beta, BaseMemObject<T const>& gamma,
     BaseMemObject<T const>& input_mean, BaseMemObject<T const>& input_variance,
     BaseMemObject<T>& running_mean, BaseMemObject<T>& running_variance,
-    int32_t const n_items, float const momentum, cl::sycl::queue& queue);
+    BaseMemObject<T>& output, int n_slices, BatchNormParams const& params,
+    cl::sycl::queue& queue);
+
+/**
+ * The internal launcher for computing batchnorm.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_batchnorm(
+    BaseMemObject<T const>& input, BaseMemObject<T const>& beta,
+    BaseMemObject<T const>& gamma, BaseMemObject<T const>& current_mean,
+    BaseMemObject<T const>& current_variance, BaseMemObject<T>& output,
+    BatchNormParams const& params, cl::sycl::queue& queue);
 
 /**
  * The internal launcher for computing input gradient for the case when
@@ -96,6 +163,23 @@ SNN_EXPORT SNNStatus launch_gamma_gradient(
     BaseMemObject<T>& output, int32_t const n_items, float const epsilon,
     cl::sycl::queue& queue);
 
+/**
+ * The internal launcher for folding frozen batchnorm parameters into the
+ * filter and bias of a preceding convolution.
+ *
+ * The feature of filter element i is (i / feature_stride) % n_features. If
+ * use_bias is false then the bias is treated as zero and is not read.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_fold_into_conv2d(
+    BaseMemObject<T const>& filter, BaseMemObject<T const>& bias,
+    BaseMemObject<T const>& beta, BaseMemObject<T const>& gamma,
+    BaseMemObject<T const>& mean, BaseMemObject<T const>& variance,
+    BaseMemObject<T>& folded_filter, BaseMemObject<T>& folded_bias,
+    int32_t const n_filter_items, int32_t const n_features,
+    int32_t const feature_stride, bool const use_bias, float const epsilon,
+    cl::sycl::queue& queue);
+
 }  // namespace internal
 }  // namespace batchnorm
 }  // namespace sycldnn
@@ -30,8 +30,14 @@
 #include "sycldnn/binaryop/operators.h"
 #include "sycldnn/internal/binaryop/launch.h"
 
+#include "sycldnn/internal/helpers/allocated_pointer.h"
+
+#include "sycldnn/helpers/macros.h"
+
 #include "sycldnn/reduce/operators.h"
 
+#include <cstddef>
+
 namespace sycldnn {
 namespace batchnorm {
 namespace internal {
@@ -64,7 +70,11 @@ using DisableIf_Gradient_Training = typename std::enable_if<
  * The internal batchnorm launcher for Forward Direction when computing Mean and
  * Variance.
  *
- * Calculates Mean, then Variance and then Batchnorm.
+ * Calculates the statistics of each slice of the input in a first kernel, then
+ * combines them, computes Batchnorm using the batch statistics and updates the
+ * running mean and variance in a second kernel. The slice statistics are held
+ * in the provided workspace, or if no workspace is provided then in a
+ * temporary buffer allocated through the backend.
  */
 
 template <typename T, typename Backend, typename Direction, typename Operation,
@@ -78,51 +88,50 @@ SNNStatus launch_forward(
     typename Backend::template pointer_type<T> running_mean,
     typename Backend::template pointer_type<T> running_variance,
     typename Backend::template pointer_type<T> output,
-    BatchNormParams const& params, Backend& backend) {
-  SNNStatus status;
-  status.event = backend.template reduce<reduce::Mean>(
-      input, running_mean, 1, params.batch * params.rows * params.cols,
-      params.channels);
-
+    typename Backend::template pointer_type<typename StatisticType<T>::type>
+        workspace,
+    size_t workspace_size, BatchNormParams const& params, Backend& backend) {
   auto n_items = params.batch * params.channels * params.rows * params.cols;
 
   auto queue = backend.get_queue();
 
-  using ConstPointer = typename Backend::template pointer_type<T const>;
-  auto const_mean = ConstPointer{running_mean};
-  auto const_mean_mem = backend.get_mem_object(const_mean, params.channels);
-
   auto in_mem = backend.get_mem_object(input, n_items);
-  auto variance_mem = backend.get_mem_object(running_variance, params.channels);
   auto beta_mem = backend.get_mem_object(beta, params.channels);
   auto gamma_mem = backend.get_mem_object(gamma, params.channels);
-  auto out_mem = backend.get_mem_object(output, n_items);
-
-  status = launch_variance(in_mem, const_mean_mem, variance_mem, params, queue);
-
-  if (sycldnn::StatusCode::OK != status.status) return status;
-
-  auto const_variance = ConstPointer{running_variance};
-  auto const_variance_mem =
-      backend.get_mem_object(const_variance, params.channels);
-
-  status = launch_batchnorm(in_mem, beta_mem, gamma_mem, const_mean_mem,
-                            const_variance_mem, out_mem, params, queue);
-
-  if (sycldnn::StatusCode::OK != status.status) return status;
-
   auto input_mean_mem = backend.get_mem_object(input_mean, params.channels);
-  auto running_mean_mem = backend.get_mem_object(running_mean, params.channels);
   auto input_variance_mem =
       backend.get_mem_object(input_variance, params.channels);
+  auto running_mean_mem = backend.get_mem_object(running_mean, params.channels);
   auto running_variance_mem =
       backend.get_mem_object(running_variance, params.channels);
+  auto out_mem = backend.get_mem_object(output, n_items);
 
-  status = launch_running_mean_variance(
-      input_mean_mem, input_variance_mem, running_mean_mem,
-      running_variance_mem, params.channels, params.momentum, queue);
-
-  return status;
+  using Statistic = typename StatisticType<T>::type;
+  using AllocatedWorkspace =
+      sycldnn::internal::helpers::AllocatedPointer<Statistic, Backend>;
+
+  int const n_slices = get_mean_variance_split_count(params);
+  size_t const required_size =
+      get_mean_variance_workspace_size(params, n_slices);
+  auto launch_with_workspace =
+      [&](BaseMemObject<Statistic>& workspace_mem) -> SNNStatus {
+    return launch_batchnorm_training(
+        in_mem, workspace_mem, beta_mem, gamma_mem, input_mean_mem,
+        input_variance_mem, running_mean_mem, running_variance_mem, out_mem,
+        n_slices, params, queue);
+  };
+
+  if (workspace_size == 0) {
+    AllocatedWorkspace allocated{required_size * sizeof(Statistic), backend};
+    auto workspace_mem =
+        backend.get_mem_object_internal(allocated.get(), required_size);
+    return launch_with_workspace(workspace_mem);
+  }
+  SNN_VALIDATE_PARAM(workspace_size >= required_size,
+                     "The workspace is too small to hold the statistics of "
+                     "each slice of the input.");
+  auto workspace_mem = backend.get_mem_object(workspace, required_size);
+  return launch_with_workspace(workspace_mem);
 }
 
 /**
@@ -148,7 +157,7 @@ SNNStatus launch_forward(
  * The internal batchnorm launcher for Gradient Direction when computing Mean
  * and Variance.
  *
- * Calculates Mean, then Variance and then Batchnorm.
+ * Calculates Mean and Variance in a single pass, then the gradients.
  * https://github.com/tensorflow/tensorflow/blob/d916f20e1f1897696a19158ac7f5bd8d83e1b857/tensorflow/python/ops/nn_grad.py#L924
  */
 
@@ -162,48 +171,56 @@ SNNStatus launch_grad(typename Backend::template pointer_type<T const> input,
                       typename Backend::template pointer_type<T> gamma_grad,
                       typename Backend::template pointer_type<T> output,
                       BatchNormParams const& params, Backend& backend) {
-  SNNStatus status;
-  status.event = backend.template reduce<reduce::Mean>(
-      input, gamma_grad, 1, params.batch * params.rows * params.cols,
-      params.channels);  // mean_x
-
   auto n_items = params.batch * params.channels * params.rows * params.cols;
   using ConstPointer = typename Backend::template pointer_type<T const>;
   auto queue = backend.get_queue();
 
-  auto const_input_mean = ConstPointer{gamma_grad};
-  auto const_input_mean_mem =
-      backend.get_mem_object(const_input_mean, params.channels);
   auto input_mem = backend.get_mem_object(input, n_items);
+  auto input_mean_mem = backend.get_mem_object(gamma_grad, params.channels);
   auto input_variance_mem = backend.get_mem_object(beta_grad, params.channels);
 
-  status = launch_variance(input_mem, const_input_mean_mem, input_variance_mem,
-                           params, queue);  // var_x
+  using Statistic = typename StatisticType<T>::type;
+  using AllocatedWorkspace =
+      sycldnn::internal::helpers::AllocatedPointer<Statistic, Backend>;
+  int const n_slices = get_mean_variance_split_count(params);
+  size_t const statistics_size =
+      get_mean_variance_workspace_size(params, n_slices);
+  AllocatedWorkspace statistics{statistics_size * sizeof(Statistic), backend};
+  auto statistics_mem =
+      backend.get_mem_object_internal(statistics.get(), statistics_size);
+
+  SNNStatus status = launch_mean_variance(
+      input_mem, statistics_mem, input_mean_mem, input_variance_mem, n_slices,
+      params, queue);  // mean_x, var_x
   if (sycldnn::StatusCode::OK != status.status) return status;
 
+  auto const_input_mean = ConstPointer{gamma_grad};
+  auto const_input_mean_mem =
+      backend.get_mem_object(const_input_mean, params.channels);
+
   auto gradient_mem = backend.get_mem_object(gradient, n_items);
   auto workspace_mem = backend.get_mem_object(workspace, n_items);
 
-  status =
+  status.append(
       sycldnn::binaryop::internal::launch_binaryop<T, sycldnn::binaryop::Sub>(
           input_mem, const_input_mean_mem, workspace_mem, params.channels,
-          queue);  // x_offset
+          queue));  // x_offset
 
   if (sycldnn::StatusCode::OK != status.status) return status;
 
-  status.event = backend.template reduce<reduce::Mean>(
+  status.append(backend.template reduce<reduce::Mean>(
       gradient, gamma_grad, 1, params.batch * params.rows * params.cols,
-      params.channels);  // mean_grad_y
+      params.channels));  // mean_grad_y
 
   auto const_gradient_mean = ConstPointer{gamma_grad};
   auto const_gradient_mean_mem =
       backend.get_mem_object(const_gradient_mean, params.channels);
   auto output_mem = backend.get_mem_object(output, n_items);
 
-  status =
+  status.append(
       sycldnn::binaryop::internal::launch_binaryop<T, sycldnn::binaryop::Sub>(
           gradient_mem, const_gradient_mean_mem, output_mem, params.channels,
-          queue);  // grad_y_offset
+          queue));  // grad_y_offset
 
   if (sycldnn::StatusCode::OK != status.status) return status;
 
@@ -216,17 +233,17 @@ SNNStatus launch_grad(typename Backend::template pointer_type<T const> input,
   auto secondary_workspace_mem =
       backend.get_mem_object(secondary_workspace, n_items);
 
-  status =
+  status.append(
       sycldnn::binaryop::internal::launch_binaryop<T, sycldnn::binaryop::Mul>(
           gradient_mem, const_workspace_mem, secondary_workspace_mem, n_items,
-          queue);  // mean pt 1
+          queue));  // mean pt 1
 
   if (sycldnn::StatusCode::OK != status.status) return status;
 
   auto const_secondary_workspace = ConstPointer{secondary_workspace};
-  status.event = backend.template reduce<reduce::Mean>(
+  status.append(backend.template reduce<reduce::Mean>(
       const_secondary_workspace, gamma_grad, 1,
-      params.batch * params.rows * params.cols, params.channels);  // mean pt 2
+      params.batch * params.rows * params.cols, params.channels));  // mean pt 2
 
   auto const_input_variance = ConstPointer{beta_grad};
   auto const_input_variance_mem =
@@ -237,28 +254,28 @@ SNNStatus launch_grad(typename Backend::template pointer_type<T const> input,
 
   auto gamma_mem = backend.get_mem_object(gamma, params.channels);
 
-  status = launch_input_gradient(
+  status.append(launch_input_gradient(
       gamma_mem, const_input_variance_mem, const_mean_mem, const_workspace_mem,
-      output_mem, params.channels, params.epsilon, queue);  // grad_x
+      output_mem, params.channels, params.epsilon, queue));  // grad_x
 
   if (sycldnn::StatusCode::OK != status.status) return status;
 
-  status.event = backend.template reduce<reduce::Add>(
+  status.append(backend.template reduce<reduce::Add>(
       const_secondary_workspace, workspace, 1,
       params.batch * params.rows * params.cols,
-      params.channels);  // grad_scale pt 1
+      params.channels));  // grad_scale pt 1
 
   auto gamma_grad_mem = backend.get_mem_object(gamma_grad, params.channels);
 
-  status = launch_gamma_gradient(const_input_variance_mem, const_workspace_mem,
-                                 gamma_grad_mem, params.channels,
-                                 params.epsilon, queue);  // grad_scale pt 2
+  status.append(launch_gamma_gradient(
+      const_input_variance_mem, const_workspace_mem, gamma_grad_mem,
+      params.channels, params.epsilon, queue));  // grad_scale pt 2
 
   if (sycldnn::StatusCode::OK != status.status) return status;
 
-  status.event = backend.template reduce<reduce::Add>(
+  status.append(backend.template reduce<reduce::Add>(
       gradient, beta_grad, 1, params.batch * params.rows * params.cols,
-      params.channels);  // grad_offset
+      params.channels));  // grad_offset
   return status;
 }
 
@@ -297,22 +314,22 @@ SNNStatus launch_grad(
   if (sycldnn::StatusCode::OK != status.status) return status;
 
   using ConstPointer = typename Backend::template pointer_type<T const>;
-  status.event = backend.template reduce<reduce::Add>(
+  status.append(backend.template reduce<reduce::Add>(
       ConstPointer{output}, gamma_grad, 1,
       params.batch * params.rows * params.cols,
-      params.channels);  // grad_scale pt 2
+      params.channels));  // grad_scale pt 2
 
   auto gamma_mem = backend.get_mem_object(gamma, params.channels);
 
-  status =
-      launch_input_gradient(gradient_mem, gamma_mem, variance_mem, output_mem,
-                            params.channels, params.epsilon, queue);  // grad_x
+  status.append(launch_input_gradient(gradient_mem, gamma_mem, variance_mem,
+                                      output_mem, params.channels,
+                                      params.epsilon, queue));  // grad_x
 
   if (sycldnn::StatusCode::OK != status.status) return status;
 
-  status.event = backend.template reduce<reduce::Add>(
+  status.append(backend.template reduce<reduce::Add>(
       gradient, beta_grad, 1, params.batch * params.rows * params.cols,
-      params.channels);  // grad_offset
+      params.channels));  // grad_offset
 
   return status;
 }
@@ -21,6 +21,8 @@
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
+#include "sycldnn/internal/conv2d/epilogue.h"
+
 #include "sycldnn/export.h"
 
 namespace sycldnn {
@@ -29,6 +31,9 @@ namespace internal {
 /**
  * The internal direct convolution launcher.
  *
+ * The epilogue is applied by the forward kernels before storing each output,
+ * and is ignored by the backprop kernels.
+ *
  * Implemented in the compiled SYCL DNN library.
  */
 template <typename T, typename ConvType>
@@ -36,6 +41,7 @@ SNN_EXPORT SNNStatus launch_direct(BaseMemObject<T const>& input,
                                    BaseMemObject<T const>& filter,
                                    BaseMemObject<T>& output,
                                    Conv2DParams const& params,
+                                   EpilogueMem<T> const& epilogue,
                                    cl::sycl::queue& queue);
 }  // namespace internal
 }  // namespace conv2d
@@ -0,0 +1,182 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_CONV2D_EPILOGUE_H_
+#define SYCLDNN_INCLUDE_INTERNAL_CONV2D_EPILOGUE_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/epilogue_params.h"
+#include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/internal/helpers/internal_pointer.h"
+
+#include <stddef.h>
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/export.h"
+
+/**
+ * \file
+ * Contains the sycldnn::conv2d::internal::EpilogueArgs struct used to pass the
+ * tensors of a fused convolution epilogue through the convolution launchers,
+ * along with sycldnn::conv2d::internal::launch_epilogue() which applies an
+ * epilogue to an existing convolution output.
+ */
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * The epilogue parameters along with the bias and residual tensors.
+ *
+ * The pointers are always valid, even when the corresponding term is disabled
+ * in the parameters, so that kernels can always bind them. The conv2d launcher
+ * uses the input tensor in place of any disabled term.
+ */
+template <typename ConstPointer>
+struct EpilogueArgs {
+  /** The operations to apply in the epilogue. */
+  EpilogueParams params;
+  /** The per-feature bias tensor. */
+  ConstPointer bias;
+  /** The residual tensor, with the same shape as the output. */
+  ConstPointer residual;
+};
+
+/**
+ * Get epilogue arguments which leave the convolution output unchanged, using
+ * the input tensor in place of the bias and residual tensors.
+ */
+template <typename ConstPointer>
+EpilogueArgs<ConstPointer> no_epilogue(ConstPointer input) {
+  return {EpilogueParams{}, input, input};
+}
+
+/** Epilogue arguments holding the user provided backend pointers. */
+template <typename T, typename Backend>
+using EpiloguePointers =
+    EpilogueArgs<typename Backend::template pointer_type<T const>>;
+
+/** Epilogue arguments holding the backend's internal pointers. */
+template <typename T, typename Backend>
+using InternalEpiloguePointers =
+    EpilogueArgs<typename Backend::template internal_pointer_type<T const>>;
+
+/**
+ * Set of internal epilogue pointers constructed from external pointers.
+ *
+ * The internal pointers will be released through the backend on destruction.
+ */
+template <typename T, typename Backend>
+struct InternalEpilogueSet {
+  using ConstInternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T const, Backend>;
+
+  InternalEpilogueSet(EpiloguePointers<T, Backend> const& epilogue,
+                      Backend& backend)
+      : params{epilogue.params},
+        bias{epilogue.bias, backend},
+        residual{epilogue.residual, backend} {}
+
+  /** Get the epilogue arguments holding the internal pointers. */
+  InternalEpiloguePointers<T, Backend> get() const {
+    return {params, bias.get(), residual.get()};
+  }
+
+  EpilogueParams params;
+  ConstInternalPointer bias;
+  ConstInternalPointer residual;
+};
+
+/** Epilogue arguments holding the memory objects used by the kernels. */
+template <typename T>
+using EpilogueMem = EpilogueArgs<BaseMemObject<T const>*>;
+
+/**
+ * Get the number of elements to access in the epilogue bias tensor. A single
+ * element is accessed if the bias is disabled, as the tensor is not read.
+ */
+inline size_t epilogue_bias_size(EpilogueParams const& epilogue,
+                                 Conv2DParams const& params) {
+  return epilogue.bias ? params.features : 1;
+}
+
+/**
+ * Get the number of elements to access in the epilogue residual tensor. A
+ * single element is accessed if the residual is disabled, as the tensor is not
+ * read.
+ */
+inline size_t epilogue_residual_size(EpilogueParams const& epilogue,
+                                     Conv2DParams const& params) {
+  return epilogue.residual ? static_cast<size_t>(params.batch) *
+                                 params.out_rows * params.out_cols *
+                                 params.features
+                           : 1;
+}
+
+/**
+ * Apply an epilogue to the output of a forward convolution in a separate
+ * kernel. Used by the algorithms whose final store is done by a matrix
+ * multiply, so cannot apply the epilogue themselves.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ *
+ * \param epilogue The epilogue parameters and tensors.
+ * \param output   The convolution output, which is updated in place.
+ * \param params   The convolution parameters.
+ * \param queue    SYCL queue to enqueue the kernel to.
+ * \return An SNNStatus containing the event tied to the kernel.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_epilogue(EpilogueMem<T> const& epilogue,
+                                     BaseMemObject<T>& output,
+                                     Conv2DParams const& params,
+                                     cl::sycl::queue& queue);
+
+/**
+ * Extract the buffers from the backend and apply an epilogue to the output of
+ * a forward convolution.
+ *
+ * \param epilogue The epilogue parameters and tensors.
+ * \param output   The convolution output, which is updated in place.
+ * \param params   The convolution parameters.
+ * \param backend  Backend to provide SYCL buffers from the pointers.
+ * \return An SNNStatus containing the event tied to the kernel.
+ */
+template <typename T, typename Backend>
+SNNStatus launch_epilogue(EpiloguePointers<T, Backend> const& epilogue,
+                          typename Backend::template pointer_type<T> output,
+                          Conv2DParams const& params, Backend& backend) {
+  auto bias_access = backend.get_mem_object(
+      epilogue.bias, epilogue_bias_size(epilogue.params, params));
+  auto res_access = backend.get_mem_object(
+      epilogue.residual, epilogue_residual_size(epilogue.params, params));
+  size_t const output_size = static_cast<size_t>(params.batch) *
+                             params.out_rows * params.out_cols *
+                             params.features;
+  auto out_access = backend.get_mem_object(output, output_size);
+
+  EpilogueMem<T> epilogue_mem{epilogue.params, &bias_access, &res_access};
+  cl::sycl::queue queue = backend.get_queue();
+  return launch_epilogue<T>(epilogue_mem, out_access, params, queue);
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_INTERNAL_CONV2D_EPILOGUE_H_
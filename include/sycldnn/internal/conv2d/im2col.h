@@ -17,6 +17,8 @@
 #define SYCLDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_H_
 
 #include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/data_format.h"
 #include "sycldnn/helpers/macros.h"
 #include "sycldnn/status.h"
 
@@ -33,6 +35,13 @@
 #include "sycldnn/internal/conv2d/im2col/tile_info.h"
 #include "sycldnn/internal/conv2d/im2col/workspace_pointer_set.h"
 
+#include "sycldnn/internal/helpers/allocated_pointer.h"
+#include "sycldnn/internal/helpers/internal_pointer.h"
+
+#include "sycldnn/internal/transpose/launch.h"
+
+#include <type_traits>
+
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
@@ -63,6 +72,24 @@ static SNNStatus launch_im2col_for_minibatch(
   }
   int const n_tiles = params.batch * tile_info.number;
   int const tile_size = tile_info.size;
+  if (params.input_format == DataFormat::NCHW) {
+    // The images are the outermost dimension of both the tiles and the NCHW
+    // output, so compute the [matmul_size x tiles] output of each image by
+    // multiplying the filter with that image's tiles.
+    size_t const image_tiles_size =
+        static_cast<size_t>(tile_info.number) * tile_size;
+    size_t const image_output_size =
+        static_cast<size_t>(tile_info.number) * matmul_size;
+    cl::sycl::event event;
+    for (int i = 0; i < params.batch; ++i) {
+      event = backend.template matmul<false, true>(
+          ConstPointer{pointers.filter},
+          ConstPointer{pointers.transform + i * image_tiles_size},
+          pointers.output + out_offset + i * image_output_size,
+          static_cast<T>(0), matmul_size, tile_size, tile_info.number);
+    }
+    return {event, StatusCode::OK};
+  }
   auto event = backend.template matmul<false, false>(
       ConstPointer{pointers.transform}, ConstPointer{pointers.filter},
       pointers.output + out_offset, static_cast<T>(0), n_tiles, tile_size,
@@ -90,9 +117,26 @@ static SNNStatus launch_im2col_for_minibatch(
     return status;
   }
 
+  cl::sycl::event matmul_event;
+  if (params.input_format == DataFormat::NCHW) {
+    // The NCHW tiles are the forward tiles of each image, so accumulate the
+    // product of each image's output backprop with its tiles.
+    size_t const image_tiles_size =
+        static_cast<size_t>(tile_info.number) * tile_info.size;
+    size_t const image_filter_size =
+        static_cast<size_t>(tile_info.number) * params.features;
+    for (int i = 0; i < params.batch; ++i) {
+      T const beta = (in_offset == 0 && i == 0) ? 0 : 1;
+      matmul_event = backend.template matmul<false, false>(
+          pointers.filter + out_offset + i * image_filter_size,
+          ConstPointer{pointers.transform + i * image_tiles_size},
+          pointers.output, beta, params.features, tile_info.number,
+          tile_info.size);
+    }
+    return {matmul_event, StatusCode::OK};
+  }
   const int n_tiles = tile_info.number;
   const int tile_size = params.batch * tile_info.size;
-  cl::sycl::event matmul_event;
   if (in_offset == 0) {
     matmul_event = backend.template matmul<false, false>(
         ConstPointer{pointers.transform}, pointers.filter + out_offset,
@@ -107,16 +151,15 @@ static SNNStatus launch_im2col_for_minibatch(
   return {matmul_event, StatusCode::OK};
 }
 
-/** Loop over the minibatches to compute im2col. */
+/**
+ * Loop over the minibatches to compute im2col, where any filter transform has
+ * already been computed.
+ */
 template <typename T, typename ConvType, typename Backend>
-static SNNStatus launch_im2col_for_all_minibatches(
+static SNNStatus launch_im2col_with_filter_transform(
     FullPointerSet<T, Backend, ConvType> const& pointers,
     TileInfo const& tile_info, BatchInfo const& batch_info,
     Conv2DParams const& params, Backend& backend) {
-  auto filter_status = launch_filter_transform(pointers, params, backend);
-  if (filter_status.status != StatusCode::OK) {
-    return filter_status;
-  }
   auto kernel_params = get_kernel_params<ConvType>(params);
   kernel_params.batch = batch_info.images_per_batch;
   cl::sycl::event event;
@@ -136,6 +179,20 @@ static SNNStatus launch_im2col_for_all_minibatches(
   return SNNStatus{event, StatusCode::OK};
 }
 
+/** Loop over the minibatches to compute im2col. */
+template <typename T, typename ConvType, typename Backend>
+static SNNStatus launch_im2col_for_all_minibatches(
+    FullPointerSet<T, Backend, ConvType> const& pointers,
+    TileInfo const& tile_info, BatchInfo const& batch_info,
+    Conv2DParams const& params, Backend& backend) {
+  auto filter_status = launch_filter_transform(pointers, params, backend);
+  if (filter_status.status != StatusCode::OK) {
+    return filter_status;
+  }
+  return launch_im2col_with_filter_transform(pointers, tile_info, batch_info,
+                                             params, backend);
+}
+
 /**
  * Split the input tensor into minibatches to ensure that the temporary
  * transform buffer can be safely allocated and create SYCL buffers using the
@@ -190,8 +247,310 @@ SNNStatus launch_im2col_with_workspace(
       backend);
 }
 
+/**
+ * Get the number of elements required to hold the im2col filter transform.
+ *
+ * Only the input backprop transforms the filter, so this is zero for the
+ * forward and filter backprop passes.
+ */
+template <typename ConvType>
+size_t filter_transform_size(Conv2DParams const& params) {
+  if (!std::is_same<ConvType, conv_type::InputBackprop>::value) {
+    return 0;
+  }
+  return params.window_rows * params.window_cols * params.channels *
+         params.features;
+}
+
+/**
+ * Mirror the filter for the input backprop into a user provided buffer, so
+ * that it can be reused by launch_im2col_pretransformed().
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              std::is_same<ConvType, conv_type::InputBackprop>::value,
+              int>::type = 0>
+SNNStatus transform_filter(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> transform,
+    Conv2DParams const& params, Backend& backend) {
+  using ConstInternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T const, Backend>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  size_t const filter_size = filter_transform_size<ConvType>(params);
+  ConstInternalPointer filter_ptr{filter, backend};
+  InternalPointer transform_ptr{transform, backend};
+  auto filter_access =
+      backend.get_mem_object_internal(filter_ptr.get(), filter_size);
+  auto transform_access =
+      backend.get_mem_object_internal(transform_ptr.get(), filter_size);
+
+  cl::sycl::queue queue = backend.get_queue();
+  return launch_filter_transform(filter_access, transform_access, params,
+                                 queue);
+}
+
+/**
+ * The forward and filter backprop passes use the filter directly, so there is
+ * no filter transform to compute.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::InputBackprop>::value,
+              int>::type = 0>
+SNNStatus transform_filter(
+    typename Backend::template pointer_type<T const> /*filter*/,
+    typename Backend::template pointer_type<T> /*transform*/,
+    Conv2DParams const& /*params*/, Backend& /*backend*/) {
+  return StatusCode::InvalidAlgorithm;
+}
+
+/**
+ * Rearrange the filter of a grouped forward convolution from HWCF, where the
+ * features of every group are interleaved in each row, so that the filter
+ * matrix for each group is contiguous.
+ */
+template <typename T, typename Backend>
+SNNStatus launch_grouped_filter_transform(
+    typename Backend::template internal_pointer_type<T const> filter,
+    typename Backend::template internal_pointer_type<T> transform,
+    Conv2DParams const& params, Backend& backend) {
+  size_t const filter_size = get_grouped_filter_size(params);
+  auto filter_acc = backend.get_mem_object_internal(filter, filter_size);
+  auto transform_acc = backend.get_mem_object_internal(transform, filter_size);
+
+  int const group_features = params.features / params.groups;
+  int const tile_size = get_tile_info<conv_type::Forward>(params).size;
+  cl::sycl::queue queue = backend.get_queue();
+  return ::sycldnn::transpose::internal::launch<T>(
+      filter_acc, transform_acc, {tile_size, params.groups, group_features},
+      {1, 0, 2}, queue);
+}
+
+/**
+ * Launch the input transform, batched matmul and output transpose to compute a
+ * minibatch of a grouped forward convolution.
+ *
+ * The input transform writes the tiles for each group as a separate matrix, so
+ * the matrix multiplies for all groups are computed by one batched matrix
+ * multiply. This gives the output with the groups as the outermost dimension,
+ * which is then transposed into the output tensor.
+ */
+template <typename T, typename Backend>
+SNNStatus launch_grouped_im2col_for_minibatch(
+    typename Backend::template internal_pointer_type<T const> input,
+    typename Backend::template internal_pointer_type<T const> filter,
+    typename Backend::template internal_pointer_type<T> transform,
+    typename Backend::template internal_pointer_type<T> output,
+    TileInfo const& tile_info, Conv2DParams const& params, Backend& backend) {
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  int const n_tiles = params.batch * tile_info.number;
+  int const tile_size = tile_info.size;
+  int const group_features = params.features / params.groups;
+  size_t const tiles_size =
+      static_cast<size_t>(params.groups) * n_tiles * tile_size;
+  size_t const output_size = static_cast<size_t>(n_tiles) * params.features;
+  auto matmul_output = transform + tiles_size;
+
+  cl::sycl::queue queue = backend.get_queue();
+  auto input_acc = backend.get_mem_object_internal(
+      input, get_sizes<conv_type::Forward>(params).input_size);
+  auto transform_acc = backend.get_mem_object_internal(transform, tiles_size);
+  auto status = launch_input_transform<T, conv_type::Forward>(
+      input_acc, transform_acc, params, params.groups * n_tiles, tile_size,
+      queue);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+
+  backend.template batch_matmul<false, false, T>(
+      ConstPointer{transform}, filter, matmul_output, params.groups, n_tiles,
+      tile_size, group_features);
+
+  auto matmul_acc =
+      backend.get_mem_object_internal(ConstPointer{matmul_output}, output_size);
+  auto output_acc = backend.get_mem_object_internal(output, output_size);
+  return ::sycldnn::transpose::internal::launch<T>(
+      matmul_acc, output_acc, {params.groups, n_tiles, group_features},
+      {1, 0, 2}, queue);
+}
+
+/**
+ * Compute a grouped forward convolution using im2col.
+ *
+ * The rearranged filter is stored at the start of the workspace, followed by
+ * the transform buffer used for each minibatch. If no workspace is provided
+ * then these are allocated through the backend.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              std::is_same<ConvType, conv_type::Forward>::value,
+              int>::type = 0>
+SNNStatus launch_grouped_im2col(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+  using AllocatedPointer =
+      ::sycldnn::internal::helpers::AllocatedPointer<T, Backend>;
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  using Pointer = typename Backend::template internal_pointer_type<T>;
+
+  InternalPointerSet<T, Backend> pointers{input, filter, output, backend};
+  auto const tile_info = get_tile_info<ConvType>(params);
+  size_t const filter_size = get_grouped_filter_size(params);
+  size_t const size_per_image = get_grouped_size_per_image(params);
+
+  auto launch_with_transforms = [&](Pointer filter_transform,
+                                    Pointer transform,
+                                    BatchInfo const& batch_info) -> SNNStatus {
+    auto status = launch_grouped_filter_transform<T>(
+        pointers.filter.get(), filter_transform, params, backend);
+    if (status.status != StatusCode::OK) {
+      return status;
+    }
+    Conv2DParams kernel_params{params};
+    kernel_params.batch = batch_info.images_per_batch;
+    for (size_t i = 0; i < batch_info.n_batches; ++i) {
+      auto offset =
+          calculate_offsets<ConvType>(i, batch_info.images_per_batch, params);
+      if (i == batch_info.n_batches - 1) {
+        kernel_params.batch = batch_info.last_batch_size;
+      }
+      status = launch_grouped_im2col_for_minibatch<T>(
+          pointers.input.get() + offset.in, ConstPointer{filter_transform},
+          transform, pointers.output.get() + offset.out, tile_info,
+          kernel_params, backend);
+      if (status.status != StatusCode::OK) {
+        return status;
+      }
+    }
+    return status;
+  };
+
+  if (workspace_size == 0) {
+    auto const alloc_info = get_alloc_info(backend.get_queue().get_device(),
+                                           params.batch,
+                                           size_per_image * sizeof(T));
+    size_t const transform_size = size_per_image * alloc_info.images_per_alloc;
+    AllocatedPointer filter_transform{sizeof(T) * filter_size, backend};
+    AllocatedPointer transform{sizeof(T) * transform_size, backend};
+    auto const batch_info =
+        get_batch_info(transform_size, params.batch, size_per_image);
+    return launch_with_transforms(filter_transform.get(), transform.get(),
+                                  batch_info);
+  }
+  SNN_VALIDATE_PARAM(workspace_size >= filter_size + size_per_image,
+                     "The workspace is too small to hold the grouped im2col "
+                     "filter and transforms for a single image.");
+  InternalPointer workspace_ptr{workspace, backend};
+  auto const batch_info = get_batch_info(
+      (workspace_size - filter_size) / size_per_image, params.batch);
+  return launch_with_transforms(workspace_ptr.get(),
+                                workspace_ptr.get() + filter_size, batch_info);
+}
+
+/** Only the forward pass supports grouped convolutions in im2col. */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::Forward>::value,
+              int>::type = 0>
+SNNStatus launch_grouped_im2col(
+    typename Backend::template pointer_type<T const> /*input*/,
+    typename Backend::template pointer_type<T const> /*filter*/,
+    typename Backend::template pointer_type<T> /*output*/,
+    typename Backend::template pointer_type<T> /*workspace*/,
+    Conv2DParams const& /*params*/, size_t /*workspace_size*/,
+    Backend& /*backend*/) {
+  return StatusCode::InvalidAlgorithm;
+}
+
 }  // namespace im2col
 
+/**
+ * Launch an im2col input backprop using a filter which has already been
+ * mirrored by im2col::transform_filter(). Any temporary buffer for the input
+ * transform is either allocated through the backend or taken from the user
+ * provided workspace.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              std::is_same<ConvType, conv_type::InputBackprop>::value,
+              int>::type = 0>
+SNNStatus launch_im2col_pretransformed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T> filter_transform,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+  using ConstInternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T const, Backend>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  using AllocatedPointer =
+      ::sycldnn::internal::helpers::AllocatedPointer<T, Backend>;
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  using Pointer = typename Backend::template internal_pointer_type<T>;
+
+  ConstInternalPointer input_ptr{input, backend};
+  InternalPointer filter_ptr{filter_transform, backend};
+  InternalPointer output_ptr{output, backend};
+
+  auto const tile_info = im2col::get_tile_info<ConvType>(params);
+  size_t const size_per_image = tile_info.number * tile_info.size;
+  auto launch_with_transform = [&](Pointer transform,
+                                   BatchInfo const& batch_info) {
+    im2col::FullPointerSet<T, Backend, ConvType> pointers{
+        input_ptr.get(), ConstPointer{filter_ptr.get()}, filter_ptr.get(),
+        transform, output_ptr.get()};
+    return im2col::launch_im2col_with_filter_transform(
+        pointers, tile_info, batch_info, params, backend);
+  };
+
+  if (workspace_size == 0) {
+    auto const alloc_info = get_alloc_info(backend.get_queue().get_device(),
+                                           params.batch,
+                                           size_per_image * sizeof(T));
+    size_t const transform_size = size_per_image * alloc_info.images_per_alloc;
+    AllocatedPointer transform{sizeof(T) * transform_size, backend};
+    auto const batch_info =
+        get_batch_info(transform_size, params.batch, size_per_image);
+    return launch_with_transform(transform.get(), batch_info);
+  }
+  SNN_VALIDATE_PARAM(workspace_size >= size_per_image,
+                     "The workspace is too small to hold the im2col transform "
+                     "for a single image.");
+  InternalPointer transform{workspace, backend};
+  auto const batch_info =
+      get_batch_info(workspace_size / size_per_image, params.batch);
+  return launch_with_transform(transform.get(), batch_info);
+}
+
+/**
+ * The forward and filter backprop passes do not transform the filter, so
+ * cannot be launched with a pre-transformed filter.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::InputBackprop>::value,
+              int>::type = 0>
+SNNStatus launch_im2col_pretransformed(
+    typename Backend::template pointer_type<T const> /*input*/,
+    typename Backend::template pointer_type<T> /*filter_transform*/,
+    typename Backend::template pointer_type<T> /*output*/,
+    typename Backend::template pointer_type<T> /*workspace*/,
+    Conv2DParams const& /*params*/, size_t /*workspace_size*/,
+    Backend& /*backend*/) {
+  return StatusCode::InvalidAlgorithm;
+}
+
 /**
  * The internal im2col convolution launcher.
  *
@@ -205,6 +564,13 @@ SNNStatus launch_im2col(typename Backend::template pointer_type<T const> input,
                         typename Backend::template pointer_type<T> workspace,
                         Conv2DParams const& params, size_t workspace_size,
                         Backend& backend) {
+  if (params.groups > 1) {
+    if (params.input_format == DataFormat::NCHW) {
+      return StatusCode::InvalidAlgorithm;
+    }
+    return im2col::launch_grouped_im2col<T, ConvType>(
+        input, filter, output, workspace, params, workspace_size, backend);
+  }
   if (workspace_size == 0) {
     return im2col::allocate_and_launch_im2col<T, ConvType>(
         input, filter, output, params, backend);
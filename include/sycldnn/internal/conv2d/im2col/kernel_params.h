@@ -16,6 +16,8 @@
 #ifndef SYCLDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_KERNEL_PARAMS_H_
 #define SYCLDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_KERNEL_PARAMS_H_
 
+#include "sycldnn/data_format.h"
+
 #include "sycldnn/conv2d/params.h"
 
 namespace sycldnn {
@@ -37,6 +39,11 @@ inline Conv2DParams get_kernel_params(Conv2DParams params) {
 template <>
 inline Conv2DParams get_kernel_params<conv_type::FilterBackprop>(
     Conv2DParams params) {
+  // The NCHW filter backprop extracts the forward tiles from the input, so
+  // uses the user provided parameters.
+  if (params.input_format == DataFormat::NCHW) {
+    return params;
+  }
   std::swap(params.out_rows, params.window_rows);
   std::swap(params.out_cols, params.window_cols);
   std::swap(params.stride_rows, params.dilation_rows);
@@ -16,6 +16,7 @@
 #ifndef SYCLDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_LAUNCH_FILTER_TRANSFORM_H_
 #define SYCLDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_LAUNCH_FILTER_TRANSFORM_H_
 
+#include "sycldnn/data_format.h"
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
@@ -23,6 +24,8 @@
 
 #include "sycldnn/internal/conv2d/im2col/full_pointer_set.h"
 
+#include "sycldnn/internal/transpose/launch.h"
+
 #include "sycldnn/export.h"
 
 namespace sycldnn {
@@ -83,6 +86,14 @@ static SNNStatus launch_filter_transform(
       backend.get_mem_object_internal(pointers.filter, filter_size);
 
   cl::sycl::queue queue = backend.get_queue();
+  if (params.input_format == DataFormat::NCHW) {
+    // The NCHW tiles are not mirrored, so the filter only needs transposing
+    // from FCHW to CFHW to give a [channels x tile_size] matrix.
+    int const window_size = params.window_rows * params.window_cols;
+    return ::sycldnn::transpose::internal::launch<T>(
+        filter_access, transform_access,
+        {params.features, params.channels, window_size}, {1, 0, 2}, queue);
+  }
   return launch_filter_transform(filter_access, transform_access, params,
                                  queue);
 }
@@ -65,7 +65,8 @@ static SNNStatus launch_input_transform(
 
   int n_tiles;
   int tile_size;
-  if (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+  if (std::is_same<ConvType, conv_type::FilterBackprop>::value &&
+      params.input_format == DataFormat::NHWC) {
     n_tiles = tile_info.number;
     tile_size = params.batch * tile_info.size;
   } else {
@@ -16,9 +16,13 @@
 #ifndef SYCLDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_TILE_INFO_H_
 #define SYCLDNN_INCLUDE_INTERNAL_CONV2D_IM2COL_TILE_INFO_H_
 
+#include "sycldnn/data_format.h"
+
 #include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
 
+#include <stddef.h>
+
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
@@ -32,6 +36,25 @@ struct TileInfo {
   int size;
 };
 
+/**
+ * The convolution type whose input tiles are extracted for an NCHW
+ * convolution.
+ *
+ * The NCHW filter backprop multiplies the output backprop by the same tiles as
+ * are used in the forward pass, so no separate filter backprop tiles are
+ * needed.
+ */
+template <typename ConvType>
+struct NCHWTileType {
+  /** The convolution type of the extracted tiles. */
+  using type = ConvType;
+};
+template <>
+struct NCHWTileType<conv_type::FilterBackprop> {
+  /** The convolution type of the extracted tiles. */
+  using type = conv_type::Forward;
+};
+
 /**
  * Get info about the tile sizes used by im2col for a single image.
  *
@@ -39,6 +62,12 @@ struct TileInfo {
  * tile. These tiles then make up one of the matrices which are used in the
  * im2col matrix multiply.
  *
+ * In a grouped forward convolution each tile only covers the channels in one
+ * group, and every image needs this number of tiles for each group.
+ *
+ * For NCHW tensors each tile holds the window in CHW order, to match the layout
+ * of the FCHW filter, and the filter backprop uses the forward tiles.
+ *
  * \param params User provided conv2d parameters
  * \return A TileInfo struct containing the number of size of im2col tiles
  */
@@ -47,8 +76,8 @@ inline TileInfo get_tile_info(Conv2DParams const& params);
 template <>
 inline TileInfo get_tile_info<conv_type::Forward>(Conv2DParams const& params) {
   const int n_tiles = params.out_rows * params.out_cols;
-  const int tile_size =
-      params.window_rows * params.window_cols * params.channels;
+  const int tile_size = params.window_rows * params.window_cols *
+                        params.channels / params.groups;
   return TileInfo{n_tiles, tile_size};
 }
 template <>
@@ -62,10 +91,40 @@ inline TileInfo get_tile_info<conv_type::InputBackprop>(
 template <>
 inline TileInfo get_tile_info<conv_type::FilterBackprop>(
     Conv2DParams const& params) {
+  if (params.input_format == DataFormat::NCHW) {
+    return get_tile_info<conv_type::Forward>(params);
+  }
   const int n_tiles = params.window_rows * params.window_cols * params.channels;
   const int tile_size = params.out_rows * params.out_cols;
   return TileInfo{n_tiles, tile_size};
 }
+
+/**
+ * Get the number of elements of temporary memory needed for each image in a
+ * grouped forward convolution. This holds the tiles for every group followed
+ * by the result of the batched matrix multiply, before it is transposed into
+ * the output tensor.
+ *
+ * \param params User provided conv2d parameters
+ * \return The number of elements needed for each image
+ */
+inline size_t get_grouped_size_per_image(Conv2DParams const& params) {
+  auto const tile_info = get_tile_info<conv_type::Forward>(params);
+  return static_cast<size_t>(tile_info.number) *
+         (tile_info.size * params.groups + params.features);
+}
+
+/**
+ * Get the number of elements needed to hold the filter of a grouped forward
+ * convolution, rearranged so that the filter for each group is contiguous.
+ *
+ * \param params User provided conv2d parameters
+ * \return The number of elements in the rearranged filter
+ */
+inline size_t get_grouped_filter_size(Conv2DParams const& params) {
+  return static_cast<size_t>(params.window_rows) * params.window_cols *
+         params.channels / params.groups * params.features;
+}
 }  // namespace im2col
 }  // namespace internal
 }  // namespace conv2d
@@ -0,0 +1,54 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_CONV2D_QUANTIZED_H_
+#define SYCLDNN_INCLUDE_INTERNAL_CONV2D_QUANTIZED_H_
+
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/helpers/macros.h"
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/quantize/params.h"
+
+#include <cstdint>
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+/**
+ * The internal quantized convolution launcher.
+ *
+ * Computes an int8 forward convolution of NHWC input with an HWCF filter,
+ * accumulating in int32 and requantizing each output feature with its own
+ * scale and zero point.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+SNN_EXPORT SNNStatus launch_quantized(
+    BaseMemObject<int8_t const>& input, BaseMemObject<int8_t const>& filter,
+    BaseMemObject<int32_t const>& bias, BaseMemObject<float const>& scales,
+    BaseMemObject<int32_t const>& zero_points, BaseMemObject<int8_t>& output,
+    Conv2DParams const& params,
+    quantize::RequantizeParams const& requantize_params,
+    cl::sycl::queue& queue);
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_INTERNAL_CONV2D_QUANTIZED_H_
@@ -17,16 +17,40 @@
 #define SYCLDNN_INCLUDE_INTERNAL_CONV2D_TILED_H_
 
 #include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/tiled_config.h"
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
+#include "sycldnn/internal/conv2d/epilogue.h"
+
+#include <vector>
+
 #include "sycldnn/export.h"
 
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
 /**
- * The internal direct convolution launcher.
+ * The internal tiled convolution launcher.
+ *
+ * The epilogue is applied by the forward kernels before storing each output
+ * tile, and is ignored by the input backprop kernels.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T, typename ConvType>
+SNN_EXPORT SNNStatus launch_tiled(BaseMemObject<T const>& input,
+                                  BaseMemObject<T const>& filter,
+                                  BaseMemObject<T>& output,
+                                  Conv2DParams const& params,
+                                  EpilogueMem<T> const& epilogue,
+                                  cl::sycl::queue& queue);
+
+/**
+ * The internal tiled convolution launcher using the specified tile sizes.
+ *
+ * Only the tile sizes returned by get_tiled_configs() are available, any other
+ * configuration will return StatusCode::InvalidAlgorithm.
  *
  * Implemented in the compiled SYCL DNN library.
  */
@@ -35,7 +59,19 @@ SNN_EXPORT SNNStatus launch_tiled(BaseMemObject<T const>& input,
                                   BaseMemObject<T const>& filter,
                                   BaseMemObject<T>& output,
                                   Conv2DParams const& params,
+                                  EpilogueMem<T> const& epilogue,
+                                  TiledConfig const& config,
                                   cl::sycl::queue& queue);
+
+/**
+ * Get the tile configurations compiled into the library which can be used to
+ * compute the convolution specified by the parameters.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename ConvType>
+SNN_EXPORT std::vector<TiledConfig> get_tiled_configs(
+    Conv2DParams const& params);
 }  // namespace internal
 }  // namespace conv2d
 }  // namespace sycldnn
@@ -21,6 +21,7 @@
 #include "sycldnn/conv2d/params.h"
 
 #include "sycldnn/internal/conv2d/batch_info.h"
+#include "sycldnn/internal/conv2d/epilogue.h"
 #include "sycldnn/internal/conv2d/internal_pointer_set.h"
 
 #include "sycldnn/internal/conv2d/winograd/calculate_offsets.h"
@@ -49,39 +50,37 @@ namespace internal {
 namespace winograd {
 
 /**
- * Launch the kernels to compute a convolution over all minibatches.
+ * Launch the input transform, batch matrix multiply and output transform
+ * kernels to compute a convolution over all minibatches, using a filter
+ * transform which has already been computed.
  *
- * \param pointers   Full set of pointers for the convolution
+ * \param pointers   Full set of pointers for the convolution, where the filter
+ *                   transform already holds the transformed filter
  * \param params     Kernel parameters for the convolution
+ * \param epilogue   Epilogue to apply in the output transform
  * \param tile_info  Information about the number of Winograd tiles
  * \param batch_info Information about the minibatch size
  * \param backend    Backend to use for matrix multiplication
- * \return An SNNStatus object containing a SYCL event corresponding to the last
- * kernel launched.
+ * \return An SNNStatus object containing the SYCL events of all the kernels
+ * launched.
  */
 template <
     typename T, int M, int N, int R, int S, typename ConvType, typename Backend,
     typename std::enable_if<
         !std::is_same<ConvType, conv_type::FilterBackprop>::value, int>::type =
         0>
-SNNStatus launch_with_transforms(FullPointerSet<T, Backend> const& pointers,
-                                 Conv2DParams const& params,
-                                 TileInfo const& tile_info,
-                                 BatchInfo const& batch_info,
-                                 Backend& backend) {
+SNNStatus launch_with_filter_transform(
+    FullPointerSet<T, Backend> const& pointers, Conv2DParams const& params,
+    InternalEpiloguePointers<T, Backend> const& epilogue,
+    TileInfo const& tile_info, BatchInfo const& batch_info, Backend& backend) {
   constexpr int A = M + R - 1;
   constexpr int B = N + S - 1;
   constexpr bool transpose_input = false;
   // Need to transpose for the input backprop, but not for the forward pass
   constexpr bool transpose_filter =
       std::is_same<ConvType, conv_type::InputBackprop>::value;
-  auto fil_status = launch_filter_transform<T, ConvType, M, N, R, S>(
-      pointers.filter, pointers.filter_transform, params, tile_info, backend);
-  if (fil_status.status != StatusCode::OK) {
-    return fil_status;
-  }
 
-  cl::sycl::event last_event;
+  SNNStatus status;
   Conv2DParams kernel_params{params};
   kernel_params.batch = batch_info.images_per_batch;
   for (size_t i = 0; i < batch_info.n_batches; ++i) {
@@ -97,21 +96,65 @@ SNNStatus launch_with_transforms(FullPointerSet<T, Backend> const& pointers,
     if (inp_status.status != StatusCode::OK) {
       return inp_status;
     }
-
-    backend.template batch_matmul<transpose_input, transpose_filter, T>(
-        pointers.input_transform, pointers.filter_transform,
-        pointers.intermediate, A * B, tile_info.number * kernel_params.batch,
-        kernel_params.channels, kernel_params.features);
-
+    status.append(inp_status);
+
+    status.append(
+        backend.template batch_matmul<transpose_input, transpose_filter, T>(
+            pointers.input_transform, pointers.filter_transform,
+            pointers.intermediate, A * B,
+            tile_info.number * kernel_params.batch, kernel_params.channels,
+            kernel_params.features));
+
+    // The residual has the same layout as the output, so is offset to the
+    // start of this minibatch.
+    auto batch_epilogue = epilogue;
+    if (epilogue.params.residual) {
+      batch_epilogue.residual = epilogue.residual + offset.out;
+    }
     auto out_status = launch_output_transform<T, ConvType, M, N, R, S>(
         pointers.intermediate, pointers.output + offset.out, kernel_params,
-        tile_info, backend);
+        batch_epilogue, tile_info, backend);
     if (out_status.status != StatusCode::OK) {
       return out_status;
     }
-    last_event = out_status.event;
+    status.append(out_status);
+  }
+  return status;
+}
+
+/**
+ * Launch the kernels to compute a convolution over all minibatches.
+ *
+ * \param pointers   Full set of pointers for the convolution
+ * \param params     Kernel parameters for the convolution
+ * \param epilogue   Epilogue to apply in the output transform, ignored for
+ *                   filter backprop convolutions
+ * \param tile_info  Information about the number of Winograd tiles
+ * \param batch_info Information about the minibatch size
+ * \param backend    Backend to use for matrix multiplication
+ * \return An SNNStatus object containing the SYCL events of all the kernels
+ * launched.
+ */
+template <
+    typename T, int M, int N, int R, int S, typename ConvType, typename Backend,
+    typename std::enable_if<
+        !std::is_same<ConvType, conv_type::FilterBackprop>::value, int>::type =
+        0>
+SNNStatus launch_with_transforms(
+    FullPointerSet<T, Backend> const& pointers, Conv2DParams const& params,
+    InternalEpiloguePointers<T, Backend> const& epilogue,
+    TileInfo const& tile_info, BatchInfo const& batch_info, Backend& backend) {
+  auto fil_status = launch_filter_transform<T, ConvType, M, N, R, S>(
+      pointers.filter, pointers.filter_transform, params, tile_info, backend);
+  if (fil_status.status != StatusCode::OK) {
+    return fil_status;
+  }
+  auto status = launch_with_filter_transform<T, M, N, R, S, ConvType>(
+      pointers, params, epilogue, tile_info, batch_info, backend);
+  if (status.status != StatusCode::OK) {
+    return status;
   }
-  return SNNStatus{last_event, StatusCode::OK};
+  return fil_status.append(status);
 }
 
 /** \copydoc launch_with_transforms() */
@@ -120,11 +163,10 @@ template <
     typename std::enable_if<
         std::is_same<ConvType, conv_type::FilterBackprop>::value, int>::type =
         0>
-SNNStatus launch_with_transforms(FullPointerSet<T, Backend> pointers,
-                                 Conv2DParams const& params,
-                                 TileInfo const& tile_info,
-                                 BatchInfo const& batch_info,
-                                 Backend& backend) {
+SNNStatus launch_with_transforms(
+    FullPointerSet<T, Backend> pointers, Conv2DParams const& params,
+    InternalEpiloguePointers<T, Backend> const& /*epilogue*/,
+    TileInfo const& tile_info, BatchInfo const& batch_info, Backend& backend) {
   constexpr int A = M + R - 1;
   constexpr int B = N + S - 1;
   constexpr bool transpose_input = true;
@@ -136,7 +178,7 @@ SNNStatus launch_with_transforms(FullPointerSet<T, Backend> pointers,
   // filter.
   std::swap(pointers.filter_transform, pointers.intermediate);
 
-  cl::sycl::event last_event;
+  SNNStatus status;
   Conv2DParams kernel_params{params};
   kernel_params.batch = batch_info.images_per_batch;
   for (size_t i = 0; i < batch_info.n_batches; ++i) {
@@ -152,6 +194,7 @@ SNNStatus launch_with_transforms(FullPointerSet<T, Backend> pointers,
     if (inp_status.status != StatusCode::OK) {
       return inp_status;
     }
+    status.append(inp_status);
 
     auto fil_status = launch_filter_transform_filter_backprop<T, M, N, R, S>(
         pointers.filter + offset.out, pointers.filter_transform, kernel_params,
@@ -159,11 +202,13 @@ SNNStatus launch_with_transforms(FullPointerSet<T, Backend> pointers,
     if (fil_status.status != StatusCode::OK) {
       return fil_status;
     }
+    status.append(fil_status);
 
-    backend.template batch_matmul<transpose_input, transpose_filter, T>(
-        pointers.input_transform, pointers.filter_transform,
-        pointers.intermediate, A * B, kernel_params.channels,
-        tile_info.number * kernel_params.batch, kernel_params.features);
+    status.append(
+        backend.template batch_matmul<transpose_input, transpose_filter, T>(
+            pointers.input_transform, pointers.filter_transform,
+            pointers.intermediate, A * B, kernel_params.channels,
+            tile_info.number * kernel_params.batch, kernel_params.features));
 
     if (i == 0) {
       // For the first mini-batch we want to overwrite the output buffer
@@ -174,7 +219,7 @@ SNNStatus launch_with_transforms(FullPointerSet<T, Backend> pointers,
       if (out_status.status != StatusCode::OK) {
         return out_status;
       }
-      last_event = out_status.event;
+      status.append(out_status);
     } else {
       // For subsequent mini-batches we need to accumulate the results with
       // those already in the output buffer
@@ -185,10 +230,10 @@ SNNStatus launch_with_transforms(FullPointerSet<T, Backend> pointers,
       if (out_status.status != StatusCode::OK) {
         return out_status;
       }
-      last_event = out_status.event;
+      status.append(out_status);
     }
   }
-  return SNNStatus{last_event, StatusCode::OK};
+  return status;
 }
 
 /**
@@ -196,12 +241,13 @@ SNNStatus launch_with_transforms(FullPointerSet<T, Backend> pointers,
  * required temporary buffers, compute the Winograd tile sizes and then launch
  * the convolution with launch_with_transforms().
  *
- * \param input   User provided input pointer
- * \param filter  User provided filter pointer
- * \param output  User provided output pointer
- * \param params  User provided convolution parameters
- * \param backend User provided backend to handle allocations and matrix
- *                multiplies
+ * \param input    User provided input pointer
+ * \param filter   User provided filter pointer
+ * \param output   User provided output pointer
+ * \param params   User provided convolution parameters
+ * \param epilogue User provided epilogue to apply to the output
+ * \param backend  User provided backend to handle allocations and matrix
+ *                 multiplies
  * \return An SNNStatus object containing a SYCL event corresponding to the last
  * kernel launched.
  */
@@ -211,11 +257,13 @@ SNNStatus allocate_and_launch_with_tiles(
     typename Backend::template pointer_type<T const> input,
     typename Backend::template pointer_type<T const> filter,
     typename Backend::template pointer_type<T> output,
-    Conv2DParams const& params, Backend& backend) {
+    Conv2DParams const& params, EpiloguePointers<T, Backend> const& epilogue,
+    Backend& backend) {
   constexpr int A = M + R - 1;
   constexpr int B = N + S - 1;
   auto kernel_params = get_params<ConvType>(params);
   InternalPointerSet<T, Backend> input_pointers{input, filter, output, backend};
+  InternalEpilogueSet<T, Backend> epilogue_pointers{epilogue, backend};
   auto const tile_info = get_tile_info<ConvType, M, N, R, S>(kernel_params);
   AllocatedPointerSet<T, Backend> allocated_pointers{
       input_pointers, kernel_params, A * B, tile_info, backend};
@@ -223,8 +271,8 @@ SNNStatus allocate_and_launch_with_tiles(
       get_batch_info(allocated_pointers.minibatch_size, params.batch);
 
   return launch_with_transforms<T, M, N, R, S, ConvType>(
-      allocated_pointers.to_full_pointer_set(), kernel_params, tile_info,
-      batch_info, backend);
+      allocated_pointers.to_full_pointer_set(), kernel_params,
+      epilogue_pointers.get(), tile_info, batch_info, backend);
 }
 
 /**
@@ -237,6 +285,7 @@ SNNStatus allocate_and_launch_with_tiles(
  * \param output         User provided output pointer
  * \param workspace      Pointer to user provided workspace buffer
  * \param params         User provided convolution parameters
+ * \param epilogue       User provided epilogue to apply to the output
  * \param workspace_size Number of elements available in the workspace buffer
  * \param backend        User provided backend to handle allocations and matrix
  *                       multiplies
@@ -250,13 +299,15 @@ SNNStatus split_workspace_and_launch_with_tiles(
     typename Backend::template pointer_type<T const> filter,
     typename Backend::template pointer_type<T> output,
     typename Backend::template pointer_type<T> workspace,
-    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+    Conv2DParams const& params, EpiloguePointers<T, Backend> const& epilogue,
+    size_t workspace_size, Backend& backend) {
   using InternalPointer =
       ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
   constexpr int A = M + R - 1;
   constexpr int B = N + S - 1;
   auto kernel_params = get_params<ConvType>(params);
   InternalPointerSet<T, Backend> input_pointers{input, filter, output, backend};
+  InternalEpilogueSet<T, Backend> epilogue_pointers{epilogue, backend};
   auto const tile_info = get_tile_info<ConvType, M, N, R, S>(kernel_params);
 
   size_t const filter_transform_size =
@@ -285,7 +336,8 @@ SNNStatus split_workspace_and_launch_with_tiles(
 
   auto batch_info = get_batch_info(minibatch_size, params.batch);
   return launch_with_transforms<T, M, N, R, S, ConvType>(
-      all_pointers, kernel_params, tile_info, batch_info, backend);
+      all_pointers, kernel_params, epilogue_pointers.get(), tile_info,
+      batch_info, backend);
 }
 
 /**
@@ -300,14 +352,16 @@ SNNStatus launch_with_tiles(
     typename Backend::template pointer_type<T const> filter,
     typename Backend::template pointer_type<T> output,
     typename Backend::template pointer_type<T> workspace,
-    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+    Conv2DParams const& params, EpiloguePointers<T, Backend> const& epilogue,
+    size_t workspace_size, Backend& backend) {
   if (workspace_size == 0) {
     return allocate_and_launch_with_tiles<T, ConvType, M, N, R, S, Backend>(
-        input, filter, output, params, backend);
+        input, filter, output, params, epilogue, backend);
   } else {
     return split_workspace_and_launch_with_tiles<T, ConvType, M, N, R, S,
                                                  Backend>(
-        input, filter, output, workspace, params, workspace_size, backend);
+        input, filter, output, workspace, params, epilogue, workspace_size,
+        backend);
   }
 }
 
@@ -316,12 +370,16 @@ SNNStatus launch_with_tiles(
  * available Winograd tile sizes and launch those kernels using
  * launch_with_tiles().
  *
- * \param input   User provided input pointer
- * \param filter  User provided filter pointer
- * \param output  User provided output pointer
- * \param params  User provided convolution parameters
- * \param backend User provided backend to handle allocations and matrix
- *                multiplies
+ * \param input          User provided input pointer
+ * \param filter         User provided filter pointer
+ * \param output         User provided output pointer
+ * \param workspace      Pointer to user provided workspace buffer
+ * \param params         User provided convolution parameters
+ * \param epilogue       User provided epilogue to apply to the output, ignored
+ *                       for filter backprop convolutions
+ * \param workspace_size Number of elements available in the workspace buffer
+ * \param backend        User provided backend to handle allocations and matrix
+ *                       multiplies
  * \return An SNNStatus object containing a SYCL event corresponding to the last
  * kernel launched.
  */
@@ -333,19 +391,28 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T const> filter,
                  typename Backend::template pointer_type<T> output,
                  typename Backend::template pointer_type<T> workspace,
-                 Conv2DParams const& params, size_t workspace_size,
-                 Backend& backend) {
+                 Conv2DParams const& params,
+                 EpiloguePointers<T, Backend> const& epilogue,
+                 size_t workspace_size, Backend& backend) {
   if (params.window_rows == 3 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 2, 2, 3, 3>(
-        input, filter, output, workspace, params, workspace_size, backend);
+        input, filter, output, workspace, params, epilogue, workspace_size,
+        backend);
   }
   if (params.window_rows == 3 && params.window_cols == 1) {
     return launch_with_tiles<T, ConvType, 2, 1, 3, 1>(
-        input, filter, output, workspace, params, workspace_size, backend);
+        input, filter, output, workspace, params, epilogue, workspace_size,
+        backend);
   }
   if (params.window_rows == 1 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 1, 2, 1, 3>(
-        input, filter, output, workspace, params, workspace_size, backend);
+        input, filter, output, workspace, params, epilogue, workspace_size,
+        backend);
+  }
+  if (params.window_rows == 5 && params.window_cols == 5) {
+    return launch_with_tiles<T, ConvType, 2, 2, 5, 5>(
+        input, filter, output, workspace, params, epilogue, workspace_size,
+        backend);
   }
   return StatusCode::InvalidAlgorithm;
 }
@@ -359,19 +426,23 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T const> filter,
                  typename Backend::template pointer_type<T> output,
                  typename Backend::template pointer_type<T> workspace,
-                 Conv2DParams const& params, size_t workspace_size,
-                 Backend& backend) {
+                 Conv2DParams const& params,
+                 EpiloguePointers<T, Backend> const& epilogue,
+                 size_t workspace_size, Backend& backend) {
   if (params.window_rows == 3 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 3, 3, 2, 2>(
-        input, filter, output, workspace, params, workspace_size, backend);
+        input, filter, output, workspace, params, epilogue, workspace_size,
+        backend);
   }
   if (params.window_rows == 3 && params.window_cols == 1) {
     return launch_with_tiles<T, ConvType, 3, 1, 2, 1>(
-        input, filter, output, workspace, params, workspace_size, backend);
+        input, filter, output, workspace, params, epilogue, workspace_size,
+        backend);
   }
   if (params.window_rows == 1 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 1, 3, 1, 2>(
-        input, filter, output, workspace, params, workspace_size, backend);
+        input, filter, output, workspace, params, epilogue, workspace_size,
+        backend);
   }
   return StatusCode::InvalidAlgorithm;
 }
@@ -385,11 +456,23 @@ SNNStatus launch_large(typename Backend::template pointer_type<T const> input,
                        typename Backend::template pointer_type<T const> filter,
                        typename Backend::template pointer_type<T> output,
                        typename Backend::template pointer_type<T> workspace,
-                       Conv2DParams const& params, size_t workspace_size,
-                       Backend& backend) {
+                       Conv2DParams const& params,
+                       EpiloguePointers<T, Backend> const& epilogue,
+                       size_t workspace_size, Backend& backend) {
   if (params.window_rows == 3 && params.window_cols == 3) {
+    if (use_6x6_tiles<ConvType>(params)) {
+      return launch_with_tiles<T, ConvType, 6, 6, 3, 3>(
+          input, filter, output, workspace, params, epilogue, workspace_size,
+          backend);
+    }
     return launch_with_tiles<T, ConvType, 4, 4, 3, 3>(
-        input, filter, output, workspace, params, workspace_size, backend);
+        input, filter, output, workspace, params, epilogue, workspace_size,
+        backend);
+  }
+  if (params.window_rows == 5 && params.window_cols == 5) {
+    return launch_with_tiles<T, ConvType, 4, 4, 5, 5>(
+        input, filter, output, workspace, params, epilogue, workspace_size,
+        backend);
   }
   return StatusCode::InvalidAlgorithm;
 }
@@ -403,11 +486,13 @@ SNNStatus launch_large(typename Backend::template pointer_type<T const> input,
                        typename Backend::template pointer_type<T const> filter,
                        typename Backend::template pointer_type<T> output,
                        typename Backend::template pointer_type<T> workspace,
-                       Conv2DParams const& params, size_t workspace_size,
-                       Backend& backend) {
+                       Conv2DParams const& params,
+                       EpiloguePointers<T, Backend> const& epilogue,
+                       size_t workspace_size, Backend& backend) {
   if (params.window_rows == 3 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 3, 3, 3, 3>(
-        input, filter, output, workspace, params, workspace_size, backend);
+        input, filter, output, workspace, params, epilogue, workspace_size,
+        backend);
   }
   return StatusCode::InvalidAlgorithm;
 }
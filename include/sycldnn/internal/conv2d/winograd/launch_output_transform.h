@@ -22,6 +22,7 @@
 
 #include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
+#include "sycldnn/internal/conv2d/epilogue.h"
 #include "sycldnn/internal/conv2d/winograd/tile_info.h"
 
 #include <stddef.h>
@@ -51,6 +52,8 @@ namespace winograd {
  * \param intermediate Intermediate tensor
  * \param output       Output temporary transform tensor
  * \param params       Kernel parameters for the convolution
+ * \param epilogue     Epilogue to apply to the output, ignored for filter
+ *                     backprop convolutions
  * \param tile_info    Winograd tile information
  * \param queue        SYCL queue to enqueue the kernels to
  * \return An SNNStatus event containing an event corresponding to the last
@@ -61,6 +64,7 @@ template <typename T, typename ConvType, int M, int N, int R, int S,
 SNN_EXPORT SNNStatus
 launch_output_transform(BaseMemObject<T const>& intermediate,
                         BaseMemObject<T>& output, Conv2DParams const& params,
+                        EpilogueMem<T> const& epilogue,
                         TileInfo const& tile_info, cl::sycl::queue& queue);
 
 /**
@@ -70,6 +74,7 @@ launch_output_transform(BaseMemObject<T const>& intermediate,
  * \param inter     Intermediate tensor
  * \param output    Output temporary transform tensor
  * \param params    Kernel parameters for the convolution
+ * \param epilogue  Epilogue to apply to the output
  * \param tile_info Winograd tile information
  * \param backend   Backend to provide SYCL buffers from the pointers
  * \return An SNNStatus event containing an event corresponding to the last
@@ -80,7 +85,9 @@ template <typename T, typename ConvType, int M, int N, int R, int S,
 SNNStatus launch_output_transform(
     typename Backend::template internal_pointer_type<T const> inter,
     typename Backend::template internal_pointer_type<T> output,
-    Conv2DParams const& params, TileInfo const& tile_info, Backend& backend) {
+    Conv2DParams const& params,
+    InternalEpiloguePointers<T, Backend> const& epilogue,
+    TileInfo const& tile_info, Backend& backend) {
   constexpr int A = M + R - 1;
   constexpr int B = N + S - 1;
 
@@ -92,9 +99,15 @@ SNNStatus launch_output_transform(
       params.batch * params.out_rows * params.out_cols * params.features;
   auto output_acc = backend.get_mem_object_internal(output, output_size);
 
+  auto bias_acc = backend.get_mem_object_internal(
+      epilogue.bias, epilogue_bias_size(epilogue.params, params));
+  auto res_acc = backend.get_mem_object_internal(
+      epilogue.residual, epilogue_residual_size(epilogue.params, params));
+  EpilogueMem<T> epilogue_mem{epilogue.params, &bias_acc, &res_acc};
+
   cl::sycl::queue queue = backend.get_queue();
   return launch_output_transform<T, ConvType, M, N, R, S>(
-      inter_acc, output_acc, params, tile_info, queue);
+      inter_acc, output_acc, params, epilogue_mem, tile_info, queue);
 }
 
 /**
@@ -127,7 +140,8 @@ SNNStatus launch_output_transform_filter_backprop(
 
   cl::sycl::queue queue = backend.get_queue();
   return launch_output_transform<T, ConvType, M, N, R, S, Accumulate>(
-      inter_acc, output_acc, params, tile_info, queue);
+      inter_acc, output_acc, params,
+      no_epilogue<BaseMemObject<T const>*>(&inter_acc), tile_info, queue);
 }
 
 }  // namespace winograd
@@ -0,0 +1,299 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_CONV2D_WINOGRAD_LAUNCH_PRETRANSFORMED_H_
+#define SYCLDNN_INCLUDE_INTERNAL_CONV2D_WINOGRAD_LAUNCH_PRETRANSFORMED_H_
+
+#include "sycldnn/helpers/macros.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/internal/conv2d/batch_info.h"
+
+#include "sycldnn/internal/conv2d/winograd/kernel_params.h"
+#include "sycldnn/internal/conv2d/winograd/launch.h"
+#include "sycldnn/internal/conv2d/winograd/launch_filter_transform.h"
+#include "sycldnn/internal/conv2d/winograd/pointer_set.h"
+#include "sycldnn/internal/conv2d/winograd/tile_info.h"
+
+#include "sycldnn/internal/helpers/internal_pointer.h"
+
+#include <algorithm>
+#include <type_traits>
+
+/**
+ * \file
+ * Contains the internal launchers to transform a filter into the Winograd
+ * domain once, and to compute Winograd convolutions using that pre-transformed
+ * filter without launching the filter transform kernel again.
+ */
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace winograd {
+
+/**
+ * Get the number of elements required to hold a Winograd filter transform.
+ *
+ * \param params User provided convolution parameters
+ * \param large  Whether to use the tile sizes of launch_large()
+ * \return The number of elements in the filter transform, or zero if the
+ *         window size is not supported by the Winograd implementation.
+ */
+template <typename ConvType>
+size_t filter_transform_size(Conv2DParams const& params, bool large) {
+  if (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+    return 0;
+  }
+  size_t n_matrices = 0;
+  if (params.window_rows == 3 && params.window_cols == 3) {
+    if (!large) {
+      n_matrices = 4 * 4;
+    } else if (use_6x6_tiles<ConvType>(params)) {
+      n_matrices = 8 * 8;
+    } else {
+      n_matrices = 6 * 6;
+    }
+  } else if (params.window_rows == 5 && params.window_cols == 5) {
+    n_matrices = large ? 8 * 8 : 6 * 6;
+  } else if (!large && ((params.window_rows == 3 && params.window_cols == 1) ||
+                        (params.window_rows == 1 && params.window_cols == 3))) {
+    n_matrices = 4;
+  }
+  return n_matrices * params.channels * params.features;
+}
+
+/**
+ * Launch the Winograd filter transform for the given tile sizes, storing the
+ * result in the user provided transform buffer.
+ */
+template <typename T, typename ConvType, int M, int N, int R, int S,
+          typename Backend>
+SNNStatus transform_filter_with_tiles(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> transform,
+    Conv2DParams const& params, Backend& backend) {
+  using ConstInternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T const, Backend>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  auto kernel_params = get_params<ConvType>(params);
+  auto const tile_info = get_tile_info<ConvType, M, N, R, S>(kernel_params);
+  ConstInternalPointer filter_ptr{filter, backend};
+  InternalPointer transform_ptr{transform, backend};
+  return launch_filter_transform<T, ConvType, M, N, R, S>(
+      filter_ptr.get(), transform_ptr.get(), kernel_params, tile_info,
+      backend);
+}
+
+/**
+ * Compute a Winograd convolution using a filter which has already been
+ * transformed with transform_filter_with_tiles(). Any temporary buffers are
+ * either allocated through the backend or taken from the user provided
+ * workspace.
+ */
+template <typename T, typename ConvType, int M, int N, int R, int S,
+          typename Backend>
+SNNStatus launch_with_tiles_pretransformed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T> filter_transform,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend) {
+  using ConstInternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T const, Backend>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  constexpr int A = M + R - 1;
+  constexpr int B = N + S - 1;
+  auto kernel_params = get_params<ConvType>(params);
+  auto const tile_info = get_tile_info<ConvType, M, N, R, S>(kernel_params);
+  ConstInternalPointer input_ptr{input, backend};
+  InternalPointer output_ptr{output, backend};
+  InternalPointer filter_transform_ptr{filter_transform, backend};
+
+  if (workspace_size == 0) {
+    TransformedFilterPointerSet<T, Backend> pointers{
+        input_ptr.get(), filter_transform_ptr.get(), output_ptr.get(),
+        kernel_params, A * B, tile_info, backend};
+    auto batch_info = get_batch_info(pointers.minibatch_size, params.batch);
+    return launch_with_filter_transform<T, M, N, R, S, ConvType>(
+        pointers.to_full_pointer_set(), kernel_params,
+        no_epilogue(input_ptr.get()), tile_info, batch_info, backend);
+  }
+
+  size_t const input_transform_size =
+      A * B * tile_info.number * kernel_params.channels;
+  size_t const inter_transform_size =
+      A * B * tile_info.number * kernel_params.features;
+  size_t const minibatch_size = std::min<size_t>(
+      workspace_size / (input_transform_size + inter_transform_size),
+      params.batch);
+  SNN_VALIDATE_PARAM(minibatch_size > 0,
+                     "The workspace is too small to hold the Winograd "
+                     "transforms for a single image.");
+  size_t const mb_input_transform_size = input_transform_size * minibatch_size;
+
+  InternalPointer input_transform_ptr{workspace, backend};
+  InternalPointer inter_transform_ptr{workspace + mb_input_transform_size,
+                                      backend};
+  auto all_pointers = FullPointerSet<T, Backend>{
+      input_ptr.get(),            ConstPointer{filter_transform_ptr.get()},
+      output_ptr.get(),           input_transform_ptr.get(),
+      filter_transform_ptr.get(), inter_transform_ptr.get()};
+
+  auto batch_info = get_batch_info(minibatch_size, params.batch);
+  return launch_with_filter_transform<T, M, N, R, S, ConvType>(
+      all_pointers, kernel_params, no_epilogue(input_ptr.get()), tile_info,
+      batch_info, backend);
+}
+
+/**
+ * Transform a filter into the Winograd domain, matching the tile sizes used
+ * by launch() or launch_large() for the given window.
+ *
+ * \param filter    User provided filter pointer
+ * \param transform User provided buffer to store the transformed filter in,
+ *                  holding at least filter_transform_size() elements
+ * \param params    User provided convolution parameters
+ * \param large     Whether to use the tile sizes of launch_large()
+ * \param backend   User provided backend
+ * \return An SNNStatus object containing a SYCL event corresponding to the
+ * filter transform kernel.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+SNNStatus transform_filter(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> transform,
+    Conv2DParams const& params, bool large, Backend& backend) {
+  if (params.window_rows == 3 && params.window_cols == 3) {
+    if (large && use_6x6_tiles<ConvType>(params)) {
+      return transform_filter_with_tiles<T, ConvType, 6, 6, 3, 3>(
+          filter, transform, params, backend);
+    }
+    if (large) {
+      return transform_filter_with_tiles<T, ConvType, 4, 4, 3, 3>(
+          filter, transform, params, backend);
+    }
+    return transform_filter_with_tiles<T, ConvType, 2, 2, 3, 3>(
+        filter, transform, params, backend);
+  }
+  if (params.window_rows == 5 && params.window_cols == 5) {
+    if (large) {
+      return transform_filter_with_tiles<T, ConvType, 4, 4, 5, 5>(
+          filter, transform, params, backend);
+    }
+    return transform_filter_with_tiles<T, ConvType, 2, 2, 5, 5>(
+        filter, transform, params, backend);
+  }
+  if (large) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  if (params.window_rows == 3 && params.window_cols == 1) {
+    return transform_filter_with_tiles<T, ConvType, 2, 1, 3, 1>(
+        filter, transform, params, backend);
+  }
+  if (params.window_rows == 1 && params.window_cols == 3) {
+    return transform_filter_with_tiles<T, ConvType, 1, 2, 1, 3>(
+        filter, transform, params, backend);
+  }
+  return StatusCode::InvalidAlgorithm;
+}
+
+/**
+ * Launch a Winograd convolution using a filter which has already been
+ * transformed by transform_filter().
+ *
+ * \param input            User provided input pointer
+ * \param filter_transform User provided transformed filter pointer
+ * \param output           User provided output pointer
+ * \param workspace        User provided workspace pointer
+ * \param params           User provided convolution parameters
+ * \param filter_params    Convolution parameters that the filter was
+ *                         transformed with, which determine the tile sizes
+ * \param workspace_size   Number of elements available in the workspace
+ * \param large            Whether the filter was transformed using the tile
+ *                         sizes of launch_large()
+ * \param backend          User provided backend
+ * \return An SNNStatus object containing a SYCL event corresponding to the
+ * last kernel launched.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+SNNStatus launch_pretransformed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T> filter_transform,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, Conv2DParams const& filter_params,
+    size_t workspace_size, bool large, Backend& backend) {
+  if (params.window_rows == 3 && params.window_cols == 3) {
+    // The tile sizes must match those used to transform the filter, rather
+    // than those which would be chosen for the current image size.
+    if (large && use_6x6_tiles<ConvType>(filter_params)) {
+      return launch_with_tiles_pretransformed<T, ConvType, 6, 6, 3, 3>(
+          input, filter_transform, output, workspace, params, workspace_size,
+          backend);
+    }
+    if (large) {
+      return launch_with_tiles_pretransformed<T, ConvType, 4, 4, 3, 3>(
+          input, filter_transform, output, workspace, params, workspace_size,
+          backend);
+    }
+    return launch_with_tiles_pretransformed<T, ConvType, 2, 2, 3, 3>(
+        input, filter_transform, output, workspace, params, workspace_size,
+        backend);
+  }
+  if (params.window_rows == 5 && params.window_cols == 5) {
+    if (large) {
+      return launch_with_tiles_pretransformed<T, ConvType, 4, 4, 5, 5>(
+          input, filter_transform, output, workspace, params, workspace_size,
+          backend);
+    }
+    return launch_with_tiles_pretransformed<T, ConvType, 2, 2, 5, 5>(
+        input, filter_transform, output, workspace, params, workspace_size,
+        backend);
+  }
+  if (large) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  if (params.window_rows == 3 && params.window_cols == 1) {
+    return launch_with_tiles_pretransformed<T, ConvType, 2, 1, 3, 1>(
+        input, filter_transform, output, workspace, params, workspace_size,
+        backend);
+  }
+  if (params.window_rows == 1 && params.window_cols == 3) {
+    return launch_with_tiles_pretransformed<T, ConvType, 1, 2, 1, 3>(
+        input, filter_transform, output, workspace, params, workspace_size,
+        backend);
+  }
+  return StatusCode::InvalidAlgorithm;
+}
+
+}  // namespace winograd
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_CONV2D_WINOGRAD_LAUNCH_PRETRANSFORMED_H_
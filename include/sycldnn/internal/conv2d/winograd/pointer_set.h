@@ -190,6 +190,97 @@ struct AllocatedPointerSet {
   }
 };
 
+/**
+ * Container to allocate the temporary buffers required for a Winograd
+ * convolution where the filter has already been transformed.
+ *
+ * This matches \ref AllocatedPointerSet, except that the user provided filter
+ * transform is used rather than allocating a temporary filter transform
+ * buffer.
+ */
+template <typename T, typename Backend>
+struct TransformedFilterPointerSet {
+  /** User provided internal pointer type. */
+  using Pointer = typename Backend::template internal_pointer_type<T>;
+  /** User provided internal const pointer type. */
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  /** RAII allocating pointer which releases its buffer on destruction. */
+  using AllocatedPointer =
+      ::sycldnn::internal::helpers::AllocatedPointer<T, Backend>;
+
+  /**
+   * Construct a TransformedFilterPointerSet from the user provided pointers
+   * and the convolution parameters. Will allocate the temporary input and
+   * intermediate buffers required through the backend.
+   *
+   * \param input            The user provided input pointer.
+   * \param filter_transform The user provided transformed filter.
+   * \param output           The user provided output pointer.
+   * \param params           The parameters for the convolution.
+   * \param n_matrices       The number of matrices in the intermediate
+   *                         Winograd tensor.
+   * \param tile_info        Information about the number of tiles in the
+   *                         convolution.
+   * \param backend          The user provided backend to use to allocate the
+   *                         temporary buffers.
+   */
+  TransformedFilterPointerSet(ConstPointer input, Pointer filter_transform,
+                              Pointer output, Conv2DParams const& params,
+                              int n_matrices, TileInfo const& tile_info,
+                              Backend& backend)
+      : minibatch_size{get_minibatch_size(params, tile_info, n_matrices,
+                                          backend)},
+        input{input},
+        output{output},
+        filter_transform{filter_transform},
+        input_transform{minibatch_size * sizeof(T) * n_matrices *
+                            tile_info.number * params.channels,
+                        backend},
+        intermediate{minibatch_size * sizeof(T) * n_matrices *
+                         tile_info.number * params.features,
+                     backend} {}
+
+  /**
+   * Convert a TransformedFilterPointerSet to a FullPointerSet instance.
+   * \return A FullPointerSet containing the pointers in this
+   * TransformedFilterPointerSet.
+   */
+  FullPointerSet<T, Backend> to_full_pointer_set() const {
+    return {input,
+            ConstPointer{filter_transform},
+            output,
+            input_transform.get(),
+            filter_transform,
+            intermediate.get()};
+  }
+
+  /** Minibatch size used to allocate the temporary buffers. */
+  size_t minibatch_size;
+  /** The user provided input pointer. */
+  ConstPointer input;
+  /** The user provided output pointer. */
+  Pointer output;
+  /** The user provided filter transform pointer. */
+  Pointer filter_transform;
+  /** The temporary input transform pointer. */
+  AllocatedPointer input_transform;
+  /** The temporary output transform pointer. */
+  AllocatedPointer intermediate;
+
+ private:
+  /** Get the number of images to use per minibatch. */
+  static size_t get_minibatch_size(Conv2DParams const& params,
+                                   TileInfo const& tile_info, int n_matrices,
+                                   Backend& backend) {
+    size_t const max_bytes = sizeof(T) * n_matrices * tile_info.number *
+                             std::max(params.channels, params.features);
+    auto alloc_info = get_alloc_info(backend.get_queue().get_device(),
+                                     params.batch, max_bytes);
+    return alloc_info.images_per_alloc;
+  }
+};
+
 }  // namespace winograd
 }  // namespace internal
 }  // namespace conv2d
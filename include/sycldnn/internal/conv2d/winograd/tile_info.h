@@ -20,6 +20,9 @@
 #include "sycldnn/conv2d/params.h"
 #include "sycldnn/helpers/ratio.h"
 
+#include "sycldnn/internal/conv2d/winograd/kernel_params.h"
+
+#include <stddef.h>
 #include <type_traits>
 
 namespace sycldnn {
@@ -74,6 +77,43 @@ inline TileInfo get_tile_info(Conv2DParams const& params) {
   return result;
 }
 
+/**
+ * Compute the number of values in the Winograd domain for each channel of a
+ * convolution computed with the given tile sizes. This is proportional to the
+ * number of multiplies in the batch matrix multiply, so gives a measure of how
+ * expensive the convolution is with these tile sizes.
+ *
+ * \param params Kernel parameters for convolution
+ * \return The number of transformed values for each channel.
+ */
+template <int M, int N, int R, int S>
+inline size_t transformed_size(Conv2DParams const& params) {
+  auto const tile_info = get_tile_info<conv_type::Forward, M, N, R, S>(params);
+  return static_cast<size_t>(M + R - 1) * (N + S - 1) * tile_info.number;
+}
+
+/**
+ * Check whether a 3x3 convolution computed with the larger Winograd tiles
+ * should use F(6x6, 3x3) rather than F(4x4, 3x3).
+ *
+ * The 6x6 tiles need fewer multiplies for each output value, but any tiles
+ * overlapping the edge of the output compute values which are then discarded.
+ * For small images this waste outweighs the savings, so the 6x6 tiles are only
+ * used when they need fewer multiplies for the whole image.
+ *
+ * \param params User provided convolution parameters
+ * \return Whether to use F(6x6, 3x3) tiles.
+ */
+template <typename ConvType>
+inline bool use_6x6_tiles(Conv2DParams const& params) {
+  if (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+    return false;
+  }
+  auto const kernel_params = get_params<ConvType>(params);
+  return transformed_size<6, 6, 3, 3>(kernel_params) <
+         transformed_size<4, 4, 3, 3>(kernel_params);
+}
+
 }  // namespace winograd
 }  // namespace internal
 }  // namespace conv2d
@@ -27,6 +27,10 @@
 
 #include "sycldnn/depthwise_conv2d/params.h"
 
+#include "sycldnn/quantize/params.h"
+
+#include <cstdint>
+
 #include <CL/sycl.hpp>
 
 #include "sycldnn/export.h"
@@ -57,6 +61,37 @@ SNN_EXPORT SNNStatus launch(BaseMemObject<T const>& input,
                             DepthwiseConv2DParams const& params,
                             cl::sycl::queue& queue);
 
+/**
+ * Launch an int8 quantized forward 2D depthwise convolution.
+ *
+ * The products are accumulated in int32 and each output feature is
+ * requantized with its own scale and zero point.
+ *
+ * Implemented in the compiled SYCL-DNN library.
+ *
+ * \param input             An accessor for the int8 input tensor.
+ * \param filter            An accessor for the int8 filter tensor.
+ * \param bias              An accessor for the int32 bias tensor.
+ * \param scales            An accessor for the per-feature scales.
+ * \param zero_points       An accessor for the per-feature zero points.
+ * \param output            An accessor for the int8 output tensor.
+ * \param params            The convolution parameters, which describe the
+ *                          tensor shapes and convolution strides.
+ * \param requantize_params The input and filter zero points and the output
+ *                          bounds.
+ * \param queue             The SYCL queue to enqueue the kernels to.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+SNN_EXPORT SNNStatus launch_quantized(
+    BaseMemObject<int8_t const>& input, BaseMemObject<int8_t const>& filter,
+    BaseMemObject<int32_t const>& bias, BaseMemObject<float const>& scales,
+    BaseMemObject<int32_t const>& zero_points, BaseMemObject<int8_t>& output,
+    DepthwiseConv2DParams const& params,
+    quantize::RequantizeParams const& requantize_params,
+    cl::sycl::queue& queue);
+
 }  // namespace internal
 }  // namespace depthwise_conv2d
 }  // namespace sycldnn
@@ -0,0 +1,67 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_HELPERS_DEVICE_FILE_NAME_H_
+#define SYCLDNN_INCLUDE_INTERNAL_HELPERS_DEVICE_FILE_NAME_H_
+
+#include <cctype>
+#include <cstring>
+#include <string>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace internal {
+namespace helpers {
+
+/**
+ * OpenCL is unclear whether strings returned from clGet*Info() should be null
+ * terminated, so trim any embedded nulls and replace any characters which are
+ * not safe to use in a file name.
+ */
+inline std::string sanitise_file_name(std::string s) {
+  s.resize(strlen(s.c_str()));
+  for (auto& c : s) {
+    if (!std::isalnum(static_cast<unsigned char>(c)) && c != '.' && c != '-') {
+      c = '_';
+    }
+  }
+  return s;
+}
+
+/**
+ * Get a file name which uniquely identifies a device and its driver, used to
+ * store tuning results which are only valid on that device.
+ *
+ * \param prefix    A prefix identifying the contents of the file.
+ * \param device    The SYCL device.
+ * \param extension The file extension, including the leading dot.
+ * \return A file name, without any directory component.
+ */
+inline std::string device_file_name(std::string const& prefix,
+                                    cl::sycl::device const& device,
+                                    std::string const& extension) {
+  std::string device_name = device.get_info<cl::sycl::info::device::name>();
+  std::string driver_version =
+      device.get_info<cl::sycl::info::device::driver_version>();
+  return prefix + "_" + sanitise_file_name(device_name) + "_" +
+         sanitise_file_name(driver_version) + extension;
+}
+
+}  // namespace helpers
+}  // namespace internal
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_HELPERS_DEVICE_FILE_NAME_H_
@@ -0,0 +1,114 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_HELPERS_SCOPED_DEPENDENCIES_H_
+#define SYCLDNN_INCLUDE_INTERNAL_HELPERS_SCOPED_DEPENDENCIES_H_
+
+#include "sycldnn/helpers/dependencies.h"
+#include "sycldnn/helpers/macros.h"
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace internal {
+namespace helpers {
+
+/**
+ * Check whether a backend provides set_dependencies and get_dependencies,
+ * which make the kernels of an operation wait on a list of events.
+ */
+template <typename Backend, typename = void>
+struct SupportsDependencies : std::false_type {};
+
+/** \copydoc SupportsDependencies */
+template <typename Backend>
+struct SupportsDependencies<
+    Backend,
+    decltype(std::declval<Backend&>().set_dependencies(
+                 std::declval<Backend&>().get_dependencies()),
+             void())> : std::true_type {};
+
+/**
+ * Helper to add dependencies to all operations launched with a backend
+ * within the lifetime of this object.
+ *
+ * The dependencies are added to any dependencies already set on the backend,
+ * and the previous dependencies are restored on destruction.
+ */
+template <typename Backend, bool = SNN_HAS_DEPENDS_ON &&
+                                   SupportsDependencies<Backend>::value>
+struct ScopedDependencies {
+  /**
+   * Add the given dependencies to the backend.
+   *
+   * \param backend      Backend used to launch the operation.
+   * \param dependencies Events which the operation must wait for.
+   */
+  ScopedDependencies(Backend& backend,
+                     std::vector<cl::sycl::event> const& dependencies)
+      : backend_(backend), active_{!dependencies.empty()} {
+    if (active_) {
+      previous_ = backend_.get_dependencies();
+      auto combined = previous_;
+      combined.insert(combined.end(), dependencies.begin(),
+                      dependencies.end());
+      backend_.set_dependencies(std::move(combined));
+    }
+  }
+
+  SNN_DISABLE_COPY(ScopedDependencies);
+  SNN_DISABLE_MOVE(ScopedDependencies);
+
+  /** Restore the backend's previous dependencies. */
+  ~ScopedDependencies() {
+    if (active_) {
+      backend_.set_dependencies(std::move(previous_));
+    }
+  }
+
+ private:
+  Backend& backend_;
+  bool active_;
+  std::vector<cl::sycl::event> previous_;
+};
+
+/**
+ * Fallback for backends or SYCL implementations which cannot make kernels
+ * depend on events. The dependencies are waited on from the host instead.
+ */
+template <typename Backend>
+struct ScopedDependencies<Backend, false> {
+  /** \copydoc ScopedDependencies::ScopedDependencies */
+  ScopedDependencies(Backend& backend,
+                     std::vector<cl::sycl::event> const& dependencies) {
+    SNN_UNUSED_VAR(backend)
+    if (!dependencies.empty()) {
+      cl::sycl::event::wait_and_throw(dependencies);
+    }
+  }
+
+  SNN_DISABLE_COPY(ScopedDependencies);
+  SNN_DISABLE_MOVE(ScopedDependencies);
+};
+
+}  // namespace helpers
+}  // namespace internal
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_HELPERS_SCOPED_DEPENDENCIES_H_
@@ -21,6 +21,14 @@
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
+#include "sycldnn/internal/reduce/launch.h"
+#include "sycldnn/matmul/config.h"
+
+#include "sycldnn/quantize/params.h"
+
+#include <cstdint>
+#include <vector>
+
 #include "sycldnn/export.h"
 
 namespace sycldnn {
@@ -38,6 +46,114 @@ SNN_EXPORT SNNStatus launch(BaseMemObject<T const>& lhs,
                             BaseMemObject<T>& output, int batches, int m, int k,
                             int n, T beta, cl::sycl::queue& queue);
 
+/**
+ * The internal matrix multiply launcher using the specified tile sizes and
+ * work-group shape.
+ *
+ * Only the tile sizes included in get_configs() are available, any other tile
+ * sizes will return StatusCode::InvalidAlgorithm.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS>
+SNN_EXPORT SNNStatus launch(BaseMemObject<T const>& lhs,
+                            BaseMemObject<T const>& rhs,
+                            BaseMemObject<T>& output, int batches, int m, int k,
+                            int n, T beta, MatmulConfig const& config,
+                            cl::sycl::queue& queue);
+
+/**
+ * Get every tile size and work-group shape combination compiled into the
+ * library.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+SNN_EXPORT std::vector<MatmulConfig> get_configs();
+
+/**
+ * Choose a configuration for a matrix multiply based on the matrix sizes.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+SNN_EXPORT MatmulConfig get_default_config(int batches, int m, int k, int n);
+
+/**
+ * The internal matrix multiply launcher for the kernel which stages the input
+ * matrices in local memory.
+ *
+ * Returns StatusCode::InvalidAlgorithm if the device does not support the
+ * work-group size or local memory size required by the kernel.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS>
+SNN_EXPORT SNNStatus launch_local_mem(BaseMemObject<T const>& lhs,
+                                      BaseMemObject<T const>& rhs,
+                                      BaseMemObject<T>& output, int batches,
+                                      int m, int k, int n, T beta,
+                                      cl::sycl::queue& queue);
+
+/**
+ * Check whether the local memory matrix multiply kernel should be used for
+ * the given matrix sizes on a device.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T>
+SNN_EXPORT bool use_local_mem_kernel(cl::sycl::device const& device,
+                                     int batches, int m, int k, int n);
+
+/**
+ * The type of the partial products stored in the workspace of a split-K
+ * matrix multiply. This matches the type used to accumulate values of type T
+ * in the kernels, as for the partial results of a split reduction.
+ */
+template <typename T>
+using PartialType = reduce::internal::PartialType<T>;
+
+/**
+ * The internal split-K matrix multiply launcher.
+ *
+ * The accumulation dimension is split into n_splits slices, the partial
+ * product for each slice is written to the workspace and then the partial
+ * products are summed into the output. The partial products are kept in
+ * PartialType<T>, so they are only rounded to T once summed.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS>
+SNN_EXPORT SNNStatus
+launch_split_k(BaseMemObject<T const>& lhs, BaseMemObject<T const>& rhs,
+               BaseMemObject<T>& output,
+               BaseMemObject<typename PartialType<T>::type>& workspace,
+               int batches, int m, int k, int n, int n_splits, T beta,
+               cl::sycl::queue& queue);
+
+/**
+ * Choose the number of slices to split the accumulation dimension into for a
+ * matrix multiply. A value of 1 means that split-K should not be used.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+SNN_EXPORT int get_split_k_count(int batches, int m, int k, int n);
+
+/**
+ * The internal int8 quantized matrix multiply launcher.
+ *
+ * The products are accumulated in int32 and each output column is requantized
+ * with its own scale and zero point.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <bool TransposeLHS, bool TransposeRHS>
+SNN_EXPORT SNNStatus launch_quantized(
+    BaseMemObject<int8_t const>& lhs, BaseMemObject<int8_t const>& rhs,
+    BaseMemObject<int32_t const>& bias, BaseMemObject<float const>& scales,
+    BaseMemObject<int32_t const>& zero_points, BaseMemObject<int8_t>& output,
+    int batches, int m, int k, int n,
+    quantize::RequantizeParams const& requantize_params,
+    cl::sycl::queue& queue);
+
 }  // namespace internal
 }  // namespace matmul
 }  // namespace sycldnn
@@ -0,0 +1,62 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_QUANTIZE_LAUNCH_H_
+#define SYCLDNN_INCLUDE_INTERNAL_QUANTIZE_LAUNCH_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/quantize/params.h"
+
+#include <cstdint>
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace quantize {
+namespace internal {
+
+/**
+ * The internal launcher for quantizing a tensor to int8.
+ *
+ * Implemented in the compiled SYCL-DNN library.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_quantize(BaseMemObject<T const>& input,
+                                     BaseMemObject<float const>& scales,
+                                     BaseMemObject<int32_t const>& zero_points,
+                                     BaseMemObject<int8_t>& output,
+                                     QuantizeParams const& params,
+                                     cl::sycl::queue& queue);
+
+/**
+ * The internal launcher for dequantizing an int8 tensor.
+ *
+ * Implemented in the compiled SYCL-DNN library.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_dequantize(
+    BaseMemObject<int8_t const>& input, BaseMemObject<float const>& scales,
+    BaseMemObject<int32_t const>& zero_points, BaseMemObject<T>& output,
+    QuantizeParams const& params, cl::sycl::queue& queue);
+
+}  // namespace internal
+}  // namespace quantize
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_QUANTIZE_LAUNCH_H_
@@ -23,12 +23,84 @@
 
 #include "sycldnn/export.h"
 
+#include "sycldnn/reduce/operators.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
 namespace sycldnn {
 namespace reduce {
 namespace internal {
 
 /**
- * The internal reduce launcher.
+ * The type of the partial results stored in the workspace of a reduction which
+ * splits the outer dimension. This matches the type used to accumulate values
+ * of type T in the kernels, so half precision partial results are kept in
+ * single precision.
+ */
+template <typename T>
+struct PartialType {
+  /** The type of each partial result. */
+  using type = T;
+};
+#ifdef SNN_USE_HALF
+/** Half precision partial results are stored in single precision. */
+template <>
+struct PartialType<cl::sycl::half> {
+  /** The type of each partial result. */
+  using type = float;
+};
+#endif  // SNN_USE_HALF
+
+/**
+ * The number of values making up the partial result of reducing a slice of
+ * the outer dimension with Op.
+ */
+template <typename Op>
+struct PartialSize : std::integral_constant<int, 1> {};
+
+/**
+ * LogSumExp keeps both the largest value and the sum of exponentials relative
+ * to that value.
+ */
+template <>
+struct PartialSize<LogSumExp> : std::integral_constant<int, 2> {};
+
+/**
+ * Get the number of elements needed in the workspace of a reduction which
+ * splits the outer dimension into n_splits slices.
+ *
+ * \param batches  The number of batches.
+ * \param inner    The inner size.
+ * \param n_splits The number of slices the outer dimension is split into.
+ * \return The number of elements needed in the workspace.
+ */
+template <typename Op>
+inline size_t get_split_workspace_size(int batches, int inner, int n_splits) {
+  return static_cast<size_t>(PartialSize<Op>::value) * n_splits * batches *
+         inner;
+}
+
+/**
+ * Choose the number of slices to split the outer dimension into.
+ *
+ * Splitting is only worthwhile when there are too few outputs to occupy the
+ * device with a work item per output, but the outer dimension is long.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ *
+ * \param batches The number of batches.
+ * \param outer   The outer size.
+ * \param inner   The inner size.
+ * \return The number of slices to use in launch_split(). A value of 1 means
+ *         that the reduction should not be split.
+ */
+SNN_EXPORT int get_split_count(int batches, int outer, int inner);
+
+/**
+ * The internal reduce launcher, which reduces each output in a single work
+ * item.
  *
  * Implemented in the compiled SYCL DNN library.
  */
@@ -37,6 +109,54 @@ SNN_EXPORT SNNStatus launch(BaseMemObject<T const>& input,
                             BaseMemObject<T>& output, int batches, int outer,
                             int inner, cl::sycl::queue& queue);
 
+/**
+ * The internal reduce launcher which splits the outer dimension of each output
+ * into n_splits slices. The partial result of each slice is written to the
+ * workspace, then a second kernel combines the partial results of each output.
+ * When the inner size is one and there are only a few outputs, each slice is
+ * reduced across a workgroup rather than in a single work item.
+ *
+ * The workspace must hold at least get_split_workspace_size<Op>() elements.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T, typename Op>
+SNN_EXPORT SNNStatus
+launch_split(BaseMemObject<T const>& input,
+             BaseMemObject<typename PartialType<T>::type>& workspace,
+             BaseMemObject<T>& output, int batches, int outer, int inner,
+             int n_splits, cl::sycl::queue& queue);
+
+/**
+ * The internal launcher for reductions which compute the index in the outer
+ * dimension of the best value, such as ArgMax, using a single work item for
+ * each output.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T, typename Op>
+SNN_EXPORT SNNStatus launch_arg(BaseMemObject<T const>& input,
+                                BaseMemObject<int32_t>& output, int batches,
+                                int outer, int inner, cl::sycl::queue& queue);
+
+/**
+ * The internal launcher for index reductions which splits the outer dimension
+ * of each output into n_splits slices, in the same way as launch_split(). The
+ * best value and its index in each slice are written to the two workspaces,
+ * with ties resolved in favour of the lowest index.
+ *
+ * Both workspaces must hold at least get_split_workspace_size<Op>() elements.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T, typename Op>
+SNN_EXPORT SNNStatus
+launch_arg_split(BaseMemObject<T const>& input,
+                 BaseMemObject<typename PartialType<T>::type>& value_workspace,
+                 BaseMemObject<int32_t>& index_workspace,
+                 BaseMemObject<int32_t>& output, int batches, int outer,
+                 int inner, int n_splits, cl::sycl::queue& queue);
+
 }  // namespace internal
 }  // namespace reduce
 }  // namespace sycldnn
@@ -0,0 +1,75 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_SOFTMAX_LAUNCH_H_
+#define SYCLDNN_INCLUDE_INTERNAL_SOFTMAX_LAUNCH_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace softmax {
+namespace internal {
+
+/**
+ * The internal launcher for a forward softmax along the innermost dimension
+ * of a tensor, computed in a single kernel.
+ *
+ * Implemented in the compiled SYCL-DNN library.
+ *
+ * \param input    Input tensor of shape [n_rows, channels].
+ * \param output   Output tensor of shape [n_rows, channels].
+ * \param n_rows   Number of independent rows to compute softmax over.
+ * \param channels Number of elements in each row.
+ * \param queue    Queue to launch the kernel on.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_softmax_forward(BaseMemObject<T const>& input,
+                                            BaseMemObject<T>& output,
+                                            int n_rows, int channels,
+                                            cl::sycl::queue& queue);
+
+/**
+ * The internal launcher for the gradient of a softmax along the innermost
+ * dimension of a tensor, computed in a single kernel.
+ *
+ * Implemented in the compiled SYCL-DNN library.
+ *
+ * \param output         Output of the forward softmax, of shape
+ *                       [n_rows, channels].
+ * \param gradient       Gradient with respect to the softmax output, of shape
+ *                       [n_rows, channels].
+ * \param input_backprop Gradient with respect to the softmax input, of shape
+ *                       [n_rows, channels].
+ * \param n_rows         Number of independent rows the softmax was computed
+ *                       over.
+ * \param channels       Number of elements in each row.
+ * \param queue          Queue to launch the kernel on.
+ */
+template <typename T>
+SNN_EXPORT SNNStatus launch_softmax_gradient(
+    BaseMemObject<T const>& output, BaseMemObject<T const>& gradient,
+    BaseMemObject<T>& input_backprop, int n_rows, int channels,
+    cl::sycl::queue& queue);
+
+}  // namespace internal
+}  // namespace softmax
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_SOFTMAX_LAUNCH_H_
@@ -19,14 +19,9 @@
 
 #include "sycldnn/status.h"
 
-#include "sycldnn/internal/pointwise/launch_internal.h"
-#include "sycldnn/pointwise/direction.h"
-#include "sycldnn/pointwise/operators.h"
+#include "sycldnn/helpers/macros.h"
 
-#include "sycldnn/binaryop/operators.h"
-#include "sycldnn/internal/binaryop/launch.h"
-
-#include "sycldnn/reduce/operators.h"
+#include "sycldnn/internal/softmax/launch.h"
 
 namespace sycldnn {
 namespace softmax {
@@ -43,8 +38,9 @@ using DisableIfGradient = typename std::enable_if<
 /**
  * The internal softmax launcher for Forward direction.
  *
- * Performs an element-wise exponentiation, followed by reduction
- * and then the pointwise division.
+ * Computes the maximum of each row, the sum of exponentials relative to the
+ * maximum and the normalised outputs in a single kernel, so the output is
+ * only written once. The workspace is not needed.
  */
 template <typename T, typename Direction, typename Backend,
           typename = DisableIfGradient<Direction>>
@@ -52,42 +48,22 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T> workspace,
                  typename Backend::template pointer_type<T> output,
                  SoftmaxParams const& params, Backend& backend) {
-  auto n_items = params.batch * params.channels * params.rows * params.cols;
+  SNN_UNUSED_VAR(workspace)
+  auto n_rows = params.batch * params.rows * params.cols;
+  auto n_items = n_rows * params.channels;
   auto queue = backend.get_queue();
   auto in_mem = backend.get_mem_object(input, n_items);
   auto out_mem = backend.get_mem_object(output, n_items);
-  auto workspace_items = params.batch * params.rows * params.cols;
-
-  SNNStatus status = pointwise::internal::launch_pointwise<T, pointwise::Exp,
-                                                           pointwise::Forward>(
-      in_mem, out_mem, n_items, queue);
-
-  if (sycldnn::StatusCode::OK != status.status) return status;
-
-  using ConstPointer = typename Backend::template pointer_type<T const>;
-  status.event = backend.template reduce<reduce::Add>(
-      ConstPointer{output}, workspace, params.batch * params.rows * params.cols,
-      params.channels, 1);
-
-  auto const_workspace = ConstPointer{workspace};
-  auto const_workspace_mem =
-      backend.get_mem_object(const_workspace, workspace_items);
 
-  auto const_output = ConstPointer{output};
-  auto const_output_mem = backend.get_mem_object(const_output, n_items);
-
-  status =
-      binaryop::internal::launch_binaryop<T, binaryop::internal::SoftmaxDiv>(
-          const_output_mem, const_workspace_mem, out_mem, params.channels,
-          queue);
-  return status;
+  return launch_softmax_forward<T>(in_mem, out_mem, n_rows, params.channels,
+                                   queue);
 }
 
 /**
  * The internal softmax launcher for Gradient (Backward) direction.
  *
- * Performs an binary elementwise multiplication, followed by summation,
- * subtraction and then again multiplication.
+ * Computes y * (dy - sum(dy * y)) for each row in a single kernel, using a
+ * workgroup reduction for the sum. The workspace is not needed.
  */
 template <typename T, typename Direction, typename Backend,
           typename = EnableIfGradient<Direction>>
@@ -96,43 +72,16 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T> workspace,
                  typename Backend::template pointer_type<T> output,
                  SoftmaxParams const& params, Backend& backend) {
-  auto n_items1 = params.batch * params.rows * params.cols * params.channels;
-  auto n_items2 = params.batch * params.rows * params.cols;
-
-  auto in_mem = backend.get_mem_object(input, n_items1);
-  auto grad_mem = backend.get_mem_object(gradient, n_items1);
-  auto workspace_mem = backend.get_mem_object(workspace, n_items1);
-  auto out_mem = backend.get_mem_object(output, n_items1);
-
+  SNN_UNUSED_VAR(workspace)
+  auto n_rows = params.batch * params.rows * params.cols;
+  auto n_items = n_rows * params.channels;
   auto queue = backend.get_queue();
+  auto in_mem = backend.get_mem_object(input, n_items);
+  auto grad_mem = backend.get_mem_object(gradient, n_items);
+  auto out_mem = backend.get_mem_object(output, n_items);
 
-  SNNStatus status = binaryop::internal::launch_binaryop<T, binaryop::Mul>(
-      grad_mem, in_mem, workspace_mem, n_items1, queue);
-
-  if (sycldnn::StatusCode::OK != status.status) return status;
-
-  using ConstPointer = typename Backend::template pointer_type<T const>;
-
-  auto const_workspace = ConstPointer{workspace};
-  auto const_workspace_mem = backend.get_mem_object(const_workspace, n_items1);
-
-  status.event = backend.template reduce<reduce::Add>(
-      const_workspace, output, params.batch * params.rows * params.cols,
-      params.channels, 1);
-
-  auto const_output = ConstPointer{output};
-  auto const_output_mem = backend.get_mem_object(const_output, n_items2);
-
-  status =
-      binaryop::internal::launch_binaryop<T, binaryop::internal::SoftmaxSub>(
-          grad_mem, const_output_mem, workspace_mem, params.channels, queue);
-
-  if (sycldnn::StatusCode::OK != status.status) return status;
-
-  status = binaryop::internal::launch_binaryop<T, binaryop::Mul>(
-      const_workspace_mem, in_mem, out_mem, n_items1, queue);
-
-  return status;
+  return launch_softmax_gradient<T>(in_mem, grad_mem, out_mem, n_rows,
+                                    params.channels, queue);
 }
 
 }  // namespace internal
@@ -0,0 +1,62 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_MATMUL_CONFIG_H_
+#define SYCLDNN_INCLUDE_MATMUL_CONFIG_H_
+
+/**
+ * \file
+ * Defines the \ref sycldnn::matmul::MatmulConfig struct, which describes the
+ * tile sizes and work-group shape used to compute a matrix multiply.
+ */
+namespace sycldnn {
+namespace matmul {
+
+/** The tile sizes and work-group shape used by the matmul kernel. */
+struct MatmulConfig {
+  /** The number of output rows computed by each work item. */
+  int row_tile;
+  /** The number of values along the accumulation dimension loaded at once. */
+  int acc_tile;
+  /** The number of output columns computed by each work item. */
+  int col_tile;
+  /** The number of work items in a work-group along the output rows. */
+  int wg_rows;
+  /** The number of work items in a work-group along the output columns. */
+  int wg_cols;
+  /** The number of work items in a work-group along the batch dimension. */
+  int wg_batch;
+};
+
+/**
+ * Compare two matmul configurations.
+ * \param lhs The first configuration.
+ * \param rhs The second configuration.
+ * \return Whether the tile sizes and work-group shapes match.
+ */
+inline bool operator==(MatmulConfig const& lhs, MatmulConfig const& rhs) {
+  return lhs.row_tile == rhs.row_tile && lhs.acc_tile == rhs.acc_tile &&
+         lhs.col_tile == rhs.col_tile && lhs.wg_rows == rhs.wg_rows &&
+         lhs.wg_cols == rhs.wg_cols && lhs.wg_batch == rhs.wg_batch;
+}
+
+/** \copydoc operator==() */
+inline bool operator!=(MatmulConfig const& lhs, MatmulConfig const& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_MATMUL_CONFIG_H_
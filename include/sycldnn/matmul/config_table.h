@@ -0,0 +1,149 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_MATMUL_CONFIG_TABLE_H_
+#define SYCLDNN_INCLUDE_MATMUL_CONFIG_TABLE_H_
+
+/**
+ * \file
+ * Contains the declaration of the \ref sycldnn::matmul::MatmulConfigTable
+ * class, which stores measured matmul configurations for specific matrix
+ * sizes.
+ */
+#include "sycldnn/matmul/config.h"
+
+#include <string>
+#include <unordered_map>
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace matmul {
+
+/**
+ * Map from matrix multiply sizes to the fastest measured configuration.
+ *
+ * Matrix sizes which are not in the table fall back to the shape based
+ * heuristic in \ref sycldnn::matmul::get_default_config. The table can
+ * optionally be backed by a file, in which case entries are loaded on
+ * construction and can be written back with \ref MatmulConfigTable::save.
+ */
+class SNN_EXPORT MatmulConfigTable {
+ public:
+  /**
+   * Construct a table which is only held in memory.
+   */
+  MatmulConfigTable() = default;
+
+  /**
+   * Construct a table backed by the given file. Any entries already stored in
+   * the file are loaded.
+   *
+   * \param file_path Path to the table file. The file does not need to exist.
+   */
+  explicit MatmulConfigTable(std::string file_path);
+
+  /**
+   * Look up the stored configuration for a matrix multiply.
+   *
+   * \param batches The number of matrices in each tensor.
+   * \param m       The number of rows in the output.
+   * \param k       The size of the accumulation dimension.
+   * \param n       The number of columns in the output.
+   * \param config  Set to the stored configuration if one is found.
+   * \return Whether an entry exists for the sizes.
+   */
+  template <bool TransposeLHS, bool TransposeRHS>
+  bool lookup(int batches, int m, int k, int n, MatmulConfig& config) const {
+    return lookup(TransposeLHS, TransposeRHS, batches, m, k, n, config);
+  }
+
+  /**
+   * Store the configuration to use for a matrix multiply, replacing any
+   * existing entry.
+   *
+   * \param batches The number of matrices in each tensor.
+   * \param m       The number of rows in the output.
+   * \param k       The size of the accumulation dimension.
+   * \param n       The number of columns in the output.
+   * \param config  The configuration to store.
+   */
+  template <bool TransposeLHS, bool TransposeRHS>
+  void insert(int batches, int m, int k, int n, MatmulConfig const& config) {
+    insert(TransposeLHS, TransposeRHS, batches, m, k, n, config);
+  }
+
+  /**
+   * Get the configuration to use for a matrix multiply, using the stored
+   * entry if there is one and the default heuristic otherwise.
+   *
+   * \param batches The number of matrices in each tensor.
+   * \param m       The number of rows in the output.
+   * \param k       The size of the accumulation dimension.
+   * \param n       The number of columns in the output.
+   * \return The configuration to use.
+   */
+  template <bool TransposeLHS, bool TransposeRHS>
+  MatmulConfig select(int batches, int m, int k, int n) const {
+    return select(TransposeLHS, TransposeRHS, batches, m, k, n);
+  }
+
+  /**
+   * Write all entries to the backing file.
+   *
+   * \return Whether the file was successfully written. Always false for a
+   *         table without a backing file.
+   */
+  bool save() const;
+
+  /**
+   * Get the number of entries in the table.
+   * \return The number of stored entries.
+   */
+  size_t size() const { return entries_.size(); }
+
+  /**
+   * Get the path of the backing file.
+   * \return The file path, or an empty string if the table is in memory only.
+   */
+  std::string const& file_path() const { return file_path_; }
+
+  /**
+   * Get a file name which uniquely identifies a device and its driver, so that
+   * results measured on one device are never applied to another.
+   *
+   * \param device The SYCL device that the results were measured on.
+   * \return A file name, without any directory component.
+   */
+  static std::string file_name_for(cl::sycl::device const& device);
+
+ private:
+  bool lookup(bool transpose_lhs, bool transpose_rhs, int batches, int m,
+              int k, int n, MatmulConfig& config) const;
+  void insert(bool transpose_lhs, bool transpose_rhs, int batches, int m,
+              int k, int n, MatmulConfig const& config);
+  MatmulConfig select(bool transpose_lhs, bool transpose_rhs, int batches,
+                      int m, int k, int n) const;
+  void load();
+
+  std::string file_path_;
+  std::unordered_map<std::string, MatmulConfig> entries_;
+};
+
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_MATMUL_CONFIG_TABLE_H_
@@ -24,8 +24,18 @@
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
+#include "sycldnn/matmul/config.h"
+#include "sycldnn/matmul/config_table.h"
+
 #include "sycldnn/helpers/macros.h"
 #include "sycldnn/internal/matmul/launch.h"
+#include "sycldnn/internal/helpers/scoped_dependencies.h"
+
+#include "sycldnn/quantize/launch.h"
+#include "sycldnn/quantize/params.h"
+
+#include <cstdint>
+#include <vector>
 
 namespace sycldnn {
 namespace matmul {
@@ -51,6 +61,8 @@ namespace matmul {
  * \param beta A scalar value to scale the output tensor.
  * \param backend The backend implementation, used to map between pointer
  *                representations.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
  * \return Returns an SNNStatus containing the SYCL event tied to the kernel
  *         launches and a StatusCode enum showing if the launch was OK or
  *         whether it encountered some problem.
@@ -59,7 +71,10 @@ template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend>
 SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
                  typename Backend::template pointer_type<T const> rhs,
                  typename Backend::template pointer_type<T> output, int batches,
-                 int m, int k, int n, T beta, Backend& backend) {
+                 int m, int k, int n, T beta, Backend& backend,
+                 std::vector<cl::sycl::event> const& dependencies = {}) {
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
   SNN_VALIDATE_PARAM(batches > 0, "The number of batches must be positive.");
   SNN_VALIDATE_PARAM(m > 0, "The value of m must be positive.");
   SNN_VALIDATE_PARAM(k > 0, "The value of k must be positive.");
@@ -78,6 +93,314 @@ SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
   return internal::launch<T, TransposeLHS, TransposeRHS>(
       lhs_acc, rhs_acc, out_acc, batches, m, k, n, beta, sycl_queue);
 }
+
+/**
+ * Launch a batched matrix multiplication using the given tile sizes and
+ * work-group shape.
+ *
+ * \copydetails launch
+ * \param config The tile sizes and work-group shape to use. The tile sizes
+ *               must be one of those returned by get_configs(), otherwise
+ *               StatusCode::InvalidAlgorithm is returned.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend>
+SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
+                 typename Backend::template pointer_type<T const> rhs,
+                 typename Backend::template pointer_type<T> output, int batches,
+                 int m, int k, int n, T beta, MatmulConfig const& config,
+                 Backend& backend,
+                 std::vector<cl::sycl::event> const& dependencies = {}) {
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
+  SNN_VALIDATE_PARAM(batches > 0, "The number of batches must be positive.");
+  SNN_VALIDATE_PARAM(m > 0, "The value of m must be positive.");
+  SNN_VALIDATE_PARAM(k > 0, "The value of k must be positive.");
+  SNN_VALIDATE_PARAM(n > 0, "The value of n must be positive.");
+  SNN_VALIDATE_PARAM(config.wg_rows > 0 && config.wg_cols > 0 &&
+                         config.wg_batch > 0,
+                     "The work-group sizes must be positive.");
+
+  size_t lhs_size = batches * m * k;
+  size_t rhs_size = batches * k * n;
+  size_t out_size = batches * m * n;
+
+  auto lhs_acc = backend.get_mem_object(lhs, lhs_size);
+  auto rhs_acc = backend.get_mem_object(rhs, rhs_size);
+  auto out_acc = backend.get_mem_object(output, out_size);
+
+  auto sycl_queue = backend.get_queue();
+
+  return internal::launch<T, TransposeLHS, TransposeRHS>(
+      lhs_acc, rhs_acc, out_acc, batches, m, k, n, beta, config, sycl_queue);
+}
+
+/**
+ * Launch a batched matrix multiplication using the configuration stored in a
+ * table of measured results, or the default heuristic if the matrix sizes are
+ * not in the table.
+ *
+ * \copydetails launch
+ * \param table The table of measured configurations.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend>
+SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
+                 typename Backend::template pointer_type<T const> rhs,
+                 typename Backend::template pointer_type<T> output, int batches,
+                 int m, int k, int n, T beta, MatmulConfigTable const& table,
+                 Backend& backend,
+                 std::vector<cl::sycl::event> const& dependencies = {}) {
+  auto const config =
+      table.template select<TransposeLHS, TransposeRHS>(batches, m, k, n);
+  return launch<T, TransposeLHS, TransposeRHS>(lhs, rhs, output, batches, m, k,
+                                               n, beta, config, backend,
+                                               dependencies);
+}
+
+/**
+ * Launch a batched matrix multiplication using the kernel which cooperatively
+ * stages panels of the input matrices in local memory.
+ *
+ * This kernel reduces the global memory traffic for large matrices on devices
+ * with dedicated local memory. Use use_local_mem_kernel() to check whether it
+ * is likely to be faster than the default kernel.
+ *
+ * \copydetails launch
+ * \return Returns StatusCode::InvalidAlgorithm if the device does not provide
+ *         enough local memory or a large enough work-group size.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend>
+SNNStatus launch_local_mem(
+    typename Backend::template pointer_type<T const> lhs,
+    typename Backend::template pointer_type<T const> rhs,
+    typename Backend::template pointer_type<T> output, int batches, int m,
+    int k, int n, T beta, Backend& backend,
+    std::vector<cl::sycl::event> const& dependencies = {}) {
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
+  SNN_VALIDATE_PARAM(batches > 0, "The number of batches must be positive.");
+  SNN_VALIDATE_PARAM(m > 0, "The value of m must be positive.");
+  SNN_VALIDATE_PARAM(k > 0, "The value of k must be positive.");
+  SNN_VALIDATE_PARAM(n > 0, "The value of n must be positive.");
+
+  size_t lhs_size = batches * m * k;
+  size_t rhs_size = batches * k * n;
+  size_t out_size = batches * m * n;
+
+  auto lhs_acc = backend.get_mem_object(lhs, lhs_size);
+  auto rhs_acc = backend.get_mem_object(rhs, rhs_size);
+  auto out_acc = backend.get_mem_object(output, out_size);
+
+  auto sycl_queue = backend.get_queue();
+
+  return internal::launch_local_mem<T, TransposeLHS, TransposeRHS>(
+      lhs_acc, rhs_acc, out_acc, batches, m, k, n, beta, sycl_queue);
+}
+
+/**
+ * Check whether the local memory kernel should be used for a matrix multiply.
+ *
+ * The local memory kernel is only chosen for devices which report dedicated
+ * local memory, and for matrices large enough to fill its work-groups.
+ *
+ * \param device  The SYCL device that the matrix multiply will run on.
+ * \param batches The number of matrices in each tensor.
+ * \param m       The number of rows in the output.
+ * \param k       The size of the accumulation dimension.
+ * \param n       The number of columns in the output.
+ * \return Whether launch_local_mem() should be used instead of launch().
+ */
+template <typename T>
+bool use_local_mem_kernel(cl::sycl::device const& device, int batches, int m,
+                          int k, int n) {
+  return internal::use_local_mem_kernel<T>(device, batches, m, k, n);
+}
+
+/**
+ * Get the number of elements required in the workspace passed to
+ * launch_split_k(). The elements have the type given by
+ * internal::PartialType<T>.
+ *
+ * \param batches  The number of matrices in each tensor.
+ * \param m        The number of rows in the output.
+ * \param n        The number of columns in the output.
+ * \param n_splits The number of slices the accumulation dimension is split
+ *                 into.
+ * \return The number of elements needed in the workspace.
+ */
+inline size_t get_split_k_workspace_size(int batches, int m, int n,
+                                         int n_splits) {
+  return static_cast<size_t>(n_splits) * batches * m * n;
+}
+
+/**
+ * Choose the number of slices to split the accumulation dimension into.
+ *
+ * Splitting is only worthwhile when the output is too small to occupy the
+ * device, but the accumulation dimension is large, such as the matrix
+ * multiplies computing the filter gradients of a convolution.
+ *
+ * \param batches The number of matrices in each tensor.
+ * \param m       The number of rows in the output.
+ * \param k       The size of the accumulation dimension.
+ * \param n       The number of columns in the output.
+ * \return The number of slices to use in launch_split_k(). A value of 1
+ *         means that the matrix multiply should not be split.
+ */
+inline int get_split_k_count(int batches, int m, int k, int n) {
+  return internal::get_split_k_count(batches, m, k, n);
+}
+
+/**
+ * Launch a batched matrix multiplication which splits the accumulation
+ * dimension across work items.
+ *
+ * Each of the n_splits slices of the accumulation dimension is computed
+ * separately, with the partial products stored in the workspace, before the
+ * partial products are summed into the output. The partial products are kept
+ * in the accumulator type, so half precision partial products are stored in
+ * single precision.
+ *
+ * \copydetails launch
+ * \param workspace A pointer to a temporary buffer of at least
+ *                  get_split_k_workspace_size() elements of
+ *                  internal::PartialType<T>.
+ * \param n_splits  The number of slices to split the accumulation dimension
+ *                  into. Must be a positive value.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend>
+SNNStatus launch_split_k(
+    typename Backend::template pointer_type<T const> lhs,
+    typename Backend::template pointer_type<T const> rhs,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<
+        typename internal::PartialType<T>::type>
+        workspace,
+    int batches, int m, int k, int n, T beta, int n_splits, Backend& backend,
+    std::vector<cl::sycl::event> const& dependencies = {}) {
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
+  SNN_VALIDATE_PARAM(batches > 0, "The number of batches must be positive.");
+  SNN_VALIDATE_PARAM(m > 0, "The value of m must be positive.");
+  SNN_VALIDATE_PARAM(k > 0, "The value of k must be positive.");
+  SNN_VALIDATE_PARAM(n > 0, "The value of n must be positive.");
+  SNN_VALIDATE_PARAM(n_splits > 0, "The number of splits must be positive.");
+
+  size_t lhs_size = batches * m * k;
+  size_t rhs_size = batches * k * n;
+  size_t out_size = batches * m * n;
+  size_t workspace_size = get_split_k_workspace_size(batches, m, n, n_splits);
+
+  auto lhs_acc = backend.get_mem_object(lhs, lhs_size);
+  auto rhs_acc = backend.get_mem_object(rhs, rhs_size);
+  auto out_acc = backend.get_mem_object(output, out_size);
+  auto ws_acc = backend.get_mem_object(workspace, workspace_size);
+
+  auto sycl_queue = backend.get_queue();
+
+  return internal::launch_split_k<T, TransposeLHS, TransposeRHS>(
+      lhs_acc, rhs_acc, out_acc, ws_acc, batches, m, k, n, n_splits, beta,
+      sycl_queue);
+}
+
+/**
+ * Launch an int8 quantized batched matrix multiplication.
+ *
+ * The int8 values of the left and right hand side matrices are offset by the
+ * input and filter zero points respectively, and their products accumulated
+ * in int32 along with the int32 bias. Each output column c is then
+ * requantized to int8 as
+ *
+ *     output = clamp(round(acc * scales[c]) + zero_points[c], min, max)
+ *
+ * using the activation bounds in the requantization parameters. The columns of
+ * the output correspond to the output channels of a fully connected layer.
+ *
+ * \param lhs               A pointer to the int8 left hand side matrices.
+ * \param rhs               A pointer to the int8 right hand side matrices.
+ * \param bias              A pointer to the int32 bias, holding one value per
+ *                          output column.
+ * \param scales            A pointer to the per-column requantization scales.
+ * \param zero_points       A pointer to the per-column output zero points.
+ * \param output            A pointer to the int8 output matrices.
+ * \param batches           The number of matrices in each tensor.
+ * \param m                 The number of rows in the output.
+ * \param k                 The size of the accumulation dimension.
+ * \param n                 The number of columns in the output.
+ * \param requantize_params The zero points of the inputs and the bounds of the
+ *                          quantized output.
+ * \param backend           The backend providing access to the SYCL buffers
+ *                          corresponding to the pointers.
+ * \param dependencies      Optional list of events which must complete before
+ *                          the operation's kernels can start.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <bool TransposeLHS, bool TransposeRHS, typename Backend>
+SNNStatus launch_quantized(
+    typename Backend::template pointer_type<int8_t const> lhs,
+    typename Backend::template pointer_type<int8_t const> rhs,
+    typename Backend::template pointer_type<int32_t const> bias,
+    typename Backend::template pointer_type<float const> scales,
+    typename Backend::template pointer_type<int32_t const> zero_points,
+    typename Backend::template pointer_type<int8_t> output, int batches, int m,
+    int k, int n, quantize::RequantizeParams const& requantize_params,
+    Backend& backend, std::vector<cl::sycl::event> const& dependencies = {}) {
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
+  SNN_VALIDATE_PARAM(batches > 0, "The number of batches must be positive.");
+  SNN_VALIDATE_PARAM(m > 0, "The value of m must be positive.");
+  SNN_VALIDATE_PARAM(k > 0, "The value of k must be positive.");
+  SNN_VALIDATE_PARAM(n > 0, "The value of n must be positive.");
+  auto validation_status =
+      quantize::internal::validate_params(requantize_params);
+  if (validation_status.status != StatusCode::OK) {
+    return validation_status;
+  }
+
+  size_t lhs_size = batches * m * k;
+  size_t rhs_size = batches * k * n;
+  size_t out_size = batches * m * n;
+
+  auto lhs_acc = backend.get_mem_object(lhs, lhs_size);
+  auto rhs_acc = backend.get_mem_object(rhs, rhs_size);
+  auto bias_acc = backend.get_mem_object(bias, n);
+  auto scale_acc = backend.get_mem_object(scales, n);
+  auto zero_point_acc = backend.get_mem_object(zero_points, n);
+  auto out_acc = backend.get_mem_object(output, out_size);
+
+  auto sycl_queue = backend.get_queue();
+
+  return internal::launch_quantized<TransposeLHS, TransposeRHS>(
+      lhs_acc, rhs_acc, bias_acc, scale_acc, zero_point_acc, out_acc, batches,
+      m, k, n, requantize_params, sycl_queue);
+}
+
+/**
+ * Get every tile size and work-group shape combination available in the
+ * library.
+ *
+ * \return A list of configurations which can be passed to launch.
+ */
+inline std::vector<MatmulConfig> get_configs() {
+  return internal::get_configs();
+}
+
+/**
+ * Get the configuration chosen by the shape based heuristic used when no
+ * configuration is provided to launch.
+ *
+ * \param batches The number of matrices in each tensor.
+ * \param m       The number of rows in the output.
+ * \param k       The size of the accumulation dimension.
+ * \param n       The number of columns in the output.
+ * \return The default configuration for the matrix sizes.
+ */
+inline MatmulConfig get_default_config(int batches, int m, int k, int n) {
+  return internal::get_default_config(batches, m, k, n);
+}
 }  // namespace matmul
 }  // namespace sycldnn
 #endif  // SYCLDNN_INCLUDE_MATMUL_LAUNCH_H_
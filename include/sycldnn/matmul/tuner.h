@@ -0,0 +1,136 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_MATMUL_TUNER_H_
+#define SYCLDNN_INCLUDE_MATMUL_TUNER_H_
+
+/**
+ * \file
+ * Contains helpers to time the matmul configurations available in the library
+ * on the target device, and record the fastest in a
+ * \ref sycldnn::matmul::MatmulConfigTable.
+ */
+#include "sycldnn/status.h"
+
+#include "sycldnn/matmul/config.h"
+#include "sycldnn/matmul/config_table.h"
+#include "sycldnn/matmul/launch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+
+namespace sycldnn {
+namespace matmul {
+
+/** The result of tuning a matrix multiply. */
+struct MatmulTuningResult {
+  /**
+   * StatusCode::OK if a configuration was found, otherwise
+   * StatusCode::InvalidAlgorithm.
+   */
+  StatusCode status;
+  /** The fastest configuration. */
+  MatmulConfig config;
+  /** The fastest measured runtime in seconds. */
+  double seconds;
+};
+
+/**
+ * Time every configuration available in the library for the given matrix
+ * sizes and return the fastest.
+ *
+ * Each configuration is launched once to ensure any kernel compilation is not
+ * included in the measurements, then timed n_runs times. Configurations which
+ * fail to launch on the device, for example because the work-group is too
+ * large, are skipped.
+ *
+ * \param lhs     Pointer to the left hand matrix.
+ * \param rhs     Pointer to the right hand matrix.
+ * \param output  Pointer to the output matrix, which will be overwritten.
+ * \param batches The number of matrices in each tensor.
+ * \param m       The number of rows in the output.
+ * \param k       The size of the accumulation dimension.
+ * \param n       The number of columns in the output.
+ * \param backend The backend used to launch the kernels.
+ * \param n_runs  The number of timed launches of each configuration.
+ * \return The fastest configuration, or a status of
+ *         StatusCode::InvalidAlgorithm if no configuration could be used.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend>
+MatmulTuningResult tune(typename Backend::template pointer_type<T const> lhs,
+                        typename Backend::template pointer_type<T const> rhs,
+                        typename Backend::template pointer_type<T> output,
+                        int batches, int m, int k, int n, Backend& backend,
+                        int n_runs = 3) {
+  using Clock = std::chrono::steady_clock;
+  using Seconds = std::chrono::duration<double>;
+
+  MatmulTuningResult result{StatusCode::InvalidAlgorithm, MatmulConfig{}, 0.};
+  for (auto const& config : get_configs()) {
+    try {
+      auto status = launch<T, TransposeLHS, TransposeRHS>(
+          lhs, rhs, output, batches, m, k, n, static_cast<T>(0), config,
+          backend);
+      if (status.status != StatusCode::OK) {
+        continue;
+      }
+      status.event.wait_and_throw();
+
+      auto fastest = Seconds::max();
+      for (int i = 0; i < n_runs; ++i) {
+        auto start = Clock::now();
+        status = launch<T, TransposeLHS, TransposeRHS>(
+            lhs, rhs, output, batches, m, k, n, static_cast<T>(0), config,
+            backend);
+        status.event.wait_and_throw();
+        auto end = Clock::now();
+        fastest = std::min<Seconds>(fastest, end - start);
+      }
+      if (result.status != StatusCode::OK ||
+          fastest.count() < result.seconds) {
+        result = MatmulTuningResult{StatusCode::OK, config, fastest.count()};
+      }
+    } catch (std::exception const&) {
+      continue;
+    }
+  }
+  return result;
+}
+
+/**
+ * Tune a matrix multiply and store the fastest configuration in a table.
+ *
+ * \copydetails tune
+ * \param table   The table to store the result in.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend>
+MatmulTuningResult tune_into(
+    typename Backend::template pointer_type<T const> lhs,
+    typename Backend::template pointer_type<T const> rhs,
+    typename Backend::template pointer_type<T> output, int batches, int m,
+    int k, int n, MatmulConfigTable& table, Backend& backend, int n_runs = 3) {
+  auto result = tune<T, TransposeLHS, TransposeRHS>(lhs, rhs, output, batches,
+                                                    m, k, n, backend, n_runs);
+  if (result.status == StatusCode::OK) {
+    table.template insert<TransposeLHS, TransposeRHS>(batches, m, k, n,
+                                                      result.config);
+  }
+  return result;
+}
+
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_MATMUL_TUNER_H_
@@ -20,10 +20,17 @@
  * \file
  * Provides the \ref sycldnn::MemObject and \ref sycldnn::BaseMemObject classes,
  * along with the \ref sycldnn::make_mem_object helper function.
+ *
+ * When USM support is enabled this also provides the \ref
+ * sycldnn::USMMemObject class and \ref sycldnn::make_usm_mem_object helper.
  */
 #include "sycldnn/accessor_types.h"
+#include "sycldnn/helpers/dependencies.h"
 #include "sycldnn/helpers/macros.h"
 
+#include <utility>
+#include <vector>
+
 #include <CL/sycl.hpp>
 
 namespace sycldnn {
@@ -120,22 +127,32 @@ struct MemObject final : public BaseMemObject<T> {
    * \param offset The offset from the start of the buffer (in number of
    *               elements) to use as the initial index for the memory
    * object.
+   * \param dependencies Events which must complete before any kernel using
+   *                     this memory can start, in addition to those tracked
+   *                     by the SYCL runtime for the buffer.
    */
-  MemObject(Buffer buffer, size_t extent, size_t offset)
-      : buffer_{buffer}, extent_{extent}, offset_{offset} {}
+  MemObject(Buffer buffer, size_t extent, size_t offset,
+            std::vector<cl::sycl::event> dependencies = {})
+      : buffer_{buffer},
+        extent_{extent},
+        offset_{offset},
+        dependencies_{std::move(dependencies)} {}
 
   /** \copydoc BaseMemObject<T>::read_accessor */
   ReadAccessor<DataType> read_accessor(Handler& cgh) override {
+    helpers::add_dependencies(cgh, dependencies_);
     return {buffer_, cgh, extent_, offset_};
   }
 
   /** \copydoc BaseMemObject<T>::read_write_accessor */
   ReadWriteAccessor<DataType> read_write_accessor(Handler& cgh) override {
+    helpers::add_dependencies(cgh, dependencies_);
     return {buffer_, cgh, extent_, offset_};
   }
 
   /** \copydoc BaseMemObject<T>::write_accessor */
   WriteAccessor<DataType> write_accessor(Handler& cgh) override {
+    helpers::add_dependencies(cgh, dependencies_);
     return {buffer_, cgh, extent_, offset_};
   }
 
@@ -171,6 +188,8 @@ struct MemObject final : public BaseMemObject<T> {
   size_t extent_;
   /** The offset from the start of the buffer (in elements). */
   size_t offset_;
+  /** Additional events that kernels using this memory must wait for. */
+  std::vector<cl::sycl::event> dependencies_;
 };
 
 /**
@@ -192,11 +211,16 @@ struct MemObject<T const, Alloc> final : public BaseMemObject<T const> {
 
  public:
   /** \copydoc MemObject<T>::MemObject */
-  MemObject(Buffer buffer, size_t extent, size_t offset)
-      : buffer_{buffer}, extent_{extent}, offset_{offset} {}
+  MemObject(Buffer buffer, size_t extent, size_t offset,
+            std::vector<cl::sycl::event> dependencies = {})
+      : buffer_{buffer},
+        extent_{extent},
+        offset_{offset},
+        dependencies_{std::move(dependencies)} {}
 
   /** \copydoc BaseMemObject<T>::read_accessor */
   ReadAccessor<DataType> read_accessor(Handler& cgh) override {
+    helpers::add_dependencies(cgh, dependencies_);
     return {buffer_, cgh, extent_, offset_};
   }
 
@@ -222,6 +246,8 @@ struct MemObject<T const, Alloc> final : public BaseMemObject<T const> {
   size_t extent_;
   /** The offset from the start of the buffer (in elements). */
   size_t offset_;
+  /** Additional events that kernels using this memory must wait for. */
+  std::vector<cl::sycl::event> dependencies_;
 };
 
 /**
@@ -238,16 +264,150 @@ struct MemObject<T const, Alloc> final : public BaseMemObject<T const> {
  *               access to.
  * \param offset The offset from the start of the buffer (in number of
  *               elements) to use as the initial index for the memory object.
+ * \param dependencies Events which must complete before any kernel using the
+ *                     memory can start.
  *
  * \return A MemObject that provides access to the given SYCL buffer.
  */
 template <typename T, typename Alloc>
-MemObject<T, Alloc> make_mem_object(cl::sycl::buffer<T, 1, Alloc> buffer,
-                                    size_t extent, size_t offset) {
+MemObject<T, Alloc> make_mem_object(
+    cl::sycl::buffer<T, 1, Alloc> buffer, size_t extent, size_t offset,
+    std::vector<cl::sycl::event> dependencies = {}) {
   SNN_ASSERT(buffer.get_count() >= extent + offset,
              "Buffer must contain at least extent + offset elements");
-  return MemObject<T, Alloc>{buffer, extent, offset};
+  return MemObject<T, Alloc>{buffer, extent, offset, std::move(dependencies)};
+}
+
+#ifdef SNN_USE_USM
+/**
+ * The implementation of BaseMemObject for USM device pointers.
+ *
+ * The accessors returned by a USMMemObject wrap the raw pointer, so no SYCL
+ * accessors are created and the SYCL runtime does not track any dependencies
+ * for the memory. Instead each command group which requests an accessor is
+ * made to depend on the list of events provided on construction.
+ */
+template <typename T>
+struct USMMemObject final : public BaseMemObject<T> {
+  /** The datatype stored in the memory object. */
+  using DataType = T;
+  /** \copydoc BaseMemObject<T>::Handler */
+  using typename BaseMemObject<DataType>::Handler;
+
+ public:
+  /**
+   * Construct a USMMemObject wrapper around the given USM pointer.
+   *
+   * \param ptr          USM device pointer to the start of the memory.
+   * \param extent       The number of elements available from the pointer.
+   * \param dependencies Events which must complete before any kernel using
+   *                     this memory can start.
+   */
+  USMMemObject(T* ptr, size_t extent,
+               std::vector<cl::sycl::event> dependencies)
+      : ptr_{ptr}, extent_{extent}, dependencies_{std::move(dependencies)} {}
+
+  /** \copydoc BaseMemObject<T>::read_accessor */
+  ReadAccessor<DataType> read_accessor(Handler& cgh) override {
+    helpers::add_dependencies(cgh, dependencies_);
+    return {ptr_, extent_};
+  }
+
+  /** \copydoc BaseMemObject<T>::read_write_accessor */
+  ReadWriteAccessor<DataType> read_write_accessor(Handler& cgh) override {
+    helpers::add_dependencies(cgh, dependencies_);
+    return {ptr_, extent_};
+  }
+
+  /** \copydoc BaseMemObject<T>::write_accessor */
+  WriteAccessor<DataType> write_accessor(Handler& cgh) override {
+    helpers::add_dependencies(cgh, dependencies_);
+    return {ptr_, extent_};
+  }
+
+  /**
+   * Get the USM pointer referred to by this USMMemObject.
+   * \return The USM pointer.
+   */
+  T* get_pointer() const { return ptr_; }
+
+  /** \copydoc MemObject<T>::get_extent  */
+  size_t get_extent() const { return extent_; }
+
+  /**
+   * Get the number of elements available from the pointer.
+   * \return number of elements.
+   */
+  size_t get_count() const override { return extent_; }
+
+ private:
+  /** The underlying USM pointer. */
+  T* ptr_;
+  /** The number of elements available from the pointer. */
+  size_t extent_;
+  /** The events that kernels using this memory must wait for. */
+  std::vector<cl::sycl::event> dependencies_;
+};
+
+/**
+ * Specialisation of \ref USMMemObject for `const` DataTypes.
+ *
+ * The specialisation restricts access to read only, as the underlying data
+ * type is constant.
+ */
+template <typename T>
+struct USMMemObject<T const> final : public BaseMemObject<T const> {
+  /** The datatype stored in the memory object. */
+  using DataType = T const;
+  /** \copydoc BaseMemObject<T const>::Handler */
+  using typename BaseMemObject<DataType>::Handler;
+
+ public:
+  /** \copydoc USMMemObject<T>::USMMemObject */
+  USMMemObject(T const* ptr, size_t extent,
+               std::vector<cl::sycl::event> dependencies)
+      : ptr_{ptr}, extent_{extent}, dependencies_{std::move(dependencies)} {}
+
+  /** \copydoc BaseMemObject<T>::read_accessor */
+  ReadAccessor<DataType> read_accessor(Handler& cgh) override {
+    helpers::add_dependencies(cgh, dependencies_);
+    return {ptr_, extent_};
+  }
+
+  /** \copydoc USMMemObject<T>::get_pointer  */
+  T const* get_pointer() const { return ptr_; }
+
+  /** \copydoc MemObject<T>::get_extent  */
+  size_t get_extent() const { return extent_; }
+
+  /** \copydoc USMMemObject<T>::get_count  */
+  size_t get_count() const override { return extent_; }
+
+ private:
+  /** The underlying USM pointer. */
+  T const* ptr_;
+  /** The number of elements available from the pointer. */
+  size_t extent_;
+  /** The events that kernels using this memory must wait for. */
+  std::vector<cl::sycl::event> dependencies_;
+};
+
+/**
+ * Helper function to create USMMemObjects.
+ *
+ * \param ptr          USM device pointer to the start of the memory.
+ * \param extent       The number of elements available from the pointer.
+ * \param dependencies Events which must complete before any kernel using the
+ *                     memory can start.
+ *
+ * \return A USMMemObject that provides access to the given USM pointer.
+ */
+template <typename T>
+USMMemObject<T> make_usm_mem_object(
+    T* ptr, size_t extent, std::vector<cl::sycl::event> dependencies = {}) {
+  return USMMemObject<T>{ptr, extent, std::move(dependencies)};
 }
+#endif  // SNN_USE_USM
 
 }  // namespace sycldnn
 
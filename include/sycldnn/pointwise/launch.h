@@ -33,6 +33,9 @@
 #include "sycldnn/pointwise/operators.h"
 
 #include "sycldnn/internal/pointwise/launch_internal.h"
+#include "sycldnn/internal/helpers/scoped_dependencies.h"
+
+#include <vector>
 
 namespace sycldnn {
 /** Namespace containing all pointwise operations. */
@@ -52,6 +55,8 @@ namespace pointwise {
  * \param [in]  n_items   The number of items in the input tensor.
  * \param [in]  backend   The backend providing access to the SYCL buffers
  *                        corresponding to the input and output pointers.
+ * \param [in]  dependencies Optional list of events which must complete before
+ *                           the operation's kernels can start.
  *
  * \return An \ref SNNStatus containing the SYCL event tied to the kernel
  *         launches and a \ref StatusCode enum showing if the launch was OK or
@@ -62,7 +67,10 @@ template <typename T, template <typename> class PointwiseType,
           typename = internal::DisableIfGradient<Direction>>
 SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T> output,
-                 size_t const n_items, Backend& backend) {
+                 size_t const n_items, Backend& backend,
+                 std::vector<cl::sycl::event> const& dependencies = {}) {
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
   SNN_VALIDATE_PARAM(n_items > 0, "The number of items must be positive.");
 
   auto inp_access = backend.get_mem_object(input, n_items);
@@ -90,6 +98,8 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
  * \param [in]  backend            The backend providing access to the SYCL
  *                                 buffers corresponding to the input and
  *                                 output pointers.
+ * \param [in]  dependencies       Optional list of events which must complete
+ *                                 before the operation's kernels can start.
  *
  * \return An \ref SNNStatus containing the SYCL event tied to the kernel
  *         launches and a \ref StatusCode enum showing if the launch was OK or
@@ -102,7 +112,10 @@ SNNStatus launch(
     typename Backend::template pointer_type<T const> input_forward,
     typename Backend::template pointer_type<T const> input_backprop,
     typename Backend::template pointer_type<T> output_backprop,
-    size_t const n_items, Backend& backend) {
+    size_t const n_items, Backend& backend,
+    std::vector<cl::sycl::event> const& dependencies = {}) {
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
   SNN_VALIDATE_PARAM(n_items > 0, "The number of items must be positive.");
 
   auto inp_fwd_access = backend.get_mem_object(input_forward, n_items);
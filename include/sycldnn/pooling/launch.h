@@ -32,6 +32,9 @@
 #include "sycldnn/pooling/sizes.h"
 
 #include "sycldnn/internal/pooling/launch_internal.h"
+#include "sycldnn/internal/helpers/scoped_dependencies.h"
+
+#include <vector>
 
 namespace sycldnn {
 /** Namespace containing all pooling operations. */
@@ -98,6 +101,8 @@ SNNStatus inline validate_params(PoolingParams const& params) {
  * \param [in]  pp       The parameters of the pooling operation.
  * \param [in]  backend  The backend that provides access to the SYCL buffers
  *                       corresponding to the input and output pointers.
+ * \param [in]  dependencies Optional list of events which must complete before
+ *                           the operation's kernels can start.
  * \return An \ref SNNStatus containing the SYCL event tied to the kernel
  *         launches and a \ref StatusCode enum showing if the launch was OK or
  *         whether it encountered some problem.
@@ -107,11 +112,14 @@ template <typename T, template <typename> class PoolType, typename Direction,
           typename internal::DisableIfMaxGradient<T, PoolType, Direction> = 0>
 SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T> output,
-                 const PoolingParams& pp, Backend& backend) {
+                 const PoolingParams& pp, Backend& backend,
+                 std::vector<cl::sycl::event> const& dependencies = {}) {
   auto validation_status = internal::validate_params(pp);
   if (validation_status.status != StatusCode::OK) {
     return validation_status;
   }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
   auto sizes = get_sizes<Direction>(pp);
 
   auto inp_mem = backend.get_mem_object(input, sizes.input_size);
@@ -141,6 +149,8 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
  * \param [in]  backend        The backend that provides access to the SYCL
  *                             buffers corresponding to the input and output
  *                             pointers.
+ * \param [in]  dependencies   Optional list of events which must complete
+ *                             before the operation's kernels can start.
  * \return An \ref SNNStatus containing the SYCL event tied to the kernel
  *         launches and a \ref StatusCode enum showing if the launch was OK or
  *         whether it encountered some problem.
@@ -153,11 +163,13 @@ SNNStatus launch(
     typename Backend::template pointer_type<T const> output_data,
     typename Backend::template pointer_type<T const> input_backprop,
     typename Backend::template pointer_type<T> output, const PoolingParams& pp,
-    Backend& backend) {
+    Backend& backend, std::vector<cl::sycl::event> const& dependencies = {}) {
   auto validation_status = internal::validate_params(pp);
   if (validation_status.status != StatusCode::OK) {
     return validation_status;
   }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
   auto fwd_sizes = get_sizes<Forward>(pp);
   auto back_sizes = get_sizes<Backpropagate>(pp);
 
@@ -0,0 +1,193 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_QUANTIZE_LAUNCH_H_
+#define SYCLDNN_INCLUDE_QUANTIZE_LAUNCH_H_
+
+/**
+ * \file
+ * Implements the \ref sycldnn::quantize::quantize() and
+ * \ref sycldnn::quantize::dequantize() functions, which asynchronously
+ * dispatch the SYCL kernels to convert tensors between a floating point type
+ * and int8.
+ */
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "sycldnn/quantize/params.h"
+
+#include "sycldnn/internal/quantize/launch.h"
+#include "sycldnn/internal/helpers/scoped_dependencies.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace sycldnn {
+/** Namespace containing the int8 quantization operations. */
+namespace quantize {
+namespace internal {
+
+/**
+ * Validate that the quantization parameters are supported.
+ *
+ * \param params The quantization parameters to validate.
+ * \return A SNNStatus object containing either \ref StatusCode::OK if all
+ *         parameters are valid, or \ref StatusCode::InvalidParameter
+ *         otherwise.
+ */
+SNNStatus inline validate_params(QuantizeParams const& params) {
+  SNN_VALIDATE_PARAM(params.size > 0, "The number of items must be positive.");
+  SNN_VALIDATE_PARAM(params.channels > 0,
+                     "The number of channels must be positive.");
+  SNN_VALIDATE_PARAM(params.size % params.channels == 0,
+                     "The number of items must be divisible by the number of "
+                     "channels.");
+  return StatusCode::OK;
+}
+
+/**
+ * Validate that the requantization parameters of a quantized operation are
+ * supported.
+ *
+ * \param params The requantization parameters to validate.
+ * \return A SNNStatus object containing either \ref StatusCode::OK if all
+ *         parameters are valid, or \ref StatusCode::InvalidParameter
+ *         otherwise.
+ */
+SNNStatus inline validate_params(RequantizeParams const& params) {
+  SNN_VALIDATE_PARAM(
+      params.input_zero_point >= -128 && params.input_zero_point <= 127,
+      "The input zero point must be representable in int8.");
+  SNN_VALIDATE_PARAM(
+      params.filter_zero_point >= -128 && params.filter_zero_point <= 127,
+      "The filter zero point must be representable in int8.");
+  SNN_VALIDATE_PARAM(params.activation_min >= -128,
+                     "The activation minimum must be representable in int8.");
+  SNN_VALIDATE_PARAM(params.activation_max <= 127,
+                     "The activation maximum must be representable in int8.");
+  SNN_VALIDATE_PARAM(params.activation_min <= params.activation_max,
+                     "The activation minimum must not be larger than the "
+                     "activation maximum.");
+  return StatusCode::OK;
+}
+
+}  // namespace internal
+
+/**
+ * Quantize a tensor to int8, computing
+ *
+ *   out = clamp(round(in / scale[c]) + zero_point[c], -128, 127)
+ *
+ * where c is the channel of each value.
+ *
+ * \tparam T                The data type of the input tensor.
+ * \tparam Backend          The type of the Backend.
+ *
+ * \param [in]  input       A pointer to the input tensor.
+ * \param [in]  scales      A pointer to the per-channel scales.
+ * \param [in]  zero_points A pointer to the per-channel zero points.
+ * \param [out] output      A pointer to the quantized output tensor.
+ * \param [in]  params      The quantization parameters.
+ * \param [in]  backend     The backend providing access to the SYCL buffers
+ *                          corresponding to the pointers.
+ * \param [in]  dependencies Optional list of events which must complete before
+ *                           the operation's kernels can start.
+ *
+ * \return An \ref SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a \ref StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, typename Backend>
+SNNStatus quantize(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<float const> scales,
+    typename Backend::template pointer_type<int32_t const> zero_points,
+    typename Backend::template pointer_type<int8_t> output,
+    QuantizeParams const& params, Backend& backend,
+    std::vector<cl::sycl::event> const& dependencies = {}) {
+  auto validation_status = internal::validate_params(params);
+  if (validation_status.status != StatusCode::OK) {
+    return validation_status;
+  }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
+
+  auto inp_access = backend.get_mem_object(input, params.size);
+  auto scale_access = backend.get_mem_object(scales, params.channels);
+  auto zero_point_access = backend.get_mem_object(zero_points, params.channels);
+  auto outp_access = backend.get_mem_object(output, params.size);
+
+  auto queue = backend.get_queue();
+  return internal::launch_quantize<T>(inp_access, scale_access,
+                                      zero_point_access, outp_access, params,
+                                      queue);
+}
+
+/**
+ * Dequantize an int8 tensor, computing
+ *
+ *   out = (in - zero_point[c]) * scale[c]
+ *
+ * where c is the channel of each value.
+ *
+ * \tparam T                The data type of the output tensor.
+ * \tparam Backend          The type of the Backend.
+ *
+ * \param [in]  input       A pointer to the quantized input tensor.
+ * \param [in]  scales      A pointer to the per-channel scales.
+ * \param [in]  zero_points A pointer to the per-channel zero points.
+ * \param [out] output      A pointer to the output tensor.
+ * \param [in]  params      The quantization parameters.
+ * \param [in]  backend     The backend providing access to the SYCL buffers
+ *                          corresponding to the pointers.
+ * \param [in]  dependencies Optional list of events which must complete before
+ *                           the operation's kernels can start.
+ *
+ * \return An \ref SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a \ref StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, typename Backend>
+SNNStatus dequantize(
+    typename Backend::template pointer_type<int8_t const> input,
+    typename Backend::template pointer_type<float const> scales,
+    typename Backend::template pointer_type<int32_t const> zero_points,
+    typename Backend::template pointer_type<T> output,
+    QuantizeParams const& params, Backend& backend,
+    std::vector<cl::sycl::event> const& dependencies = {}) {
+  auto validation_status = internal::validate_params(params);
+  if (validation_status.status != StatusCode::OK) {
+    return validation_status;
+  }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
+
+  auto inp_access = backend.get_mem_object(input, params.size);
+  auto scale_access = backend.get_mem_object(scales, params.channels);
+  auto zero_point_access = backend.get_mem_object(zero_points, params.channels);
+  auto outp_access = backend.get_mem_object(output, params.size);
+
+  auto queue = backend.get_queue();
+  return internal::launch_dequantize<T>(inp_access, scale_access,
+                                        zero_point_access, outp_access, params,
+                                        queue);
+}
+
+}  // namespace quantize
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_QUANTIZE_LAUNCH_H_
@@ -0,0 +1,92 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_QUANTIZE_PARAMS_H_
+#define SYCLDNN_INCLUDE_QUANTIZE_PARAMS_H_
+
+/**
+ * \file
+ * Defines the \ref sycldnn::quantize::QuantizeParams and
+ * \ref sycldnn::quantize::RequantizeParams structs, which describe the int8
+ * quantization of tensors and the integer computation of quantized operations.
+ */
+#include <cstdint>
+
+namespace sycldnn {
+namespace quantize {
+
+/**
+ * Parameters describing the per-channel affine quantization of a tensor.
+ *
+ * A real value x in channel c is represented by the int8 value q, where
+ *
+ *   x = (q - zero_point[c]) * scale[c]
+ *
+ * The scales and zero points are provided as tensors with one value per
+ * channel.
+ */
+struct QuantizeParams {
+  /** The type of the params is int, providing a decent
+   * upper bound on the tensor sizes.*/
+  using Index = int;
+
+  /** The total number of values in the tensor. */
+  Index size;
+
+  /**
+   * The number of channels with their own scale and zero point. The channels
+   * are the innermost dimension of the tensor, so for an NHWC tensor this is
+   * the number of features. A single channel gives per-tensor quantization.
+   */
+  Index channels = 1;
+};
+
+/**
+ * Parameters describing the integer computation of a quantized convolution or
+ * matrix multiply.
+ *
+ * The int8 products are accumulated in int32 after subtracting the input and
+ * filter zero points, and the int32 bias is added. The accumulator for output
+ * channel c is then requantized to int8 as
+ *
+ *   out = clamp(round(acc * scale[c]) + zero_point[c], min, max)
+ *
+ * where scale[c] = input_scale * filter_scale[c] / output_scale, and
+ * zero_point[c] is the output zero point.
+ */
+struct RequantizeParams {
+  /** The zero point of the input, or left hand side, tensor. */
+  int32_t input_zero_point = 0;
+
+  /**
+   * The zero point of the filter, or right hand side, tensor. Filters with
+   * per-channel scales are typically quantized symmetrically, with a zero
+   * point of 0.
+   */
+  int32_t filter_zero_point = 0;
+
+  /**
+   * The smallest quantized output value. This can be raised above -128 to fuse
+   * a ReLU or ReLU6 activation into the requantization.
+   */
+  int32_t activation_min = -128;
+
+  /** The largest quantized output value. */
+  int32_t activation_max = 127;
+};
+
+}  // namespace quantize
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_QUANTIZE_PARAMS_H_
@@ -26,15 +26,46 @@
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
+#include "sycldnn/internal/helpers/allocated_pointer.h"
+#include "sycldnn/internal/helpers/scoped_dependencies.h"
 #include "sycldnn/internal/reduce/launch.h"
 #include "sycldnn/reduce/operators.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace sycldnn {
 namespace reduce {
+namespace internal {
+
+/** Check whether Op reduces to a value of the input type. */
+template <typename Op>
+struct IsValueReduction
+    : std::integral_constant<bool, std::is_same<Op, Add>::value ||
+                                       std::is_same<Op, Mean>::value ||
+                                       std::is_same<Op, Max>::value ||
+                                       std::is_same<Op, Min>::value ||
+                                       std::is_same<Op, Prod>::value ||
+                                       std::is_same<Op, SumOfSquares>::value ||
+                                       std::is_same<Op, L2Norm>::value ||
+                                       std::is_same<Op, LogSumExp>::value> {};
+
+/** Check whether Op reduces to the index of a value in the outer dimension. */
+template <typename Op>
+struct IsIndexReduction
+    : std::integral_constant<bool, std::is_same<Op, ArgMax>::value ||
+                                       std::is_same<Op, ArgMin>::value> {};
+
+}  // namespace internal
+
 /**
  * Launch a reduction of [batch, outer, inner] applying Op on the outer
  * dimension. The output shape is [batch, inner].
  *
+ * When there are too few outputs to occupy the device the outer dimension is
+ * split into slices, with the partial results held in a temporary workspace
+ * allocated through the backend.
+ *
  * \tparam Op Operation to apply on the reduced dimension
  * \param input A pointer to the memory representing the input tensor.
  * \param output A pointer to the memory representing the output tensor.
@@ -44,6 +75,8 @@ namespace reduce {
  * \param inner Inner size. Must be a positive value.
  * \param backend The backend implementation, used to map between pointer
  *                representations.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
  * \return Returns an SNNStatus containing the SYCL event tied to the kernel
  *         launches and a StatusCode enum showing if the launch was OK or
  *         whether it encountered some problem.
@@ -51,9 +84,11 @@ namespace reduce {
 template <typename T, typename Op, typename Backend>
 SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T> output, int batches,
-                 int outer, int inner, Backend& backend) {
-  static_assert(std::is_same<Op, reduce::Add>::value ||
-                    std::is_same<Op, reduce::Mean>::value,
+                 int outer, int inner, Backend& backend,
+                 std::vector<cl::sycl::event> const& dependencies = {}) {
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
+  static_assert(internal::IsValueReduction<Op>::value,
                 "Invalid Reduction Type");
   SNN_VALIDATE_PARAM(batches > 0, "The number of batches must be positive.");
   SNN_VALIDATE_PARAM(outer > 0, "The value of outer must be positive.");
@@ -67,8 +102,89 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
 
   auto sycl_queue = backend.get_queue();
 
-  return internal::launch<T, Op>(in_acc, out_acc, batches, outer, inner,
-                                 sycl_queue);
+  int const n_splits = internal::get_split_count(batches, outer, inner);
+  if (n_splits == 1) {
+    return internal::launch<T, Op>(in_acc, out_acc, batches, outer, inner,
+                                   sycl_queue);
+  }
+  using Partial = typename internal::PartialType<T>::type;
+  using AllocatedPointer =
+      sycldnn::internal::helpers::AllocatedPointer<Partial, Backend>;
+  size_t const workspace_size =
+      internal::get_split_workspace_size<Op>(batches, inner, n_splits);
+  AllocatedPointer workspace{workspace_size * sizeof(Partial), backend};
+  auto ws_acc =
+      backend.get_mem_object_internal(workspace.get(), workspace_size);
+  return internal::launch_split<T, Op>(in_acc, ws_acc, out_acc, batches, outer,
+                                       inner, n_splits, sycl_queue);
+}
+
+/**
+ * Launch a reduction of [batch, outer, inner] computing the index in the outer
+ * dimension of the value selected by Op. The output shape is [batch, inner].
+ *
+ * The outer dimension is split between work items in the same way as for
+ * launch().
+ *
+ * \tparam Op Index reduction to apply on the reduced dimension, either ArgMax
+ *            or ArgMin. Ties are resolved in favour of the lowest index.
+ * \param input A pointer to the memory representing the input tensor.
+ * \param output A pointer to the memory representing the output tensor of
+ * indices.
+ * \param batches The number of batches. Must be a positive value.
+ * \param outer Outer size. This is the dimension that is always reduced. Must
+ * be a positive value.
+ * \param inner Inner size. Must be a positive value.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, typename Op, typename Backend>
+SNNStatus launch_arg(typename Backend::template pointer_type<T const> input,
+                     typename Backend::template pointer_type<int32_t> output,
+                     int batches, int outer, int inner, Backend& backend,
+                     std::vector<cl::sycl::event> const& dependencies = {}) {
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
+  static_assert(internal::IsIndexReduction<Op>::value,
+                "Invalid Index Reduction Type");
+  SNN_VALIDATE_PARAM(batches > 0, "The number of batches must be positive.");
+  SNN_VALIDATE_PARAM(outer > 0, "The value of outer must be positive.");
+  SNN_VALIDATE_PARAM(inner > 0, "The value of inner must be positive.");
+
+  size_t in_size = batches * outer * inner;
+  size_t out_size = batches * inner;
+
+  auto in_acc = backend.get_mem_object(input, in_size);
+  auto out_acc = backend.get_mem_object(output, out_size);
+
+  auto sycl_queue = backend.get_queue();
+
+  int const n_splits = internal::get_split_count(batches, outer, inner);
+  if (n_splits == 1) {
+    return internal::launch_arg<T, Op>(in_acc, out_acc, batches, outer, inner,
+                                       sycl_queue);
+  }
+  using Partial = typename internal::PartialType<T>::type;
+  using AllocatedValues =
+      sycldnn::internal::helpers::AllocatedPointer<Partial, Backend>;
+  using AllocatedIndices =
+      sycldnn::internal::helpers::AllocatedPointer<int32_t, Backend>;
+  size_t const workspace_size =
+      internal::get_split_workspace_size<Op>(batches, inner, n_splits);
+  AllocatedValues values{workspace_size * sizeof(Partial), backend};
+  AllocatedIndices indices{workspace_size * sizeof(int32_t), backend};
+  auto values_acc =
+      backend.get_mem_object_internal(values.get(), workspace_size);
+  auto indices_acc =
+      backend.get_mem_object_internal(indices.get(), workspace_size);
+  return internal::launch_arg_split<T, Op>(in_acc, values_acc, indices_acc,
+                                           out_acc, batches, outer, inner,
+                                           n_splits, sycl_queue);
 }
 }  // namespace reduce
 }  // namespace sycldnn
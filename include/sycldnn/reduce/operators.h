@@ -19,7 +19,11 @@
 
 /**
  * \file
- * Contains the declarations of the Add, Mean tag types.
+ * Contains the declarations of the reduction operator tag types.
+ *
+ * Add, Mean, Max, Min, Prod, SumOfSquares, L2Norm and LogSumExp reduce the
+ * outer dimension to a value of the input type. ArgMax and ArgMin reduce the
+ * outer dimension to the index of the largest or smallest value.
  */
 
 namespace sycldnn {
@@ -29,6 +33,26 @@ struct Add;
 
 struct Mean;
 
+struct Max;
+
+struct Min;
+
+struct Prod;
+
+struct SumOfSquares;
+
+/** Square root of the sum of squares. */
+struct L2Norm;
+
+/** Logarithm of the sum of exponentials, computed without overflowing. */
+struct LogSumExp;
+
+/** Index of the first largest value. */
+struct ArgMax;
+
+/** Index of the first smallest value. */
+struct ArgMin;
+
 }  // namespace reduce
 }  // namespace sycldnn
 
@@ -31,6 +31,9 @@
 #include "sycldnn/roi_align/params.h"
 
 #include "sycldnn/internal/roi_align/launch_internal.h"
+#include "sycldnn/internal/helpers/scoped_dependencies.h"
+
+#include <vector>
 
 namespace sycldnn {
 /** Namespace containing all ROI Align operations. */
@@ -99,6 +102,8 @@ SNNStatus inline validate_params(RoiAlignParams const& params) {
  * \param [in]  backend         The backend that provides access to the SYCL
  *                              buffers corresponding to the input and output
  *                              pointers.
+ * \param [in]  dependencies    Optional list of events which must complete
+ *                              before the operation's kernels can start.
  *
  * \return An \ref SNNStatus containing the SYCL event tied to the kernel
  * launches and a \ref StatusCode enum showing if the launch was OK or whether
@@ -111,11 +116,14 @@ SNNStatus launch(
     typename Backend::template pointer_type<T const> rois,
     typename Backend::template pointer_type<BatchIndicesT const> batch_indices,
     typename Backend::template pointer_type<T> output,
-    const RoiAlignParams& rap, Backend& backend) {
+    const RoiAlignParams& rap, Backend& backend,
+    std::vector<cl::sycl::event> const& dependencies = {}) {
   auto validation_status = internal::validate_params(rap);
   if (validation_status.status != StatusCode::OK) {
     return validation_status;
   }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
 
   auto inp_mem = backend.get_mem_object(
       input, rap.batch * rap.channels * rap.in_height * rap.in_width);
@@ -28,9 +28,12 @@
 #include "sycldnn/softmax/params.h"
 
 #include "sycldnn/internal/softmax/launch_internal.h"
+#include "sycldnn/internal/helpers/scoped_dependencies.h"
 
 #include "sycldnn/helpers/macros.h"
 
+#include <vector>
+
 namespace sycldnn {
 /** Namespace containing the softmax operator. */
 namespace softmax {
@@ -79,12 +82,16 @@ SNNStatus inline validate_params(SoftmaxParams const& params) {
  * \tparam Direction   The direction of processing, either Forward or Gradient.
  * \tparam Backend     The type of backend.
  * \param input        A pointer to the memory representing the input tensor.
- * \param workspace    A pointer to the memory representing the workspace.
+ * \param workspace    A pointer to the memory representing the workspace. The
+ *                     forward softmax is computed in a single kernel, so the
+ *                     workspace is not used.
  * \param output       A pointer to the memory representing the output tensor.
  * \param params       The softmax parameters, which describe the tensor shape
  *                     and layout.
  * \param backend      The backend implementation, used to map between pointer
  *                     representations.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
  * \return Returns a SNNStatus containing the SYCL event tied to the kernel
  *         launches and a StatusCode enum showing if the launch was OK or
  *         whether it encountered some problem.
@@ -94,11 +101,14 @@ template <typename T, typename Direction, typename Backend,
 SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T> workspace,
                  typename Backend::template pointer_type<T> output,
-                 SoftmaxParams const& params, Backend& backend) {
+                 SoftmaxParams const& params, Backend& backend,
+                 std::vector<cl::sycl::event> const& dependencies = {}) {
   auto validation_status = internal::validate_params(params);
   if (validation_status.status != StatusCode::OK) {
     return validation_status;
   }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
 
   return internal::launch<T, Direction>(input, workspace, output, params,
                                         backend);
@@ -112,12 +122,16 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
  * \tparam Backend     The type of backend.
  * \param input        A pointer to the memory representing the input tensor.
  * \param gradient     A pointer to the memory representing the gradient tensor.
- * \param workspace    A pointer to the memory representing the workspace.
+ * \param workspace    A pointer to the memory representing the workspace. The
+ *                     softmax gradient is computed in a single kernel, so the
+ *                     workspace is not used.
  * \param output       A pointer to the memory representing the output tensor.
  * \param params       The softmax parameters, which describe the tensor shape
  *                     and layout.
  * \param backend      The backend implementation, used to map between pointer
  *                     representations.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
  * \return Returns a SNNStatus containing the SYCL event tied to the kernel
  *         launches and a StatusCode enum showing if the launch was OK or
  *         whether it encountered some problem.
@@ -129,11 +143,14 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T const> gradient,
                  typename Backend::template pointer_type<T> workspace,
                  typename Backend::template pointer_type<T> output,
-                 SoftmaxParams const& params, Backend& backend) {
+                 SoftmaxParams const& params, Backend& backend,
+                 std::vector<cl::sycl::event> const& dependencies = {}) {
   auto validation_status = internal::validate_params(params);
   if (validation_status.status != StatusCode::OK) {
     return validation_status;
   }
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
 
   return internal::launch<T, Direction>(input, gradient, workspace, output,
                                         params, backend);
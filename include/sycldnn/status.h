@@ -25,6 +25,8 @@
  */
 #include <CL/sycl.hpp>
 
+#include <vector>
+
 #include "sycldnn/helpers/macros.h"
 namespace sycldnn {
 /** The possible errors returned by SYCL-DNN kernel launchers. */
@@ -46,6 +48,9 @@ enum class StatusCode {
  * A status object containing the SYCL event corresponding to the last kernel
  * launch and a StatusCode which gives the cause of any possible error when
  * launching the kernel.
+ *
+ * Operations which launch more than one kernel also provide the events of
+ * all of their kernels.
  */
 struct SNNStatus {
   /**
@@ -54,7 +59,8 @@ struct SNNStatus {
    * \param e SYCL event
    * \param s StatusCode
    */
-  SNNStatus(const cl::sycl::event e, StatusCode s) : event(e), status(s) {}
+  SNNStatus(const cl::sycl::event e, StatusCode s)
+      : event(e), events{e}, status(s) {}
 
   /**
    * \brief Construct a new SNNStatus object
@@ -62,7 +68,7 @@ struct SNNStatus {
    *
    * \param s StatusCode
    */
-  SNNStatus(StatusCode s) : SNNStatus({}, s) {}
+  SNNStatus(StatusCode s) : event(), events(), status(s) {}
 
   /**
    * \brief Construct a new SNNStatus object with the OK status.
@@ -72,6 +78,35 @@ struct SNNStatus {
   /** Default copy constructor and assignment. */
   SNN_DEFAULT_COPY(SNNStatus);
 
+  /**
+   * Add the status of a later kernel launch in the same operation.
+   *
+   * The final event and status code are replaced by those of the later
+   * launch, and its events are added to the list of all events.
+   *
+   * \param later The status of the later kernel launch.
+   * \return A reference to this SNNStatus.
+   */
+  SNNStatus& append(SNNStatus const& later) {
+    event = later.event;
+    events.insert(events.end(), later.events.begin(), later.events.end());
+    status = later.status;
+    return *this;
+  }
+
+  /**
+   * Add the event of a later kernel launch in the same operation, which
+   * becomes the final event of the operation.
+   *
+   * \param later The event of the later kernel launch.
+   * \return A reference to this SNNStatus.
+   */
+  SNNStatus& append(cl::sycl::event const& later) {
+    event = later;
+    events.push_back(later);
+    return *this;
+  }
+
   /**
    * A SYCL event corresponding to the final SYCL kernel launch. This event can
    * be used to facilitate synchronization between the host processor and the
@@ -81,6 +116,16 @@ struct SNNStatus {
    */
   cl::sycl::event event;
 
+  /**
+   * The SYCL events of every kernel launched by the operation, in the order
+   * they were submitted. The final entry is the same as event.
+   *
+   * The kernels of an operation can complete out of order, for example when
+   * an operation also updates running statistics, so this list should be used
+   * to wait for the whole operation to finish.
+   */
+  std::vector<cl::sycl::event> events;
+
   /**
    * A status code indicating whether the operator was launched sucessfully, or
    * the reason for an unsucessful launch.
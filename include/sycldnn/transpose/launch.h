@@ -28,6 +28,7 @@
 #include "sycldnn/helpers/macros.h"
 
 #include "sycldnn/internal/transpose/launch.h"
+#include "sycldnn/internal/helpers/scoped_dependencies.h"
 
 #include <numeric>
 #include <vector>
@@ -49,6 +50,8 @@ namespace transpose {
  *                    dimension in the input.
  * \param backend     The backend implementation, used to map between pointer
  *                    representations.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
  * \return Returns an SNNStatus containing the SYCL event tied to the kernel
  *         launches and a StatusCode enum showing if the launch was OK or
  *         whether it encountered some problem.
@@ -64,7 +67,10 @@ template <typename T, typename Backend>
 SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T> output,
                  std::vector<int> const& dimensions,
-                 std::vector<int> const& permutation, Backend& backend) {
+                 std::vector<int> const& permutation, Backend& backend,
+                 std::vector<cl::sycl::event> const& dependencies = {}) {
+  sycldnn::internal::helpers::ScopedDependencies<Backend> scoped_dependencies{
+      backend, dependencies};
   auto n_dimensions = dimensions.size();
   SNN_VALIDATE_PARAM(n_dimensions > 0u,
                      "The number of dimensions must be positive.");
@@ -107,6 +113,8 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
  *                    in the input tensor.
  * \param backend     The backend implementation, used to map between pointer
  *                    representations.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
  * \return Returns an SNNStatus containing the SYCL event tied to the kernel
  *         launches and a StatusCode enum showing if the launch was OK or
  *         whether it encountered some problem.
@@ -120,11 +128,13 @@ template <typename T, typename Backend>
 SNNStatus convert_nhwc_to_nchw(
     typename Backend::template pointer_type<T const> input,
     typename Backend::template pointer_type<T> output,
-    std::vector<int> const& dimensions, Backend& backend) {
+    std::vector<int> const& dimensions, Backend& backend,
+    std::vector<cl::sycl::event> const& dependencies = {}) {
   SNN_VALIDATE_PARAM(
       dimensions.size() == 4,
       "Conversion from NHWC to NCHW is only valid on 4D tensors.");
-  return launch<T>(input, output, dimensions, {0, 3, 1, 2}, backend);
+  return launch<T>(input, output, dimensions, {0, 3, 1, 2}, backend,
+                   dependencies);
 }
 
 /**
@@ -137,6 +147,8 @@ SNNStatus convert_nhwc_to_nchw(
  *                    in the input tensor.
  * \param backend     The backend implementation, used to map between pointer
  *                    representations.
+ * \param dependencies Optional list of events which must complete before the
+ *                     operation's kernels can start.
  * \return Returns an SNNStatus containing the SYCL event tied to the kernel
  *         launches and a StatusCode enum showing if the launch was OK or
  *         whether it encountered some problem.
@@ -150,11 +162,13 @@ template <typename T, typename Backend>
 SNNStatus convert_nchw_to_nhwc(
     typename Backend::template pointer_type<T const> input,
     typename Backend::template pointer_type<T> output,
-    std::vector<int> const& dimensions, Backend& backend) {
+    std::vector<int> const& dimensions, Backend& backend,
+    std::vector<cl::sycl::event> const& dependencies = {}) {
   SNN_VALIDATE_PARAM(
       dimensions.size() == 4,
       "Conversion from NCHW to NHWC is only valid on 4D tensors.");
-  return launch<T>(input, output, dimensions, {0, 2, 3, 1}, backend);
+  return launch<T>(input, output, dimensions, {0, 2, 3, 1}, backend,
+                   dependencies);
 }
 
 }  // namespace transpose
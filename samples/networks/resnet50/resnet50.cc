@@ -1521,6 +1521,9 @@ int main(int argc, char* argv[]) {
   network.add_layer(create_softmax_layer<DType>(
       network.get_output(), backend, make_softmax_params(1, 1, 1, 1000)));
 
+  // Share activation and workspace memory between the layers
+  network.plan_memory();
+
   auto test_status = network.test();
   test_status.event.wait_and_throw();
   auto index = std::max_element(output.begin(), output.end());
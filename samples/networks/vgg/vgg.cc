@@ -20,10 +20,15 @@
 #include "sycldnn/backend/snn_backend.h"
 #endif
 
+#include "tools/data_parallel_network.h"
 #include "tools/network.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <fstream>
 #include <iostream>
+#include <string>
 
 using DType = float;
 
@@ -44,12 +49,17 @@ std::vector<char> read_binary_data(std::string const& name) {
   return output;
 }
 
-// read image data from disk
-DeviceMem read_image_data(std::string const& name, Backend& backend) {
-  cl::sycl::range<1> r{224 * 224 * 3};  // vgg input size
+// read image data from disk, repeating the image for each item in the batch
+DeviceMem read_image_data(std::string const& name, Backend& backend,
+                          int batch) {
+  cl::sycl::range<1> r{224 * 224 * 3 * static_cast<size_t>(batch)};
   cl::sycl::buffer<DType> b{r};
-  auto data = read_binary_data(name);
-  assert(data.size() == 224 * 224 * 3 * sizeof(DType));
+  auto image = read_binary_data(name);
+  assert(image.size() == 224 * 224 * 3 * sizeof(DType));
+  std::vector<char> data;
+  for (int i = 0; i < batch; ++i) {
+    data.insert(data.end(), image.begin(), image.end());
+  }
   {
     auto char_data = b.reinterpret<char>(r * sizeof(DType));
     auto event = backend.get_queue().submit([&](cl::sycl::handler& cgh) {
@@ -191,8 +201,9 @@ inline sycldnn::PoolingLayer<T, Backend, PoolingType>* create_pooling_layer(
 }
 
 // make fully connected layer parameters
-inline sycldnn::matmul::MatmulParams make_fc_params(int input, int output) {
-  sycldnn::matmul::MatmulParams params = {1, 1, input, output, 0.f};
+inline sycldnn::matmul::MatmulParams make_fc_params(int batch, int input,
+                                                    int output) {
+  sycldnn::matmul::MatmulParams params = {1, batch, input, output, 0.f};
   return params;
 }
 
@@ -204,7 +215,7 @@ inline sycldnn::FCLayer<T, Backend>* create_fc_layer(
   DeviceMem filter, output;
   auto filter_size = params.k * params.n;
   filter = backend.allocate<T>(filter_size);
-  output = backend.allocate<T>(params.n);
+  output = backend.allocate<T>(params.m * params.n);
 
   std::vector<char> weights(filter_size * sizeof(T));
   if (data_dir == "")
@@ -257,252 +268,348 @@ std::string get_path_to_layer_biases(std::string const& data_dir,
   return data_dir + "layer_" + std::to_string(layer_number) + "-biases.bin";
 }
 
-int main(int argc, char* argv[]) {
-  if (argc < 3) {
-    std::cout << "USAGE: vgg <directory> <image>\n";
-    return 1;
-  }
-
-  cl::sycl::queue q([](cl::sycl::exception_list l) {
-    for (auto e : l) {
-      try {
-        std::rethrow_exception(e);
-      } catch (cl::sycl::exception& e) {
-        std::cout << e.what() << " " << e.get_cl_code() << "\n";
-      }
-    }
-  });
-  Backend backend(q);
-  auto selector = sycldnn::conv2d::get_default_selector(q.get_device());
-  std::vector<DType> output;
-  std::string data_dir{argv[1]};
-  auto input = read_image_data(argv[2], backend);
-  sycldnn::Network<DType, Backend> network(backend, output);
-
+// add the VGG layers for a batch of images to the network
+void add_vgg_layers(sycldnn::Network<DType, Backend>& network, Backend& backend,
+                    sycldnn::conv2d::Selector& selector,
+                    std::string const& data_dir, DeviceMem const input,
+                    int batch) {
   network.add_layer(create_conv_layer<DType>(
-      input, backend, get_path_to_layer_weights(data_dir, 1), *selector,
-      make_conv_params(1, 224, 3, 64, 3, 1, sycldnn::PaddingMode::SAME)));
+      input, backend, get_path_to_layer_weights(data_dir, 1), selector,
+      make_conv_params(batch, 224, 3, 64, 3, 1, sycldnn::PaddingMode::SAME)));
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, get_path_to_layer_biases(data_dir, 1),
-      make_bias_params(1, 224, 64)));
+      make_bias_params(batch, 224, 64)));
 
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
-      network.get_output(), backend, make_pointwise_params(224 * 224 * 64)));
+      network.get_output(), backend,
+      make_pointwise_params(batch * 224 * 224 * 64)));
 
   network.add_layer(create_conv_layer<DType>(
       network.get_output(), backend, get_path_to_layer_weights(data_dir, 2),
-      *selector,
-      make_conv_params(1, 224, 64, 64, 3, 1, sycldnn::PaddingMode::SAME)));
+      selector,
+      make_conv_params(batch, 224, 64, 64, 3, 1, sycldnn::PaddingMode::SAME)));
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, get_path_to_layer_biases(data_dir, 2),
-      make_bias_params(1, 224, 64)));
+      make_bias_params(batch, 224, 64)));
 
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
-      network.get_output(), backend, make_pointwise_params(224 * 224 * 64)));
+      network.get_output(), backend,
+      make_pointwise_params(batch * 224 * 224 * 64)));
 
   network.add_layer(create_pooling_layer<DType, sycldnn::pooling::Max>(
       network.get_output(), backend,
-      make_pooling_params(1, 224, 64, 2, 2, sycldnn::PaddingMode::VALID)));
+      make_pooling_params(batch, 224, 64, 2, 2, sycldnn::PaddingMode::VALID)));
 
   network.add_layer(create_conv_layer<DType>(
       network.get_output(), backend, get_path_to_layer_weights(data_dir, 3),
-      *selector,
-      make_conv_params(1, 112, 64, 128, 3, 1, sycldnn::PaddingMode::SAME)));
+      selector,
+      make_conv_params(batch, 112, 64, 128, 3, 1, sycldnn::PaddingMode::SAME)));
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, get_path_to_layer_biases(data_dir, 3),
-      make_bias_params(1, 112, 128)));
+      make_bias_params(batch, 112, 128)));
 
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
-      network.get_output(), backend, make_pointwise_params(112 * 112 * 128)));
+      network.get_output(), backend,
+      make_pointwise_params(batch * 112 * 112 * 128)));
 
   network.add_layer(create_conv_layer<DType>(
       network.get_output(), backend, get_path_to_layer_weights(data_dir, 4),
-      *selector,
-      make_conv_params(1, 112, 128, 128, 3, 1, sycldnn::PaddingMode::SAME)));
+      selector,
+      make_conv_params(batch, 112, 128, 128, 3, 1,
+                       sycldnn::PaddingMode::SAME)));
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, get_path_to_layer_biases(data_dir, 4),
-      make_bias_params(1, 112, 128)));
+      make_bias_params(batch, 112, 128)));
 
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
-      network.get_output(), backend, make_pointwise_params(112 * 112 * 128)));
+      network.get_output(), backend,
+      make_pointwise_params(batch * 112 * 112 * 128)));
 
   network.add_layer(create_pooling_layer<DType, sycldnn::pooling::Max>(
       network.get_output(), backend,
-      make_pooling_params(1, 112, 128, 2, 2, sycldnn::PaddingMode::VALID)));
+      make_pooling_params(batch, 112, 128, 2, 2, sycldnn::PaddingMode::VALID)));
 
   network.add_layer(create_conv_layer<DType>(
       network.get_output(), backend, get_path_to_layer_weights(data_dir, 5),
-      *selector,
-      make_conv_params(1, 56, 128, 256, 3, 1, sycldnn::PaddingMode::SAME)));
+      selector,
+      make_conv_params(batch, 56, 128, 256, 3, 1, sycldnn::PaddingMode::SAME)));
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, get_path_to_layer_biases(data_dir, 5),
-      make_bias_params(1, 56, 256)));
+      make_bias_params(batch, 56, 256)));
 
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
-      network.get_output(), backend, make_pointwise_params(56 * 56 * 256)));
+      network.get_output(), backend,
+      make_pointwise_params(batch * 56 * 56 * 256)));
 
   network.add_layer(create_conv_layer<DType>(
       network.get_output(), backend, get_path_to_layer_weights(data_dir, 6),
-      *selector,
-      make_conv_params(1, 56, 256, 256, 3, 1, sycldnn::PaddingMode::SAME)));
+      selector,
+      make_conv_params(batch, 56, 256, 256, 3, 1, sycldnn::PaddingMode::SAME)));
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, get_path_to_layer_biases(data_dir, 6),
-      make_bias_params(1, 56, 256)));
+      make_bias_params(batch, 56, 256)));
 
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
-      network.get_output(), backend, make_pointwise_params(56 * 56 * 256)));
+      network.get_output(), backend,
+      make_pointwise_params(batch * 56 * 56 * 256)));
 
   network.add_layer(create_conv_layer<DType>(
       network.get_output(), backend, get_path_to_layer_weights(data_dir, 7),
-      *selector,
-      make_conv_params(1, 56, 256, 256, 3, 1, sycldnn::PaddingMode::SAME)));
+      selector,
+      make_conv_params(batch, 56, 256, 256, 3, 1, sycldnn::PaddingMode::SAME)));
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, get_path_to_layer_biases(data_dir, 7),
-      make_bias_params(1, 56, 256)));
+      make_bias_params(batch, 56, 256)));
 
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
-      network.get_output(), backend, make_pointwise_params(56 * 56 * 256)));
+      network.get_output(), backend,
+      make_pointwise_params(batch * 56 * 56 * 256)));
 
   network.add_layer(create_pooling_layer<DType, sycldnn::pooling::Max>(
       network.get_output(), backend,
-      make_pooling_params(1, 56, 256, 2, 2, sycldnn::PaddingMode::VALID)));
+      make_pooling_params(batch, 56, 256, 2, 2, sycldnn::PaddingMode::VALID)));
 
   network.add_layer(create_conv_layer<DType>(
       network.get_output(), backend, get_path_to_layer_weights(data_dir, 8),
-      *selector,
-      make_conv_params(1, 28, 256, 512, 3, 1, sycldnn::PaddingMode::SAME)));
+      selector,
+      make_conv_params(batch, 28, 256, 512, 3, 1, sycldnn::PaddingMode::SAME)));
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, get_path_to_layer_biases(data_dir, 8),
-      make_bias_params(1, 28, 512)));
+      make_bias_params(batch, 28, 512)));
 
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
-      network.get_output(), backend, make_pointwise_params(28 * 28 * 512)));
+      network.get_output(), backend,
+      make_pointwise_params(batch * 28 * 28 * 512)));
 
   network.add_layer(create_conv_layer<DType>(
       network.get_output(), backend, get_path_to_layer_weights(data_dir, 9),
-      *selector,
-      make_conv_params(1, 28, 512, 512, 3, 1, sycldnn::PaddingMode::SAME)));
+      selector,
+      make_conv_params(batch, 28, 512, 512, 3, 1, sycldnn::PaddingMode::SAME)));
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, get_path_to_layer_biases(data_dir, 9),
-      make_bias_params(1, 28, 512)));
+      make_bias_params(batch, 28, 512)));
 
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
-      network.get_output(), backend, make_pointwise_params(28 * 28 * 512)));
+      network.get_output(), backend,
+      make_pointwise_params(batch * 28 * 28 * 512)));
 
   network.add_layer(create_conv_layer<DType>(
       network.get_output(), backend, get_path_to_layer_weights(data_dir, 10),
-      *selector,
-      make_conv_params(1, 28, 512, 512, 3, 1, sycldnn::PaddingMode::SAME)));
+      selector,
+      make_conv_params(batch, 28, 512, 512, 3, 1, sycldnn::PaddingMode::SAME)));
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, get_path_to_layer_biases(data_dir, 10),
-      make_bias_params(1, 28, 512)));
+      make_bias_params(batch, 28, 512)));
 
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
-      network.get_output(), backend, make_pointwise_params(28 * 28 * 512)));
+      network.get_output(), backend,
+      make_pointwise_params(batch * 28 * 28 * 512)));
 
   network.add_layer(create_pooling_layer<DType, sycldnn::pooling::Max>(
       network.get_output(), backend,
-      make_pooling_params(1, 28, 512, 2, 2, sycldnn::PaddingMode::VALID)));
+      make_pooling_params(batch, 28, 512, 2, 2, sycldnn::PaddingMode::VALID)));
 
   network.add_layer(create_conv_layer<DType>(
       network.get_output(), backend, get_path_to_layer_weights(data_dir, 11),
-      *selector,
-      make_conv_params(1, 14, 512, 512, 3, 1, sycldnn::PaddingMode::SAME)));
+      selector,
+      make_conv_params(batch, 14, 512, 512, 3, 1, sycldnn::PaddingMode::SAME)));
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, get_path_to_layer_biases(data_dir, 11),
-      make_bias_params(1, 14, 512)));
+      make_bias_params(batch, 14, 512)));
 
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
-      network.get_output(), backend, make_pointwise_params(14 * 14 * 512)));
+      network.get_output(), backend,
+      make_pointwise_params(batch * 14 * 14 * 512)));
 
   network.add_layer(create_conv_layer<DType>(
       network.get_output(), backend, get_path_to_layer_weights(data_dir, 12),
-      *selector,
-      make_conv_params(1, 14, 512, 512, 3, 1, sycldnn::PaddingMode::SAME)));
+      selector,
+      make_conv_params(batch, 14, 512, 512, 3, 1, sycldnn::PaddingMode::SAME)));
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, get_path_to_layer_biases(data_dir, 12),
-      make_bias_params(1, 14, 512)));
+      make_bias_params(batch, 14, 512)));
 
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
-      network.get_output(), backend, make_pointwise_params(14 * 14 * 512)));
+      network.get_output(), backend,
+      make_pointwise_params(batch * 14 * 14 * 512)));
 
   network.add_layer(create_conv_layer<DType>(
       network.get_output(), backend, get_path_to_layer_weights(data_dir, 13),
-      *selector,
-      make_conv_params(1, 14, 512, 512, 3, 1, sycldnn::PaddingMode::SAME)));
+      selector,
+      make_conv_params(batch, 14, 512, 512, 3, 1, sycldnn::PaddingMode::SAME)));
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, get_path_to_layer_biases(data_dir, 13),
-      make_bias_params(1, 14, 512)));
+      make_bias_params(batch, 14, 512)));
 
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
-      network.get_output(), backend, make_pointwise_params(14 * 14 * 512)));
+      network.get_output(), backend,
+      make_pointwise_params(batch * 14 * 14 * 512)));
 
   network.add_layer(create_pooling_layer<DType, sycldnn::pooling::Max>(
       network.get_output(), backend,
-      make_pooling_params(1, 14, 512, 2, 2, sycldnn::PaddingMode::VALID)));
+      make_pooling_params(batch, 14, 512, 2, 2, sycldnn::PaddingMode::VALID)));
 
   network.add_layer(create_fc_layer<DType>(
       network.get_output(), backend, get_path_to_layer_weights(data_dir, 14),
-      make_fc_params(7 * 7 * 512, 4096)));
+      make_fc_params(batch, 7 * 7 * 512, 4096)));
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, get_path_to_layer_biases(data_dir, 14),
-      make_bias_params(1, 1, 4096)));
+      make_bias_params(batch, 1, 4096)));
 
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
-      network.get_output(), backend, make_pointwise_params(4096)));
+      network.get_output(), backend, make_pointwise_params(batch * 4096)));
 
   network.add_layer(create_fc_layer<DType>(
       network.get_output(), backend, get_path_to_layer_weights(data_dir, 15),
-      make_fc_params(4096, 4096)));
+      make_fc_params(batch, 4096, 4096)));
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, get_path_to_layer_biases(data_dir, 15),
-      make_bias_params(1, 1, 4096)));
+      make_bias_params(batch, 1, 4096)));
 
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
-      network.get_output(), backend, make_pointwise_params(4096)));
+      network.get_output(), backend, make_pointwise_params(batch * 4096)));
 
   network.add_layer(create_fc_layer<DType>(
       network.get_output(), backend, get_path_to_layer_weights(data_dir, 16),
-      make_fc_params(4096, 1000)));
+      make_fc_params(batch, 4096, 1000)));
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, get_path_to_layer_biases(data_dir, 16),
-      make_bias_params(1, 1, 1000)));
+      make_bias_params(batch, 1, 1000)));
 
   network.add_layer(create_softmax_layer<DType>(
-      network.get_output(), backend, make_softmax_params(1, 1, 1, 1000)));
+      network.get_output(), backend, make_softmax_params(batch, 1, 1, 1000)));
+}
 
-  auto test_status = network.test();
-  test_status.event.wait_and_throw();
-  auto index = std::max_element(output.begin(), output.end());
-  std::cout << "classed as " << std::distance(output.begin(), index)
-            << ", value " << (index != std::end(output) ? *index : 0.f)
-            << std::endl;
+// print the class with the largest score for each image in the batch
+void print_classes(std::vector<DType> const& output) {
+  for (auto image = output.begin(); image != output.end(); image += 1000) {
+    auto index = std::max_element(image, image + 1000);
+    std::cout << "classed as " << std::distance(image, index) << ", value "
+              << *index << std::endl;
+  }
+}
 
+// time a number of runs of a network, either a sycldnn::Network or a
+// sycldnn::DataParallelNetwork
+template <typename NetworkType>
+void time_network(NetworkType& network) {
   int loops = 8;
   do {
     auto st = std::chrono::high_resolution_clock::now();
     auto status = network.run();
-    status.event.wait_and_throw();
+    cl::sycl::event::wait_and_throw(status.events);
     auto end = std::chrono::high_resolution_clock::now();
     std::cout << (end - st).count() << " ns\n";
   } while (--loops);
+}
+
+// check that the gathered outputs of the data parallel network match the
+// outputs of the network run on a single queue
+bool outputs_match(std::vector<DType> const& expected,
+                   std::vector<DType> const& output) {
+  if (expected.size() != output.size()) {
+    std::cout << "data parallel output has " << output.size()
+              << " values, expected " << expected.size() << "\n";
+    return false;
+  }
+  for (size_t i = 0; i < expected.size(); ++i) {
+    DType const tolerance = 1e-4f + 1e-3f * std::abs(expected[i]);
+    if (std::abs(expected[i] - output[i]) > tolerance) {
+      std::cout << "data parallel output " << i << " is " << output[i]
+                << ", expected " << expected[i] << "\n";
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  if (argc < 3) {
+    std::cout << "USAGE: vgg <directory> <image> [<batch> [<queues>]]\n";
+    return 1;
+  }
+  std::string data_dir{argv[1]};
+  std::string image{argv[2]};
+  int const batch = argc > 3 ? std::stoi(argv[3]) : 1;
+  int const n_queues = argc > 4 ? std::stoi(argv[4]) : 1;
+  if (batch < 1 || n_queues < 1) {
+    std::cout << "The batch and number of queues must be positive\n";
+    return 1;
+  }
 
+  auto exception_handler = [](cl::sycl::exception_list l) {
+    for (auto e : l) {
+      try {
+        std::rethrow_exception(e);
+      } catch (cl::sycl::exception& e) {
+        std::cout << e.what() << " " << e.get_cl_code() << "\n";
+      }
+    }
+  };
+  cl::sycl::queue q(exception_handler);
+  auto selector = sycldnn::conv2d::get_default_selector(q.get_device());
+  std::vector<DType> output;
+  {
+    Backend backend(q);
+    auto input = read_image_data(image, backend, batch);
+    sycldnn::Network<DType, Backend> network(backend, output);
+    add_vgg_layers(network, backend, *selector, data_dir, input, batch);
+
+    // Share activation and workspace memory between the layers
+    network.plan_memory();
+
+    auto test_status = network.test();
+    test_status.event.wait_and_throw();
+    print_classes(output);
+    time_network(network);
+  }
   q.wait_and_throw();
+
+  if (n_queues > 1) {
+    // Split the batch between several queues on the same device, each with
+    // its own copy of the network, and check the result against the single
+    // queue run
+    std::vector<cl::sycl::queue> queues;
+    for (int i = 0; i < n_queues; ++i) {
+      queues.emplace_back(q.get_device(), exception_handler);
+    }
+    std::vector<DType> parallel_output;
+    sycldnn::DataParallelNetwork<DType, Backend> network(
+        queues, batch,
+        [&](sycldnn::Network<DType, Backend>& shard_network, Backend& backend,
+            sycldnn::BatchShard const& shard) {
+          auto input = read_image_data(image, backend, shard.batch);
+          add_vgg_layers(shard_network, backend, *selector, data_dir, input,
+                         shard.batch);
+        },
+        parallel_output);
+
+    network.test();
+    if (!outputs_match(output, parallel_output)) {
+      return 1;
+    }
+    std::cout << "data parallel output over " << network.get_num_shards()
+              << " queues matches\n";
+    time_network(network);
+    for (auto& queue : queues) {
+      queue.wait_and_throw();
+    }
+  }
   return 0;
 }
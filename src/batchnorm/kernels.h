@@ -19,7 +19,9 @@
 
 #include <CL/sycl.hpp>
 
+#include "src/helpers/accumulator_type.h"
 #include "src/helpers/tensor_index.h"
+#include "src/helpers/vector_element.h"
 #include "src/helpers/vector_io.h"
 #include "src/helpers/vector_type.h"
 
@@ -30,107 +32,330 @@
 namespace sycldnn {
 namespace batchnorm {
 
-template <typename T, typename Index, int VectorWidth>
-class VarianceOp;
-
-template <typename T, typename Index, int VectorWidth>
-class VarianceOp {
-  using DType = typename helpers::VectorType<T, VectorWidth>::type;
-  using Load = helpers::io::Load<DType>;
-  using Store = helpers::io::Store<DType>;
+/**
+ * Computes the mean and variance of a slice of the positions of each channel,
+ * using a work item for each channel of each slice.
+ *
+ * Slice s holds the positions s, s + n_slices, s + 2 * n_slices, ..., so
+ * neighbouring work items read neighbouring channels of the same position and
+ * the loads are coalesced. Each work item accumulates its slice using
+ * Welford's algorithm, then writes the mean and the variance of the slice to
+ * the workspace, which is laid out as [2, n_slices, channels].
+ *
+ * Assumes that there are no more slices than positions.
+ */
+template <typename T, typename Index>
+class MeanVariancePartialOp {
+  using Accumulator = typename helpers::AccumulatorType<T>::type;
 
-  ReadAccessor<T const> input_, current_mean_;
-  WriteAccessor<T> current_variance_;
-  const Index n_items_;
+  ReadAccessor<T const> input_;
+  WriteAccessor<Accumulator> workspace_;
+  const Index n_positions_;
+  const Index n_slices_;
+  const Index channels_;
 
  public:
-  SNN_ALWAYS_INLINE void operator()(cl::sycl::item<1> item) {
-    Index idx = item.get_id(0);
+  SNN_ALWAYS_INLINE void operator()(cl::sycl::item<2> item) {
+    Index const slice = item.get_id(0);
+    Index const channel = item.get_id(1);
+
+    const auto input = input_.get_pointer().get();
+    auto workspace = workspace_.get_pointer().get();
+
+    Accumulator count{0};
+    Accumulator mean{0};
+    Accumulator m2{0};
+    for (Index i = slice; i < n_positions_; i += n_slices_) {
+      auto const value =
+          static_cast<Accumulator>(input[i * channels_ + channel]);
+      count += static_cast<Accumulator>(1);
+      auto const delta = value - mean;
+      mean += delta / count;
+      m2 += delta * (value - mean);
+    }
 
-    if (idx < n_items_) {
-      auto in_count = static_cast<Index>(input_.get_extent());
-      auto mean_count = static_cast<Index>(current_mean_.get_extent());
+    Index const idx = slice * channels_ + channel;
+    workspace[idx] = mean;
+    workspace[n_slices_ * channels_ + idx] = m2 / count;
+  }
 
-      auto incr = in_count / mean_count;
+  MeanVariancePartialOp(ReadAccessor<T const> input,
+                        WriteAccessor<Accumulator> workspace,
+                        Index const n_positions, Index const n_slices,
+                        Index const channels)
+      : input_(input),
+        workspace_(workspace),
+        n_positions_(n_positions),
+        n_slices_(n_slices),
+        channels_(channels) {}
+};
 
-      auto vec_idx1 = idx * VectorWidth;
-      auto vec_idx2 = vec_idx1 % mean_count;
+/**
+ * Combine the count, mean and sum of squared differences from the mean of two
+ * sets of values, using the pairwise update of Chan et al. This avoids the
+ * cancellation of computing the variance from the sum of squares.
+ *
+ * The statistics of the other set are ignored if it holds no values.
+ */
+template <typename Accumulator>
+SNN_ALWAYS_INLINE void merge_statistics(Accumulator& count, Accumulator& mean,
+                                        Accumulator& m2,
+                                        Accumulator const other_count,
+                                        Accumulator const other_mean,
+                                        Accumulator const other_m2) {
+  if (other_count == Accumulator{0}) {
+    return;
+  }
+  Accumulator const total = count + other_count;
+  Accumulator const delta = other_mean - mean;
+  mean += delta * other_count / total;
+  m2 += other_m2 + delta * delta * count * other_count / total;
+  count = total;
+}
+
+/**
+ * Get the number of positions in a slice of each channel, where slice s holds
+ * the positions s, s + n_slices, s + 2 * n_slices, ...
+ */
+template <typename Accumulator, typename Index>
+SNN_ALWAYS_INLINE Accumulator slice_count(Index const slice,
+                                          Index const n_positions,
+                                          Index const n_slices) {
+  return static_cast<Accumulator>((n_positions - slice - 1) / n_slices + 1);
+}
+
+/**
+ * Combine the statistics of each slice of a channel written by
+ * MeanVariancePartialOp.
+ *
+ * The number of positions in each slice is not stored, but is given by
+ * slice_count().
+ */
+template <typename Accumulator, typename Pointer, typename Index>
+SNN_ALWAYS_INLINE void merge_slice_statistics(
+    Pointer workspace, Index const channel, Index const n_positions,
+    Index const n_slices, Index const channels, Accumulator& mean,
+    Accumulator& variance) {
+  Index const variance_offset = n_slices * channels;
+  Accumulator count{0};
+  Accumulator m2{0};
+  mean = Accumulator{0};
+  for (Index slice = 0; slice < n_slices; ++slice) {
+    Index const idx = slice * channels + channel;
+    auto const n_values =
+        slice_count<Accumulator>(slice, n_positions, n_slices);
+    merge_statistics(count, mean, m2, n_values, workspace[idx],
+                     workspace[variance_offset + idx] * n_values);
+  }
+  variance = m2 / count;
+}
 
-      const auto input = input_.get_pointer();
-      const auto current_mean = current_mean_.get_pointer();
-      auto current_variance = current_variance_.get_pointer();
+/**
+ * Combines the statistics of each slice into the mean and variance of each
+ * channel, using a work item per channel.
+ */
+template <typename T, typename Index>
+class MeanVarianceOp {
+  using Accumulator = typename helpers::AccumulatorType<T>::type;
 
-      auto mean = Load()(current_mean, vec_idx2);
-      auto out = static_cast<DType>(0);
-      for (Index i = vec_idx1; i < in_count; i += mean_count) {
-        out += cl::sycl::pow(Load()(input, i) - mean, static_cast<DType>(2));
-      }
+  ReadAccessor<Accumulator> workspace_;
+  WriteAccessor<T> mean_, variance_;
+  const Index n_positions_;
+  const Index n_slices_;
+  const Index channels_;
 
-      if (incr == 1) {
-        Store()(current_variance, vec_idx2, out);
-      } else {
-        Store()(current_variance, vec_idx2, out / static_cast<DType>(incr));
-      }
-    }
+ public:
+  SNN_ALWAYS_INLINE void operator()(cl::sycl::item<1> item) {
+    Index const channel = item.get_id(0);
+
+    Accumulator mean;
+    Accumulator variance;
+    merge_slice_statistics(workspace_.get_pointer().get(), channel,
+                           n_positions_, n_slices_, channels_, mean, variance);
+
+    auto mean_ptr = mean_.get_pointer().get();
+    auto variance_ptr = variance_.get_pointer().get();
+    mean_ptr[channel] = static_cast<T>(mean);
+    variance_ptr[channel] = static_cast<T>(variance);
   }
 
-  VarianceOp(ReadAccessor<T const> input, ReadAccessor<T const> current_mean,
-             WriteAccessor<T> current_variance, Index const num_items)
-      : input_(input),
-        current_mean_(current_mean),
-        current_variance_(current_variance),
-        n_items_(num_items) {}
+  MeanVarianceOp(ReadAccessor<Accumulator> workspace,
+                 WriteAccessor<T> mean, WriteAccessor<T> variance,
+                 Index const n_positions, Index const n_slices,
+                 Index const channels)
+      : workspace_(workspace),
+        mean_(mean),
+        variance_(variance),
+        n_positions_(n_positions),
+        n_slices_(n_slices),
+        channels_(channels) {}
 };
 
+/**
+ * Computes batchnorm using the batch statistics when training, combining the
+ * statistics of each slice written by MeanVariancePartialOp in the same
+ * kernel, and updating the running mean and variance using the momentum.
+ *
+ * Each workgroup handles a block of positions_per_group positions for
+ * local_range(1) vectors of channels. The rows of the workgroup first combine
+ * the statistics of the slices row, row + local_range(0), ... and then merge
+ * their results through local memory, so each workgroup only reads the small
+ * workspace once. The work items then normalise their positions in the block
+ * with the combined statistics, and the first row of the first block of
+ * positions writes the running mean and variance.
+ *
+ * Assumes that local_range(0) is a power of two, and that the local memory
+ * holds three values for each channel of each work item.
+ */
 template <typename T, typename Index, int VectorWidth>
-class RunningMeanVarianceOp {
+class BatchNormTrainingOp {
+  using Accumulator = typename helpers::AccumulatorType<T>::type;
   using DType = typename helpers::VectorType<T, VectorWidth>::type;
   using Load = helpers::io::Load<DType>;
   using Store = helpers::io::Store<DType>;
 
-  ReadAccessor<T const> input_mean_, input_variance_;
-  ReadWriteAccessor<T> output_mean_, output_variance_;
-  const Index n_items_;
+  ReadAccessor<T const> input_;
+  ReadAccessor<Accumulator> workspace_;
+  ReadAccessor<T const> beta_, gamma_, input_mean_, input_variance_;
+  WriteAccessor<T> running_mean_, running_variance_, output_;
+  LocalAccessor<Accumulator> local_;
+  const Index n_positions_;
+  const Index n_slices_;
+  const Index channels_;
+  const Index positions_per_group_;
+  const float epsilon_;
   const float momentum_;
 
  public:
-  SNN_ALWAYS_INLINE void operator()(cl::sycl::item<1> item) {
-    Index idx = item.get_id(0);
+  SNN_ALWAYS_INLINE void operator()(cl::sycl::nd_item<2> item) {
+    Index const row = item.get_local_id(0);
+    Index const n_rows = item.get_local_range(0);
+    Index const col_stride = item.get_local_range(1) * VectorWidth;
+    Index const channel = item.get_global_id(1) * VectorWidth;
+    bool const valid_channel = channel < channels_;
+
+    const auto workspace = workspace_.get_pointer();
+    auto local = local_.get_pointer();
+    Index const local_size = n_rows * col_stride;
+    Index const local_idx =
+        row * col_stride + item.get_local_id(1) * VectorWidth;
+
+    // Work items past the last channel still take part in the barriers, with
+    // empty statistics.
+    Index const variance_offset = n_slices_ * channels_;
+    for (int i = 0; i < VectorWidth; ++i) {
+      Accumulator count{0};
+      Accumulator mean{0};
+      Accumulator m2{0};
+      if (valid_channel) {
+        for (Index slice = row; slice < n_slices_; slice += n_rows) {
+          Index const idx = slice * channels_ + channel + i;
+          auto const n_values =
+              slice_count<Accumulator>(slice, n_positions_, n_slices_);
+          merge_statistics(count, mean, m2, n_values, workspace[idx],
+                           workspace[variance_offset + idx] * n_values);
+        }
+      }
+      local[local_idx + i] = count;
+      local[local_size + local_idx + i] = mean;
+      local[2 * local_size + local_idx + i] = m2;
+    }
 
-    if (idx < n_items_) {
-      auto vec_idx = idx * VectorWidth;
-
-      const auto input_mean_ptr = input_mean_.get_pointer();
-      const auto input_variance_ptr = input_variance_.get_pointer();
-      auto output_mean_ptr = output_mean_.get_pointer();
-      auto output_variance_ptr = output_variance_.get_pointer();
-
-      auto out_mean_val =
-          Load()(input_mean_ptr, vec_idx) * static_cast<DType>(momentum_) +
-          Load()(helpers::internal::as_const_ptr(output_mean_ptr), vec_idx) *
-              static_cast<DType>(1 - momentum_);
-      auto out_variance_val =
-          Load()(input_variance_ptr, vec_idx) * static_cast<DType>(momentum_) +
-          Load()(helpers::internal::as_const_ptr(output_variance_ptr),
-                 vec_idx) *
-              static_cast<DType>(1 - momentum_);
-
-      Store()(output_mean_ptr, vec_idx, out_mean_val);
-      Store()(output_variance_ptr, vec_idx, out_variance_val);
+    for (Index offset = n_rows / 2; offset > 0; offset /= 2) {
+      item.barrier(cl::sycl::access::fence_space::local_space);
+      if (row < offset) {
+        Index const other_idx = local_idx + offset * col_stride;
+        for (int i = 0; i < VectorWidth; ++i) {
+          Accumulator count = local[local_idx + i];
+          Accumulator mean = local[local_size + local_idx + i];
+          Accumulator m2 = local[2 * local_size + local_idx + i];
+          merge_statistics(count, mean, m2, local[other_idx + i],
+                           local[local_size + other_idx + i],
+                           local[2 * local_size + other_idx + i]);
+          local[local_idx + i] = count;
+          local[local_size + local_idx + i] = mean;
+          local[2 * local_size + local_idx + i] = m2;
+        }
+      }
+    }
+    item.barrier(cl::sycl::access::fence_space::local_space);
+
+    if (!valid_channel) {
+      return;
+    }
+
+    const auto beta = beta_.get_pointer();
+    const auto gamma = gamma_.get_pointer();
+    bool const update_running = item.get_group(0) == 0 && row == 0;
+    Index const merged_idx = local_idx - row * col_stride;
+    DType scale;
+    DType shift;
+    for (int i = 0; i < VectorWidth; ++i) {
+      Accumulator const mean = local[local_size + merged_idx + i];
+      Accumulator const variance =
+          local[2 * local_size + merged_idx + i] / local[merged_idx + i];
+      auto const channel_scale =
+          static_cast<Accumulator>(gamma[channel + i]) /
+          cl::sycl::sqrt(variance + static_cast<Accumulator>(epsilon_));
+      helpers::vector_element::set(scale, i, static_cast<T>(channel_scale));
+      helpers::vector_element::set(
+          shift, i,
+          static_cast<T>(static_cast<Accumulator>(beta[channel + i]) -
+                         mean * channel_scale));
+
+      if (update_running) {
+        const auto input_mean = input_mean_.get_pointer();
+        const auto input_variance = input_variance_.get_pointer();
+        auto running_mean = running_mean_.get_pointer();
+        auto running_variance = running_variance_.get_pointer();
+        auto const momentum = static_cast<Accumulator>(momentum_);
+        auto const batch_weight = static_cast<Accumulator>(1 - momentum_);
+        running_mean[channel + i] = static_cast<T>(
+            static_cast<Accumulator>(input_mean[channel + i]) * momentum +
+            mean * batch_weight);
+        running_variance[channel + i] = static_cast<T>(
+            static_cast<Accumulator>(input_variance[channel + i]) * momentum +
+            variance * batch_weight);
+      }
+    }
+
+    const auto input = input_.get_pointer();
+    auto output = output_.get_pointer();
+    Index const begin = item.get_group(0) * positions_per_group_;
+    Index const end = cl::sycl::min(begin + positions_per_group_, n_positions_);
+    for (Index position = begin + row; position < end; position += n_rows) {
+      Index const idx = position * channels_ + channel;
+      Store()(output, idx, Load()(input, idx) * scale + shift);
     }
   }
 
-  RunningMeanVarianceOp(ReadAccessor<T const> input_mean,
-                        ReadAccessor<T const> input_variance,
-                        ReadWriteAccessor<T> output_mean,
-                        ReadWriteAccessor<T> output_variance,
-                        Index const num_items, float const momentum)
-      : input_mean_(input_mean),
+  BatchNormTrainingOp(ReadAccessor<T const> input,
+                      ReadAccessor<Accumulator> workspace,
+                      ReadAccessor<T const> beta, ReadAccessor<T const> gamma,
+                      ReadAccessor<T const> input_mean,
+                      ReadAccessor<T const> input_variance,
+                      WriteAccessor<T> running_mean,
+                      WriteAccessor<T> running_variance,
+                      WriteAccessor<T> output, LocalAccessor<Accumulator> local,
+                      Index const n_positions, Index const n_slices,
+                      Index const positions_per_group,
+                      BatchNormParams const& params)
+      : input_(input),
+        workspace_(workspace),
+        beta_(beta),
+        gamma_(gamma),
+        input_mean_(input_mean),
         input_variance_(input_variance),
-        output_mean_(output_mean),
-        output_variance_(output_variance),
-        n_items_(num_items),
-        momentum_(momentum) {}
+        running_mean_(running_mean),
+        running_variance_(running_variance),
+        output_(output),
+        local_(local),
+        n_positions_(n_positions),
+        n_slices_(n_slices),
+        channels_(params.channels),
+        positions_per_group_(positions_per_group),
+        epsilon_(params.epsilon),
+        momentum_(params.momentum) {}
 };
 
 template <typename T, typename Index, int VectorWidth>
@@ -189,6 +414,104 @@ class BatchNormOp {
         params_(pp) {}
 };
 
+template <typename T, typename Index>
+class FoldFilterOp;
+
+template <typename T, typename Index>
+class FoldFilterOp {
+  using Load = helpers::io::Load<T>;
+  using Store = helpers::io::Store<T>;
+
+  ReadAccessor<T const> filter_, gamma_, variance_;
+  WriteAccessor<T> output_;
+  const Index n_items_;
+  const Index n_features_;
+  const Index feature_stride_;
+  const float epsilon_;
+
+ public:
+  SNN_ALWAYS_INLINE void operator()(cl::sycl::item<1> item) {
+    Index idx = item.get_id(0);
+
+    if (idx < n_items_) {
+      auto feature_idx = (idx / feature_stride_) % n_features_;
+
+      const auto filter = filter_.get_pointer();
+      const auto gamma = gamma_.get_pointer();
+      const auto variance = variance_.get_pointer();
+      auto output = output_.get_pointer();
+
+      auto scale = Load()(gamma, feature_idx) /
+                   cl::sycl::sqrt(Load()(variance, feature_idx) +
+                                  static_cast<T>(epsilon_));
+      Store()(output, idx, Load()(filter, idx) * scale);
+    }
+  }
+
+  FoldFilterOp(ReadAccessor<T const> filter, ReadAccessor<T const> gamma,
+               ReadAccessor<T const> variance, WriteAccessor<T> output,
+               Index const num_items, Index const num_features,
+               Index const feature_stride, float const epsilon)
+      : filter_(filter),
+        gamma_(gamma),
+        variance_(variance),
+        output_(output),
+        n_items_(num_items),
+        n_features_(num_features),
+        feature_stride_(feature_stride),
+        epsilon_(epsilon) {}
+};
+
+template <typename T, typename Index>
+class FoldBiasOp;
+
+template <typename T, typename Index>
+class FoldBiasOp {
+  using Load = helpers::io::Load<T>;
+  using Store = helpers::io::Store<T>;
+
+  ReadAccessor<T const> bias_, beta_, gamma_, mean_, variance_;
+  WriteAccessor<T> output_;
+  const Index n_items_;
+  const bool use_bias_;
+  const float epsilon_;
+
+ public:
+  SNN_ALWAYS_INLINE void operator()(cl::sycl::item<1> item) {
+    Index idx = item.get_id(0);
+
+    if (idx < n_items_) {
+      const auto bias = bias_.get_pointer();
+      const auto beta = beta_.get_pointer();
+      const auto gamma = gamma_.get_pointer();
+      const auto mean = mean_.get_pointer();
+      const auto variance = variance_.get_pointer();
+      auto output = output_.get_pointer();
+
+      auto bias_val = use_bias_ ? Load()(bias, idx) : static_cast<T>(0);
+      auto scale = Load()(gamma, idx) /
+                   cl::sycl::sqrt(Load()(variance, idx) +
+                                  static_cast<T>(epsilon_));
+      auto val = (bias_val - Load()(mean, idx)) * scale + Load()(beta, idx);
+      Store()(output, idx, val);
+    }
+  }
+
+  FoldBiasOp(ReadAccessor<T const> bias, ReadAccessor<T const> beta,
+             ReadAccessor<T const> gamma, ReadAccessor<T const> mean,
+             ReadAccessor<T const> variance, WriteAccessor<T> output,
+             Index const num_items, bool const use_bias, float const epsilon)
+      : bias_(bias),
+        beta_(beta),
+        gamma_(gamma),
+        mean_(mean),
+        variance_(variance),
+        output_(output),
+        n_items_(num_items),
+        use_bias_(use_bias),
+        epsilon_(epsilon) {}
+};
+
 }  // namespace batchnorm
 }  // namespace sycldnn
 
@@ -0,0 +1,312 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/accessor_types.h"
+
+#include "sycldnn/batchnorm/params.h"
+
+#include "src/batchnorm/kernels.h"
+#include "sycldnn/internal/batchnorm/launch_batchnorm.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace batchnorm {
+namespace internal {
+
+namespace {
+
+// The mean and variance are split across enough slices to give roughly this
+// many work items, as long as each slice holds at least min_slice_size
+// positions. The number of slices is also bounded, as the statistics of all of
+// the slices are read again to combine them.
+constexpr int target_threads = 16384;
+constexpr int min_slice_size = 32;
+constexpr int max_slices = 512;
+
+// Largest workgroup used in the training kernel, which combines the statistics
+// of each slice before normalising a block of positions. Each work item
+// normalises at least min_positions_per_item positions, and at least as many
+// positions as slices it combines, so the cost of combining is amortised.
+constexpr size_t max_workgroup_size = 256;
+constexpr size_t min_positions_per_item = 16;
+
+/**
+ * Queue the kernel computing the mean and variance of each slice of each
+ * channel.
+ */
+template <typename T, typename Index>
+cl::sycl::event queue_slice_statistics(
+    BaseMemObject<T const>& input,
+    BaseMemObject<typename StatisticType<T>::type>& workspace, int n_slices,
+    BatchNormParams const& params, cl::sycl::queue& queue) {
+  static_assert(std::is_same<typename StatisticType<T>::type,
+                             typename helpers::AccumulatorType<T>::type>::value,
+                "The workspace must hold the accumulator type.");
+  Index const n_positions = params.batch * params.rows * params.cols;
+  return queue.submit([&](cl::sycl::handler& cgh) {
+    auto input_acc = input.read_accessor(cgh);
+    auto workspace_acc = workspace.write_accessor(cgh);
+    MeanVariancePartialOp<T, Index> op{input_acc, workspace_acc, n_positions,
+                                       n_slices, params.channels};
+
+    cgh.parallel_for(
+        cl::sycl::range<2>{static_cast<size_t>(n_slices),
+                           static_cast<size_t>(params.channels)},
+        op);
+  });
+}
+
+template <typename T, typename Index>
+SNNStatus queue_mean_variance(
+    BaseMemObject<T const>& input,
+    BaseMemObject<typename StatisticType<T>::type>& workspace,
+    BaseMemObject<T>& mean, BaseMemObject<T>& variance, int n_slices,
+    BatchNormParams const& params, cl::sycl::queue& queue) {
+  Index const n_positions = params.batch * params.rows * params.cols;
+  auto partial_event = queue_slice_statistics<T, Index>(
+      input, workspace, n_slices, params, queue);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto workspace_acc = workspace.read_accessor(cgh);
+    auto mean_acc = mean.write_accessor(cgh);
+    auto variance_acc = variance.write_accessor(cgh);
+    MeanVarianceOp<T, Index> op{workspace_acc, mean_acc,
+                                variance_acc,  n_positions,
+                                n_slices,      params.channels};
+
+    cgh.parallel_for(cl::sycl::range<1>{static_cast<size_t>(params.channels)},
+                     op);
+  });
+
+  SNNStatus status{partial_event, StatusCode::OK};
+  return status.append(event);
+}
+
+/**
+ * Get the power of two number of rows and columns in the workgroups of the
+ * training kernel, given the number of vectors of channels. The columns cover
+ * as many of the channels as possible, so the loads are coalesced, and the
+ * remaining work items in the workgroup are used as rows.
+ */
+cl::sycl::range<2> get_training_workgroup_size(size_t n_vectors,
+                                               cl::sycl::queue& queue) {
+  size_t const device_max_size =
+      queue.get_device()
+          .get_info<cl::sycl::info::device::max_work_group_size>();
+  size_t const max_size = std::min(device_max_size, max_workgroup_size);
+  size_t cols = 1;
+  while (cols < n_vectors && cols * 2 <= max_size) {
+    cols *= 2;
+  }
+  size_t rows = 1;
+  while (rows * cols * 2 <= max_size) {
+    rows *= 2;
+  }
+  return {rows, cols};
+}
+
+template <typename T, typename Index, int VectorWidth>
+SNNStatus queue_batchnorm_training(
+    BaseMemObject<T const>& input,
+    BaseMemObject<typename StatisticType<T>::type>& workspace,
+    BaseMemObject<T const>& beta, BaseMemObject<T const>& gamma,
+    BaseMemObject<T const>& input_mean, BaseMemObject<T const>& input_variance,
+    BaseMemObject<T>& running_mean, BaseMemObject<T>& running_variance,
+    BaseMemObject<T>& output, int n_slices, BatchNormParams const& params,
+    cl::sycl::queue& queue) {
+  using Accumulator = typename StatisticType<T>::type;
+  Index const n_positions = params.batch * params.rows * params.cols;
+  auto partial_event = queue_slice_statistics<T, Index>(
+      input, workspace, n_slices, params, queue);
+
+  size_t const n_vectors = params.channels / VectorWidth;
+  auto const local_range = get_training_workgroup_size(n_vectors, queue);
+  size_t const n_rows = local_range[0];
+  size_t const n_cols = local_range[1];
+  size_t const slices_per_row = (n_slices + n_rows - 1) / n_rows;
+  size_t const positions_per_group =
+      n_rows * std::max(min_positions_per_item, slices_per_row);
+  size_t const n_position_groups =
+      (n_positions + positions_per_group - 1) / positions_per_group;
+  size_t const n_channel_groups = (n_vectors + n_cols - 1) / n_cols;
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input_acc = input.read_accessor(cgh);
+    auto workspace_acc = workspace.read_accessor(cgh);
+    auto beta_acc = beta.read_accessor(cgh);
+    auto gamma_acc = gamma.read_accessor(cgh);
+    auto input_mean_acc = input_mean.read_accessor(cgh);
+    auto input_variance_acc = input_variance.read_accessor(cgh);
+    auto running_mean_acc = running_mean.write_accessor(cgh);
+    auto running_variance_acc = running_variance.write_accessor(cgh);
+    auto output_acc = output.write_accessor(cgh);
+    LocalAccessor<Accumulator> local{
+        cl::sycl::range<1>{3 * n_rows * n_cols * VectorWidth}, cgh};
+    BatchNormTrainingOp<T, Index, VectorWidth> op{
+        input_acc,
+        workspace_acc,
+        beta_acc,
+        gamma_acc,
+        input_mean_acc,
+        input_variance_acc,
+        running_mean_acc,
+        running_variance_acc,
+        output_acc,
+        local,
+        n_positions,
+        n_slices,
+        static_cast<Index>(positions_per_group),
+        params};
+
+    cgh.parallel_for(
+        cl::sycl::nd_range<2>{
+            cl::sycl::range<2>{n_position_groups * n_rows,
+                               n_channel_groups * n_cols},
+            local_range},
+        op);
+  });
+
+  SNNStatus status{partial_event, StatusCode::OK};
+  return status.append(event);
+}
+
+template <typename T, typename Index>
+SNNStatus queue_batchnorm_training(
+    BaseMemObject<T const>& input,
+    BaseMemObject<typename StatisticType<T>::type>& workspace,
+    BaseMemObject<T const>& beta, BaseMemObject<T const>& gamma,
+    BaseMemObject<T const>& input_mean, BaseMemObject<T const>& input_variance,
+    BaseMemObject<T>& running_mean, BaseMemObject<T>& running_variance,
+    BaseMemObject<T>& output, int n_slices, BatchNormParams const& params,
+    cl::sycl::queue& queue) {
+  if (params.channels % 4 == 0) {
+    return queue_batchnorm_training<T, Index, 4>(
+        input, workspace, beta, gamma, input_mean, input_variance,
+        running_mean, running_variance, output, n_slices, params, queue);
+  } else if (params.channels % 2 == 0) {
+    return queue_batchnorm_training<T, Index, 2>(
+        input, workspace, beta, gamma, input_mean, input_variance,
+        running_mean, running_variance, output, n_slices, params, queue);
+  } else {
+    return queue_batchnorm_training<T, Index, 1>(
+        input, workspace, beta, gamma, input_mean, input_variance,
+        running_mean, running_variance, output, n_slices, params, queue);
+  }
+}
+
+}  // namespace
+
+int get_mean_variance_split_count(BatchNormParams const& params) {
+  int const n_positions = params.batch * params.rows * params.cols;
+  int const by_occupancy = std::max(1, target_threads / params.channels);
+  int const by_size = std::max(1, n_positions / min_slice_size);
+  return std::min({by_occupancy, by_size, max_slices});
+}
+
+/**
+ * The internal launcher to compute the mean and variance of each channel in a
+ * single pass.
+ */
+template <typename T>
+SNNStatus launch_mean_variance(
+    BaseMemObject<T const>& input,
+    BaseMemObject<typename StatisticType<T>::type>& workspace,
+    BaseMemObject<T>& mean, BaseMemObject<T>& variance, int n_slices,
+    BatchNormParams const& params, cl::sycl::queue& queue) {
+  auto total_size = params.batch * params.rows * params.cols * params.channels;
+  if (total_size > std::numeric_limits<int32_t>::max()) {
+#ifdef SNN_USE_INT64
+    return queue_mean_variance<T, int64_t>(input, workspace, mean, variance,
+                                           n_slices, params, queue);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return queue_mean_variance<T, int32_t>(input, workspace, mean, variance,
+                                           n_slices, params, queue);
+  }
+}
+
+/**
+ * The internal launcher to compute batchnorm using the batch statistics when
+ * training, and update the running statistics.
+ */
+template <typename T>
+SNNStatus launch_batchnorm_training(
+    BaseMemObject<T const>& input,
+    BaseMemObject<typename StatisticType<T>::type>& workspace,
+    BaseMemObject<T const>& beta, BaseMemObject<T const>& gamma,
+    BaseMemObject<T const>& input_mean, BaseMemObject<T const>& input_variance,
+    BaseMemObject<T>& running_mean, BaseMemObject<T>& running_variance,
+    BaseMemObject<T>& output, int n_slices, BatchNormParams const& params,
+    cl::sycl::queue& queue) {
+  auto total_size = params.batch * params.rows * params.cols * params.channels;
+  if (total_size > std::numeric_limits<int32_t>::max()) {
+#ifdef SNN_USE_INT64
+    return queue_batchnorm_training<T, int64_t>(
+        input, workspace, beta, gamma, input_mean, input_variance,
+        running_mean, running_variance, output, n_slices, params, queue);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return queue_batchnorm_training<T, int32_t>(
+        input, workspace, beta, gamma, input_mean, input_variance,
+        running_mean, running_variance, output, n_slices, params, queue);
+  }
+}
+
+#define INSTANTIATE_LAUNCH(DTYPE)                                           \
+  template SNN_EXPORT SNNStatus launch_mean_variance<DTYPE>(                \
+      BaseMemObject<DTYPE const> & input,                                   \
+      BaseMemObject<StatisticType<DTYPE>::type> & workspace,                \
+      BaseMemObject<DTYPE> & mean, BaseMemObject<DTYPE> & variance,         \
+      int n_slices, BatchNormParams const& params, cl::sycl::queue& queue); \
+  template SNN_EXPORT SNNStatus launch_batchnorm_training<DTYPE>(           \
+      BaseMemObject<DTYPE const> & input,                                   \
+      BaseMemObject<StatisticType<DTYPE>::type> & workspace,                \
+      BaseMemObject<DTYPE const> & beta,                                    \
+      BaseMemObject<DTYPE const> & gamma,                                   \
+      BaseMemObject<DTYPE const> & input_mean,                              \
+      BaseMemObject<DTYPE const> & input_variance,                          \
+      BaseMemObject<DTYPE> & running_mean,                                  \
+      BaseMemObject<DTYPE> & running_variance,                              \
+      BaseMemObject<DTYPE> & output, int n_slices,                          \
+      BatchNormParams const& params, cl::sycl::queue& queue)
+
+INSTANTIATE_LAUNCH(float);
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_LAUNCH(cl::sycl::half);
+#endif
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_LAUNCH(double);
+#endif
+
+}  // namespace internal
+}  // namespace batchnorm
+}  // namespace sycldnn
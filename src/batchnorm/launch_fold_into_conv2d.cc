@@ -0,0 +1,104 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "src/batchnorm/kernels.h"
+#include "sycldnn/internal/batchnorm/launch_batchnorm.h"
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace batchnorm {
+namespace internal {
+
+/**
+ * The internal launcher to fold frozen batchnorm into a convolution.
+ *
+ * Folding is a one-off transform of the convolution weights, so the kernels
+ * are not specialised on vector width.
+ */
+template <typename T>
+SNNStatus launch_fold_into_conv2d(
+    BaseMemObject<T const>& filter, BaseMemObject<T const>& bias,
+    BaseMemObject<T const>& beta, BaseMemObject<T const>& gamma,
+    BaseMemObject<T const>& mean, BaseMemObject<T const>& variance,
+    BaseMemObject<T>& folded_filter, BaseMemObject<T>& folded_bias,
+    int32_t const n_filter_items, int32_t const n_features,
+    int32_t const feature_stride, bool const use_bias, float const epsilon,
+    cl::sycl::queue& queue) {
+  queue.submit([&](cl::sycl::handler& cgh) {
+    auto filter_acc = filter.read_accessor(cgh);
+    auto gamma_acc = gamma.read_accessor(cgh);
+    auto variance_acc = variance.read_accessor(cgh);
+    auto output_acc = folded_filter.write_accessor(cgh);
+    FoldFilterOp<T, int32_t> op{filter_acc,     gamma_acc,
+                                variance_acc,   output_acc,
+                                n_filter_items, n_features,
+                                feature_stride, epsilon};
+    size_t const n_threads =
+        helpers::round_up_to_nearest_multiple(n_filter_items, 64);
+
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, op);
+  });
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto bias_acc = bias.read_accessor(cgh);
+    auto beta_acc = beta.read_accessor(cgh);
+    auto gamma_acc = gamma.read_accessor(cgh);
+    auto mean_acc = mean.read_accessor(cgh);
+    auto variance_acc = variance.read_accessor(cgh);
+    auto output_acc = folded_bias.write_accessor(cgh);
+    FoldBiasOp<T, int32_t> op{bias_acc,   beta_acc,     gamma_acc,
+                              mean_acc,   variance_acc, output_acc,
+                              n_features, use_bias,     epsilon};
+    size_t const n_threads =
+        helpers::round_up_to_nearest_multiple(n_features, 64);
+
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, op);
+  });
+
+  return {event, StatusCode::OK};
+}
+
+#define INSTANTIATE_LAUNCH(DTYPE)                                             \
+  template SNN_EXPORT SNNStatus launch_fold_into_conv2d<DTYPE>(               \
+      BaseMemObject<DTYPE const> & filter, BaseMemObject<DTYPE const> & bias, \
+      BaseMemObject<DTYPE const> & beta, BaseMemObject<DTYPE const> & gamma,  \
+      BaseMemObject<DTYPE const> & mean,                                      \
+      BaseMemObject<DTYPE const> & variance,                                  \
+      BaseMemObject<DTYPE> & folded_filter,                                   \
+      BaseMemObject<DTYPE> & folded_bias, int32_t const n_filter_items,       \
+      int32_t const n_features, int32_t const feature_stride,                 \
+      bool const use_bias, float const epsilon, cl::sycl::queue& queue)
+
+INSTANTIATE_LAUNCH(float);
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_LAUNCH(cl::sycl::half);
+#endif
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_LAUNCH(double);
+#endif
+
+}  // namespace internal
+}  // namespace batchnorm
+}  // namespace sycldnn
@@ -48,13 +48,11 @@ SNNStatus launch_binaryop(BaseMemObject<T const>& lhs,
       BaseMemObject<DTYPE> & outp_access, int32_t const n_items, \
       cl::sycl::queue& queue)
 
-#define INSTANTIATE_BINARYOP_FOR_TYPE(DTYPE)      \
-  INSTANTIATE_BINARYOP_LAUNCH(DTYPE, Add);        \
-  INSTANTIATE_BINARYOP_LAUNCH(DTYPE, Sub);        \
-  INSTANTIATE_BINARYOP_LAUNCH(DTYPE, Mul);        \
-  INSTANTIATE_BINARYOP_LAUNCH(DTYPE, Div);        \
-  INSTANTIATE_BINARYOP_LAUNCH(DTYPE, SoftmaxDiv); \
-  INSTANTIATE_BINARYOP_LAUNCH(DTYPE, SoftmaxSub);
+#define INSTANTIATE_BINARYOP_FOR_TYPE(DTYPE) \
+  INSTANTIATE_BINARYOP_LAUNCH(DTYPE, Add);   \
+  INSTANTIATE_BINARYOP_LAUNCH(DTYPE, Sub);   \
+  INSTANTIATE_BINARYOP_LAUNCH(DTYPE, Mul);   \
+  INSTANTIATE_BINARYOP_LAUNCH(DTYPE, Div);
 
 INSTANTIATE_BINARYOP_FOR_TYPE(float);
 
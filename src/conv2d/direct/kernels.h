@@ -22,6 +22,8 @@
 #include "src/helpers/vector_type.h"
 #include "src/helpers/window_index.h"
 
+#include "src/conv2d/epilogue/kernels.h"
+
 #include "sycldnn/accessor_types.h"
 #include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
@@ -30,7 +30,8 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   using IndexDivType = typename fast_div::IndexDiv<Index, UseFastDiv>::type;
 
   DirectConv2D(const Conv2DParams& params, const ReadAccessor<const T> input,
-               const ReadAccessor<const T> filter, WriteAccessor<T> output)
+               const ReadAccessor<const T> filter, WriteAccessor<T> output,
+               const epilogue::Epilogue<T> epilogue)
       : n_elems_{params.batch * params.out_rows * params.out_cols *
                  params.features},
         div_features_{params.features},
@@ -38,6 +39,8 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         div_out_rows_{params.out_rows},
         channels_{params.channels},
         features_{params.features},
+        group_channels_{params.channels / params.groups},
+        group_features_{params.features / params.groups},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -49,9 +52,12 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_accessor_{input},
         filter_accessor_{filter},
-        output_accessor_{output} {}
+        output_accessor_{output},
+        epilogue_{epilogue} {}
 
   inline SNN_ALWAYS_INLINE void operator()(cl::sycl::item<1> item) {
     Index index = item.get_id(0);
@@ -70,6 +76,7 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
       const Index row_idx = tensor_idx.s2;
       const Index feature = tensor_idx.s1;
       const Index batch = tensor_idx.s0;
+      const Index group = feature / group_features_;
 
       const Index col_stride = static_stride_param(stride_cols_);
       const auto col_window_struct =
@@ -88,23 +95,27 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
       const Index row_window = static_window_param(window_rows_);
       const Index col_window = static_window_param(window_cols_);
       const auto input_data_n =
-          input_data + batch * channels_ * in_rows_ * in_cols_;
+          input_data +
+          (batch * channels_ + group * group_channels_) * in_rows_ * in_cols_;
       const auto filter_data_n =
-          filter_data + feature * channels_ * row_window * col_window;
+          filter_data + feature * group_channels_ * row_window * col_window;
 
       for (Index channel = 0, in_chan_idx = 0, fil_chan_idx = 0;
-           channel < channels_; ++channel, in_chan_idx += in_rows_ * in_cols_,
+           channel < group_channels_;
+           ++channel, in_chan_idx += in_rows_ * in_cols_,
                  fil_chan_idx += row_window * col_window) {
         Index in_row_idx = in_chan_idx + rstart * in_cols_;
         Index fil_row_idx = fil_chan_idx + firstr * col_window;
         for (Index r = rstart, i = firstr; i < row_window;
-             ++r, ++i, in_row_idx += in_cols_, fil_row_idx += col_window) {
+             r += dilation_rows_, ++i, in_row_idx += dilation_rows_ * in_cols_,
+                   fil_row_idx += col_window) {
           if (r >= 0 && r < in_rows_) {
             Index in_col_idx = in_row_idx + cstart;
             Index fil_col_idx = fil_row_idx + firstc;
 
             for (Index c = cstart, j = firstc; j < col_window;
-                 ++c, ++j, ++in_col_idx, ++fil_col_idx) {
+                 c += dilation_cols_, ++j, in_col_idx += dilation_cols_,
+                       ++fil_col_idx) {
               if (c >= 0 && c < in_cols_) {
                 T in_val = input_data_n[in_col_idx];
                 T fil_val = filter_data_n[fil_col_idx];
@@ -115,7 +126,7 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         }  // row loop
       }    // channel loop
 
-      output_data[index] = out_val;
+      output_data[index] = epilogue_.apply(out_val, feature, index);
     }
   }
 
@@ -137,6 +148,8 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   const IndexDivType div_out_rows_;
   const Index channels_;
   const Index features_;
+  const Index group_channels_;
+  const Index group_features_;
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
@@ -148,9 +161,12 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const ReadAccessor<const T> input_accessor_;
   const ReadAccessor<const T> filter_accessor_;
   WriteAccessor<T> output_accessor_;
+  const epilogue::Epilogue<T> epilogue_;
 };
 template <typename T, typename Index, bool UseFastDiv, int StaticWindow,
           int StaticStride>
@@ -168,6 +184,8 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
         div_in_rows_{params.in_rows},
         channels_{params.channels},
         features_{params.features},
+        group_channels_{params.channels / params.groups},
+        group_features_{params.features / params.groups},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -177,10 +195,14 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
         stride_cols_{params.stride_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
-        pad_rows_{static_window_param(params.window_rows) - params.pad_rows -
-                  1},
-        pad_cols_{static_window_param(params.window_cols) - params.pad_cols -
-                  1},
+        pad_rows_{(static_window_param(params.window_rows) - 1) *
+                      params.dilation_rows -
+                  params.pad_rows},
+        pad_cols_{(static_window_param(params.window_cols) - 1) *
+                      params.dilation_cols -
+                  params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_accessor_{input},
         filter_accessor_{filter},
         output_accessor_{output} {}
@@ -202,6 +224,8 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
       const Index row_idx = tensor_idx.s2;
       const Index feature = tensor_idx.s1;
       const Index batch = tensor_idx.s0;
+      const Index group = feature / group_features_;
+      const Index group_feature = feature - group * group_features_;
 
       const Index col_stride = static_stride_param(stride_cols_);
       const auto col_window_struct =
@@ -220,15 +244,24 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
       const Index row_window = static_window_param(window_rows_);
       const Index col_window = static_window_param(window_cols_);
       const auto input_data_n =
-          input_data + batch * channels_ * out_cols_ * out_rows_;
+          input_data + (batch * channels_ + group * group_channels_) *
+                           out_cols_ * out_rows_;
       const auto filter_data_n =
-          filter_data + feature * row_window * col_window;
+          filter_data +
+          (group * group_channels_ * group_features_ + group_feature) *
+              row_window * col_window;
+
+      if (dilation_rows_ != 1 || dilation_cols_ != 1) {
+        output_data[index] =
+            dilated_value(input_data_n, filter_data_n, row_idx, col_idx);
+        continue;
+      }
 
       Index in_chan_idx = 0;
       Index fil_chan_idx = 0;
-      for (Index channel = 0; channel < channels_; ++channel,
+      for (Index channel = 0; channel < group_channels_; ++channel,
                  in_chan_idx += out_cols_ * out_rows_,
-                 fil_chan_idx += features_ * row_window * col_window) {
+                 fil_chan_idx += group_features_ * row_window * col_window) {
         Index in_row_idx = in_chan_idx + rstart * out_cols_;
         Index fil_row_idx =
             fil_chan_idx + (row_window - firstr - 1) * col_window;
@@ -257,6 +290,52 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
   }
 
  private:
+  /**
+   * Compute the input backprop value for a dilated convolution.
+   *
+   * The filter taps which use an input are no longer a fixed number of output
+   * indices apart, so check each filter tap in turn for the output index, if
+   * any, which uses this input at that tap.
+   */
+  template <typename InputPointer, typename FilterPointer>
+  T SNN_ALWAYS_INLINE dilated_value(InputPointer input_data_n,
+                                    FilterPointer filter_data_n,
+                                    Index const row_idx,
+                                    Index const col_idx) const {
+    const Index row_stride = static_stride_param(stride_rows_);
+    const Index col_stride = static_stride_param(stride_cols_);
+    const Index row_window = static_window_param(window_rows_);
+    const Index col_window = static_window_param(window_cols_);
+
+    T out_val{0};
+    Index in_chan_idx = 0;
+    Index fil_chan_idx = 0;
+    for (Index channel = 0; channel < group_channels_; ++channel,
+               in_chan_idx += out_cols_ * out_rows_,
+               fil_chan_idx += group_features_ * row_window * col_window) {
+      for (Index i = 0; i < row_window; ++i) {
+        Index const padded_r = row_idx - pad_rows_ + i * dilation_rows_;
+        Index const r = padded_r / row_stride;
+        if (padded_r >= 0 && r * row_stride == padded_r && r < out_rows_) {
+          Index const in_row_idx = in_chan_idx + r * out_cols_;
+          Index const fil_row_idx =
+              fil_chan_idx + (row_window - i - 1) * col_window;
+          for (Index j = 0; j < col_window; ++j) {
+            Index const padded_c = col_idx - pad_cols_ + j * dilation_cols_;
+            Index const c = padded_c / col_stride;
+            if (padded_c >= 0 && c * col_stride == padded_c &&
+                c < out_cols_) {
+              T in_val = input_data_n[in_row_idx + c];
+              T fil_val = filter_data_n[fil_row_idx + col_window - j - 1];
+              out_val = helpers::math::mad(in_val, fil_val, out_val);
+            }
+          }  // col loop
+        }
+      }  // row loop
+    }    // channel loop
+    return out_val;
+  }
+
   constexpr Index static_window_param(Index window) const {
     return (StaticWindow > 0 ? StaticWindow : window);
   }
@@ -270,6 +349,8 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
   const IndexDivType div_in_rows_;
   const Index channels_;
   const Index features_;
+  const Index group_channels_;
+  const Index group_features_;
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
@@ -281,6 +362,8 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const ReadAccessor<const T> input_accessor_;
   const ReadAccessor<const T> filter_accessor_;
   WriteAccessor<T> output_accessor_;
@@ -303,13 +386,15 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
 
   DirectConv2D(const Conv2DParams& params, const ReadAccessor<const T> input,
                const ReadAccessor<const T> filter, WriteAccessor<T> output)
-      : n_elems_{params.out_rows * params.out_cols * params.channels *
-                 params.features},
-        div_channels_{params.channels},
+      : n_elems_{params.out_rows * params.out_cols * params.channels /
+                 params.groups * params.features},
+        div_group_channels_{params.channels / params.groups},
         div_out_cols_{params.out_cols},
         div_out_rows_{params.out_rows},
         channels_{params.channels},
         features_{params.features},
+        group_channels_{params.channels / params.groups},
+        group_features_{params.features / params.groups},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -321,6 +406,8 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_accessor_{input},
         filter_accessor_{filter},
         output_accessor_{output} {}
@@ -338,16 +425,17 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
       const Index col_out = static_out_param(out_cols_);
       const auto tensor_idx =
           helpers::TensorIndexHelper<Index, UseFastDiv>::unflatten4d(
-              index, div_channels_, channels_, div_out_rows_, row_out,
-              div_out_cols_, col_out);
+              index, div_group_channels_, group_channels_, div_out_rows_,
+              row_out, div_out_cols_, col_out);
       const Index col_idx = tensor_idx.s3;
       const Index row_idx = tensor_idx.s2;
       const Index channel = tensor_idx.s1;
       const Index feature = tensor_idx.s0;
+      const Index group = feature / group_features_;
 
-      const Index cstart = col_idx - pad_cols_;
+      const Index cstart = col_idx * dilation_cols_ - pad_cols_;
       const Index cend = cstart + window_cols_;
-      const Index rstart = row_idx - pad_rows_;
+      const Index rstart = row_idx * dilation_rows_ - pad_rows_;
       const Index rend = rstart + window_rows_;
 
       const Index row_stride = static_stride_param(stride_rows_);
@@ -360,7 +448,8 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
 
       T out_val{0};
 
-      auto input_data_n = input_data + channel * in_rows_ * in_cols_;
+      auto input_data_n = input_data + (group * group_channels_ + channel) *
+                                           in_rows_ * in_cols_;
       auto filter_data_n = filter_data + feature * filter_rows * filter_cols;
 
       for (Index b = 0; b < batch_; b++) {
@@ -401,11 +490,13 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
   }
 
   const Index n_elems_;
-  const IndexDivType div_channels_;
+  const IndexDivType div_group_channels_;
   const IndexDivType div_out_cols_;
   const IndexDivType div_out_rows_;
   const Index channels_;
   const Index features_;
+  const Index group_channels_;
+  const Index group_features_;
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
@@ -417,6 +508,8 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const ReadAccessor<const T> input_accessor_;
   const ReadAccessor<const T> filter_accessor_;
   WriteAccessor<T> output_accessor_;
@@ -36,7 +36,8 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   using StoreData = helpers::io::Store<DataType>;
 
   DirectConv2D(const Conv2DParams& params, const ReadAccessor<const T> input,
-               const ReadAccessor<const T> filter, WriteAccessor<T> output)
+               const ReadAccessor<const T> filter, WriteAccessor<T> output,
+               const epilogue::Epilogue<T> epilogue)
       : n_elems_{params.batch * params.out_rows * params.out_cols *
                  params.features / VectorWidth},
         div_features_{params.features / VectorWidth},
@@ -44,6 +45,8 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         div_out_rows_{params.out_rows},
         channels_{params.channels},
         features_{params.features},
+        group_channels_{params.channels / params.groups},
+        group_features_{params.features / params.groups},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -55,9 +58,12 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_accessor_{input},
         filter_accessor_{filter},
-        output_accessor_{output} {}
+        output_accessor_{output},
+        epilogue_{epilogue} {}
 
   inline SNN_ALWAYS_INLINE void operator()(cl::sycl::item<1> item) {
     Index index = item.get_id(0);
@@ -76,6 +82,7 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
       const Index col_idx = tensor_idx.s2;
       const Index row_idx = tensor_idx.s1;
       const Index batch = tensor_idx.s0;
+      const Index group = feature / group_features_;
 
       const Index col_stride = static_stride_param(stride_cols_);
       const auto col_window_struct =
@@ -91,29 +98,32 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
 
       DataType out_val{0};
 
-      const auto input_data_n =
-          input_data + batch * in_cols_ * in_rows_ * channels_;
+      const auto input_data_n = input_data +
+                                batch * in_cols_ * in_rows_ * channels_ +
+                                group * group_channels_;
       const auto filter_data_n = filter_data + feature;
       const Index row_window = static_window_param(window_rows_);
       const Index col_window = static_window_param(window_cols_);
 
       Index in_row_idx = rstart * in_cols_ * channels_;
-      Index fil_row_idx = firstr * col_window * channels_ * features_;
-      for (Index r = rstart, i = firstr; i < row_window; ++r, ++i,
-                 in_row_idx += in_cols_ * channels_,
-                 fil_row_idx += col_window * channels_ * features_) {
+      Index fil_row_idx = firstr * col_window * group_channels_ * features_;
+      for (Index r = rstart, i = firstr; i < row_window; r += dilation_rows_,
+                 ++i, in_row_idx += dilation_rows_ * in_cols_ * channels_,
+                 fil_row_idx += col_window * group_channels_ * features_) {
         if (r >= 0 && r < in_rows_) {
           Index in_col_idx = in_row_idx + cstart * channels_;
-          Index fil_col_idx = fil_row_idx + firstc * channels_ * features_;
+          Index fil_col_idx =
+              fil_row_idx + firstc * group_channels_ * features_;
 
-          for (Index c = cstart, j = firstc; j < col_window; ++c, ++j,
-                     in_col_idx += channels_,
-                     fil_col_idx += channels_ * features_) {
+          for (Index c = cstart, j = firstc; j < col_window;
+               c += dilation_cols_, ++j,
+                     in_col_idx += dilation_cols_ * channels_,
+                     fil_col_idx += group_channels_ * features_) {
             if (c >= 0 && c < in_cols_) {
               Index idx = in_col_idx;
               Index k_idx = fil_col_idx;
 
-              for (Index channel = 0; channel < channels_;
+              for (Index channel = 0; channel < group_channels_;
                    ++channel, ++idx, k_idx += features_) {
                 DataType in_val = DataType{LoadScalar()(input_data_n, idx)};
                 DataType fil_vals = LoadData()(filter_data_n, k_idx);
@@ -125,6 +135,7 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         }
       }  // row loop
 
+      out_val = epilogue_.apply(out_val, feature, index * VectorWidth);
       StoreData()(output_data, index * VectorWidth, out_val);
     }
   }
@@ -147,6 +158,8 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   const IndexDivType div_out_rows_;
   const Index channels_;
   const Index features_;
+  const Index group_channels_;
+  const Index group_features_;
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
@@ -158,9 +171,12 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const ReadAccessor<const T> input_accessor_;
   const ReadAccessor<const T> filter_accessor_;
   WriteAccessor<T> output_accessor_;
+  const epilogue::Epilogue<T> epilogue_;
 };
 template <typename T, typename Index, bool UseFastDiv, int StaticWindow,
           int StaticStride, int VectorWidth>
@@ -185,6 +201,8 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
         div_in_rows_{params.in_rows},
         channels_{params.channels},
         features_{params.features},
+        group_channels_{params.channels / params.groups},
+        group_features_{params.features / params.groups},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -194,10 +212,14 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
         stride_cols_{params.stride_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
-        pad_rows_{static_window_param(params.window_rows) - params.pad_rows -
-                  1},
-        pad_cols_{static_window_param(params.window_cols) - params.pad_cols -
-                  1},
+        pad_rows_{(static_window_param(params.window_rows) - 1) *
+                      params.dilation_rows -
+                  params.pad_rows},
+        pad_cols_{(static_window_param(params.window_cols) - 1) *
+                      params.dilation_cols -
+                  params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_accessor_{input},
         filter_accessor_{filter},
         output_accessor_{output} {}
@@ -219,6 +241,8 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
       const Index col_idx = tensor_idx.s2;
       const Index row_idx = tensor_idx.s1;
       const Index batch = tensor_idx.s0;
+      const Index group = feature / group_features_;
+      const Index group_feature = feature - group * group_features_;
 
       const Index col_stride = static_stride_param(stride_cols_);
       const auto col_window_struct =
@@ -234,32 +258,40 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
 
       ScalarType out_val{0};
 
-      const auto input_data_n =
-          input_data + batch * out_cols_ * out_rows_ * channels_;
-      const auto filter_data_n = filter_data + feature * channels_;
+      const auto input_data_n = input_data +
+                                batch * out_cols_ * out_rows_ * channels_ +
+                                group * group_channels_;
+      const auto filter_data_n =
+          filter_data + group_feature * channels_ + group * group_channels_;
       const Index row_window = static_window_param(window_rows_);
       const Index col_window = static_window_param(window_cols_);
 
+      if (dilation_rows_ != 1 || dilation_cols_ != 1) {
+        out_val = dilated_value(input_data_n, filter_data_n, row_idx, col_idx);
+        StoreScalar()(output_data, index, out_val);
+        continue;
+      }
+
       Index in_row_idx = rstart * out_cols_ * channels_;
-      Index fil_row_idx =
-          (row_window - firstr - 1) * col_window * features_ * channels_;
+      Index fil_row_idx = (row_window - firstr - 1) * col_window *
+                          group_features_ * channels_;
       for (Index r = rstart, i = firstr; i < row_window; ++r, i += row_stride,
                  in_row_idx += out_cols_ * channels_,
-                 fil_row_idx -= row_stride * col_window * features_ *
+                 fil_row_idx -= row_stride * col_window * group_features_ *
                                                          channels_) {
         if (r >= 0 && r < out_rows_) {
           Index in_col_idx = in_row_idx + cstart * channels_;
-          Index fil_col_idx =
-              fil_row_idx + (col_window - firstc - 1) * features_ * channels_;
+          Index fil_col_idx = fil_row_idx + (col_window - firstc - 1) *
+                                                group_features_ * channels_;
 
           for (Index c = cstart, j = firstc; j < col_window; ++c,
                      j += col_stride, in_col_idx += channels_,
-                     fil_col_idx -= col_stride * features_ * channels_) {
+                     fil_col_idx -= col_stride * group_features_ * channels_) {
             if (c >= 0 && c < out_cols_) {
               Index idx = in_col_idx;
               Index k_idx = fil_col_idx;
 
-              for (Index channel = 0; channel < channels_;
+              for (Index channel = 0; channel < group_channels_;
                    channel += VectorWidth, idx += VectorWidth,
                          k_idx += VectorWidth) {
                 DataType in_val = LoadData()(input_data_n, idx);
@@ -277,6 +309,54 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
   }
 
  private:
+  /**
+   * Compute the input backprop value for a dilated convolution.
+   *
+   * The filter taps which use an input are no longer a fixed number of output
+   * indices apart, so check each filter tap in turn for the output index, if
+   * any, which uses this input at that tap.
+   */
+  template <typename InputPointer, typename FilterPointer>
+  ScalarType SNN_ALWAYS_INLINE dilated_value(InputPointer input_data_n,
+                                             FilterPointer filter_data_n,
+                                             Index const row_idx,
+                                             Index const col_idx) const {
+    const Index row_stride = static_stride_param(stride_rows_);
+    const Index col_stride = static_stride_param(stride_cols_);
+    const Index row_window = static_window_param(window_rows_);
+    const Index col_window = static_window_param(window_cols_);
+
+    ScalarType out_val{0};
+    for (Index i = 0; i < row_window; ++i) {
+      Index const padded_r = row_idx - pad_rows_ + i * dilation_rows_;
+      Index const r = padded_r / row_stride;
+      if (padded_r >= 0 && r * row_stride == padded_r && r < out_rows_) {
+        Index const in_row_idx = r * out_cols_ * channels_;
+        Index const fil_row_idx =
+            (row_window - i - 1) * col_window * group_features_ * channels_;
+        for (Index j = 0; j < col_window; ++j) {
+          Index const padded_c = col_idx - pad_cols_ + j * dilation_cols_;
+          Index const c = padded_c / col_stride;
+          if (padded_c >= 0 && c * col_stride == padded_c && c < out_cols_) {
+            Index idx = in_row_idx + c * channels_;
+            Index k_idx = fil_row_idx +
+                          (col_window - j - 1) * group_features_ * channels_;
+
+            for (Index channel = 0; channel < group_channels_;
+                 channel += VectorWidth, idx += VectorWidth,
+                       k_idx += VectorWidth) {
+              DataType in_val = LoadData()(input_data_n, idx);
+              DataType fil_val = LoadData()(filter_data_n, k_idx);
+
+              out_val += helpers::math::dot(in_val, fil_val);
+            }  // channel loop
+          }
+        }  // col loop
+      }
+    }  // row loop
+    return out_val;
+  }
+
   constexpr Index static_window_param(Index window) const {
     return (StaticWindow > 0 ? StaticWindow : window);
   }
@@ -290,6 +370,8 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
   const IndexDivType div_in_rows_;
   const Index channels_;
   const Index features_;
+  const Index group_channels_;
+  const Index group_features_;
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
@@ -301,6 +383,8 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const ReadAccessor<const T> input_accessor_;
   const ReadAccessor<const T> filter_accessor_;
   WriteAccessor<T> output_accessor_;
@@ -330,13 +414,15 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
 
   DirectConv2D(const Conv2DParams& params, const ReadAccessor<const T> input,
                const ReadAccessor<const T> filter, WriteAccessor<T> output)
-      : n_elems_{params.out_rows * params.out_cols * params.channels *
-                 params.features / VectorWidth},
+      : n_elems_{params.out_rows * params.out_cols * params.channels /
+                 params.groups * params.features / VectorWidth},
         div_features_{params.features / VectorWidth},
-        div_channels_{params.channels},
+        div_group_channels_{params.channels / params.groups},
         div_out_cols_{params.out_cols},
         channels_{params.channels},
         features_{params.features},
+        group_channels_{params.channels / params.groups},
+        group_features_{params.features / params.groups},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -348,6 +434,8 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_accessor_{input},
         filter_accessor_{filter},
         output_accessor_{output} {}
@@ -364,16 +452,17 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
       const Index col_out = static_out_param(out_cols_);
       const auto tensor_idx =
           helpers::TensorIndexHelper<Index, UseFastDiv>::unflatten4d(
-              index, div_out_cols_, col_out, div_channels_, channels_,
-              div_features_, features_ / VectorWidth);
+              index, div_out_cols_, col_out, div_group_channels_,
+              group_channels_, div_features_, features_ / VectorWidth);
       const Index feature = tensor_idx.s3 * VectorWidth;
       const Index channel = tensor_idx.s2;
       const Index col_idx = tensor_idx.s1;
       const Index row_idx = tensor_idx.s0;
+      const Index group = feature / group_features_;
 
-      const Index cstart = col_idx - pad_cols_;
+      const Index cstart = col_idx * dilation_cols_ - pad_cols_;
       const Index cend = cstart + window_cols_;
-      const Index rstart = row_idx - pad_rows_;
+      const Index rstart = row_idx * dilation_rows_ - pad_rows_;
       const Index rend = rstart + window_rows_;
 
       const Index row_stride = static_stride_param(stride_rows_);
@@ -386,7 +475,7 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
 
       DataType out_val{0};
 
-      auto input_data_n = input_data + channel;
+      auto input_data_n = input_data + group * group_channels_ + channel;
       auto filter_data_n = filter_data + feature;
 
       for (Index b = 0; b < batch_; b++) {
@@ -428,10 +517,12 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
 
   const Index n_elems_;
   const IndexDivType div_features_;
-  const IndexDivType div_channels_;
+  const IndexDivType div_group_channels_;
   const IndexDivType div_out_cols_;
   const Index channels_;
   const Index features_;
+  const Index group_channels_;
+  const Index group_features_;
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
@@ -443,6 +534,8 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const ReadAccessor<const T> input_accessor_;
   const ReadAccessor<const T> filter_accessor_;
   WriteAccessor<T> output_accessor_;
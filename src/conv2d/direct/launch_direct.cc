@@ -57,8 +57,8 @@ inline bool can_use_fast_div<conv_type::InputBackprop>(
 template <>
 inline bool can_use_fast_div<conv_type::FilterBackprop>(
     Conv2DParams const& params, int vec_width) {
-  return (params.features / vec_width) != 1 && params.channels != 1 &&
-         params.out_cols != 1;
+  return (params.features / vec_width) != 1 &&
+         (params.channels / params.groups) != 1 && params.out_cols != 1;
 }
 /**
  * Check whether the provided window and stride can be used with the given
@@ -74,6 +74,9 @@ inline bool can_use_static_conv(Conv2DParams const& params, int const window,
 /**
  * Check whether a given vector width can be used for the given convolution.
  *
+ * The vectors cannot span more than one group, so the width has to divide the
+ * number of features in each group.
+ *
  * Expects the convolution parameters to be the original parameters, not the
  * kernel parameters.
  * */
@@ -81,7 +84,7 @@ template <typename ConvType>
 inline bool can_use_vector_width(Conv2DParams const& params, int const width) {
   return params.input_format == DataFormat::NHWC &&
          params.filter_format == FilterFormat::HWCF &&
-         params.features % width == 0;
+         (params.features / params.groups) % width == 0;
 }
 
 template <typename T, typename Index, typename ConvType, bool UseFastDiv,
@@ -89,14 +92,15 @@ template <typename T, typename Index, typename ConvType, bool UseFastDiv,
 SNNStatus launch_with_fast_div(BaseMemObject<T const>& input,
                                BaseMemObject<T const>& filter,
                                BaseMemObject<T>& output,
-                               Conv2DParams const& params, Index output_size,
-                               cl::sycl::queue& queue) {
+                               Conv2DParams const& params,
+                               EpilogueMem<T> const& epilogue,
+                               Index output_size, cl::sycl::queue& queue) {
   if (params.input_format == DataFormat::NCHW &&
       params.filter_format == FilterFormat::FCHW) {
 #ifdef SNN_ENABLE_NCHW
     return queue_direct_kernel<T, Index, ConvType, UseFastDiv, Window, Stride,
                                VectorWidth, layout::NCHW>(
-        input, filter, output, params, output_size, queue);
+        input, filter, output, params, epilogue, output_size, queue);
 #else
     return StatusCode::InvalidAlgorithm;
 #endif
@@ -104,7 +108,7 @@ SNNStatus launch_with_fast_div(BaseMemObject<T const>& input,
              params.filter_format == FilterFormat::HWCF) {
     return queue_direct_kernel<T, Index, ConvType, UseFastDiv, Window, Stride,
                                VectorWidth, layout::NHWC>(
-        input, filter, output, params, output_size, queue);
+        input, filter, output, params, epilogue, output_size, queue);
   }
   return StatusCode::InvalidAlgorithm;
 }
@@ -118,17 +122,20 @@ template <typename T, typename Index, typename ConvType, int Window, int Stride,
 SNNStatus launch_with_vector(BaseMemObject<T const>& input,
                              BaseMemObject<T const>& filter,
                              BaseMemObject<T>& output,
-                             Conv2DParams const& params, Index output_size,
+                             Conv2DParams const& params,
+                             EpilogueMem<T> const& epilogue, Index output_size,
                              cl::sycl::queue& queue) {
   auto kernel_params = direct::get_kernel_params<ConvType>(params);
   if (can_use_fast_div<ConvType>(kernel_params, VectorWidth)) {
     return launch_with_fast_div<T, Index, ConvType, true, Window, Stride,
                                 VectorWidth>(input, filter, output,
-                                             kernel_params, output_size, queue);
+                                             kernel_params, epilogue,
+                                             output_size, queue);
   } else {
     return launch_with_fast_div<T, Index, ConvType, false, Window, Stride,
                                 VectorWidth>(input, filter, output,
-                                             kernel_params, output_size, queue);
+                                             kernel_params, epilogue,
+                                             output_size, queue);
   }
 }
 
@@ -140,17 +147,18 @@ template <typename T, typename Index, typename ConvType, int Window, int Stride>
 SNNStatus launch_with_index(BaseMemObject<T const>& input,
                             BaseMemObject<T const>& filter,
                             BaseMemObject<T>& output,
-                            Conv2DParams const& params, Index output_size,
+                            Conv2DParams const& params,
+                            EpilogueMem<T> const& epilogue, Index output_size,
                             cl::sycl::queue& queue) {
   if (can_use_vector_width<ConvType>(params, 4)) {
     return launch_with_vector<T, Index, ConvType, Window, Stride, 4>(
-        input, filter, output, params, output_size, queue);
+        input, filter, output, params, epilogue, output_size, queue);
   } else if (can_use_vector_width<ConvType>(params, 2)) {
     return launch_with_vector<T, Index, ConvType, Window, Stride, 2>(
-        input, filter, output, params, output_size, queue);
+        input, filter, output, params, epilogue, output_size, queue);
   } else {
     return launch_with_vector<T, Index, ConvType, Window, Stride, 1>(
-        input, filter, output, params, output_size, queue);
+        input, filter, output, params, epilogue, output_size, queue);
   }
 }
 
@@ -163,21 +171,22 @@ SNNStatus launch_with_static_sizes(BaseMemObject<T const>& input,
                                    BaseMemObject<T const>& filter,
                                    BaseMemObject<T>& output,
                                    Conv2DParams const& params,
+                                   EpilogueMem<T> const& epilogue,
                                    cl::sycl::queue& queue) {
   auto conv_sizes = get_sizes<ConvType>(params);
   size_t output_size = conv_sizes.output_size;
   if (output_size > std::numeric_limits<int32_t>::max()) {
 #ifdef SNN_USE_INT64
     return launch_with_index<T, int64_t, ConvType, Window, Stride>(
-        input, filter, output, params, static_cast<int64_t>(output_size),
-        queue);
+        input, filter, output, params, epilogue,
+        static_cast<int64_t>(output_size), queue);
 #else
     return StatusCode::IndexExceeded;
 #endif  // SNN_USE_INT64
   } else {
     return launch_with_index<T, int32_t, ConvType, Window, Stride>(
-        input, filter, output, params, static_cast<int32_t>(output_size),
-        queue);
+        input, filter, output, params, epilogue,
+        static_cast<int32_t>(output_size), queue);
   }
 }
 }  // namespace
@@ -185,33 +194,37 @@ SNNStatus launch_with_static_sizes(BaseMemObject<T const>& input,
  * Use static window and stride sizes for the most common cases, or fall back
  * to using dynamic window and strides. This allows the compiler to make use of
  * the static window and stride sizes to better optimise when possible.
+ *
+ * The dilation is always a runtime value, so dilated convolutions with common
+ * window sizes, such as dilated 3x3, still use the static window kernels.
  */
 template <typename T, typename ConvType>
 SNNStatus launch_direct(BaseMemObject<T const>& input,
                         BaseMemObject<T const>& filter,
                         BaseMemObject<T>& output, Conv2DParams const& params,
+                        EpilogueMem<T> const& epilogue,
                         cl::sycl::queue& queue) {
 #ifdef SNN_CONV2D_STATIC_DIRECT
   if (can_use_static_conv<ConvType>(params, 1, 1)) {
-    return launch_with_static_sizes<T, ConvType, 1, 1>(input, filter, output,
-                                                       params, queue);
+    return launch_with_static_sizes<T, ConvType, 1, 1>(
+        input, filter, output, params, epilogue, queue);
   } else if (can_use_static_conv<ConvType>(params, 3, 1)) {
-    return launch_with_static_sizes<T, ConvType, 3, 1>(input, filter, output,
-                                                       params, queue);
+    return launch_with_static_sizes<T, ConvType, 3, 1>(
+        input, filter, output, params, epilogue, queue);
   } else if (can_use_static_conv<ConvType>(params, 3, 2)) {
-    return launch_with_static_sizes<T, ConvType, 3, 2>(input, filter, output,
-                                                       params, queue);
+    return launch_with_static_sizes<T, ConvType, 3, 2>(
+        input, filter, output, params, epilogue, queue);
   } else if (can_use_static_conv<ConvType>(params, 5, 1)) {
-    return launch_with_static_sizes<T, ConvType, 5, 1>(input, filter, output,
-                                                       params, queue);
+    return launch_with_static_sizes<T, ConvType, 5, 1>(
+        input, filter, output, params, epilogue, queue);
   } else if (can_use_static_conv<ConvType>(params, 5, 2)) {
-    return launch_with_static_sizes<T, ConvType, 5, 2>(input, filter, output,
-                                                       params, queue);
+    return launch_with_static_sizes<T, ConvType, 5, 2>(
+        input, filter, output, params, epilogue, queue);
   } else
 #endif  // SNN_CONV2D_STATIC_DIRECT
   {
-    return launch_with_static_sizes<T, ConvType, 0, 0>(input, filter, output,
-                                                       params, queue);
+    return launch_with_static_sizes<T, ConvType, 0, 0>(
+        input, filter, output, params, epilogue, queue);
   }
 }
 
@@ -219,7 +232,7 @@ SNNStatus launch_direct(BaseMemObject<T const>& input,
   template SNN_EXPORT SNNStatus launch_direct<DTYPE, DIR>(                     \
       BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE const> & filter, \
       BaseMemObject<DTYPE> & output, Conv2DParams const& params,               \
-      cl::sycl::queue& queue)
+      EpilogueMem<DTYPE> const& epilogue, cl::sycl::queue& queue)
 
 #define INSTANTIATE_FOR_TYPE(DTYPE)                      \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward);       \
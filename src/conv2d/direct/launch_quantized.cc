@@ -0,0 +1,126 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/internal/conv2d/quantized.h"
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "sycldnn/helpers/macros.h"
+#include "sycldnn/helpers/ratio.h"
+
+#include "sycldnn/quantize/params.h"
+
+#include "src/conv2d/direct/quantized_kernels.h"
+#include "src/quantize/requantize.h"
+
+#include <CL/sycl.hpp>
+
+#include <stddef.h>
+#include <cstdint>
+#include <limits>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace {
+
+/** The tile of output positions, channels and features used by each thread. */
+constexpr int position_tile = 4;
+constexpr int channel_tile = 4;
+constexpr int feature_tile = 4;
+
+template <typename Index>
+SNNStatus queue_quantized_kernel(
+    BaseMemObject<int8_t const>& input, BaseMemObject<int8_t const>& filter,
+    BaseMemObject<int32_t const>& bias, BaseMemObject<float const>& scales,
+    BaseMemObject<int32_t const>& zero_points, BaseMemObject<int8_t>& output,
+    Conv2DParams const& params,
+    quantize::RequantizeParams const& requantize_params,
+    cl::sycl::queue& queue) {
+  using Functor = direct::QuantizedConv2D<Index, position_tile, channel_tile,
+                                          feature_tile>;
+  Index const n_positions =
+      static_cast<Index>(params.batch) * params.out_rows * params.out_cols;
+  Index const n_position_tiles =
+      helpers::round_ratio_up(n_positions, position_tile);
+  Index const n_feature_tiles =
+      helpers::round_ratio_up(Index{params.features / params.groups},
+                              Index{feature_tile}) *
+      params.groups;
+  Index const n_threads = n_position_tiles * n_feature_tiles;
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input_acc = input.read_accessor(cgh);
+    auto filter_acc = filter.read_accessor(cgh);
+    auto bias_acc = bias.read_accessor(cgh);
+    auto scale_acc = scales.read_accessor(cgh);
+    auto zero_point_acc = zero_points.read_accessor(cgh);
+    auto output_acc = output.write_accessor(cgh);
+
+    Functor conv(n_threads, params, requantize_params, input_acc, filter_acc,
+                 bias_acc, scale_acc, zero_point_acc, output_acc);
+    size_t const n_global_threads =
+        helpers::round_up_to_nearest_multiple(n_threads, 64);
+
+    cgh.parallel_for(cl::sycl::range<1>{n_global_threads}, conv);
+  });
+
+  return {event, StatusCode::OK};
+}
+
+}  // namespace
+
+SNNStatus launch_quantized(
+    BaseMemObject<int8_t const>& input, BaseMemObject<int8_t const>& filter,
+    BaseMemObject<int32_t const>& bias, BaseMemObject<float const>& scales,
+    BaseMemObject<int32_t const>& zero_points, BaseMemObject<int8_t>& output,
+    Conv2DParams const& params,
+    quantize::RequantizeParams const& requantize_params,
+    cl::sycl::queue& queue) {
+  SNN_VALIDATE_PARAM(params.window_rows * params.window_cols *
+                             (params.channels / params.groups) <=
+                         quantize::internal::max_accumulation_size,
+                     "The int32 accumulators can overflow for windows with "
+                     "more than 2^15 values.");
+  auto conv_sizes = get_sizes<conv_type::Forward>(params);
+  size_t output_size = conv_sizes.output_size;
+  size_t input_size = conv_sizes.input_size;
+  if (output_size > std::numeric_limits<int32_t>::max() ||
+      input_size > std::numeric_limits<int32_t>::max()) {
+#ifdef SNN_USE_INT64
+    return queue_quantized_kernel<int64_t>(
+        input, filter, bias, scales, zero_points, output, params,
+        requantize_params, queue);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return queue_quantized_kernel<int32_t>(
+        input, filter, bias, scales, zero_points, output, params,
+        requantize_params, queue);
+  }
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
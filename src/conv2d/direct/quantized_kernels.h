@@ -0,0 +1,228 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_DIRECT_QUANTIZED_KERNELS_H_
+#define SYCLDNN_SRC_CONV2D_DIRECT_QUANTIZED_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/helpers/macros.h"
+
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/quantize/params.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "src/helpers/tensor_index.h"
+#include "src/helpers/vector_element.h"
+#include "src/helpers/vector_io.h"
+#include "src/helpers/window_index.h"
+#include "src/matmul/blocks.h"
+#include "src/quantize/requantize.h"
+
+#include <array>
+#include <cstdint>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace direct {
+
+/**
+ * Int8 quantized forward convolution, computing a tile of PositionTile output
+ * positions by FeatureTile features per thread with int32 accumulators.
+ *
+ * The convolution is computed as a matrix multiply of the input windows with
+ * the filter, reusing the block helpers of the matmul kernels. For each window
+ * position a PositionTile x ChannelTile block of the input and a ChannelTile x
+ * FeatureTile block of the filter are loaded, widened to int32 and offset by
+ * their zero points, with padding and values past the end of the channels or
+ * features set to zero so that they contribute nothing to the accumulator.
+ *
+ * The input is NHWC and the filter HWCF, where the filter holds
+ * channels / groups channels for each feature. The feature tiles never span
+ * more than one group.
+ */
+template <typename Index, int PositionTile, int ChannelTile, int FeatureTile>
+struct QuantizedConv2D {
+  using AccBlock = matmul::VectorBlock<int32_t, PositionTile, FeatureTile>;
+  using AccVector = typename AccBlock::VectorType;
+  using InputBlock = matmul::VectorBlock<int8_t, PositionTile, ChannelTile>;
+  using InputVector = typename InputBlock::VectorType;
+  using LoadInt = helpers::io::Load<int32_t>;
+  using LoadScale = helpers::io::Load<float>;
+  using Store = helpers::io::Store<int8_t>;
+
+  QuantizedConv2D(Index n_threads, Conv2DParams const& params,
+                  quantize::RequantizeParams const& requantize_params,
+                  ReadAccessor<int8_t const> const& input,
+                  ReadAccessor<int8_t const> const& filter,
+                  ReadAccessor<int32_t const> const& bias,
+                  ReadAccessor<float const> const& scales,
+                  ReadAccessor<int32_t const> const& zero_points,
+                  WriteAccessor<int8_t> const& output)
+      : n_threads_{n_threads},
+        n_positions_{params.batch * params.out_rows * params.out_cols},
+        group_channels_{params.channels / params.groups},
+        group_features_{params.features / params.groups},
+        feature_tiles_per_group_{
+            helpers::round_ratio_up(group_features_, Index{FeatureTile})},
+        p_{params},
+        q_{requantize_params},
+        input_accessor_{input},
+        filter_accessor_{filter},
+        bias_accessor_{bias},
+        scale_accessor_{scales},
+        zero_point_accessor_{zero_points},
+        output_accessor_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) {
+    Index const index = item.get_id(0);
+
+    if (index < n_threads_) {
+      auto const input_data = input_accessor_.get_pointer();
+      auto const filter_data = filter_accessor_.get_pointer();
+
+      Index const n_feature_tiles = feature_tiles_per_group_ * p_.groups;
+      Index const feature_tile = index % n_feature_tiles;
+      Index const position = (index / n_feature_tiles) * PositionTile;
+      Index const group = feature_tile / feature_tiles_per_group_;
+      Index const group_feature =
+          (feature_tile % feature_tiles_per_group_) * FeatureTile;
+      Index const feature = group * group_features_ + group_feature;
+
+      std::array<bool, FeatureTile> valid_feature;
+      for (int i = 0; i < FeatureTile; ++i) {
+        valid_feature[i] = group_feature + i < group_features_;
+      }
+      std::array<bool, PositionTile> valid_position;
+      Index rstart[PositionTile];
+      Index cstart[PositionTile];
+      Index input_batch_offset[PositionTile];
+      for (int i = 0; i < PositionTile; ++i) {
+        valid_position[i] = position + i < n_positions_;
+        auto const tensor_idx =
+            helpers::TensorIndexHelper<Index, false>::unflatten3d(
+                position + i, p_.out_rows, p_.out_rows, p_.out_cols,
+                p_.out_cols);
+        rstart[i] = helpers::in_window_from_output(
+                        tensor_idx.s1, p_.stride_rows, p_.pad_rows)
+                        .window_start;
+        cstart[i] = helpers::in_window_from_output(
+                        tensor_idx.s2, p_.stride_cols, p_.pad_cols)
+                        .window_start;
+        input_batch_offset[i] =
+            tensor_idx.s0 * p_.in_rows * p_.in_cols * p_.channels +
+            group * group_channels_;
+      }
+
+      AccVector const bias = matmul::load_row<AccVector, FeatureTile>(
+          bias_accessor_.get_pointer() + feature, valid_feature);
+      AccBlock out_block;
+      for (int i = 0; i < PositionTile; ++i) {
+        out_block.data(i) = bias;
+      }
+
+      for (Index i = 0; i < p_.window_rows; ++i) {
+        for (Index j = 0; j < p_.window_cols; ++j) {
+          std::array<bool, PositionTile> valid_input;
+          Index input_offset[PositionTile];
+          for (int pos = 0; pos < PositionTile; ++pos) {
+            Index const row = rstart[pos] + i * p_.dilation_rows;
+            Index const col = cstart[pos] + j * p_.dilation_cols;
+            valid_input[pos] = valid_position[pos] && row >= 0 &&
+                               row < p_.in_rows && col >= 0 &&
+                               col < p_.in_cols;
+            input_offset[pos] = input_batch_offset[pos] +
+                                (row * p_.in_cols + col) * p_.channels;
+          }
+          Index filter_offset =
+              (i * p_.window_cols + j) * group_channels_ * p_.features +
+              feature;
+          for (Index channel = 0; channel < group_channels_;
+               channel += ChannelTile) {
+            std::array<bool, ChannelTile> valid_channel;
+            for (int c = 0; c < ChannelTile; ++c) {
+              valid_channel[c] = channel + c < group_channels_;
+            }
+            InputBlock input_block;
+            for (int pos = 0; pos < PositionTile; ++pos) {
+              input_block.data(pos) =
+                  valid_input[pos]
+                      ? matmul::load_row<InputVector, ChannelTile>(
+                            input_data + input_offset[pos] + channel,
+                            valid_channel)
+                      : InputVector{0};
+            }
+            auto in_block = matmul::convert_block<int32_t>(input_block);
+            matmul::masked_scalar_subtract<PositionTile, ChannelTile>(
+                in_block, q_.input_zero_point, valid_input, valid_channel);
+            auto fil_block = matmul::convert_block<int32_t>(
+                matmul::load_block<ChannelTile, FeatureTile>(
+                    filter_data + filter_offset, p_.features, valid_channel,
+                    valid_feature));
+            matmul::masked_scalar_subtract<ChannelTile, FeatureTile>(
+                fil_block, q_.filter_zero_point, valid_channel,
+                valid_feature);
+            matmul::block_mmacc(in_block, fil_block, out_block);
+            filter_offset += ChannelTile * p_.features;
+          }  // channel loop
+        }    // col loop
+      }      // row loop
+
+      namespace vec_elem = helpers::vector_element;
+      auto output_data =
+          output_accessor_.get_pointer() + position * p_.features + feature;
+      for (int f = 0; f < FeatureTile; ++f) {
+        if (valid_feature[f]) {
+          auto const scale =
+              LoadScale()(scale_accessor_.get_pointer(), feature + f);
+          auto const zero_point =
+              LoadInt()(zero_point_accessor_.get_pointer(), feature + f);
+          for (int pos = 0; pos < PositionTile; ++pos) {
+            if (valid_position[pos]) {
+              Store()(output_data, pos * p_.features + f,
+                      quantize::internal::requantize(
+                          vec_elem::get(out_block.data(pos), f), scale,
+                          zero_point, q_.activation_min, q_.activation_max));
+            }
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  Index const n_threads_;
+  Index const n_positions_;
+  Index const group_channels_;
+  Index const group_features_;
+  Index const feature_tiles_per_group_;
+  Conv2DParams const p_;
+  quantize::RequantizeParams const q_;
+  ReadAccessor<int8_t const> const input_accessor_;
+  ReadAccessor<int8_t const> const filter_accessor_;
+  ReadAccessor<int32_t const> const bias_accessor_;
+  ReadAccessor<float const> const scale_accessor_;
+  ReadAccessor<int32_t const> const zero_point_accessor_;
+  WriteAccessor<int8_t> output_accessor_;
+};
+
+}  // namespace direct
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_CONV2D_DIRECT_QUANTIZED_KERNELS_H_
@@ -21,11 +21,15 @@
 
 #include "sycldnn/conv2d/params.h"
 
+#include "sycldnn/internal/conv2d/epilogue.h"
+
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
 /**
  * Queue a direct convolution kernel to the provided SYCL queue.
+ *
+ * The epilogue is only applied by the forward kernels.
  */
 template <typename T, typename Index, typename ConvType, bool UseFastDiv,
           int Window, int Stride, int VectorWidth, typename Layout>
@@ -33,6 +37,7 @@ SNNStatus queue_direct_kernel(BaseMemObject<T const>& input,
                               BaseMemObject<T const>& filter,
                               BaseMemObject<T>& output,
                               Conv2DParams const& kernel_params,
+                              EpilogueMem<T> const& epilogue,
                               Index output_size, cl::sycl::queue& queue);
 }  // namespace internal
 }  // namespace conv2d
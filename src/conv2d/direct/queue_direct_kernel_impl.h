@@ -38,12 +38,36 @@ Index calculate_required_threads(Index output_size) {
   }
 }
 
+/** Construct a forward convolution functor, which applies the epilogue. */
+template <typename Functor, typename T>
+Functor make_direct_functor(conv_type::Forward, Conv2DParams const& params,
+                            ReadAccessor<T const> input,
+                            ReadAccessor<T const> filter,
+                            WriteAccessor<T> output,
+                            EpilogueMem<T> const& epilogue,
+                            cl::sycl::handler& cgh) {
+  return {params, input, filter, output,
+          epilogue::make_epilogue(epilogue, cgh)};
+}
+
+/** Construct a backprop convolution functor, which has no epilogue. */
+template <typename Functor, typename T, typename ConvType>
+Functor make_direct_functor(ConvType, Conv2DParams const& params,
+                            ReadAccessor<T const> input,
+                            ReadAccessor<T const> filter,
+                            WriteAccessor<T> output,
+                            EpilogueMem<T> const& /*epilogue*/,
+                            cl::sycl::handler& /*cgh*/) {
+  return {params, input, filter, output};
+}
+
 template <typename T, typename Index, typename ConvType, bool UseFastDiv,
           int Window, int Stride, int VectorWidth, typename Layout>
 SNNStatus queue_direct_kernel(BaseMemObject<T const>& in_mem,
                               BaseMemObject<T const>& fil_mem,
                               BaseMemObject<T>& out_mem,
                               Conv2DParams const& kernel_params,
+                              EpilogueMem<T> const& epilogue,
                               Index output_size, cl::sycl::queue& queue) {
   using Functor = direct::DirectConv2D<T, Index, ConvType, UseFastDiv, Window,
                                        Stride, VectorWidth, Layout>;
@@ -60,7 +84,8 @@ SNNStatus queue_direct_kernel(BaseMemObject<T const>& in_mem,
     auto filter = fil_mem.read_accessor(cgh);
     auto output = out_mem.write_accessor(cgh);
 
-    Functor conv{kernel_params, input, filter, output};
+    auto conv = make_direct_functor<Functor>(ConvType{}, kernel_params, input,
+                                             filter, output, epilogue, cgh);
 
     cgh.parallel_for(cl::sycl::range<1>{n_threads}, conv);
   });
@@ -0,0 +1,165 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_EPILOGUE_KERNELS_H_
+#define SYCLDNN_SRC_CONV2D_EPILOGUE_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/helpers/macros.h"
+
+#include "sycldnn/conv2d/epilogue_params.h"
+
+#include "sycldnn/internal/conv2d/epilogue.h"
+
+#include "src/helpers/accumulator_type.h"
+#include "src/helpers/vector_io.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace epilogue {
+
+/**
+ * The type of the bias and residual values added to a value of type DataType,
+ * where the tensors hold values of type T.
+ */
+template <typename T, typename DataType>
+struct StorageType {
+  using type = T;
+};
+template <typename T, typename U, int N>
+struct StorageType<T, cl::sycl::vec<U, N>> {
+  using type = cl::sycl::vec<T, N>;
+};
+
+/**
+ * Device side convolution epilogue, applied by a convolution kernel to each
+ * output value before it is stored.
+ *
+ * The bias and residual accessors are always bound, but only read when
+ * enabled in the epilogue parameters.
+ */
+template <typename T>
+struct Epilogue {
+  Epilogue(EpilogueParams const& params, ReadAccessor<T const> bias,
+           ReadAccessor<T const> residual)
+      : use_bias_{params.bias},
+        use_residual_{params.residual},
+        activation_{params.activation},
+        bias_accessor_{bias},
+        residual_accessor_{residual} {}
+
+  /**
+   * Apply the epilogue to a value, or vector of values, to be stored in the
+   * output. The value may be in a wider accumulator type than the tensors, in
+   * which case the epilogue is computed in the accumulator type.
+   *
+   * \param value   The value computed by the convolution.
+   * \param feature The output feature of the first element of value.
+   * \param index   The index in the output tensor of the first element of
+   *                value.
+   * \return The value to store in the output.
+   */
+  template <typename DataType, typename Index>
+  DataType SNN_ALWAYS_INLINE apply(DataType value, Index const feature,
+                                   Index const index) const {
+    using Storage = typename StorageType<T, DataType>::type;
+    using Load = helpers::io::Load<Storage>;
+    if (use_bias_) {
+      value += helpers::convert<DataType>(
+          Load()(bias_accessor_.get_pointer(), feature));
+    }
+    if (use_residual_) {
+      value += helpers::convert<DataType>(
+          Load()(residual_accessor_.get_pointer(), index));
+    }
+    switch (activation_) {
+      case Activation::Relu:
+        return cl::sycl::max(value, DataType{0});
+      case Activation::Relu6:
+        return cl::sycl::min(cl::sycl::max(value, DataType{0}), DataType{6});
+      case Activation::Tanh:
+        return cl::sycl::tanh(value);
+      case Activation::None:
+      default:
+        return value;
+    }
+  }
+
+ private:
+  bool const use_bias_;
+  bool const use_residual_;
+  Activation const activation_;
+  ReadAccessor<T const> const bias_accessor_;
+  ReadAccessor<T const> const residual_accessor_;
+};
+
+/**
+ * Bind the epilogue tensors to a command group and construct the device side
+ * epilogue.
+ */
+template <typename T>
+Epilogue<T> make_epilogue(EpilogueMem<T> const& epilogue,
+                          cl::sycl::handler& cgh) {
+  return {epilogue.params, epilogue.bias->read_accessor(cgh),
+          epilogue.residual->read_accessor(cgh)};
+}
+
+/**
+ * Kernel to apply an epilogue in place to an existing convolution output.
+ *
+ * The feature of each output element is computed from the number of elements
+ * between consecutive features, which is 1 for NHWC tensors and the image size
+ * for NCHW tensors.
+ */
+template <typename T, typename Index>
+struct EpilogueOp {
+  EpilogueOp(Epilogue<T> const& epilogue, ReadWriteAccessor<T> output,
+             Index const n_elems, Index const n_features,
+             Index const feature_stride)
+      : epilogue_{epilogue},
+        output_accessor_{output},
+        n_elems_{n_elems},
+        n_features_{n_features},
+        feature_stride_{feature_stride} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) {
+    Index const index = item.get_id(0);
+    if (index < n_elems_) {
+      auto output_data = output_accessor_.get_pointer();
+      Index const feature = (index / feature_stride_) % n_features_;
+
+      T value = helpers::io::Load<T>()(output_data, index);
+      value = epilogue_.apply(value, feature, index);
+      helpers::io::Store<T>()(output_data, index, value);
+    }
+  }
+
+ private:
+  Epilogue<T> const epilogue_;
+  ReadWriteAccessor<T> output_accessor_;
+  Index const n_elems_;
+  Index const n_features_;
+  Index const feature_stride_;
+};
+
+}  // namespace epilogue
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_EPILOGUE_KERNELS_H_
@@ -0,0 +1,100 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/internal/conv2d/epilogue.h"
+
+#include "sycldnn/data_format.h"
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "src/conv2d/epilogue/kernels.h"
+
+#include <CL/sycl.hpp>
+
+#include <stddef.h>
+#include <cstdint>
+#include <limits>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace {
+
+template <typename T, typename Index>
+SNNStatus queue_epilogue(EpilogueMem<T> const& epilogue,
+                         BaseMemObject<T>& out_mem, Conv2DParams const& params,
+                         Index const n_elems, cl::sycl::queue& queue) {
+  Index const feature_stride = params.input_format == DataFormat::NCHW
+                                   ? params.out_rows * params.out_cols
+                                   : 1;
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto output = out_mem.read_write_accessor(cgh);
+    auto device_epilogue = epilogue::make_epilogue(epilogue, cgh);
+    size_t const n_threads =
+        helpers::round_up_to_nearest_multiple(n_elems, 64);
+    epilogue::EpilogueOp<T, Index> op{device_epilogue, output, n_elems,
+                                      params.features, feature_stride};
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, op);
+  });
+  return {event, StatusCode::OK};
+}
+
+}  // namespace
+
+template <typename T>
+SNNStatus launch_epilogue(EpilogueMem<T> const& epilogue,
+                          BaseMemObject<T>& output, Conv2DParams const& params,
+                          cl::sycl::queue& queue) {
+  size_t const n_elems = static_cast<size_t>(params.batch) * params.out_rows *
+                         params.out_cols * params.features;
+  if (n_elems > std::numeric_limits<int32_t>::max()) {
+#ifdef SNN_USE_INT64
+    return queue_epilogue<T, int64_t>(epilogue, output, params,
+                                      static_cast<int64_t>(n_elems), queue);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return queue_epilogue<T, int32_t>(epilogue, output, params,
+                                      static_cast<int32_t>(n_elems), queue);
+  }
+}
+
+#define INSTANTIATE_LAUNCHER(DTYPE)                                     \
+  template SNN_EXPORT SNNStatus launch_epilogue<DTYPE>(                 \
+      EpilogueMem<DTYPE> const& epilogue, BaseMemObject<DTYPE>& output, \
+      Conv2DParams const& params, cl::sycl::queue& queue)
+
+INSTANTIATE_LAUNCHER(float);
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_LAUNCHER(double);
+#endif  // SNN_USE_DOUBLE
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_LAUNCHER(cl::sycl::half);
+#endif  // SNN_USE_HALF
+
+#undef INSTANTIATE_LAUNCHER
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
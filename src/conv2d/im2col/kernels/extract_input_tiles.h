@@ -17,6 +17,7 @@
 #define SYCLDNN_SRC_CONV2D_IM2COL_KERNELS_EXTRACT_INPUT_TILES_H_
 
 #include "sycldnn/accessor_types.h"
+#include "sycldnn/format_type.h"
 
 #include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
@@ -34,15 +35,21 @@ namespace conv2d {
 namespace internal {
 namespace im2col {
 
-template <typename T, typename Index, int VectorWidth, typename ConvType>
+template <typename T, typename Index, int VectorWidth, typename ConvType,
+          typename Layout>
 struct ExtractInputTiles;
 /**
  * Have one thread per input entry. That thread is then responsible for writing
  * its one entry to each point in the intermediate tensor as required for the
  * contraction.
+ *
+ * For grouped convolutions the tiles for each group are written to separate
+ * contiguous matrices, so that the matrix multiplies for all groups can be
+ * computed in a single batched matrix multiply.
  */
 template <typename T, typename Index, int VectorWidth>
-struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward> {
+struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward,
+                         layout::NHWC> {
   using VecType = typename helpers::VectorType<T, VectorWidth>::type;
   using Load = helpers::io::Load<VecType>;
   using Store = helpers::io::Store<VecType>;
@@ -53,6 +60,9 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward> {
       : tile_size_{tile_size},
         channels_{params.channels},
         features_{params.features},
+        group_channels_{params.channels / params.groups},
+        group_size_{params.batch * params.out_rows * params.out_cols *
+                    tile_size},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -62,8 +72,12 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward> {
         stride_cols_{params.stride_cols},
         out_rows_{params.out_rows},
         out_cols_{params.out_cols},
-        pad_rows_{params.window_rows - params.pad_rows - 1},
-        pad_cols_{params.window_cols - params.pad_cols - 1},
+        pad_rows_{(params.window_rows - 1) * params.dilation_rows -
+                  params.pad_rows},
+        pad_cols_{(params.window_cols - 1) * params.dilation_cols -
+                  params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_accessor_{input},
         output_accessor_{output} {}
 
@@ -93,6 +107,16 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward> {
           channel;
       VecType in_val = Load()(input_data, in_idx);
 
+      Index const group = channel / group_channels_;
+      Index const group_channel = channel - group * group_channels_;
+      auto const group_data = output_data + group * group_size_;
+
+      if (dilation_rows_ != 1 || dilation_cols_ != 1) {
+        store_dilated(group_data, batch, row_idx, col_idx, group_channel,
+                      in_val);
+        return;
+      }
+
       auto const col_window_struct =
           helpers::out_window_from_input(col_idx, stride_cols_, pad_cols_);
       Index const cstart = col_window_struct.window_start;
@@ -110,10 +134,10 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward> {
                ++c, in_c -= stride_cols_) {
             if (c >= 0 && c < out_cols_) {
               auto tile_start =
-                  output_data +
+                  group_data +
                   ((batch * out_rows_ + r) * out_cols_ + c) * tile_size_;
-              Index tile_idx =
-                  (in_r * window_cols_ + in_c) * channels_ + channel;
+              Index tile_idx = (in_r * window_cols_ + in_c) * group_channels_ +
+                               group_channel;
               Store()(tile_start, tile_idx, in_val);
             }
           }
@@ -123,9 +147,47 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward> {
   }
 
  private:
+  /**
+   * Write an input value to each tile which uses it in a dilated convolution.
+   *
+   * The window positions which use an input are no longer a fixed number of
+   * output indices apart, so check each window position in turn for the
+   * output index, if any, which uses this input at that position.
+   *
+   * The output pointer and channel are relative to the group containing the
+   * input.
+   */
+  template <typename OutputPointer>
+  void SNN_ALWAYS_INLINE store_dilated(OutputPointer output_data, Index batch,
+                                       Index row_idx, Index col_idx,
+                                       Index channel, VecType in_val) {
+    for (Index in_r = 0; in_r < window_rows_; ++in_r) {
+      Index const padded_r =
+          row_idx - pad_rows_ + (window_rows_ - 1 - in_r) * dilation_rows_;
+      Index const r = padded_r / stride_rows_;
+      if (padded_r >= 0 && r * stride_rows_ == padded_r && r < out_rows_) {
+        for (Index in_c = 0; in_c < window_cols_; ++in_c) {
+          Index const padded_c =
+              col_idx - pad_cols_ + (window_cols_ - 1 - in_c) * dilation_cols_;
+          Index const c = padded_c / stride_cols_;
+          if (padded_c >= 0 && c * stride_cols_ == padded_c && c < out_cols_) {
+            auto tile_start =
+                output_data +
+                ((batch * out_rows_ + r) * out_cols_ + c) * tile_size_;
+            Index tile_idx =
+                (in_r * window_cols_ + in_c) * group_channels_ + channel;
+            Store()(tile_start, tile_idx, in_val);
+          }
+        }
+      }
+    }
+  }
+
   Index const tile_size_;
   Index const channels_;
   Index const features_;
+  Index const group_channels_;
+  Index const group_size_;
   Index const batch_;
   Index const in_rows_;
   Index const in_cols_;
@@ -137,12 +199,15 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward> {
   Index const out_cols_;
   Index const pad_rows_;
   Index const pad_cols_;
+  Index const dilation_rows_;
+  Index const dilation_cols_;
   ReadAccessor<T const> input_accessor_;
   WriteAccessor<T> output_accessor_;
 };
 
 template <typename T, typename Index, int VectorWidth>
-struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop> {
+struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop,
+                         layout::NHWC> {
   using VecType = typename helpers::VectorType<T, VectorWidth>::type;
   using Load = helpers::io::Load<VecType>;
   using Store = helpers::io::Store<VecType>;
@@ -164,6 +229,8 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop> {
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_accessor_{input},
         output_accessor_{output} {}
 
@@ -195,10 +262,11 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop> {
       Index const cstart = col_idx * stride_cols_ - pad_cols_;
       Index const rstart = row_idx * stride_rows_ - pad_rows_;
 
-      for (Index r = rstart, in_r = window_rows_ - 1; in_r >= 0; ++r, --in_r) {
+      for (Index r = rstart, in_r = window_rows_ - 1; in_r >= 0;
+           r += dilation_rows_, --in_r) {
         if (r >= 0 && r < in_rows_) {
           for (Index c = cstart, in_c = window_cols_ - 1; in_c >= 0;
-               ++c, --in_c) {
+               c += dilation_cols_, --in_c) {
             if (c >= 0 && c < in_cols_) {
               auto tile_start =
                   output_data +
@@ -228,12 +296,15 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop> {
   Index const out_cols_;
   Index const pad_rows_;
   Index const pad_cols_;
+  Index const dilation_rows_;
+  Index const dilation_cols_;
   ReadAccessor<T const> input_accessor_;
   WriteAccessor<T> output_accessor_;
 };
 
 template <typename T, typename Index, int VectorWidth>
-struct ExtractInputTiles<T, Index, VectorWidth, conv_type::FilterBackprop> {
+struct ExtractInputTiles<T, Index, VectorWidth, conv_type::FilterBackprop,
+                         layout::NHWC> {
   using VecType = typename helpers::VectorType<T, 1>::type;
   using Load = helpers::io::Load<VecType>;
   using Store = helpers::io::Store<VecType>;
@@ -286,6 +357,11 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::FilterBackprop> {
           channel;
       VecType in_val = Load()(input_data, in_idx);
 
+      if (stride_rows_ != 1 || stride_cols_ != 1) {
+        store_dilated(output_data, batch, row_idx, col_idx, channel, in_val);
+        return;
+      }
+
       // c is the index in the padded output tensor (ie with lots of extra
       // zeros), but without the first padding. first_padded_c adds this extra
       // padding.
@@ -336,9 +412,247 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::FilterBackprop> {
     }
   }
 
+ private:
+  /**
+   * Write an input value to each tile which uses it when the user provided
+   * convolution is dilated.
+   *
+   * The kernel parameters swap the stride and dilation, so here the stride is
+   * the dilation of the user's convolution. For each filter position check
+   * whether there is an output position which uses this input at that filter
+   * position.
+   */
+  template <typename OutputPointer>
+  void SNN_ALWAYS_INLINE store_dilated(OutputPointer output_data, Index batch,
+                                       Index row_idx, Index col_idx,
+                                       Index channel, VecType in_val) {
+    for (Index r = 0; r < out_rows_; ++r) {
+      Index const window_r = row_idx + pad_rows_ - r * stride_rows_;
+      Index const in_r = window_r / dilation_rows_;
+      if (window_r >= 0 && in_r * dilation_rows_ == window_r &&
+          in_r < window_rows_) {
+        for (Index c = 0; c < out_cols_; ++c) {
+          Index const window_c = col_idx + pad_cols_ - c * stride_cols_;
+          Index const in_c = window_c / dilation_cols_;
+          if (window_c >= 0 && in_c * dilation_cols_ == window_c &&
+              in_c < window_cols_) {
+            auto tile_start =
+                output_data +
+                ((r * out_cols_ + c) * channels_ + channel) * tile_size_;
+            Index tile_idx =
+                ((batch * window_rows_ + in_r) * window_cols_ + in_c);
+            Store()(tile_start, tile_idx, in_val);
+          }
+        }
+      }
+    }
+  }
+
+  Index const tile_size_;
+  Index const channels_;
+  Index const features_;
+  Index const batch_;
+  Index const in_rows_;
+  Index const in_cols_;
+  Index const window_rows_;
+  Index const window_cols_;
+  Index const stride_rows_;
+  Index const stride_cols_;
+  Index const out_rows_;
+  Index const out_cols_;
+  Index const pad_rows_;
+  Index const pad_cols_;
+  Index const dilation_rows_;
+  Index const dilation_cols_;
+  ReadAccessor<T const> input_accessor_;
+  WriteAccessor<T> output_accessor_;
+};
+
+/**
+ * Have one thread per entry of an NCHW input tensor, writing that entry to
+ * each tile which uses it.
+ *
+ * Each tile holds the input window for one output pixel in CHW order, which
+ * matches the layout of the filter for each feature in an FCHW filter tensor.
+ */
+template <typename T, typename Index>
+struct ExtractInputTiles<T, Index, 1, conv_type::Forward, layout::NCHW> {
+  using Load = helpers::io::Load<T>;
+  using Store = helpers::io::Store<T>;
+
+  ExtractInputTiles(Index tile_size, Conv2DParams const& params,
+                    ReadAccessor<T const> const& input,
+                    WriteAccessor<T> const& output)
+      : tile_size_{tile_size},
+        channels_{params.channels},
+        batch_{params.batch},
+        in_rows_{params.in_rows},
+        in_cols_{params.in_cols},
+        window_rows_{params.window_rows},
+        window_cols_{params.window_cols},
+        stride_rows_{params.stride_rows},
+        stride_cols_{params.stride_cols},
+        out_rows_{params.out_rows},
+        out_cols_{params.out_cols},
+        pad_rows_{params.pad_rows},
+        pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
+        input_accessor_{input},
+        output_accessor_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<3> item) {
+    Index const col_idx = item.get_id(0);
+    Index const row_idx = item.get_id(1);
+    Index channel;
+    Index batch;
+    if (batch_ == 1) {
+      channel = item.get_id(2);
+      batch = 0;
+    } else {
+      auto const tensor_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten2d(
+              item.get_id(2), channels_, channels_);
+      channel = tensor_idx.s1;
+      batch = tensor_idx.s0;
+    }
+
+    if (col_idx < in_cols_ && row_idx < in_rows_ && channel < channels_ &&
+        batch < batch_) {
+      auto input_data = input_accessor_.get_pointer();
+      auto output_data = output_accessor_.get_pointer();
+
+      Index const in_idx =
+          ((batch * channels_ + channel) * in_rows_ + row_idx) * in_cols_ +
+          col_idx;
+      T in_val = Load()(input_data, in_idx);
+
+      for (Index in_r = 0; in_r < window_rows_; ++in_r) {
+        Index const padded_r = row_idx + pad_rows_ - in_r * dilation_rows_;
+        Index const r = padded_r / stride_rows_;
+        if (padded_r >= 0 && r * stride_rows_ == padded_r && r < out_rows_) {
+          for (Index in_c = 0; in_c < window_cols_; ++in_c) {
+            Index const padded_c = col_idx + pad_cols_ - in_c * dilation_cols_;
+            Index const c = padded_c / stride_cols_;
+            if (padded_c >= 0 && c * stride_cols_ == padded_c &&
+                c < out_cols_) {
+              auto tile_start =
+                  output_data +
+                  ((batch * out_rows_ + r) * out_cols_ + c) * tile_size_;
+              Index tile_idx =
+                  (channel * window_rows_ + in_r) * window_cols_ + in_c;
+              Store()(tile_start, tile_idx, in_val);
+            }
+          }
+        }
+      }
+    }
+  }
+
  private:
   Index const tile_size_;
   Index const channels_;
+  Index const batch_;
+  Index const in_rows_;
+  Index const in_cols_;
+  Index const window_rows_;
+  Index const window_cols_;
+  Index const stride_rows_;
+  Index const stride_cols_;
+  Index const out_rows_;
+  Index const out_cols_;
+  Index const pad_rows_;
+  Index const pad_cols_;
+  Index const dilation_rows_;
+  Index const dilation_cols_;
+  ReadAccessor<T const> input_accessor_;
+  WriteAccessor<T> output_accessor_;
+};
+
+/**
+ * Have one thread per entry of an NCHW output backprop tensor, writing that
+ * entry to the tile of each input pixel it contributes to.
+ *
+ * Each tile holds the output backprop values used by one input pixel in FHW
+ * order, so the input backprop is computed by multiplying the tiles with the
+ * filter transposed from FCHW to CFHW.
+ */
+template <typename T, typename Index>
+struct ExtractInputTiles<T, Index, 1, conv_type::InputBackprop, layout::NCHW> {
+  using Load = helpers::io::Load<T>;
+  using Store = helpers::io::Store<T>;
+
+  ExtractInputTiles(Index tile_size, Conv2DParams const& params,
+                    ReadAccessor<T const> const& input,
+                    WriteAccessor<T> const& output)
+      : tile_size_{tile_size},
+        features_{params.features},
+        batch_{params.batch},
+        in_rows_{params.in_rows},
+        in_cols_{params.in_cols},
+        window_rows_{params.window_rows},
+        window_cols_{params.window_cols},
+        stride_rows_{params.stride_rows},
+        stride_cols_{params.stride_cols},
+        out_rows_{params.out_rows},
+        out_cols_{params.out_cols},
+        pad_rows_{params.pad_rows},
+        pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
+        input_accessor_{input},
+        output_accessor_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<3> item) {
+    Index const col_idx = item.get_id(0);
+    Index const row_idx = item.get_id(1);
+    Index feature;
+    Index batch;
+    if (batch_ == 1) {
+      feature = item.get_id(2);
+      batch = 0;
+    } else {
+      auto const tensor_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten2d(
+              item.get_id(2), features_, features_);
+      feature = tensor_idx.s1;
+      batch = tensor_idx.s0;
+    }
+
+    if (col_idx < out_cols_ && row_idx < out_rows_ && feature < features_ &&
+        batch < batch_) {
+      auto input_data = input_accessor_.get_pointer();
+      auto output_data = output_accessor_.get_pointer();
+
+      Index const in_idx =
+          ((batch * features_ + feature) * out_rows_ + row_idx) * out_cols_ +
+          col_idx;
+      T in_val = Load()(input_data, in_idx);
+
+      Index const rstart = row_idx * stride_rows_ - pad_rows_;
+      Index const cstart = col_idx * stride_cols_ - pad_cols_;
+
+      for (Index r = rstart, in_r = 0; in_r < window_rows_;
+           r += dilation_rows_, ++in_r) {
+        if (r >= 0 && r < in_rows_) {
+          for (Index c = cstart, in_c = 0; in_c < window_cols_;
+               c += dilation_cols_, ++in_c) {
+            if (c >= 0 && c < in_cols_) {
+              auto tile_start =
+                  output_data +
+                  ((batch * in_rows_ + r) * in_cols_ + c) * tile_size_;
+              Index tile_idx =
+                  (feature * window_rows_ + in_r) * window_cols_ + in_c;
+              Store()(tile_start, tile_idx, in_val);
+            }
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  Index const tile_size_;
   Index const features_;
   Index const batch_;
   Index const in_rows_;
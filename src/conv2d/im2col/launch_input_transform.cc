@@ -14,6 +14,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "sycldnn/data_format.h"
+#include "sycldnn/format_type.h"
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
@@ -21,6 +23,7 @@
 #include "sycldnn/conv2d/params.h"
 
 #include "sycldnn/internal/conv2d/im2col/launch_input_transform.h"
+#include "sycldnn/internal/conv2d/im2col/tile_info.h"
 
 #include "src/conv2d/im2col/queue_input_transform.h"
 #include "src/conv2d/im2col/queue_zero_out_transform.h"
@@ -55,7 +58,7 @@ size_t get_thread_size<conv_type::InputBackprop>(Conv2DParams const& params,
 /** Check whether a certain vector size can be used for the given parameters. */
 template <typename ConvType>
 bool can_use_vector(Conv2DParams const& params, int vector_width) {
-  return params.channels % vector_width == 0;
+  return (params.channels / params.groups) % vector_width == 0;
 }
 template <>
 bool can_use_vector<conv_type::InputBackprop>(Conv2DParams const& params,
@@ -68,7 +71,8 @@ bool can_use_vector<conv_type::FilterBackprop>(Conv2DParams const& /*params*/,
   return false;
 }
 
-template <typename T, typename Index, int VectorWidth, typename ConvType>
+template <typename T, typename Index, int VectorWidth, typename ConvType,
+          typename Layout>
 SNNStatus launch_with_index(BaseMemObject<T const>& input,
                             BaseMemObject<T>& output,
                             Conv2DParams const& params, int n_tiles,
@@ -78,12 +82,13 @@ SNNStatus launch_with_index(BaseMemObject<T const>& input,
   if (status.status != StatusCode::OK) {
     return status;
   } else {
-    return queue_input_transform<T, Index, VectorWidth, ConvType>(
+    return queue_input_transform<T, Index, VectorWidth, ConvType, Layout>(
         input, output, params, tile_size, queue);
   }
 }
 
-template <typename T, int VectorWidth, typename ConvType>
+template <typename T, int VectorWidth, typename ConvType,
+          typename Layout = layout::NHWC>
 SNNStatus launch_with_vector(BaseMemObject<T const>& input,
                              BaseMemObject<T>& output,
                              Conv2DParams const& params, int n_tiles,
@@ -91,13 +96,13 @@ SNNStatus launch_with_vector(BaseMemObject<T const>& input,
   size_t thread_size = get_thread_size<ConvType>(params, VectorWidth);
   if (thread_size > std::numeric_limits<int32_t>::max()) {
 #ifdef SNN_USE_INT64
-    return launch_with_index<T, int64_t, VectorWidth, ConvType>(
+    return launch_with_index<T, int64_t, VectorWidth, ConvType, Layout>(
         input, output, params, n_tiles, tile_size, queue);
 #else
     return StatusCode::IndexExceeded;
 #endif  // SNN_USE_INT64
   } else {
-    return launch_with_index<T, int32_t, VectorWidth, ConvType>(
+    return launch_with_index<T, int32_t, VectorWidth, ConvType, Layout>(
         input, output, params, n_tiles, tile_size, queue);
   }
 }
@@ -108,6 +113,15 @@ SNNStatus launch_input_transform(BaseMemObject<T const>& input,
                                  BaseMemObject<T>& output,
                                  Conv2DParams const& params, int n_tiles,
                                  int tile_size, cl::sycl::queue& queue) {
+  if (params.input_format == DataFormat::NCHW) {
+#ifdef SNN_ENABLE_NCHW
+    using TileType = typename NCHWTileType<ConvType>::type;
+    return launch_with_vector<T, 1, TileType, layout::NCHW>(
+        input, output, params, n_tiles, tile_size, queue);
+#else
+    return StatusCode::InvalidAlgorithm;
+#endif  // SNN_ENABLE_NCHW
+  }
   if (can_use_vector<ConvType>(params, 4)) {
     return launch_with_vector<T, 4, ConvType>(input, output, params, n_tiles,
                                               tile_size, queue);
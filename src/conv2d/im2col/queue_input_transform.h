@@ -28,7 +28,8 @@ namespace conv2d {
 namespace internal {
 namespace im2col {
 
-template <typename T, typename Index, int VectorWidth, typename ConvType>
+template <typename T, typename Index, int VectorWidth, typename ConvType,
+          typename Layout>
 SNNStatus queue_input_transform(BaseMemObject<T const>& input,
                                 BaseMemObject<T>& output,
                                 Conv2DParams const& params, int tile_size,
@@ -16,6 +16,7 @@
 #ifndef SYCLDNN_SRC_CONV2D_IM2COL_QUEUE_INPUT_TRANSFORM_IMPL_H_
 #define SYCLDNN_SRC_CONV2D_IM2COL_QUEUE_INPUT_TRANSFORM_IMPL_H_
 
+#include "sycldnn/format_type.h"
 #include "sycldnn/mem_object.h"
 
 #include "sycldnn/conv2d/params.h"
@@ -40,9 +41,10 @@ auto round_up = [](int val) {
   return helpers::round_up_to_nearest_multiple(val, pow_two_multiple);
 };
 
-template <int VectorWidth, typename ConvType,
+template <int VectorWidth, typename ConvType, typename Layout,
           typename std::enable_if<
-              !std::is_same<ConvType, conv_type::InputBackprop>::value,
+              !std::is_same<ConvType, conv_type::InputBackprop>::value &&
+                  std::is_same<Layout, layout::NHWC>::value,
               int>::type = 0>
 cl::sycl::range<3> get_thread_range(Conv2DParams const& params) {
   size_t x = round_up(params.channels / VectorWidth);
@@ -51,10 +53,11 @@ cl::sycl::range<3> get_thread_range(Conv2DParams const& params) {
   return cl::sycl::range<3>{x, y, z};
 }
 
-template <
-    int VectorWidth, typename ConvType,
-    typename std::enable_if<
-        std::is_same<ConvType, conv_type::InputBackprop>::value, int>::type = 0>
+template <int VectorWidth, typename ConvType, typename Layout,
+          typename std::enable_if<
+              std::is_same<ConvType, conv_type::InputBackprop>::value &&
+                  std::is_same<Layout, layout::NHWC>::value,
+              int>::type = 0>
 cl::sycl::range<3> get_thread_range(Conv2DParams const& params) {
   size_t x = round_up(params.features / VectorWidth);
   size_t y = round_up(params.out_cols);
@@ -62,19 +65,44 @@ cl::sycl::range<3> get_thread_range(Conv2DParams const& params) {
   return cl::sycl::range<3>{x, y, z};
 }
 
+template <int VectorWidth, typename ConvType, typename Layout,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::InputBackprop>::value &&
+                  std::is_same<Layout, layout::NCHW>::value,
+              int>::type = 0>
+cl::sycl::range<3> get_thread_range(Conv2DParams const& params) {
+  size_t x = round_up(params.in_cols);
+  size_t y = round_up(params.in_rows);
+  size_t z = round_up(params.channels * params.batch);
+  return cl::sycl::range<3>{x, y, z};
+}
+
+template <int VectorWidth, typename ConvType, typename Layout,
+          typename std::enable_if<
+              std::is_same<ConvType, conv_type::InputBackprop>::value &&
+                  std::is_same<Layout, layout::NCHW>::value,
+              int>::type = 0>
+cl::sycl::range<3> get_thread_range(Conv2DParams const& params) {
+  size_t x = round_up(params.out_cols);
+  size_t y = round_up(params.out_rows);
+  size_t z = round_up(params.features * params.batch);
+  return cl::sycl::range<3>{x, y, z};
+}
+
 }  // namespace
 
-template <typename T, typename Index, int VectorWidth, typename ConvType>
+template <typename T, typename Index, int VectorWidth, typename ConvType,
+          typename Layout>
 SNNStatus queue_input_transform(BaseMemObject<T const>& input_mem,
                                 BaseMemObject<T>& output_mem,
                                 Conv2DParams const& params, int tile_size,
                                 cl::sycl::queue& queue) {
-  using Functor = ExtractInputTiles<T, Index, VectorWidth, ConvType>;
+  using Functor = ExtractInputTiles<T, Index, VectorWidth, ConvType, Layout>;
 
   auto event = queue.submit([&](cl::sycl::handler& cgh) {
     auto input = input_mem.read_accessor(cgh);
     auto output = output_mem.write_accessor(cgh);
-    auto range = get_thread_range<VectorWidth, ConvType>(params);
+    auto range = get_thread_range<VectorWidth, ConvType, Layout>(params);
     Functor conv{tile_size, params, input, output};
 
     cgh.parallel_for(range, conv);
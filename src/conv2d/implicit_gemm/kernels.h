@@ -0,0 +1,455 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_KERNELS_H_
+#define SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "src/helpers/math.h"
+#include "src/helpers/vector_io.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace implicit_gemm {
+
+/**
+ * Convolution computed as a matrix multiply, where the rows of the implicit
+ * patch matrix are gathered from the input tensor as they are needed rather
+ * than being written to a temporary buffer first.
+ *
+ * Each work item computes a RowTile x ColTile block of the output matrix,
+ * keeping the partial sums in registers.
+ */
+template <typename T, typename Index, typename ConvType, int RowTile,
+          int ColTile>
+struct ImplicitGemmConv2D;
+
+/**
+ * Accumulate the outer product of a column of the patch matrix and a row of
+ * the filter matrix into a block of outputs.
+ */
+template <typename T, int RowTile, int ColTile>
+inline SNN_ALWAYS_INLINE void accumulate(T const (&lhs)[RowTile],
+                                         T const (&rhs)[ColTile],
+                                         T (&out_block)[RowTile][ColTile]) {
+  for (int i = 0; i < RowTile; ++i) {
+    for (int j = 0; j < ColTile; ++j) {
+      out_block[i][j] = helpers::math::mad(lhs[i], rhs[j], out_block[i][j]);
+    }
+  }
+}
+
+/** Store the valid values of a block of outputs to the output matrix. */
+template <typename T, typename Index, int RowTile, int ColTile,
+          typename Pointer>
+inline SNN_ALWAYS_INLINE void store(T const (&out_block)[RowTile][ColTile],
+                                    Pointer output, Index row, Index col,
+                                    bool const (&valid_row)[RowTile],
+                                    bool const (&valid_col)[ColTile],
+                                    Index ld) {
+  using Store = helpers::io::Store<T>;
+  for (int i = 0; i < RowTile; ++i) {
+    if (valid_row[i]) {
+      for (int j = 0; j < ColTile; ++j) {
+        if (valid_col[j]) {
+          Store()(output, (row + i) * ld + col + j, out_block[i][j]);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Forward convolution. The output matrix is [batch * out_rows * out_cols,
+ * features], the patch matrix is [batch * out_rows * out_cols, window_rows *
+ * window_cols * channels] and the filter is used directly as the
+ * [window_rows * window_cols * channels, features] matrix.
+ */
+template <typename T, typename Index, int RowTile, int ColTile>
+struct ImplicitGemmConv2D<T, Index, conv_type::Forward, RowTile, ColTile> {
+  ImplicitGemmConv2D(Conv2DParams const& params,
+                     ReadAccessor<T const> const& input,
+                     ReadAccessor<T const> const& filter,
+                     WriteAccessor<T> const& output)
+      : n_rows_{params.batch * params.out_rows * params.out_cols},
+        channels_{params.channels},
+        features_{params.features},
+        in_rows_{params.in_rows},
+        in_cols_{params.in_cols},
+        out_rows_{params.out_rows},
+        out_cols_{params.out_cols},
+        window_rows_{params.window_rows},
+        window_cols_{params.window_cols},
+        stride_rows_{params.stride_rows},
+        stride_cols_{params.stride_cols},
+        pad_rows_{params.pad_rows},
+        pad_cols_{params.pad_cols},
+        input_{input},
+        filter_{filter},
+        output_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<2> item) {
+    Index const row = item.get_id(0) * RowTile;
+    Index const feature = item.get_id(1) * ColTile;
+
+    auto input_data = input_.get_pointer();
+    auto filter_data = filter_.get_pointer();
+    auto output_data = output_.get_pointer();
+
+    bool valid_row[RowTile];
+    Index batch_offset[RowTile];
+    Index in_row_start[RowTile];
+    Index in_col_start[RowTile];
+    for (int i = 0; i < RowTile; ++i) {
+      Index const out_idx = row + i;
+      valid_row[i] = out_idx < n_rows_;
+      Index const out_col = out_idx % out_cols_;
+      Index const out_row = (out_idx / out_cols_) % out_rows_;
+      Index const batch = out_idx / (out_cols_ * out_rows_);
+      batch_offset[i] = batch * in_rows_ * in_cols_ * channels_;
+      in_row_start[i] = out_row * stride_rows_ - pad_rows_;
+      in_col_start[i] = out_col * stride_cols_ - pad_cols_;
+    }
+    bool valid_col[ColTile];
+    for (int j = 0; j < ColTile; ++j) {
+      valid_col[j] = feature + j < features_;
+    }
+
+    T out_block[RowTile][ColTile];
+    for (int i = 0; i < RowTile; ++i) {
+      for (int j = 0; j < ColTile; ++j) {
+        out_block[i][j] = T{0};
+      }
+    }
+
+    using Load = helpers::io::Load<T>;
+    for (Index win_row = 0; win_row < window_rows_; ++win_row) {
+      for (Index win_col = 0; win_col < window_cols_; ++win_col) {
+        bool valid_pixel[RowTile];
+        Index pixel_offset[RowTile];
+        for (int i = 0; i < RowTile; ++i) {
+          Index const in_row = in_row_start[i] + win_row;
+          Index const in_col = in_col_start[i] + win_col;
+          valid_pixel[i] = valid_row[i] && in_row >= 0 && in_row < in_rows_ &&
+                           in_col >= 0 && in_col < in_cols_;
+          pixel_offset[i] =
+              batch_offset[i] + (in_row * in_cols_ + in_col) * channels_;
+        }
+        Index filter_offset =
+            (win_row * window_cols_ + win_col) * channels_ * features_ +
+            feature;
+        for (Index channel = 0; channel < channels_;
+             ++channel, filter_offset += features_) {
+          T in_vals[RowTile];
+          for (int i = 0; i < RowTile; ++i) {
+            in_vals[i] = valid_pixel[i]
+                             ? Load()(input_data, pixel_offset[i] + channel)
+                             : T{0};
+          }
+          T fil_vals[ColTile];
+          for (int j = 0; j < ColTile; ++j) {
+            fil_vals[j] =
+                valid_col[j] ? Load()(filter_data, filter_offset + j) : T{0};
+          }
+          accumulate(in_vals, fil_vals, out_block);
+        }
+      }
+    }
+
+    store(out_block, output_data, row, feature, valid_row, valid_col,
+          features_);
+  }
+
+ private:
+  Index const n_rows_;
+  Index const channels_;
+  Index const features_;
+  Index const in_rows_;
+  Index const in_cols_;
+  Index const out_rows_;
+  Index const out_cols_;
+  Index const window_rows_;
+  Index const window_cols_;
+  Index const stride_rows_;
+  Index const stride_cols_;
+  Index const pad_rows_;
+  Index const pad_cols_;
+  ReadAccessor<T const> input_;
+  ReadAccessor<T const> filter_;
+  WriteAccessor<T> output_;
+};
+
+/**
+ * Input backprop convolution. The output matrix is [batch * in_rows * in_cols,
+ * channels], the patch matrix is [batch * in_rows * in_cols, window_rows *
+ * window_cols * features] gathered from the output gradients, and the filter
+ * is used directly as the transposed [window_rows * window_cols * features,
+ * channels] matrix, so no filter transform is needed.
+ */
+template <typename T, typename Index, int RowTile, int ColTile>
+struct ImplicitGemmConv2D<T, Index, conv_type::InputBackprop, RowTile,
+                          ColTile> {
+  ImplicitGemmConv2D(Conv2DParams const& params,
+                     ReadAccessor<T const> const& input,
+                     ReadAccessor<T const> const& filter,
+                     WriteAccessor<T> const& output)
+      : n_rows_{params.batch * params.in_rows * params.in_cols},
+        channels_{params.channels},
+        features_{params.features},
+        in_rows_{params.in_rows},
+        in_cols_{params.in_cols},
+        out_rows_{params.out_rows},
+        out_cols_{params.out_cols},
+        window_rows_{params.window_rows},
+        window_cols_{params.window_cols},
+        stride_rows_{params.stride_rows},
+        stride_cols_{params.stride_cols},
+        pad_rows_{params.pad_rows},
+        pad_cols_{params.pad_cols},
+        input_{input},
+        filter_{filter},
+        output_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<2> item) {
+    Index const row = item.get_id(0) * RowTile;
+    Index const channel = item.get_id(1) * ColTile;
+
+    auto input_data = input_.get_pointer();
+    auto filter_data = filter_.get_pointer();
+    auto output_data = output_.get_pointer();
+
+    bool valid_row[RowTile];
+    Index batch_offset[RowTile];
+    Index padded_row[RowTile];
+    Index padded_col[RowTile];
+    for (int i = 0; i < RowTile; ++i) {
+      Index const in_idx = row + i;
+      valid_row[i] = in_idx < n_rows_;
+      Index const in_col = in_idx % in_cols_;
+      Index const in_row = (in_idx / in_cols_) % in_rows_;
+      Index const batch = in_idx / (in_cols_ * in_rows_);
+      batch_offset[i] = batch * out_rows_ * out_cols_ * features_;
+      padded_row[i] = in_row + pad_rows_;
+      padded_col[i] = in_col + pad_cols_;
+    }
+    bool valid_col[ColTile];
+    for (int j = 0; j < ColTile; ++j) {
+      valid_col[j] = channel + j < channels_;
+    }
+
+    T out_block[RowTile][ColTile];
+    for (int i = 0; i < RowTile; ++i) {
+      for (int j = 0; j < ColTile; ++j) {
+        out_block[i][j] = T{0};
+      }
+    }
+
+    using Load = helpers::io::Load<T>;
+    for (Index win_row = 0; win_row < window_rows_; ++win_row) {
+      for (Index win_col = 0; win_col < window_cols_; ++win_col) {
+        // An input pixel only receives a gradient from an output pixel if the
+        // filter element lands on it, which requires the offset to be a
+        // multiple of the stride.
+        bool valid_pixel[RowTile];
+        Index pixel_offset[RowTile];
+        for (int i = 0; i < RowTile; ++i) {
+          Index const row_offset = padded_row[i] - win_row;
+          Index const col_offset = padded_col[i] - win_col;
+          Index const out_row = row_offset / stride_rows_;
+          Index const out_col = col_offset / stride_cols_;
+          valid_pixel[i] = valid_row[i] && row_offset >= 0 &&
+                           col_offset >= 0 &&
+                           row_offset % stride_rows_ == 0 &&
+                           col_offset % stride_cols_ == 0 &&
+                           out_row < out_rows_ && out_col < out_cols_;
+          pixel_offset[i] =
+              batch_offset[i] + (out_row * out_cols_ + out_col) * features_;
+        }
+        Index const filter_offset =
+            ((win_row * window_cols_ + win_col) * channels_ + channel) *
+            features_;
+        for (Index feature = 0; feature < features_; ++feature) {
+          T in_vals[RowTile];
+          for (int i = 0; i < RowTile; ++i) {
+            in_vals[i] = valid_pixel[i]
+                             ? Load()(input_data, pixel_offset[i] + feature)
+                             : T{0};
+          }
+          T fil_vals[ColTile];
+          for (int j = 0; j < ColTile; ++j) {
+            fil_vals[j] = valid_col[j]
+                              ? Load()(filter_data,
+                                       filter_offset + j * features_ + feature)
+                              : T{0};
+          }
+          accumulate(in_vals, fil_vals, out_block);
+        }
+      }
+    }
+
+    store(out_block, output_data, row, channel, valid_row, valid_col,
+          channels_);
+  }
+
+ private:
+  Index const n_rows_;
+  Index const channels_;
+  Index const features_;
+  Index const in_rows_;
+  Index const in_cols_;
+  Index const out_rows_;
+  Index const out_cols_;
+  Index const window_rows_;
+  Index const window_cols_;
+  Index const stride_rows_;
+  Index const stride_cols_;
+  Index const pad_rows_;
+  Index const pad_cols_;
+  ReadAccessor<T const> input_;
+  ReadAccessor<T const> filter_;
+  WriteAccessor<T> output_;
+};
+
+/**
+ * Filter backprop convolution. The output matrix is the [window_rows *
+ * window_cols * channels, features] filter gradient, the patch matrix is the
+ * transposed [window_rows * window_cols * channels, batch * out_rows *
+ * out_cols] matrix gathered from the input, and the output gradients are used
+ * directly as the [batch * out_rows * out_cols, features] matrix.
+ */
+template <typename T, typename Index, int RowTile, int ColTile>
+struct ImplicitGemmConv2D<T, Index, conv_type::FilterBackprop, RowTile,
+                          ColTile> {
+  ImplicitGemmConv2D(Conv2DParams const& params,
+                     ReadAccessor<T const> const& input,
+                     ReadAccessor<T const> const& filter,
+                     WriteAccessor<T> const& output)
+      : n_rows_{params.window_rows * params.window_cols * params.channels},
+        batch_{params.batch},
+        channels_{params.channels},
+        features_{params.features},
+        in_rows_{params.in_rows},
+        in_cols_{params.in_cols},
+        out_rows_{params.out_rows},
+        out_cols_{params.out_cols},
+        window_cols_{params.window_cols},
+        stride_rows_{params.stride_rows},
+        stride_cols_{params.stride_cols},
+        pad_rows_{params.pad_rows},
+        pad_cols_{params.pad_cols},
+        input_{input},
+        filter_{filter},
+        output_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<2> item) {
+    Index const row = item.get_id(0) * RowTile;
+    Index const feature = item.get_id(1) * ColTile;
+
+    auto input_data = input_.get_pointer();
+    auto filter_data = filter_.get_pointer();
+    auto output_data = output_.get_pointer();
+
+    bool valid_row[RowTile];
+    Index channel[RowTile];
+    Index row_start[RowTile];
+    Index col_start[RowTile];
+    for (int i = 0; i < RowTile; ++i) {
+      Index const fil_idx = row + i;
+      valid_row[i] = fil_idx < n_rows_;
+      channel[i] = fil_idx % channels_;
+      Index const win_col = (fil_idx / channels_) % window_cols_;
+      Index const win_row = fil_idx / (channels_ * window_cols_);
+      row_start[i] = win_row - pad_rows_;
+      col_start[i] = win_col - pad_cols_;
+    }
+    bool valid_col[ColTile];
+    for (int j = 0; j < ColTile; ++j) {
+      valid_col[j] = feature + j < features_;
+    }
+
+    T out_block[RowTile][ColTile];
+    for (int i = 0; i < RowTile; ++i) {
+      for (int j = 0; j < ColTile; ++j) {
+        out_block[i][j] = T{0};
+      }
+    }
+
+    using Load = helpers::io::Load<T>;
+    Index grad_offset = feature;
+    for (Index batch = 0; batch < batch_; ++batch) {
+      Index const batch_offset = batch * in_rows_ * in_cols_ * channels_;
+      for (Index out_row = 0; out_row < out_rows_; ++out_row) {
+        for (Index out_col = 0; out_col < out_cols_;
+             ++out_col, grad_offset += features_) {
+          T in_vals[RowTile];
+          for (int i = 0; i < RowTile; ++i) {
+            Index const in_row = row_start[i] + out_row * stride_rows_;
+            Index const in_col = col_start[i] + out_col * stride_cols_;
+            bool const valid_pixel = valid_row[i] && in_row >= 0 &&
+                                     in_row < in_rows_ && in_col >= 0 &&
+                                     in_col < in_cols_;
+            in_vals[i] =
+                valid_pixel
+                    ? Load()(input_data,
+                             batch_offset +
+                                 (in_row * in_cols_ + in_col) * channels_ +
+                                 channel[i])
+                    : T{0};
+          }
+          T grad_vals[ColTile];
+          for (int j = 0; j < ColTile; ++j) {
+            grad_vals[j] =
+                valid_col[j] ? Load()(filter_data, grad_offset + j) : T{0};
+          }
+          accumulate(in_vals, grad_vals, out_block);
+        }
+      }
+    }
+
+    store(out_block, output_data, row, feature, valid_row, valid_col,
+          features_);
+  }
+
+ private:
+  Index const n_rows_;
+  Index const batch_;
+  Index const channels_;
+  Index const features_;
+  Index const in_rows_;
+  Index const in_cols_;
+  Index const out_rows_;
+  Index const out_cols_;
+  Index const window_cols_;
+  Index const stride_rows_;
+  Index const stride_cols_;
+  Index const pad_rows_;
+  Index const pad_cols_;
+  ReadAccessor<T const> input_;
+  ReadAccessor<T const> filter_;
+  WriteAccessor<T> output_;
+};
+
+}  // namespace implicit_gemm
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_KERNELS_H_
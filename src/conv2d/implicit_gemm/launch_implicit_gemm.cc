@@ -0,0 +1,137 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/internal/conv2d/implicit_gemm.h"
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "src/conv2d/implicit_gemm/queue_implicit_gemm.h"
+
+#include <CL/sycl.hpp>
+
+#include <stddef.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace {
+
+/** The size of the output matrix computed by the implicit GEMM. */
+struct MatrixSizes {
+  size_t rows;
+  size_t cols;
+};
+
+template <typename ConvType>
+MatrixSizes get_matrix_sizes(Conv2DParams const& params);
+
+template <>
+MatrixSizes get_matrix_sizes<conv_type::Forward>(Conv2DParams const& params) {
+  size_t const rows = params.batch * params.out_rows * params.out_cols;
+  return {rows, static_cast<size_t>(params.features)};
+}
+
+template <>
+MatrixSizes get_matrix_sizes<conv_type::InputBackprop>(
+    Conv2DParams const& params) {
+  size_t const rows = params.batch * params.in_rows * params.in_cols;
+  return {rows, static_cast<size_t>(params.channels)};
+}
+
+template <>
+MatrixSizes get_matrix_sizes<conv_type::FilterBackprop>(
+    Conv2DParams const& params) {
+  size_t const rows = params.window_rows * params.window_cols * params.channels;
+  return {rows, static_cast<size_t>(params.features)};
+}
+
+// The tile sizes used by each work item. These must match the values
+// instantiated in src/conv2d/CMakeLists.txt.
+constexpr int row_tile = 4;
+constexpr int col_tile = 4;
+
+}  // namespace
+
+template <typename T, typename ConvType>
+SNNStatus launch_implicit_gemm(BaseMemObject<T const>& input,
+                               BaseMemObject<T const>& filter,
+                               BaseMemObject<T>& output,
+                               Conv2DParams const& params,
+                               cl::sycl::queue& queue) {
+  if (params.input_format != DataFormat::NHWC ||
+      params.filter_format != FilterFormat::HWCF) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  auto const conv_sizes = get_sizes<ConvType>(params);
+  auto const matrix_sizes = get_matrix_sizes<ConvType>(params);
+  size_t const max_size = std::max({conv_sizes.input_size,
+                                    conv_sizes.filter_size,
+                                    conv_sizes.output_size});
+  if (max_size > std::numeric_limits<int32_t>::max()) {
+#ifdef SNN_USE_INT64
+    return implicit_gemm::queue_implicit_gemm<T, int64_t, ConvType, row_tile,
+                                              col_tile>(
+        input, filter, output, params,
+        static_cast<int64_t>(matrix_sizes.rows),
+        static_cast<int64_t>(matrix_sizes.cols), queue);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return implicit_gemm::queue_implicit_gemm<T, int32_t, ConvType, row_tile,
+                                              col_tile>(
+        input, filter, output, params,
+        static_cast<int32_t>(matrix_sizes.rows),
+        static_cast<int32_t>(matrix_sizes.cols), queue);
+  }
+}
+
+#define INSTANTIATE_LAUNCHER(DTYPE, DIR)                                       \
+  template SNN_EXPORT SNNStatus launch_implicit_gemm<DTYPE, DIR>(              \
+      BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE const> & filter, \
+      BaseMemObject<DTYPE> & output, Conv2DParams const& params,               \
+      cl::sycl::queue& queue)
+
+#define INSTANTIATE_FOR_TYPE(DTYPE)                      \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward);       \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop); \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::FilterBackprop)
+
+INSTANTIATE_FOR_TYPE(float);
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_FOR_TYPE(double);
+#endif  // SNN_USE_DOUBLE
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_FOR_TYPE(cl::sycl::half);
+#endif  // SNN_USE_HALF
+
+#undef INSTANTIATE_FOR_TYPE
+#undef INSTANTIATE_LAUNCHER
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
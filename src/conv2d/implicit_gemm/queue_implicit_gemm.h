@@ -0,0 +1,47 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_H_
+#define SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/params.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace implicit_gemm {
+
+/**
+ * Queue an implicit GEMM convolution kernel to the provided SYCL queue.
+ *
+ * \param n_rows The number of rows in the output matrix.
+ * \param n_cols The number of columns in the output matrix.
+ */
+template <typename T, typename Index, typename ConvType, int RowTile,
+          int ColTile>
+SNNStatus queue_implicit_gemm(BaseMemObject<T const>& input,
+                              BaseMemObject<T const>& filter,
+                              BaseMemObject<T>& output,
+                              Conv2DParams const& params, Index n_rows,
+                              Index n_cols, cl::sycl::queue& queue);
+
+}  // namespace implicit_gemm
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_H_
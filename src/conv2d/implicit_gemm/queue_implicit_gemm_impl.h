@@ -0,0 +1,61 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_IMPL_H_
+#define SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_IMPL_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "src/conv2d/implicit_gemm/kernels.h"
+#include "src/conv2d/implicit_gemm/queue_implicit_gemm.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace implicit_gemm {
+
+template <typename T, typename Index, typename ConvType, int RowTile,
+          int ColTile>
+SNNStatus queue_implicit_gemm(BaseMemObject<T const>& in_mem,
+                              BaseMemObject<T const>& fil_mem,
+                              BaseMemObject<T>& out_mem,
+                              Conv2DParams const& params, Index n_rows,
+                              Index n_cols, cl::sycl::queue& queue) {
+  using Functor = ImplicitGemmConv2D<T, Index, ConvType, RowTile, ColTile>;
+  size_t const n_row_threads =
+      helpers::round_ratio_up_above_zero(n_rows, RowTile);
+  size_t const n_col_threads =
+      helpers::round_ratio_up_above_zero(n_cols, ColTile);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = in_mem.read_accessor(cgh);
+    auto filter = fil_mem.read_accessor(cgh);
+    auto output = out_mem.write_accessor(cgh);
+
+    Functor conv{params, input, filter, output};
+
+    cgh.parallel_for(cl::sycl::range<2>{n_row_threads, n_col_threads}, conv);
+  });
+  return {event, StatusCode::OK};
+}
+
+}  // namespace implicit_gemm
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_IMPL_H_
@@ -13,7 +13,10 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "sycldnn/data_format.h"
+
 #include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
 
 #include "sycldnn/conv2d/selector/default_selector.h"
@@ -21,8 +24,12 @@
 
 #include "sycldnn/conv2d/selector/selector.h"
 
+#include "sycldnn/internal/conv2d/winograd/kernel_params.h"
+#include "sycldnn/internal/conv2d/winograd/tile_info.h"
+
 #include <memory>
 #include <string>
+#include <type_traits>
 
 #include <CL/sycl.hpp>
 
@@ -36,6 +43,86 @@
 
 namespace {
 
+/** Check whether the convolution uses a dilation other than 1. */
+bool is_dilated(sycldnn::conv2d::Conv2DParams const& params) {
+  return params.dilation_rows != 1 || params.dilation_cols != 1;
+}
+
+/** Check whether the convolution uses more than one group. */
+bool is_grouped(sycldnn::conv2d::Conv2DParams const& params) {
+  return params.groups != 1;
+}
+
+/** Check whether the convolution uses NCHW tensors. */
+bool is_nchw(sycldnn::conv2d::Conv2DParams const& params) {
+  return params.input_format == sycldnn::DataFormat::NCHW;
+}
+
+/**
+ * Check whether the tiled kernels support the convolution's window and stride.
+ * Tiled is supported for 1x1, 3x3 and 5x5 with stride 1 or 2, and for dilated
+ * convolutions with stride 1.
+ */
+bool can_use_tiled(sycldnn::conv2d::Conv2DParams const& params) {
+  return params.stride_rows == params.stride_cols &&
+         params.window_rows == params.window_cols &&
+         (params.window_rows == 1 || params.window_rows == 3 ||
+          params.window_rows == 5) &&
+         (params.stride_rows == 1 ||
+          (params.stride_rows == 2 && !is_dilated(params)));
+}
+
+/**
+ * Choose the Winograd tile sizes for a 5x5s1 convolution. F(4x4, 5x5) needs
+ * fewer multiplies for each output than F(2x2, 5x5), but for small images more
+ * of that work is wasted on tiles which overlap the edge of the output, so
+ * pick whichever needs fewer multiplies for the whole image.
+ */
+template <typename ConvType>
+sycldnn::conv2d::Algorithm select_winograd_5x5(
+    sycldnn::conv2d::Conv2DParams const& params) {
+  namespace winograd = sycldnn::conv2d::internal::winograd;
+  auto const kernel_params = winograd::get_params<ConvType>(params);
+  if (winograd::transformed_size<4, 4, 5, 5>(kernel_params) <
+      winograd::transformed_size<2, 2, 5, 5>(kernel_params)) {
+    return sycldnn::conv2d::Algorithm::WinogradLarge;
+  }
+  return sycldnn::conv2d::Algorithm::Winograd;
+}
+
+/**
+ * Select an algorithm for an NCHW convolution. Grouped NCHW convolutions are
+ * only supported by direct. Otherwise the Winograd transforms and matmul
+ * support NCHW tensors in the same cases as for NHWC, and im2col is used for
+ * anything else.
+ */
+template <typename ConvType>
+sycldnn::conv2d::Algorithm select_nchw(
+    sycldnn::conv2d::Conv2DParams const& params) {
+  using FilterBackprop = sycldnn::conv2d::conv_type::FilterBackprop;
+  if (is_grouped(params)) {
+    return sycldnn::conv2d::Algorithm::Direct;
+  }
+  if (params.stride_rows == 1 && params.stride_cols == 1 &&
+      params.window_rows == 1 && params.window_cols == 1 &&
+      params.pad_rows == 0 && params.pad_cols == 0) {
+    return sycldnn::conv2d::Algorithm::Matmul;
+  }
+  if (params.stride_rows == 1 && params.stride_cols == 1 &&
+      !is_dilated(params)) {
+    if (params.window_rows == 3 && params.window_cols == 3) {
+      return sycldnn::conv2d::Algorithm::WinogradLarge;
+    } else if ((params.window_rows == 1 && params.window_cols == 3) ||
+               (params.window_rows == 3 && params.window_cols == 1)) {
+      return sycldnn::conv2d::Algorithm::Winograd;
+    } else if (params.window_rows == 5 && params.window_cols == 5 &&
+               !std::is_same<ConvType, FilterBackprop>::value) {
+      return select_winograd_5x5<ConvType>(params);
+    }
+  }
+  return sycldnn::conv2d::Algorithm::Im2col;
+}
+
 /**
  * A selector which makes no assumption about the underlying device.
  * This is chosen as a fall-back when the available device is not recognised.
@@ -48,28 +135,35 @@ class DefaultSelector : public sycldnn::conv2d::Selector {
    */
   sycldnn::conv2d::Algorithm select_forward(
       sycldnn::conv2d::Conv2DParams const& params) override {
+    if (is_nchw(params)) {
+      return select_nchw<sycldnn::conv2d::conv_type::Forward>(params);
+    }
+    // Grouped and dilated convolutions are supported by direct, tiled and
+    // im2col. Tiled avoids the im2col transform and works directly on each
+    // group's channels, so prefer it where the window and stride allow.
+    if (is_grouped(params) || is_dilated(params)) {
+      return can_use_tiled(params) ? sycldnn::conv2d::Algorithm::Tiled
+                                   : sycldnn::conv2d::Algorithm::Im2col;
+    }
     // For 1x1s1 the convolution is equivalent to a matrix multiply.
     if (params.stride_rows == 1 && params.stride_cols == 1 &&
         params.window_rows == 1 && params.window_cols == 1) {
       return sycldnn::conv2d::Algorithm::Matmul;
     }
-    // Winograd is supported for 1x3s1, 3x1s1, 3x3s1.
+    // Winograd is supported for 1x3s1, 3x1s1, 3x3s1 and 5x5s1.
     if (params.stride_rows == 1 && params.stride_cols == 1) {
       if (params.window_rows == 3 && params.window_cols == 3) {
         return sycldnn::conv2d::Algorithm::WinogradLarge;
       } else if ((params.window_rows == 1 && params.window_cols == 3) ||
                  (params.window_rows == 3 && params.window_cols == 1)) {
         return sycldnn::conv2d::Algorithm::Winograd;
+      } else if (params.window_rows == 5 && params.window_cols == 5) {
+        return select_winograd_5x5<sycldnn::conv2d::conv_type::Forward>(
+            params);
       }
     }
-    // Tiled is supported for 1x1s1, 1x1s2, 3x3s1, 3x3s2, 5x5s1.
-    if (params.stride_rows == params.stride_cols &&
-        params.window_rows == params.window_cols) {
-      if ((params.window_rows == 5 && params.stride_rows == 1) ||
-          ((params.window_rows == 1 || params.window_rows == 3) &&
-           (params.stride_rows == 1 || params.stride_rows == 2))) {
-        return sycldnn::conv2d::Algorithm::Tiled;
-      }
+    if (can_use_tiled(params)) {
+      return sycldnn::conv2d::Algorithm::Tiled;
     }
     // Fallback to use Im2col for anything else.
     return sycldnn::conv2d::Algorithm::Im2col;
@@ -81,18 +175,36 @@ class DefaultSelector : public sycldnn::conv2d::Selector {
    */
   sycldnn::conv2d::Algorithm select_input_backprop(
       sycldnn::conv2d::Conv2DParams const& params) override {
+    if (is_nchw(params)) {
+      return select_nchw<sycldnn::conv2d::conv_type::InputBackprop>(params);
+    }
+    // Grouped input backprops are supported by direct and tiled, but tiled
+    // does not support dilated input backprops.
+    if (is_grouped(params)) {
+      return can_use_tiled(params) && !is_dilated(params)
+                 ? sycldnn::conv2d::Algorithm::Tiled
+                 : sycldnn::conv2d::Algorithm::Direct;
+    }
+    // Dilated convolutions are only supported by direct and im2col, and im2col
+    // can use the backend's optimized matrix multiply.
+    if (is_dilated(params)) {
+      return sycldnn::conv2d::Algorithm::Im2col;
+    }
     // For 1x1s1 the convolution is equivalent to a matrix multiply.
     if (params.stride_rows == 1 && params.stride_cols == 1 &&
         params.window_rows == 1 && params.window_cols == 1) {
       return sycldnn::conv2d::Algorithm::Matmul;
     }
-    // Winograd is supported for 1x3s1, 3x1s1, 3x3s1.
+    // Winograd is supported for 1x3s1, 3x1s1, 3x3s1 and 5x5s1.
     if (params.stride_rows == 1 && params.stride_cols == 1) {
       if (params.window_rows == 3 && params.window_cols == 3) {
         return sycldnn::conv2d::Algorithm::WinogradLarge;
       } else if ((params.window_rows == 1 && params.window_cols == 3) ||
                  (params.window_rows == 3 && params.window_cols == 1)) {
         return sycldnn::conv2d::Algorithm::Winograd;
+      } else if (params.window_rows == 5 && params.window_cols == 5) {
+        return select_winograd_5x5<sycldnn::conv2d::conv_type::InputBackprop>(
+            params);
       }
     }
     // Fallback to use Im2col for anything else.
@@ -105,6 +217,18 @@ class DefaultSelector : public sycldnn::conv2d::Selector {
    */
   sycldnn::conv2d::Algorithm select_filter_backprop(
       sycldnn::conv2d::Conv2DParams const& params) override {
+    if (is_nchw(params)) {
+      return select_nchw<sycldnn::conv2d::conv_type::FilterBackprop>(params);
+    }
+    // Grouped filter backprops are only supported by direct.
+    if (is_grouped(params)) {
+      return sycldnn::conv2d::Algorithm::Direct;
+    }
+    // Dilated convolutions are only supported by direct and im2col, and im2col
+    // can use the backend's optimized matrix multiply.
+    if (is_dilated(params)) {
+      return sycldnn::conv2d::Algorithm::Im2col;
+    }
     // For 1x1s1 the convolution is equivalent to a matrix multiply.
     if (params.stride_rows == 1 && params.stride_cols == 1 &&
         params.window_rows == 1 && params.window_cols == 1) {
@@ -215,6 +339,9 @@ class PowerVRSelector final : public DefaultSelector {
  public:
   sycldnn::conv2d::Algorithm select_forward(
       sycldnn::conv2d::Conv2DParams const& params) override {
+    if (is_nchw(params) || is_dilated(params) || is_grouped(params)) {
+      return this->DefaultSelector::select_forward(params);
+    }
     if (params.stride_cols > 1 && params.stride_cols > 1) {
       return sycldnn::conv2d::Algorithm::Im2col;
     }
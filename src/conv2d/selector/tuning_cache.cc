@@ -0,0 +1,168 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/conv2d/selector/tuning_cache.h"
+
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/internal/helpers/device_file_name.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/export.h"
+
+/**
+ * \file
+ * Implementation of the persistent convolution tuning cache.
+ *
+ * Each line of a cache file holds one entry, formed of a key describing the
+ * convolution type and parameters followed by the name of the chosen
+ * algorithm. Algorithms are stored by name rather than by enum value so that
+ * cache files remain valid if the Algorithm enum is extended.
+ */
+
+namespace {
+
+char const* const cache_header = "# SYCL-DNN conv2d tuning cache v1";
+
+struct AlgorithmName {
+  sycldnn::conv2d::Algorithm algo;
+  char const* name;
+};
+
+AlgorithmName const algorithm_names[] = {
+    {sycldnn::conv2d::Algorithm::Direct, "Direct"},
+    {sycldnn::conv2d::Algorithm::Tiled, "Tiled"},
+    {sycldnn::conv2d::Algorithm::Im2col, "Im2col"},
+    {sycldnn::conv2d::Algorithm::Winograd, "Winograd"},
+    {sycldnn::conv2d::Algorithm::WinogradLarge, "WinogradLarge"},
+    {sycldnn::conv2d::Algorithm::Matmul, "Matmul"},
+    {sycldnn::conv2d::Algorithm::ImplicitGemm, "ImplicitGemm"},
+};
+
+char const* to_name(sycldnn::conv2d::Algorithm algo) {
+  for (auto const& entry : algorithm_names) {
+    if (entry.algo == algo) {
+      return entry.name;
+    }
+  }
+  return nullptr;
+}
+
+bool from_name(std::string const& name, sycldnn::conv2d::Algorithm& algo) {
+  for (auto const& entry : algorithm_names) {
+    if (name == entry.name) {
+      algo = entry.algo;
+      return true;
+    }
+  }
+  return false;
+}
+
+std::string make_key(char const* conv_type,
+                     sycldnn::conv2d::Conv2DParams const& params) {
+  std::ostringstream key;
+  key << conv_type << ':' << params.channels << ',' << params.features << ','
+      << params.batch << ',' << params.in_rows << ',' << params.in_cols << ','
+      << params.window_rows << ',' << params.window_cols << ','
+      << params.stride_rows << ',' << params.stride_cols << ','
+      << params.out_rows << ',' << params.out_cols << ',' << params.pad_rows
+      << ',' << params.pad_cols << ',' << params.dilation_rows << ','
+      << params.dilation_cols << ',' << params.groups << ','
+      << static_cast<int>(params.input_format) << ','
+      << static_cast<int>(params.filter_format);
+  return key.str();
+}
+
+}  // namespace
+
+namespace sycldnn {
+namespace conv2d {
+
+TuningCache::TuningCache(std::string file_path)
+    : file_path_{std::move(file_path)} {
+  load();
+}
+
+bool TuningCache::lookup(char const* conv_type, Conv2DParams const& params,
+                         Algorithm& algo) const {
+  auto it = entries_.find(make_key(conv_type, params));
+  if (it == entries_.end()) {
+    return false;
+  }
+  algo = it->second;
+  return true;
+}
+
+void TuningCache::insert(char const* conv_type, Conv2DParams const& params,
+                         Algorithm algo) {
+  entries_[make_key(conv_type, params)] = algo;
+}
+
+void TuningCache::load() {
+  if (file_path_.empty()) {
+    return;
+  }
+  std::ifstream file{file_path_};
+  if (!file) {
+    return;
+  }
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream entry{line};
+    std::string key;
+    std::string name;
+    Algorithm algo;
+    // Skip any malformed or unrecognised entries, they will be re-tuned.
+    if (entry >> key >> name && from_name(name, algo)) {
+      entries_[key] = algo;
+    }
+  }
+}
+
+bool TuningCache::save() const {
+  if (file_path_.empty()) {
+    return false;
+  }
+  std::ofstream file{file_path_, std::ios::trunc};
+  if (!file) {
+    return false;
+  }
+  file << cache_header << '\n';
+  for (auto const& entry : entries_) {
+    auto name = to_name(entry.second);
+    if (name) {
+      file << entry.first << ' ' << name << '\n';
+    }
+  }
+  return static_cast<bool>(file);
+}
+
+std::string TuningCache::file_name_for(cl::sycl::device const& device) {
+  return sycldnn::internal::helpers::device_file_name("snn_conv2d", device,
+                                                      ".tuning");
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
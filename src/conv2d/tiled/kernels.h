@@ -17,6 +17,7 @@
 #define SYCLDNN_SRC_CONV2D_TILED_KERNELS_H_
 
 #include "sycldnn/accessor_types.h"
+#include "sycldnn/format_type.h"
 
 #include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
@@ -30,6 +31,8 @@
 #include "src/helpers/vector_type.h"
 #include "src/helpers/window_index.h"
 
+#include "src/conv2d/epilogue/kernels.h"
+
 #include "src/conv2d/tiled/tile_info.h"
 #include "src/conv2d/tiled/tiles.h"
 
@@ -40,7 +43,8 @@ namespace tiled {
 
 template <typename T, typename Index, typename ConvType, int TileRows,
           int TileCols, int ChannelVectorWidth, int FeatureVectorWidth,
-          bool UseFastDiv, int WindowRows, int WindowCols, int Stride = 0>
+          bool UseFastDiv, int WindowRows, int WindowCols, int Stride = 0,
+          typename Layout = layout::NHWC>
 struct TiledConv2D;
 
 /**
@@ -52,6 +56,14 @@ struct TiledConv2D;
  * be controlled using the FeatureVectorWidth template. The channel
  * vectorisation needs the kernel to be modified so that the loop over the
  * channels is split into a vectorised part and a scalar part.
+ *
+ * For grouped convolutions each feature vector lies in a single group, and the
+ * kernel only loops over the channels in that group.
+ *
+ * Dilated convolutions are supported when the stride is one. Each tile then
+ * covers outputs which are the dilation apart, and reads input rows and
+ * columns which are the dilation apart, so the tile computation is the same
+ * as for an undilated convolution.
  */
 template <typename T, typename Index, int OutTileRows, int OutTileCols,
           int ChannelVectorWidth, int FeatureVectorWidth, bool UseFastDiv,
@@ -73,7 +85,7 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
  public:
   TiledConv2D(ReadAccessor<T const> input, ReadAccessor<T const> filter,
               WriteAccessor<T> output, Conv2DParams const& params,
-              TileInfo const& tile_info)
+              TileInfo const& tile_info, epilogue::Epilogue<T> epilogue)
       : n_tile_cols_{tile_info.n_cols},
         n_tile_rows_{tile_info.n_rows},
         n_feature_vectors_{tile_info.output_vectors},
@@ -84,6 +96,8 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
                  n_feature_vectors_},
         channels_{params.channels},
         features_{params.features},
+        group_channels_{params.channels / params.groups},
+        group_features_{params.features / params.groups},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -91,9 +105,12 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_accessor_{std::move(input)},
         filter_accessor_{std::move(filter)},
-        output_accessor_{std::move(output)} {}
+        output_accessor_{std::move(output)},
+        epilogue_{std::move(epilogue)} {}
 
   void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) {
     Index const index = item.get_id(0);
@@ -108,9 +125,12 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
               index, div_n_tile_rows_, n_tile_rows_, div_n_tile_cols_,
               n_tile_cols_, div_feature_vectors_, n_feature_vectors_);
       Index const feature = tensor_idx.s3 * FeatureVectorWidth;
-      Index const col_idx = tensor_idx.s2 * OutTileCols;
-      Index const row_idx = tensor_idx.s1 * OutTileRows;
+      Index const col_idx =
+          first_in_tile(tensor_idx.s2, OutTileCols, dilation_cols_);
+      Index const row_idx =
+          first_in_tile(tensor_idx.s1, OutTileRows, dilation_rows_);
       Index const batch = tensor_idx.s0;
+      Index const group = feature / group_features_;
 
       const auto col_window =
           helpers::in_window_from_output(col_idx, Stride, pad_cols_);
@@ -121,30 +141,82 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
 
       Output out_tile{};
       Index filter_offset = feature;
-      Index input_channel_offset = batch * in_cols_ * in_rows_ * channels_;
-      for (Index channel = 0; channel < channels_;
+      Index input_channel_offset =
+          batch * in_cols_ * in_rows_ * channels_ + group * group_channels_;
+      for (Index channel = 0; channel < group_channels_;
            channel += ChannelVectorWidth) {
-        Filter filter_tile{filter_data, filter_offset, channels_, features_};
+        Filter filter_tile{filter_data, filter_offset, group_channels_,
+                           features_};
 
         Index input_offset =
             input_channel_offset + rstart * in_cols_ * channels_;
-        for (Index i = 0; i < InputTileRows; ++i) {
-          if (rstart + i >= 0 && rstart + i < in_rows_) {
-            auto input_tile = Input::load_input_row(
-                input_data, input_offset, cstart, in_cols_, channels_);
+        for (Index i = 0, r = rstart; i < InputTileRows;
+             ++i, r += dilation_rows_) {
+          if (r >= 0 && r < in_rows_) {
+            auto input_tile =
+                Input::load_input_row(input_data, input_offset, cstart,
+                                      in_cols_, channels_, dilation_cols_);
             convolve_tile(input_tile, filter_tile, out_tile, i);
           }
-          input_offset += in_cols_ * channels_;
+          input_offset += dilation_rows_ * in_cols_ * channels_;
         }
         input_channel_offset += ChannelVectorWidth;
         filter_offset += ChannelVectorWidth * features_;
       }
+      apply_epilogue(out_tile, batch, row_idx, col_idx, feature);
       out_tile.write_out(output_data, batch, row_idx, out_rows_, col_idx,
-                         out_cols_, feature, features_);
+                         out_cols_, feature, features_, dilation_rows_,
+                         dilation_cols_);
     }
   }
 
  private:
+  /**
+   * Get the first output index covered by a tile.
+   *
+   * A dilated convolution with unit stride splits into independent undilated
+   * convolutions, one for each offset into the dilation. The tiles in each of
+   * these cover outputs which are the dilation apart, and adjacent tile
+   * indices step through the offsets.
+   */
+  static Index SNN_ALWAYS_INLINE first_in_tile(Index const tile_idx,
+                                               Index const tile_size,
+                                               Index const dilation) {
+    if (dilation == 1) {
+      return tile_idx * tile_size;
+    }
+    Index const lattice_idx = tile_idx / dilation;
+    Index const lattice_offset = tile_idx - lattice_idx * dilation;
+    return lattice_offset + lattice_idx * tile_size * dilation;
+  }
+
+  /**
+   * Apply the epilogue to each value in the output tile which lies inside the
+   * output tensor.
+   */
+  void SNN_ALWAYS_INLINE apply_epilogue(Output& output, Index const batch,
+                                        Index const row_idx,
+                                        Index const col_idx,
+                                        Index const feature) {
+    Index row_offset =
+        ((batch * out_rows_ + row_idx) * out_cols_ + col_idx) * features_ +
+        feature;
+    SNN_PRAGMA_UNROLL
+    for (int tile_row = 0; tile_row < OutTileRows; ++tile_row) {
+      Index idx = row_offset;
+      SNN_PRAGMA_UNROLL
+      for (int tile_col = 0; tile_col < OutTileCols; ++tile_col) {
+        if (row_idx + tile_row * dilation_rows_ < out_rows_ &&
+            col_idx + tile_col * dilation_cols_ < out_cols_) {
+          output.data(tile_row, tile_col) =
+              epilogue_.apply(output.data(tile_row, tile_col), feature, idx);
+        }
+        idx += dilation_cols_ * features_;
+      }
+      row_offset += dilation_rows_ * out_cols_ * features_;
+    }
+  }
+
   void SNN_ALWAYS_INLINE convolve_tile(Input const& input, Filter const& filter,
                                        Output& output, int const row_idx) {
     SNN_PRAGMA_UNROLL
@@ -196,6 +268,8 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
   const Index n_elems_;
   const Index channels_;
   const Index features_;
+  const Index group_channels_;
+  const Index group_features_;
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
@@ -203,9 +277,12 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const ReadAccessor<const T> input_accessor_;
   const ReadAccessor<const T> filter_accessor_;
   WriteAccessor<T> output_accessor_;
+  epilogue::Epilogue<T> const epilogue_;
 };
 template <typename T, typename Index, int OutTileRows, int OutTileCols,
           int ChannelVectorWidth, int FeatureVectorWidth, bool UseFastDiv,
@@ -238,6 +315,8 @@ struct TiledConv2D<T, Index, conv_type::InputBackprop, OutTileRows, OutTileCols,
                  n_channel_vectors_},
         channels_{params.channels},
         features_{params.features},
+        group_channels_{params.channels / params.groups},
+        group_features_{params.features / params.groups},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -265,6 +344,8 @@ struct TiledConv2D<T, Index, conv_type::InputBackprop, OutTileRows, OutTileCols,
       Index const col_idx = tensor_idx.s2 * OutTileCols;
       Index const row_idx = tensor_idx.s1 * OutTileRows;
       Index const batch = tensor_idx.s0;
+      Index const group = channel / group_channels_;
+      Index const group_channel = channel - group * group_channels_;
 
       const auto col_window =
           helpers::out_window_from_input(col_idx, Stride, pad_cols_);
@@ -277,12 +358,14 @@ struct TiledConv2D<T, Index, conv_type::InputBackprop, OutTileRows, OutTileCols,
 
       Output out_tile{};
 
-      Index filter_offset = channel * features_;
-      Index input_feat_offset = batch * out_cols_ * out_rows_ * features_;
-      for (Index feature = 0; feature < features_;
+      Index filter_offset =
+          group_channel * features_ + group * group_features_;
+      Index input_feat_offset =
+          batch * out_cols_ * out_rows_ * features_ + group * group_features_;
+      for (Index feature = 0; feature < group_features_;
            feature += FeatureVectorWidth) {
-        Filter filter_tile{filter_data, filter_offset, channels_, features_,
-                           mirror_filter_tag{}};
+        Filter filter_tile{filter_data, filter_offset, group_channels_,
+                           features_, mirror_filter_tag{}};
 
         Index input_offset = input_feat_offset + rstart * out_cols_ * features_;
         for (Index r = rstart, i = first_row; i < InputTileRows;
@@ -381,6 +464,8 @@ struct TiledConv2D<T, Index, conv_type::InputBackprop, OutTileRows, OutTileCols,
   const Index n_elems_;
   const Index channels_;
   const Index features_;
+  const Index group_channels_;
+  const Index group_features_;
   const Index batch_;
   const Index in_rows_;
   const Index in_cols_;
@@ -0,0 +1,272 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_TILED_KERNELS_NCHW_H_
+#define SYCLDNN_SRC_CONV2D_TILED_KERNELS_NCHW_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/format_type.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+
+#include "src/helpers/fast_div.h"
+#include "src/helpers/math.h"
+#include "src/helpers/tensor_index.h"
+#include "src/helpers/vector_element.h"
+#include "src/helpers/vector_io.h"
+#include "src/helpers/vector_type.h"
+
+#include "src/conv2d/epilogue/kernels.h"
+
+#include "src/conv2d/tiled/kernels.h"
+#include "src/conv2d/tiled/tile_info.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace tiled {
+
+/**
+ * Forward convolution on NCHW tensors using a tiled direct computation
+ * technique.
+ *
+ * The rows of an NCHW tensor are contiguous, so the kernel is vectorised along
+ * the output columns rather than across the channels or features. Each thread
+ * computes a tile of outputs for a single feature, with each row of the tile
+ * held in a vector of OutTileCols values. Adjacent threads compute adjacent
+ * tiles in the same rows, so their loads and stores are coalesced.
+ *
+ * The filter is expected in the FCHW format. For grouped convolutions the
+ * kernel only loops over the channels in the feature's group.
+ */
+template <typename T, typename Index, int OutTileRows, int OutTileCols,
+          int ChannelVectorWidth, int FeatureVectorWidth, bool UseFastDiv,
+          int WindowRows, int WindowCols, int Stride>
+struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
+                   ChannelVectorWidth, FeatureVectorWidth, UseFastDiv,
+                   WindowRows, WindowCols, Stride, layout::NCHW> {
+  static_assert(ChannelVectorWidth == 1 && FeatureVectorWidth == 1,
+                "The NCHW tiled kernel is vectorised along the columns, so "
+                "cannot be vectorised across the channels or features.");
+
+ private:
+  using IndexDivType = typename fast_div::IndexDiv<Index, UseFastDiv>::type;
+  static constexpr auto InputTileCols = (OutTileCols - 1) * Stride + WindowCols;
+  static constexpr auto InputTileRows = (OutTileRows - 1) * Stride + WindowRows;
+  using VecType = typename helpers::VectorType<T, OutTileCols>::type;
+
+ public:
+  TiledConv2D(ReadAccessor<T const> input, ReadAccessor<T const> filter,
+              WriteAccessor<T> output, Conv2DParams const& params,
+              TileInfo const& tile_info, epilogue::Epilogue<T> epilogue)
+      : n_tile_cols_{tile_info.n_cols},
+        n_tile_rows_{tile_info.n_rows},
+        div_features_{params.features},
+        div_n_tile_cols_{n_tile_cols_},
+        div_n_tile_rows_{n_tile_rows_},
+        n_elems_{params.batch * n_tile_rows_ * n_tile_cols_ *
+                 params.features},
+        channels_{params.channels},
+        features_{params.features},
+        group_channels_{params.channels / params.groups},
+        group_features_{params.features / params.groups},
+        in_rows_{params.in_rows},
+        in_cols_{params.in_cols},
+        out_rows_{params.out_rows},
+        out_cols_{params.out_cols},
+        pad_rows_{params.pad_rows},
+        pad_cols_{params.pad_cols},
+        input_accessor_{std::move(input)},
+        filter_accessor_{std::move(filter)},
+        output_accessor_{std::move(output)},
+        epilogue_{std::move(epilogue)} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) {
+    Index const index = item.get_id(0);
+
+    if (index < n_elems_) {
+      auto input_data = input_accessor_.get_pointer();
+      auto filter_data = filter_accessor_.get_pointer();
+      auto output_data = output_accessor_.get_pointer();
+
+      auto const tensor_idx =
+          helpers::TensorIndexHelper<Index, UseFastDiv>::unflatten4d(
+              index, div_features_, features_, div_n_tile_rows_, n_tile_rows_,
+              div_n_tile_cols_, n_tile_cols_);
+      Index const col_idx = tensor_idx.s3 * OutTileCols;
+      Index const row_idx = tensor_idx.s2 * OutTileRows;
+      Index const feature = tensor_idx.s1;
+      Index const batch = tensor_idx.s0;
+      Index const group = feature / group_features_;
+
+      Index const cstart = col_idx * Stride - pad_cols_;
+      Index const rstart = row_idx * Stride - pad_rows_;
+
+      VecType out_tile[OutTileRows];
+      SNN_PRAGMA_UNROLL
+      for (int tile_row = 0; tile_row < OutTileRows; ++tile_row) {
+        out_tile[tile_row] = VecType{0};
+      }
+
+      Index input_offset =
+          (batch * channels_ + group * group_channels_) * in_rows_ * in_cols_;
+      Index filter_offset =
+          feature * group_channels_ * WindowRows * WindowCols;
+      for (Index channel = 0; channel < group_channels_; ++channel) {
+        T filter_tile[WindowRows][WindowCols];
+        SNN_PRAGMA_UNROLL
+        for (int i = 0; i < WindowRows; ++i) {
+          SNN_PRAGMA_UNROLL
+          for (int j = 0; j < WindowCols; ++j) {
+            filter_tile[i][j] = helpers::io::Load<T>()(
+                filter_data, filter_offset + i * WindowCols + j);
+          }
+        }
+
+        Index row_offset = input_offset + rstart * in_cols_;
+        SNN_PRAGMA_UNROLL
+        for (int i = 0; i < InputTileRows; ++i) {
+          Index const r = rstart + i;
+          if (r >= 0 && r < in_rows_) {
+            T input_row[InputTileCols];
+            load_input_row(input_data, row_offset, cstart, input_row);
+            convolve_row(input_row, filter_tile, out_tile, i);
+          }
+          row_offset += in_cols_;
+        }
+        input_offset += in_rows_ * in_cols_;
+        filter_offset += WindowRows * WindowCols;
+      }
+      write_out(output_data, out_tile, batch, feature, row_idx, col_idx);
+    }
+  }
+
+ private:
+  /**
+   * Load the input values needed for one row of the output tile, replacing any
+   * values in the padding by zero.
+   */
+  template <typename InputPointer>
+  void SNN_ALWAYS_INLINE load_input_row(InputPointer input_data,
+                                        Index const row_offset,
+                                        Index const cstart,
+                                        T (&input_row)[InputTileCols]) const {
+    SNN_PRAGMA_UNROLL
+    for (int j = 0; j < InputTileCols; ++j) {
+      Index const c = cstart + j;
+      input_row[j] = (c >= 0 && c < in_cols_)
+                         ? helpers::io::Load<T>()(input_data, row_offset + c)
+                         : T{0};
+    }
+  }
+
+  /**
+   * Accumulate the contribution of one input row to each output row which uses
+   * it. The input values for each filter column are gathered into a vector of
+   * the output columns, so the multiply-add is computed along the columns.
+   */
+  void SNN_ALWAYS_INLINE
+  convolve_row(T const (&input_row)[InputTileCols],
+               T const (&filter_tile)[WindowRows][WindowCols],
+               VecType (&out_tile)[OutTileRows], int const input_row_idx) {
+    SNN_PRAGMA_UNROLL
+    for (int out_row = 0; out_row < OutTileRows; ++out_row) {
+      int const filter_row = input_row_idx - out_row * Stride;
+      if (filter_row >= 0 && filter_row < WindowRows) {
+        SNN_PRAGMA_UNROLL
+        for (int filter_col = 0; filter_col < WindowCols; ++filter_col) {
+          VecType input_vec;
+          SNN_PRAGMA_UNROLL
+          for (int out_col = 0; out_col < OutTileCols; ++out_col) {
+            helpers::vector_element::set(
+                input_vec, out_col, input_row[out_col * Stride + filter_col]);
+          }
+          out_tile[out_row] = helpers::math::mad(
+              input_vec, VecType{filter_tile[filter_row][filter_col]},
+              out_tile[out_row]);
+        }
+      }
+    }
+  }
+
+  /**
+   * Apply the epilogue to the output tile and write it to the output tensor.
+   * Rows which lie entirely inside the output are stored as a single vector.
+   */
+  template <typename OutputPointer>
+  void SNN_ALWAYS_INLINE write_out(OutputPointer output_data,
+                                   VecType (&out_tile)[OutTileRows],
+                                   Index const batch, Index const feature,
+                                   Index const row_idx, Index const col_idx) {
+    Index row_offset =
+        ((batch * features_ + feature) * out_rows_ + row_idx) * out_cols_ +
+        col_idx;
+    SNN_PRAGMA_UNROLL
+    for (int tile_row = 0; tile_row < OutTileRows; ++tile_row) {
+      if (row_idx + tile_row < out_rows_) {
+        VecType value = out_tile[tile_row];
+        SNN_PRAGMA_UNROLL
+        for (int tile_col = 0; tile_col < OutTileCols; ++tile_col) {
+          helpers::vector_element::set(
+              value, tile_col,
+              epilogue_.apply(helpers::vector_element::get(value, tile_col),
+                              feature, row_offset + tile_col));
+        }
+        if (col_idx + OutTileCols <= out_cols_) {
+          helpers::io::Store<VecType>()(output_data, row_offset, value);
+        } else {
+          SNN_PRAGMA_UNROLL
+          for (int tile_col = 0; tile_col < OutTileCols; ++tile_col) {
+            if (col_idx + tile_col < out_cols_) {
+              helpers::io::Store<T>()(
+                  output_data, row_offset + tile_col,
+                  helpers::vector_element::get(value, tile_col));
+            }
+          }
+        }
+      }
+      row_offset += out_cols_;
+    }
+  }
+
+  const Index n_tile_cols_;
+  const Index n_tile_rows_;
+  const IndexDivType div_features_;
+  const IndexDivType div_n_tile_cols_;
+  const IndexDivType div_n_tile_rows_;
+  const Index n_elems_;
+  const Index channels_;
+  const Index features_;
+  const Index group_channels_;
+  const Index group_features_;
+  const Index in_rows_;
+  const Index in_cols_;
+  const Index out_rows_;
+  const Index out_cols_;
+  const Index pad_rows_;
+  const Index pad_cols_;
+  const ReadAccessor<const T> input_accessor_;
+  const ReadAccessor<const T> filter_accessor_;
+  WriteAccessor<T> output_accessor_;
+  epilogue::Epilogue<T> const epilogue_;
+};
+
+}  // namespace tiled
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_TILED_KERNELS_NCHW_H_
@@ -15,11 +15,14 @@
  */
 #include "sycldnn/internal/conv2d/tiled.h"
 
+#include "sycldnn/data_format.h"
+#include "sycldnn/format_type.h"
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
 #include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/tiled_config.h"
 
 #include "sycldnn/helpers/ratio.h"
 
@@ -31,6 +34,7 @@
 #include <cstdint>
 #include <limits>
 #include <type_traits>
+#include <vector>
 
 #include <CL/sycl.hpp>
 
@@ -65,6 +69,11 @@ inline bool can_use_fast_div<conv_type::InputBackprop>(
 template <typename ConvType>
 inline bool can_use_sizes(Conv2DParams const& params, int channel_vector,
                           int feature_vector, int window, int stride);
+/**
+ * The vectors cannot span more than one group, so the vector widths have to
+ * divide the number of channels and features in each group. The forward
+ * kernels only support dilated convolutions with unit stride.
+ */
 template <>
 inline bool can_use_sizes<conv_type::Forward>(Conv2DParams const& params,
                                               int const channel_vector,
@@ -73,8 +82,10 @@ inline bool can_use_sizes<conv_type::Forward>(Conv2DParams const& params,
                                               int const stride) {
   return (params.window_rows == window && params.window_cols == window &&
           params.stride_rows == stride && params.stride_cols == stride &&
-          params.features % feature_vector == 0 &&
-          params.channels % channel_vector == 0);
+          (stride == 1 ||
+           (params.dilation_rows == 1 && params.dilation_cols == 1)) &&
+          (params.features / params.groups) % feature_vector == 0 &&
+          (params.channels / params.groups) % channel_vector == 0);
 }
 template <>
 inline bool can_use_sizes<conv_type::InputBackprop>(Conv2DParams const& params,
@@ -84,9 +95,24 @@ inline bool can_use_sizes<conv_type::InputBackprop>(Conv2DParams const& params,
                                                     int const stride) {
   return (params.window_rows == window && params.window_cols == window &&
           params.stride_rows == stride && params.stride_cols == stride &&
-          params.features % feature_vector == 0 &&
-          params.channels % channel_vector == 0);
+          params.dilation_rows == 1 && params.dilation_cols == 1 &&
+          (params.features / params.groups) % feature_vector == 0 &&
+          (params.channels / params.groups) % channel_vector == 0);
+}
+#ifdef SNN_ENABLE_NCHW
+/**
+ * The NCHW kernel is vectorised along the output columns, so any number of
+ * channels and features can be used. Only undilated forward convolutions with
+ * an FCHW filter are supported.
+ */
+inline bool can_use_nchw_sizes(Conv2DParams const& params, int const window,
+                               int const stride) {
+  return (params.filter_format == FilterFormat::FCHW &&
+          params.window_rows == window && params.window_cols == window &&
+          params.stride_rows == stride && params.stride_cols == stride &&
+          params.dilation_rows == 1 && params.dilation_cols == 1);
 }
+#endif  // SNN_ENABLE_NCHW
 
 /**
  * Check whether fast divisions can be used for the convolution, and launch
@@ -94,11 +120,12 @@ inline bool can_use_sizes<conv_type::InputBackprop>(Conv2DParams const& params,
  */
 template <typename T, typename Index, typename ConvType, int TileRows,
           int TileCols, int ChannelVectorWidth, int FeatureVectorWidth,
-          int Window, int Stride>
+          int Window, int Stride, typename Layout = layout::NHWC>
 SNNStatus launch_with_index_type(BaseMemObject<T const>& input,
                                  BaseMemObject<T const>& filter,
                                  BaseMemObject<T>& output,
                                  Conv2DParams const& params,
+                                 EpilogueMem<T> const& epilogue,
                                  tiled::TileInfo const& tile_info,
                                  cl::sycl::queue& queue) {
   auto kernel_params = get_kernel_params<ConvType>(params);
@@ -106,13 +133,13 @@ SNNStatus launch_with_index_type(BaseMemObject<T const>& input,
                                  FeatureVectorWidth, TileRows, TileCols)) {
     return queue_tiled_kernel<T, Index, ConvType, TileRows, TileCols,
                               ChannelVectorWidth, FeatureVectorWidth, true,
-                              Window, Window, Stride>(
-        input, filter, output, kernel_params, tile_info, queue);
+                              Window, Window, Stride, Layout>(
+        input, filter, output, kernel_params, epilogue, tile_info, queue);
   } else {
     return queue_tiled_kernel<T, Index, ConvType, TileRows, TileCols,
                               ChannelVectorWidth, FeatureVectorWidth, false,
-                              Window, Window, Stride>(
-        input, filter, output, kernel_params, tile_info, queue);
+                              Window, Window, Stride, Layout>(
+        input, filter, output, kernel_params, epilogue, tile_info, queue);
   }
 }
 /**
@@ -121,11 +148,12 @@ SNNStatus launch_with_index_type(BaseMemObject<T const>& input,
  */
 template <typename T, typename ConvType, int TileRows, int TileCols,
           int ChannelVectorWidth, int FeatureVectorWidth, int Window,
-          int Stride>
+          int Stride, typename Layout = layout::NHWC>
 SNNStatus launch_with_sizes(BaseMemObject<T const>& input,
                             BaseMemObject<T const>& filter,
                             BaseMemObject<T>& output,
                             Conv2DParams const& params,
+                            EpilogueMem<T> const& epilogue,
                             cl::sycl::queue& queue) {
   auto const tile_info = tiled::get_tile_info<ConvType>(
       params, TileRows, TileCols, ChannelVectorWidth, FeatureVectorWidth);
@@ -135,16 +163,16 @@ SNNStatus launch_with_sizes(BaseMemObject<T const>& input,
 #ifdef SNN_USE_INT64
     return launch_with_index_type<T, int64_t, ConvType, TileRows, TileCols,
                                   ChannelVectorWidth, FeatureVectorWidth,
-                                  Window, Stride>(input, filter, output, params,
-                                                  tile_info, queue);
+                                  Window, Stride, Layout>(
+        input, filter, output, params, epilogue, tile_info, queue);
 #else
     return StatusCode::IndexExceeded;
 #endif  // SNN_USE_INT64
   } else {
     return launch_with_index_type<T, int32_t, ConvType, TileRows, TileCols,
                                   ChannelVectorWidth, FeatureVectorWidth,
-                                  Window, Stride>(input, filter, output, params,
-                                                  tile_info, queue);
+                                  Window, Stride, Layout>(
+        input, filter, output, params, epilogue, tile_info, queue);
   }
 }
 
@@ -156,6 +184,7 @@ inline SNNStatus launch_tiled_impl(BaseMemObject<T const>& input,
                                    BaseMemObject<T const>& filter,
                                    BaseMemObject<T>& output,
                                    Conv2DParams const& params,
+                                   EpilogueMem<T> const& epilogue,
                                    cl::sycl::queue& queue) {
 #define LAUNCH_IF_MATCH(params, window, stride, tile_row, tile_col,           \
                         channel_vector, feature_vector)                       \
@@ -163,7 +192,7 @@ inline SNNStatus launch_tiled_impl(BaseMemObject<T const>& input,
                               stride)) {                                      \
     return launch_with_sizes<T, ConvType, tile_row, tile_col, channel_vector, \
                              feature_vector, window, stride>(                 \
-        input, filter, output, params, queue);                                \
+        input, filter, output, params, epilogue, queue);                      \
   }
 
 // clang-format off
@@ -222,6 +251,7 @@ inline SNNStatus launch_tiled_impl(BaseMemObject<T const>& input,
   LAUNCH_IF_MATCH(params, 3, 2, 2, 2, 1, 1)
   LAUNCH_IF_MATCH(params, 5, 1, 2, 2, 1, 2)
   LAUNCH_IF_MATCH(params, 5, 1, 2, 4, 1, 1)
+  LAUNCH_IF_MATCH(params, 5, 2, 2, 2, 1, 1)
   LAUNCH_IF_MATCH(params, 1, 1, 2, 2, 1, 4)
   LAUNCH_IF_MATCH(params, 1, 1, 2, 2, 1, 1)
   LAUNCH_IF_MATCH(params, 1, 2, 2, 2, 1, 1)
@@ -239,6 +269,7 @@ inline SNNStatus launch_tiled_impl(BaseMemObject<T const>& input,
                                    BaseMemObject<T const>& filter,
                                    BaseMemObject<T>& output,
                                    Conv2DParams const& params,
+                                   EpilogueMem<T> const& epilogue,
                                    cl::sycl::queue& queue) {
   // clang-format off
   LAUNCH_IF_MATCH(params, 1, 2, 2, 2, 1, 4)
@@ -250,6 +281,7 @@ inline SNNStatus launch_tiled_impl(BaseMemObject<T const>& input,
   LAUNCH_IF_MATCH(params, 3, 2, 2, 2, 1, 1)
   LAUNCH_IF_MATCH(params, 5, 1, 2, 2, 1, 2)
   LAUNCH_IF_MATCH(params, 5, 1, 2, 4, 1, 1)
+  LAUNCH_IF_MATCH(params, 5, 2, 2, 2, 1, 1)
   LAUNCH_IF_MATCH(params, 1, 1, 2, 2, 1, 4)
   LAUNCH_IF_MATCH(params, 1, 1, 2, 2, 1, 1)
   LAUNCH_IF_MATCH(params, 1, 2, 2, 2, 1, 1)
@@ -269,10 +301,192 @@ inline SNNStatus launch_tiled_impl(BaseMemObject<T const>& /*input*/,
                                    BaseMemObject<T const>& /*filter*/,
                                    BaseMemObject<T>& /*output*/,
                                    Conv2DParams const& /*params*/,
+                                   EpilogueMem<T> const& /*epilogue*/,
                                    cl::sycl::queue& /*queue*/) {
   // Tiled algorithm is not supported for filter backprop.
   return StatusCode::InvalidAlgorithm;
 }
+
+/**
+ * The tile sizes which can be selected at runtime through a TiledConfig.
+ *
+ * Each entry is given as (window, stride, tile_row, tile_col, channel_vector,
+ * feature_vector), and every entry must also be instantiated in
+ * src/conv2d/CMakeLists.txt. All tile widths are even, so that the stride 2
+ * input backprop kernels cover whole input tiles for odd window sizes.
+ */
+#define TILED_CONFIG_SHAPES(MACRO, window, stride) \
+  MACRO(window, stride, 2, 2, 1, 1)                \
+  MACRO(window, stride, 2, 2, 1, 4)                \
+  MACRO(window, stride, 2, 4, 1, 2)                \
+  MACRO(window, stride, 4, 4, 1, 4)                \
+  MACRO(window, stride, 4, 4, 1, 8)
+
+#define TILED_CONFIG_MENU(MACRO)   \
+  TILED_CONFIG_SHAPES(MACRO, 1, 1) \
+  TILED_CONFIG_SHAPES(MACRO, 1, 2) \
+  TILED_CONFIG_SHAPES(MACRO, 3, 1) \
+  TILED_CONFIG_SHAPES(MACRO, 3, 2) \
+  TILED_CONFIG_SHAPES(MACRO, 5, 1) \
+  TILED_CONFIG_SHAPES(MACRO, 5, 2)
+
+/** Internal launcher for a runtime tile configuration.  */
+template <typename T, typename ConvType,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+inline SNNStatus launch_tiled_config_impl(BaseMemObject<T const>& input,
+                                          BaseMemObject<T const>& filter,
+                                          BaseMemObject<T>& output,
+                                          Conv2DParams const& params,
+                                          EpilogueMem<T> const& epilogue,
+                                          TiledConfig const& config,
+                                          cl::sycl::queue& queue) {
+#define LAUNCH_IF_CONFIG(window, stride, tile_row, tile_col, channel_vector,  \
+                         feature_vector)                                      \
+  if (config == TiledConfig{tile_row, tile_col, channel_vector,               \
+                            feature_vector} &&                                \
+      can_use_sizes<ConvType>(params, channel_vector, feature_vector, window, \
+                              stride)) {                                      \
+    return launch_with_sizes<T, ConvType, tile_row, tile_col, channel_vector, \
+                             feature_vector, window, stride>(                 \
+        input, filter, output, params, epilogue, queue);                      \
+  }
+
+  TILED_CONFIG_MENU(LAUNCH_IF_CONFIG)
+
+#undef LAUNCH_IF_CONFIG
+
+  return StatusCode::InvalidAlgorithm;
+}
+
+/** Internal launcher for a runtime tile configuration for FilterBackprop.  */
+template <typename T, typename ConvType,
+          typename std::enable_if<
+              std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+inline SNNStatus launch_tiled_config_impl(BaseMemObject<T const>& /*input*/,
+                                          BaseMemObject<T const>& /*filter*/,
+                                          BaseMemObject<T>& /*output*/,
+                                          Conv2DParams const& /*params*/,
+                                          EpilogueMem<T> const& /*epilogue*/,
+                                          TiledConfig const& /*config*/,
+                                          cl::sycl::queue& /*queue*/) {
+  // Tiled algorithm is not supported for filter backprop.
+  return StatusCode::InvalidAlgorithm;
+}
+
+#ifdef SNN_ENABLE_NCHW
+/**
+ * The NCHW forward tile sizes which can be selected at runtime through a
+ * TiledConfig.
+ *
+ * Each entry is given as (window, stride, tile_row, tile_col), and every entry
+ * must also be instantiated in src/conv2d/CMakeLists.txt. The NCHW kernel is
+ * vectorised along the output columns, so the channel and feature vector
+ * widths are always one.
+ */
+#define TILED_NCHW_CONFIG_SHAPES(MACRO, window, stride) \
+  MACRO(window, stride, 1, 4)                           \
+  MACRO(window, stride, 2, 2)                           \
+  MACRO(window, stride, 2, 4)                           \
+  MACRO(window, stride, 4, 4)
+
+#define TILED_NCHW_CONFIG_MENU(MACRO)   \
+  TILED_NCHW_CONFIG_SHAPES(MACRO, 1, 1) \
+  TILED_NCHW_CONFIG_SHAPES(MACRO, 1, 2) \
+  TILED_NCHW_CONFIG_SHAPES(MACRO, 3, 1) \
+  TILED_NCHW_CONFIG_SHAPES(MACRO, 3, 2) \
+  TILED_NCHW_CONFIG_SHAPES(MACRO, 5, 1) \
+  TILED_NCHW_CONFIG_SHAPES(MACRO, 5, 2)
+
+/**
+ * Internal launcher for NCHW tensors. Only forward convolutions are supported,
+ * and if no config is given the 2x4 tile is used.
+ */
+template <typename T, typename ConvType>
+inline SNNStatus launch_tiled_nchw_impl(BaseMemObject<T const>& input,
+                                        BaseMemObject<T const>& filter,
+                                        BaseMemObject<T>& output,
+                                        Conv2DParams const& params,
+                                        EpilogueMem<T> const& epilogue,
+                                        TiledConfig const& config,
+                                        cl::sycl::queue& queue) {
+  if (!std::is_same<ConvType, conv_type::Forward>::value) {
+    return StatusCode::InvalidAlgorithm;
+  }
+#define LAUNCH_IF_NCHW_CONFIG(window, stride, tile_row, tile_col)        \
+  if (config == TiledConfig{tile_row, tile_col, 1, 1} &&                 \
+      can_use_nchw_sizes(params, window, stride)) {                      \
+    return launch_with_sizes<T, conv_type::Forward, tile_row, tile_col, 1, \
+                             1, window, stride, layout::NCHW>(           \
+        input, filter, output, params, epilogue, queue);                 \
+  }
+
+  TILED_NCHW_CONFIG_MENU(LAUNCH_IF_NCHW_CONFIG)
+
+#undef LAUNCH_IF_NCHW_CONFIG
+
+  return StatusCode::InvalidAlgorithm;
+}
+
+/** Get the usable NCHW tile configurations from the menu.  */
+template <typename ConvType>
+inline std::vector<TiledConfig> get_tiled_nchw_configs_impl(
+    Conv2DParams const& params) {
+  std::vector<TiledConfig> configs;
+  if (!std::is_same<ConvType, conv_type::Forward>::value) {
+    return configs;
+  }
+#define ADD_IF_NCHW_USABLE(window, stride, tile_row, tile_col) \
+  if (can_use_nchw_sizes(params, window, stride)) {            \
+    configs.push_back(TiledConfig{tile_row, tile_col, 1, 1});  \
+  }
+
+  TILED_NCHW_CONFIG_MENU(ADD_IF_NCHW_USABLE)
+
+#undef ADD_IF_NCHW_USABLE
+  return configs;
+}
+
+#undef TILED_NCHW_CONFIG_MENU
+#undef TILED_NCHW_CONFIG_SHAPES
+#endif  // SNN_ENABLE_NCHW
+
+/** Get the usable tile configurations from the menu.  */
+template <typename ConvType,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+inline std::vector<TiledConfig> get_tiled_configs_impl(
+    Conv2DParams const& params) {
+  std::vector<TiledConfig> configs;
+#define ADD_IF_USABLE(window, stride, tile_row, tile_col, channel_vector,     \
+                      feature_vector)                                         \
+  if (can_use_sizes<ConvType>(params, channel_vector, feature_vector, window, \
+                              stride)) {                                      \
+    configs.push_back(                                                        \
+        TiledConfig{tile_row, tile_col, channel_vector, feature_vector});     \
+  }
+
+  TILED_CONFIG_MENU(ADD_IF_USABLE)
+
+#undef ADD_IF_USABLE
+  return configs;
+}
+
+/** FilterBackprop has no usable tile configurations.  */
+template <typename ConvType,
+          typename std::enable_if<
+              std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+inline std::vector<TiledConfig> get_tiled_configs_impl(
+    Conv2DParams const& /*params*/) {
+  return {};
+}
+
+#undef TILED_CONFIG_MENU
+#undef TILED_CONFIG_SHAPES
 }  // namespace
 
 template <typename T, typename ConvType>
@@ -280,14 +494,69 @@ inline SNNStatus launch_tiled(BaseMemObject<T const>& input,
                               BaseMemObject<T const>& filter,
                               BaseMemObject<T>& output,
                               Conv2DParams const& params,
+                              EpilogueMem<T> const& epilogue,
                               cl::sycl::queue& queue) {
-  return launch_tiled_impl<T, ConvType>(input, filter, output, params, queue);
+  if (params.input_format == DataFormat::NCHW) {
+#ifdef SNN_ENABLE_NCHW
+    return launch_tiled_nchw_impl<T, ConvType>(
+        input, filter, output, params, epilogue, TiledConfig{2, 4, 1, 1},
+        queue);
+#else
+    return StatusCode::InvalidAlgorithm;
+#endif  // SNN_ENABLE_NCHW
+  }
+  return launch_tiled_impl<T, ConvType>(input, filter, output, params,
+                                        epilogue, queue);
 }
 
+template <typename T, typename ConvType>
+inline SNNStatus launch_tiled(BaseMemObject<T const>& input,
+                              BaseMemObject<T const>& filter,
+                              BaseMemObject<T>& output,
+                              Conv2DParams const& params,
+                              EpilogueMem<T> const& epilogue,
+                              TiledConfig const& config,
+                              cl::sycl::queue& queue) {
+  if (params.input_format == DataFormat::NCHW) {
+#ifdef SNN_ENABLE_NCHW
+    return launch_tiled_nchw_impl<T, ConvType>(input, filter, output, params,
+                                               epilogue, config, queue);
+#else
+    return StatusCode::InvalidAlgorithm;
+#endif  // SNN_ENABLE_NCHW
+  }
+  return launch_tiled_config_impl<T, ConvType>(input, filter, output, params,
+                                               epilogue, config, queue);
+}
+
+template <typename ConvType>
+std::vector<TiledConfig> get_tiled_configs(Conv2DParams const& params) {
+  if (params.input_format == DataFormat::NCHW) {
+#ifdef SNN_ENABLE_NCHW
+    return get_tiled_nchw_configs_impl<ConvType>(params);
+#else
+    return {};
+#endif  // SNN_ENABLE_NCHW
+  }
+  return get_tiled_configs_impl<ConvType>(params);
+}
+
+template SNN_EXPORT std::vector<TiledConfig>
+get_tiled_configs<conv_type::Forward>(Conv2DParams const& params);
+template SNN_EXPORT std::vector<TiledConfig>
+get_tiled_configs<conv_type::InputBackprop>(Conv2DParams const& params);
+template SNN_EXPORT std::vector<TiledConfig>
+get_tiled_configs<conv_type::FilterBackprop>(Conv2DParams const& params);
+
 #define INSTANTIATE_LAUNCHER(DTYPE, DIR)                                       \
   template SNN_EXPORT SNNStatus launch_tiled<DTYPE, DIR>(                      \
       BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE const> & filter, \
       BaseMemObject<DTYPE> & output, Conv2DParams const& params,               \
+      EpilogueMem<DTYPE> const& epilogue, cl::sycl::queue& queue);             \
+  template SNN_EXPORT SNNStatus launch_tiled<DTYPE, DIR>(                      \
+      BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE const> & filter, \
+      BaseMemObject<DTYPE> & output, Conv2DParams const& params,               \
+      EpilogueMem<DTYPE> const& epilogue, TiledConfig const& config,           \
       cl::sycl::queue& queue)
 
 #define INSTANTIATE_FOR_TYPE(DTYPE)                      \
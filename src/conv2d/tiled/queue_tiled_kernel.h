@@ -21,6 +21,8 @@
 
 #include "sycldnn/conv2d/params.h"
 
+#include "sycldnn/internal/conv2d/epilogue.h"
+
 #include "src/conv2d/tiled/tile_info.h"
 
 #include <CL/sycl.hpp>
@@ -31,11 +33,13 @@ namespace internal {
 
 template <typename T, typename Index, typename ConvType, int TileRows,
           int TileCols, int ChannelVectorWidth, int FeatureVectorWidth,
-          bool UseFastDiv, int WindowRows, int WindowCols, int Stride>
+          bool UseFastDiv, int WindowRows, int WindowCols, int Stride,
+          typename Layout>
 SNNStatus queue_tiled_kernel(BaseMemObject<T const>& input,
                              BaseMemObject<T const>& filter,
                              BaseMemObject<T>& output,
                              Conv2DParams const& kernel_params,
+                             EpilogueMem<T> const& epilogue,
                              tiled::TileInfo const& tile_info,
                              cl::sycl::queue& queue);
 
@@ -24,6 +24,7 @@
 #include "sycldnn/conv2d/params.h"
 
 #include "src/conv2d/tiled/kernels.h"
+#include "src/conv2d/tiled/kernels_nchw.h"
 #include "src/conv2d/tiled/tile_info.h"
 
 #include <CL/sycl.hpp>
@@ -52,28 +53,57 @@ cl::sycl::range<1> get_thread_range(Conv2DParams const& params,
   return {size};
 }
 
+/** Construct a forward convolution functor, which applies the epilogue. */
+template <typename Functor, typename T>
+Functor make_tiled_functor(conv_type::Forward, ReadAccessor<T const> input,
+                           ReadAccessor<T const> filter,
+                           WriteAccessor<T> output,
+                           Conv2DParams const& params,
+                           tiled::TileInfo const& tile_info,
+                           EpilogueMem<T> const& epilogue,
+                           cl::sycl::handler& cgh) {
+  return {input, filter, output, params, tile_info,
+          epilogue::make_epilogue(epilogue, cgh)};
+}
+
+/** Construct a backprop convolution functor, which has no epilogue. */
+template <typename Functor, typename T, typename ConvType>
+Functor make_tiled_functor(ConvType, ReadAccessor<T const> input,
+                           ReadAccessor<T const> filter,
+                           WriteAccessor<T> output,
+                           Conv2DParams const& params,
+                           tiled::TileInfo const& tile_info,
+                           EpilogueMem<T> const& /*epilogue*/,
+                           cl::sycl::handler& /*cgh*/) {
+  return {input, filter, output, params, tile_info};
+}
+
 }  // namespace
 
 template <typename T, typename Index, typename ConvType, int TileRows,
           int TileCols, int ChannelVectorWidth, int FeatureVectorWidth,
-          bool UseFastDiv, int WindowRows, int WindowCols, int Stride>
+          bool UseFastDiv, int WindowRows, int WindowCols, int Stride,
+          typename Layout>
 SNNStatus queue_tiled_kernel(BaseMemObject<T const>& in_mem,
                              BaseMemObject<T const>& fil_mem,
                              BaseMemObject<T>& out_mem,
                              Conv2DParams const& kernel_params,
+                             EpilogueMem<T> const& epilogue,
                              tiled::TileInfo const& tile_info,
                              cl::sycl::queue& queue) {
   using Functor =
       tiled::TiledConv2D<T, Index, ConvType, TileRows, TileCols,
                          ChannelVectorWidth, FeatureVectorWidth, UseFastDiv,
-                         WindowRows, WindowCols, Stride>;
+                         WindowRows, WindowCols, Stride, Layout>;
 
   auto event = queue.submit([&](cl::sycl::handler& cgh) {
     auto input = in_mem.read_accessor(cgh);
     auto filter = fil_mem.read_accessor(cgh);
     auto output = out_mem.write_accessor(cgh);
 
-    Functor conv{input, filter, output, kernel_params, tile_info};
+    auto conv = make_tiled_functor<Functor>(ConvType{}, input, filter, output,
+                                            kernel_params, tile_info,
+                                            epilogue, cgh);
     auto threads = get_thread_range(kernel_params, tile_info, queue);
 
     cgh.parallel_for(threads, conv);
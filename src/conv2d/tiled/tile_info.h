@@ -43,6 +43,9 @@ struct TileInfo {
  * Get the number of tiles required for the convolution specified by the
  * parameters and tile sizes.
  *
+ * The tiles for a dilated forward convolution cover outputs which are the
+ * dilation apart, so each offset into the dilation is tiled separately.
+ *
  * \param params         Convolution parameters
  * \parma tile_rows      Number of rows covered in a single tile
  * \param tile_cols      Number of columns covered in a single tile
@@ -56,8 +59,14 @@ template <typename ConvType>
 inline TileInfo get_tile_info(Conv2DParams const& params, int tile_rows,
                               int tile_cols, int /*channel_vector*/,
                               int feature_vector) {
-  auto rows = helpers::round_ratio_up_above_zero(params.out_rows, tile_rows);
-  auto cols = helpers::round_ratio_up_above_zero(params.out_cols, tile_cols);
+  auto lattice_rows = helpers::round_ratio_up_above_zero(params.out_rows,
+                                                         params.dilation_rows);
+  auto lattice_cols = helpers::round_ratio_up_above_zero(params.out_cols,
+                                                         params.dilation_cols);
+  auto rows = params.dilation_rows *
+              helpers::round_ratio_up_above_zero(lattice_rows, tile_rows);
+  auto cols = params.dilation_cols *
+              helpers::round_ratio_up_above_zero(lattice_cols, tile_cols);
   auto output_vector = params.features / feature_vector;
   return {rows, cols, output_vector};
 }
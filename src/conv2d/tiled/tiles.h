@@ -21,6 +21,7 @@
 #include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
 
+#include "src/helpers/accumulator_type.h"
 #include "src/helpers/fast_div.h"
 #include "src/helpers/math.h"
 #include "src/helpers/register_tile.h"
@@ -40,27 +41,41 @@ namespace tiled {
 struct check_bounds_tag {};
 struct mirror_filter_tag {};
 
-/** A 1 x Width row from the input tensor. */
+/**
+ * A 1 x Width row from the input tensor.
+ *
+ * The tiles hold values in the accumulator type of T, so that half precision
+ * tensors are convolved with single precision accumulation.
+ */
 template <typename T, int ChannelVector, int Width>
 struct InputRow final
     : public helpers::RegisterTile1D<
-          typename helpers::VectorType<T, ChannelVector>::type, Width> {
+          typename helpers::VectorType<
+              typename helpers::AccumulatorType<T>::type, ChannelVector>::type,
+          Width> {
  public:
-  using VecType = typename helpers::VectorType<T, ChannelVector>::type;
+  using VecType = typename helpers::VectorType<
+      typename helpers::AccumulatorType<T>::type, ChannelVector>::type;
+  using StorageType = typename helpers::VectorType<T, ChannelVector>::type;
   using helpers::RegisterTile1D<VecType, Width>::data;
 
   /**
    * Input row factory method. Will load the input data specified by row, col
    * and channel into an InputRow tile from the given multi pointer.
+   *
+   * The row is made of the columns col, col + col_step, col + 2 * col_step and
+   * so on, where the step is larger than one for dilated convolutions.
    */
   template <typename Index, cl::sycl::access::address_space Space>
   static InputRow SNN_ALWAYS_INLINE
   load_input_row(cl::sycl::multi_ptr<T const, Space> input, Index const offset,
-                 Index const col, Index const n_cols, Index const n_channels) {
-    if (col >= 0 && col + Width < n_cols) {
-      return {input, offset, col, n_cols, n_channels};
+                 Index const col, Index const n_cols, Index const n_channels,
+                 Index const col_step = 1) {
+    if (col >= 0 && col + Width * col_step < n_cols) {
+      return {input, offset, col, n_cols, n_channels, col_step};
     } else {
-      return {input, offset, col, n_cols, n_channels, check_bounds_tag{}};
+      return {input,      offset,   col, n_cols,
+              n_channels, col_step, check_bounds_tag{}};
     };
   }
 
@@ -68,12 +83,14 @@ struct InputRow final
   template <typename Index, cl::sycl::access::address_space Space>
   SNN_ALWAYS_INLINE InputRow(cl::sycl::multi_ptr<T const, Space> input,
                              Index const offset, Index const col,
-                             Index const /*n_cols*/, Index const n_channels) {
+                             Index const /*n_cols*/, Index const n_channels,
+                             Index const col_step) {
     Index idx = offset + col * n_channels;
     SNN_PRAGMA_UNROLL
     for (int i = 0; i < Width; ++i) {
-      data(i) = helpers::io::Load<VecType>()(input, idx);
-      idx += n_channels;
+      data(i) = helpers::convert<VecType>(
+          helpers::io::Load<StorageType>()(input, idx));
+      idx += col_step * n_channels;
     }
   }
 
@@ -81,14 +98,16 @@ struct InputRow final
   SNN_ALWAYS_INLINE InputRow(cl::sycl::multi_ptr<T const, Space> input,
                              Index const offset, Index const col,
                              Index const n_cols, Index const n_channels,
-                             check_bounds_tag) {
+                             Index const col_step, check_bounds_tag) {
     Index idx = offset + col * n_channels;
     SNN_PRAGMA_UNROLL
     for (int i = 0; i < Width; ++i) {
-      data(i) = (col + i < 0 || col + i >= n_cols)
+      Index const in_col = col + i * col_step;
+      data(i) = (in_col < 0 || in_col >= n_cols)
                     ? VecType{0}
-                    : helpers::io::Load<VecType>()(input, idx);
-      idx += n_channels;
+                    : helpers::convert<VecType>(
+                          helpers::io::Load<StorageType>()(input, idx));
+      idx += col_step * n_channels;
     }
   }
 };
@@ -96,10 +115,14 @@ struct InputRow final
 /** A WindowRows x WindowCols tile from the filter tensor. */
 template <typename T, int ChannelVector, int FeatureVector, int WindowRows,
           int WindowCols>
-struct FilterTile : public helpers::RegisterTile3D<
-                        typename helpers::VectorType<T, FeatureVector>::type,
-                        WindowRows, WindowCols, ChannelVector> {
-  using VecType = typename helpers::VectorType<T, FeatureVector>::type;
+struct FilterTile
+    : public helpers::RegisterTile3D<
+          typename helpers::VectorType<
+              typename helpers::AccumulatorType<T>::type, FeatureVector>::type,
+          WindowRows, WindowCols, ChannelVector> {
+  using VecType = typename helpers::VectorType<
+      typename helpers::AccumulatorType<T>::type, FeatureVector>::type;
+  using StorageType = typename helpers::VectorType<T, FeatureVector>::type;
   using helpers::RegisterTile3D<VecType, WindowRows, WindowCols,
                                 ChannelVector>::data;
 
@@ -116,7 +139,8 @@ struct FilterTile : public helpers::RegisterTile3D<
         Index ch_idx = col_idx;
         SNN_PRAGMA_UNROLL
         for (int ch_v = 0; ch_v < ChannelVector; ++ch_v) {
-          data(i, j, ch_v) = helpers::io::Load<VecType>()(input, ch_idx);
+          data(i, j, ch_v) = helpers::convert<VecType>(
+              helpers::io::Load<StorageType>()(input, ch_idx));
           ch_idx += n_features;
         }
         col_idx += n_channels * n_features;
@@ -139,7 +163,8 @@ struct FilterTile : public helpers::RegisterTile3D<
         SNN_PRAGMA_UNROLL
         for (int ch_v = 0; ch_v < ChannelVector; ++ch_v) {
           data(WindowRows - 1 - i, WindowCols - 1 - j, ch_v) =
-              helpers::io::Load<VecType>()(input, ch_idx);
+              helpers::convert<VecType>(
+                  helpers::io::Load<StorageType>()(input, ch_idx));
           ch_idx += n_features;
         }
         col_idx += n_channels * n_features;
@@ -149,27 +174,40 @@ struct FilterTile : public helpers::RegisterTile3D<
   }
 };
 
-/* An OutTileRows x OutTileCols tile to collect output results. */
+/*
+ * An OutTileRows x OutTileCols tile to collect output results. The results are
+ * accumulated in the accumulator type of T and converted to T when written.
+ */
 template <typename T, int VectorWidth, int OutTileRows, int OutTileCols>
 struct OutputTile final
     : helpers::RegisterTile2D<
-          typename helpers::VectorType<T, VectorWidth>::type, OutTileRows,
-          OutTileCols> {
-  using VecType = typename helpers::VectorType<T, VectorWidth>::type;
+          typename helpers::VectorType<
+              typename helpers::AccumulatorType<T>::type, VectorWidth>::type,
+          OutTileRows, OutTileCols> {
+  using VecType = typename helpers::VectorType<
+      typename helpers::AccumulatorType<T>::type, VectorWidth>::type;
+  using StorageType = typename helpers::VectorType<T, VectorWidth>::type;
   using helpers::RegisterTile2D<VecType, OutTileRows, OutTileCols>::data;
 
+  /**
+   * Write the tile to the output tensor. The tile rows are row_step rows apart
+   * in the output, and the tile columns are col_step columns apart.
+   */
   template <typename Index, cl::sycl::access::address_space Space>
   void SNN_ALWAYS_INLINE write_out(cl::sycl::multi_ptr<T, Space> output,
                                    Index const batch, Index const out_row,
                                    Index const n_rows, Index const out_col,
                                    Index const n_cols, Index const feature,
-                                   Index const n_features) {
-    if (out_row + OutTileRows < n_rows && out_col + OutTileCols < n_cols) {
+                                   Index const n_features,
+                                   Index const row_step = 1,
+                                   Index const col_step = 1) {
+    if (out_row + OutTileRows * row_step < n_rows &&
+        out_col + OutTileCols * col_step < n_cols) {
       write_out_no_check(output, batch, out_row, n_rows, out_col, n_cols,
-                         feature, n_features);
+                         feature, n_features, row_step, col_step);
     } else {
       write_out_checked(output, batch, out_row, n_rows, out_col, n_cols,
-                        feature, n_features);
+                        feature, n_features, row_step, col_step);
     }
   }
 
@@ -178,24 +216,26 @@ struct OutputTile final
   void SNN_ALWAYS_INLINE write_out_checked(
       cl::sycl::multi_ptr<T, Space> output, Index const batch,
       Index const out_row, Index const n_rows, Index const out_col,
-      Index const n_cols, Index const feature, Index const n_features) {
+      Index const n_cols, Index const feature, Index const n_features,
+      Index const row_step, Index const col_step) {
     Index const offset =
         ((batch * n_rows + out_row) * n_cols + out_col) * n_features + feature;
 
     Index row_idx = offset;
     SNN_PRAGMA_UNROLL
     for (int tile_row = 0; tile_row < OutTileRows; ++tile_row) {
-      if (tile_row < n_rows - out_row) {
+      if (tile_row * row_step < n_rows - out_row) {
         Index idx = row_idx;
         SNN_PRAGMA_UNROLL
         for (int tile_col = 0; tile_col < OutTileCols; ++tile_col) {
-          if (tile_col < n_cols - out_col) {
-            helpers::io::Store<VecType>()(output, idx,
-                                          data(tile_row, tile_col));
-            idx += n_features;
+          if (tile_col * col_step < n_cols - out_col) {
+            helpers::io::Store<StorageType>()(
+                output, idx,
+                helpers::convert<StorageType>(data(tile_row, tile_col)));
+            idx += col_step * n_features;
           }
         }
-        row_idx += n_cols * n_features;
+        row_idx += row_step * n_cols * n_features;
       }
     }
   }
@@ -204,7 +244,8 @@ struct OutputTile final
   void SNN_ALWAYS_INLINE write_out_no_check(
       cl::sycl::multi_ptr<T, Space> output, Index const batch,
       Index const out_row, Index const n_rows, Index const out_col,
-      Index const n_cols, Index const feature, Index const n_features) {
+      Index const n_cols, Index const feature, Index const n_features,
+      Index const row_step, Index const col_step) {
     Index const offset =
         ((batch * n_rows + out_row) * n_cols + out_col) * n_features + feature;
 
@@ -214,10 +255,12 @@ struct OutputTile final
       Index idx = row_idx;
       SNN_PRAGMA_UNROLL
       for (int tile_col = 0; tile_col < OutTileCols; ++tile_col) {
-        helpers::io::Store<VecType>()(output, idx, data(tile_row, tile_col));
-        idx += n_features;
+        helpers::io::Store<StorageType>()(
+            output, idx,
+            helpers::convert<StorageType>(data(tile_row, tile_col)));
+        idx += col_step * n_features;
       }
-      row_idx += n_cols * n_features;
+      row_idx += row_step * n_cols * n_features;
     }
   }
 };
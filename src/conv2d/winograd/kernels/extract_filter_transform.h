@@ -17,6 +17,7 @@
 #define SYCLDNN_SRC_CONV2D_WINOGRAD_KERNELS_EXTRACT_FILTER_TRANSFORM_H_
 
 #include "sycldnn/accessor_types.h"
+#include "sycldnn/format_type.h"
 
 #include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
@@ -30,8 +31,14 @@ namespace conv2d {
 namespace internal {
 namespace winograd {
 
+/**
+ * Kernel to compute the Winograd transform of the filter tiles.
+ *
+ * The filter is expected in the HWCF format for the NHWC layout and in the
+ * FCHW format for the NCHW layout.
+ */
 template <typename T, typename Index, int M, int N, int R, int S,
-          typename ConvType>
+          typename ConvType, typename Layout = layout::NHWC>
 struct ExtractFilterTiles {
   ExtractFilterTiles(Conv2DParams const& params, TileInfo const& /*unused*/,
                      ReadAccessor<T const> const& filter,
@@ -54,8 +61,9 @@ struct ExtractFilterTiles {
       Index const feature_idx = channel_feature_idx.s1;
       Index const channel_idx = channel_feature_idx.s0;
 
-      FilterTile<T, M, N, R, S, ConvType> filter(
-          filter_data, channel_idx, feature_idx, n_channels_, n_features_);
+      FilterTile<T, M, N, R, S, ConvType> filter(filter_data, channel_idx,
+                                                 feature_idx, n_channels_,
+                                                 n_features_, Layout{});
       TransformedFilterTile<T, M, N, R, S> transformed{filter};
 
       OutputData<T, M, N, R, S>::write_transformed_filter(
@@ -72,8 +80,10 @@ struct ExtractFilterTiles {
   WriteAccessor<T> output_accessor_;
 };
 
-template <typename T, typename Index, int M, int N, int R, int S>
-struct ExtractFilterTiles<T, Index, M, N, R, S, conv_type::InputBackprop> {
+template <typename T, typename Index, int M, int N, int R, int S,
+          typename Layout>
+struct ExtractFilterTiles<T, Index, M, N, R, S, conv_type::InputBackprop,
+                          Layout> {
   using ConvType = conv_type::InputBackprop;
 
   /*
@@ -103,8 +113,9 @@ struct ExtractFilterTiles<T, Index, M, N, R, S, conv_type::InputBackprop> {
       Index const feature_idx = feature_channel_idx.s1;
       Index const channel_idx = feature_channel_idx.s0;
 
-      FilterTile<T, M, N, R, S, ConvType> filter(
-          filter_data, channel_idx, feature_idx, n_channels_, n_features_);
+      FilterTile<T, M, N, R, S, ConvType> filter(filter_data, channel_idx,
+                                                 feature_idx, n_channels_,
+                                                 n_features_, Layout{});
       TransformedFilterTile<T, M, N, R, S> transformed{filter};
 
       OutputData<T, M, N, R, S>::write_transformed_filter(
@@ -121,8 +132,14 @@ struct ExtractFilterTiles<T, Index, M, N, R, S, conv_type::InputBackprop> {
   WriteAccessor<T> output_accessor_;
 };
 
-template <typename T, typename Index, int M, int N, int R, int S>
-struct ExtractFilterTiles<T, Index, M, N, R, S, conv_type::FilterBackprop> {
+/**
+ * The filter backprop uses the output of the convolution as the filter, which
+ * is in the same layout as the input.
+ */
+template <typename T, typename Index, int M, int N, int R, int S,
+          typename Layout>
+struct ExtractFilterTiles<T, Index, M, N, R, S, conv_type::FilterBackprop,
+                          Layout> {
   using ConvType = conv_type::FilterBackprop;
 
   ExtractFilterTiles(Conv2DParams const& params, TileInfo const& tile_info,
@@ -164,14 +181,14 @@ struct ExtractFilterTiles<T, Index, M, N, R, S, conv_type::FilterBackprop> {
       Index const row = row_idx * R;
       Index const rend = helpers::min(row + M, n_window_rows_);
 
+      using Offsets = LayoutOffsets<Layout>;
       Index const offset =
-          ((batch * n_window_rows_ + row) * n_window_cols_ + col) *
-              n_features_ +
-          feature;
+          Offsets::offset(batch, row, n_window_rows_, col, n_window_cols_,
+                          feature, n_features_);
       SYCLOutputWindow<Index> w{rend - row, cend - col, offset};
 
-      FilterTile<T, M, N, R, S, ConvType> filter(filter_data, w, n_window_cols_,
-                                                 n_features_);
+      FilterTile<T, M, N, R, S, ConvType> filter(
+          filter_data, w, n_window_cols_, Offsets::col_stride(n_features_));
       TransformedFilterTile<T, M, N, R, S> transformed{filter};
 
       OutputData<T, M, N, R, S>::write_transformed_filter(
@@ -17,6 +17,7 @@
 #define SYCLDNN_SRC_CONV2D_WINOGRAD_KERNELS_EXTRACT_INPUT_TRANSFORM_H_
 
 #include "sycldnn/accessor_types.h"
+#include "sycldnn/format_type.h"
 
 #include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
@@ -29,14 +30,25 @@
 
 #include "src/conv2d/winograd/kernels/tiles.h"
 
+#include <type_traits>
+
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
 namespace winograd {
 
+/**
+ * Kernel to extract the input tiles and compute their Winograd transforms.
+ *
+ * The input can be in either the NHWC or the NCHW layout, though the NCHW
+ * layout can only be loaded one channel at a time as the channels are not
+ * contiguous.
+ */
 template <typename T, typename Index, int ChannelVector, int M, int N, int R,
-          int S, typename ConvType>
+          int S, typename ConvType, typename Layout = layout::NHWC>
 struct ExtractInputTiles {
+  static_assert(std::is_same<Layout, layout::NHWC>::value || ChannelVector == 1,
+                "NCHW inputs cannot be vectorized across channels.");
   using VecType = typename helpers::VectorType<T, ChannelVector>::type;
 
   ExtractInputTiles(Conv2DParams const& params, TileInfo const& tile_info,
@@ -79,7 +91,7 @@ struct ExtractInputTiles {
 
       InputTile<VecType, M, N, R, S> inp(input_data, batch, rstart, n_in_rows_,
                                          cstart, n_in_cols_, channel_idx,
-                                         n_channels_);
+                                         n_channels_, Layout{});
 
       OutputData<VecType, M, N, R, S>::write_transformed_input(
           output_data, tile_idx, channel_idx, n_tiles_, n_channels_,
@@ -102,9 +114,11 @@ struct ExtractInputTiles {
 };
 
 template <typename T, typename Index, int ChannelVector, int M, int N, int R,
-          int S>
+          int S, typename Layout>
 struct ExtractInputTiles<T, Index, ChannelVector, M, N, R, S,
-                         conv_type::FilterBackprop> {
+                         conv_type::FilterBackprop, Layout> {
+  static_assert(std::is_same<Layout, layout::NHWC>::value || ChannelVector == 1,
+                "NCHW inputs cannot be vectorized across channels.");
   using VecType = typename helpers::VectorType<T, ChannelVector>::type;
 
   ExtractInputTiles(Conv2DParams const& params, TileInfo const& tile_info,
@@ -147,7 +161,7 @@ struct ExtractInputTiles<T, Index, ChannelVector, M, N, R, S,
 
       InputTile<VecType, M, N, R, S> inp(input_data, batch, rstart, n_in_rows_,
                                          cstart, n_in_cols_, channel_idx,
-                                         n_channels_);
+                                         n_channels_, Layout{});
       TransformedInputTile<VecType, M, N, R, S> trans{inp};
 
       OutputData<VecType, M, N, R, S>::write_transformed_input(
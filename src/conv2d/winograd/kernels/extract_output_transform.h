@@ -17,13 +17,17 @@
 #define SYCLDNN_SRC_CONV2D_WINOGRAD_KERNELS_EXTRACT_OUTPUT_TRANSFORM_H_
 
 #include "sycldnn/accessor_types.h"
+#include "sycldnn/format_type.h"
 
 #include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
 #include "sycldnn/helpers/minmax.h"
 
+#include "src/helpers/accumulator_type.h"
 #include "src/helpers/tensor_index.h"
 
+#include "src/conv2d/epilogue/kernels.h"
+
 #include "src/conv2d/winograd/kernels/tiles.h"
 
 namespace sycldnn {
@@ -31,12 +35,26 @@ namespace conv2d {
 namespace internal {
 namespace winograd {
 
+/**
+ * Kernel to compute the output transform of the intermediate tiles and write
+ * the results to the output tensor.
+ *
+ * The intermediate values are read as T, but the transform is computed in the
+ * accumulator type of T so that the sums over the Winograd domain do not lose
+ * precision for half precision tensors. The output is written in the given
+ * layout.
+ */
 template <typename T, typename Index, int M, int N, int R, int S,
-          typename ConvType, bool Accumulate = false>
+          typename ConvType, bool Accumulate = false,
+          typename Layout = layout::NHWC>
 struct ExtractOutputTiles {
+  using Offsets = LayoutOffsets<Layout>;
+  using Acc = typename helpers::AccumulatorType<T>::type;
+
   ExtractOutputTiles(Conv2DParams const& params, TileInfo const& tile_info,
                      ReadAccessor<T const> const& input,
-                     WriteAccessor<T> const& output)
+                     WriteAccessor<T> const& output,
+                     epilogue::Epilogue<T> const& epilogue)
       : n_threads_{params.batch * tile_info.rows * tile_info.cols *
                    params.features},
         n_tiles_{tile_info.number * params.batch},
@@ -45,8 +63,10 @@ struct ExtractOutputTiles {
         n_out_rows_{params.out_rows},
         n_out_cols_{params.out_cols},
         n_features_{params.features},
+        col_stride_{Offsets::col_stride(n_features_)},
         input_accessor_{input},
-        output_accessor_{output} {}
+        output_accessor_{output},
+        epilogue_{epilogue} {}
 
   void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) {
     Index const index = item.get_id(0);
@@ -67,8 +87,8 @@ struct ExtractOutputTiles {
       Index const row_idx = tile_tensor_idx.s1;
       Index const batch = tile_tensor_idx.s0;
 
-      IntermediateTile<T, M, N, R, S> tmp{input_data, tile_idx, n_tiles_,
-                                          feature, n_features_};
+      IntermediateTile<Acc, M, N, R, S> tmp{input_data, tile_idx, n_tiles_,
+                                            feature, n_features_};
 
       Index const col = col_idx * N;
       Index const cend = helpers::min(col + N, n_out_cols_);
@@ -76,19 +96,31 @@ struct ExtractOutputTiles {
       Index const row = row_idx * M;
       Index const rend = helpers::min(row + M, n_out_rows_);
 
-      Index const offset =
-          ((batch * n_out_rows_ + row) * n_out_cols_ + col) * n_features_ +
-          feature;
+      Index const offset = Offsets::offset(batch, row, n_out_rows_, col,
+                                           n_out_cols_, feature, n_features_);
 
       SYCLOutputWindow<Index> out_w{rend - row, cend - col, offset};
 
-      OutputData<T, M, N, R, S>::write_output(output_data, out_w, n_out_cols_,
-                                              n_features_,
-                                              OutputTile<T, M, N, R, S>{tmp});
+      OutputTile<Acc, M, N, R, S> out_tile{tmp};
+      apply_epilogue(out_tile, out_w, feature);
+      OutputData<Acc, M, N, R, S>::write_output(output_data, out_w, n_out_cols_,
+                                                col_stride_, out_tile);
     }
   }
 
  private:
+  /** Apply the epilogue to each value in the output window. */
+  void SNN_ALWAYS_INLINE apply_epilogue(OutputTile<Acc, M, N, R, S>& tile,
+                                        SYCLOutputWindow<Index> const& window,
+                                        Index const feature) const {
+    for (int r = 0; r < M && r < window.rsize; ++r) {
+      for (int c = 0; c < N && c < window.csize; ++c) {
+        Index idx = window.offset + (r * n_out_cols_ + c) * col_stride_;
+        tile.data(r, c) = epilogue_.apply(tile.data(r, c), feature, idx);
+      }
+    }
+  }
+
   Index const n_threads_;
   Index const n_tiles_;
   Index const n_tile_rows_;
@@ -96,14 +128,16 @@ struct ExtractOutputTiles {
   Index const n_out_rows_;
   Index const n_out_cols_;
   Index const n_features_;
+  Index const col_stride_;
   ReadAccessor<T const> input_accessor_;
   WriteAccessor<T> output_accessor_;
+  epilogue::Epilogue<T> const epilogue_;
 };
 
 template <typename T, typename Index, int M, int N, int R, int S,
-          bool Accumulate>
+          bool Accumulate, typename Layout>
 struct ExtractOutputTiles<T, Index, M, N, R, S, conv_type::FilterBackprop,
-                          Accumulate> {
+                          Accumulate, Layout> {
   ExtractOutputTiles(Conv2DParams const& params, TileInfo const& /*unused*/,
                      ReadAccessor<T const> const& input,
                      WriteAccessor<T> const& output)
@@ -129,7 +163,7 @@ struct ExtractOutputTiles<T, Index, M, N, R, S, conv_type::FilterBackprop,
                                           feature, n_features_};
       OutputData<T, M, N, R, S>::template write_filter_output<Accumulate>(
           output_data, channel, feature, n_channels_, n_features_,
-          OutputTile<T, M, N, R, S>{tmp});
+          OutputTile<T, M, N, R, S>{tmp}, Layout{});
     }
   }
 
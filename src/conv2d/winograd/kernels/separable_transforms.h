@@ -0,0 +1,302 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_WINOGRAD_KERNELS_SEPARABLE_TRANSFORMS_H_
+#define SYCLDNN_SRC_CONV2D_WINOGRAD_KERNELS_SEPARABLE_TRANSFORMS_H_
+
+#include "sycldnn/helpers/macros.h"
+
+#include "src/helpers/math.h"
+
+/**
+ * \file
+ * Contains the one dimensional Winograd transforms used to build the filter,
+ * input and output transforms of the larger Winograd tiles.
+ *
+ * The 2D transforms of the smaller tiles are fully expanded in tiles_impl.h,
+ * but for tiles with 6x6 or 8x8 transforms the expanded expressions grow too
+ * large to write out. Instead the 2D transforms are computed as a 1D transform
+ * along each column of the tile followed by a 1D transform along each row.
+ */
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace winograd {
+namespace separable {
+
+/** Compute sum_k coeffs[k] * X^k. */
+template <int X, typename T, int R>
+inline SNN_ALWAYS_INLINE T evaluate(T const (&coeffs)[R]) {
+  T result = coeffs[R - 1];
+  SNN_PRAGMA_UNROLL
+  for (int k = R - 2; k >= 0; --k) {
+    result = result * X + coeffs[k];
+  }
+  return result;
+}
+
+/** Compute sum_k coeffs[k] * X^(R - 1 - k). */
+template <int X, typename T, int R>
+inline SNN_ALWAYS_INLINE T evaluate_reversed(T const (&coeffs)[R]) {
+  T result = coeffs[0];
+  SNN_PRAGMA_UNROLL
+  for (int k = 1; k < R; ++k) {
+    result = result * X + coeffs[k];
+  }
+  return result;
+}
+
+/**
+ * One dimensional Winograd transforms F(M, R) with A = M + R - 1 points in the
+ * Winograd domain.
+ *
+ * The transforms only depend on the interpolation points, so a single
+ * specialization provides the transforms for all F(M, R) with the same A.
+ */
+template <int A>
+struct Transform1D;
+
+/**
+ * Transforms using the interpolation points 0, 1, -1, 2, -2 and infinity,
+ * giving F(4, 3) and F(2, 5).
+ */
+template <>
+struct Transform1D<6> {
+  /** Filter transform, computing G * filter. */
+  template <typename T, int R>
+  static SNN_ALWAYS_INLINE void filter(T const (&in)[R], T (&out)[6]) {
+    static_assert(R > 1 && R < 6, "Invalid filter size for 6 point transform");
+    out[0] = helpers::math::ratio(in[0], 4);
+    out[1] = -helpers::math::ratio(evaluate<1>(in), 6);
+    out[2] = -helpers::math::ratio(evaluate<-1>(in), 6);
+    out[3] = helpers::math::ratio(evaluate<2>(in), 24);
+    out[4] = helpers::math::ratio(evaluate<-2>(in), 24);
+    out[5] = in[R - 1];
+  }
+
+  /** Input transform, computing B^T * input. */
+  template <typename T>
+  static SNN_ALWAYS_INLINE void input(T const (&in)[6], T (&out)[6]) {
+    T const even_1 = in[4] - in[2] * 4;
+    T const odd_1 = in[3] - in[1] * 4;
+    T const even_2 = in[4] - in[2];
+    T const odd_2 = (in[3] - in[1]) * 2;
+    out[0] = in[0] * 4 - in[2] * 5 + in[4];
+    out[1] = even_1 + odd_1;
+    out[2] = even_1 - odd_1;
+    out[3] = even_2 + odd_2;
+    out[4] = even_2 - odd_2;
+    out[5] = in[1] * 4 - in[3] * 5 + in[5];
+  }
+
+  /** Output transform, computing A^T * intermediate. */
+  template <int M, typename T>
+  static SNN_ALWAYS_INLINE void output(T const (&in)[6], T (&out)[M]) {
+    static_assert(M > 1 && M < 6, "Invalid output size for 6 point transform");
+    T const even_1 = in[1] + in[2];
+    T const odd_1 = in[1] - in[2];
+    T const even_2 = in[3] + in[4];
+    T const odd_2 = in[3] - in[4];
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < M; ++i) {
+      bool const even = i % 2 == 0;
+      out[i] = (even ? even_1 : odd_1) + (even ? even_2 : odd_2) * (1 << i);
+    }
+    out[0] += in[0];
+    out[M - 1] += in[5];
+  }
+};
+
+/**
+ * Transforms using the interpolation points 0, 1, -1, 2, -2, 1/2, -1/2 and
+ * infinity, giving F(6, 3) and F(4, 5).
+ */
+template <>
+struct Transform1D<8> {
+  /** Filter transform, computing G * filter. */
+  template <typename T, int R>
+  static SNN_ALWAYS_INLINE void filter(T const (&in)[R], T (&out)[8]) {
+    static_assert(R > 1 && R < 8, "Invalid filter size for 8 point transform");
+    // Evaluating at -1/2 with reversed coefficients introduces a factor of
+    // (-1)^(R - 1) which needs to be removed.
+    constexpr int half_sign = (R % 2 == 1) ? 1 : -1;
+    constexpr int half_scale = 45 * (1 << (R - 1));
+    out[0] = in[0];
+    out[1] = -helpers::math::ratio(evaluate<1>(in) * 2, 9);
+    out[2] = -helpers::math::ratio(evaluate<-1>(in) * 2, 9);
+    out[3] = helpers::math::ratio(evaluate<2>(in), 90);
+    out[4] = helpers::math::ratio(evaluate<-2>(in), 90);
+    out[5] = helpers::math::ratio(evaluate_reversed<2>(in) * 32, half_scale);
+    out[6] = helpers::math::ratio(evaluate_reversed<-2>(in) * (32 * half_sign),
+                                  half_scale);
+    out[7] = in[R - 1];
+  }
+
+  /** Input transform, computing B^T * input. */
+  template <typename T>
+  static SNN_ALWAYS_INLINE void input(T const (&in)[8], T (&out)[8]) {
+    T const even_1 = in[2] + in[6] - helpers::math::ratio(in[4] * 17, 4);
+    T const odd_1 = in[1] + in[5] - helpers::math::ratio(in[3] * 17, 4);
+    T const even_2 = in[6] + helpers::math::ratio(in[2] - in[4] * 5, 4);
+    T const odd_2 = helpers::math::ratio(in[1] - in[3] * 5, 2) + in[5] * 2;
+    T const even_half = in[6] + in[2] * 4 - in[4] * 5;
+    T const odd_half =
+        in[1] * 2 + helpers::math::ratio(in[5] - in[3] * 5, 2);
+    out[0] = in[0] - in[6] + helpers::math::ratio((in[4] - in[2]) * 21, 4);
+    out[1] = even_1 + odd_1;
+    out[2] = even_1 - odd_1;
+    out[3] = even_2 + odd_2;
+    out[4] = even_2 - odd_2;
+    out[5] = even_half + odd_half;
+    out[6] = even_half - odd_half;
+    out[7] = in[7] - in[1] + helpers::math::ratio((in[3] - in[5]) * 21, 4);
+  }
+
+  /** Output transform, computing A^T * intermediate. */
+  template <int M, typename T>
+  static SNN_ALWAYS_INLINE void output(T const (&in)[8], T (&out)[M]) {
+    static_assert(M > 1 && M < 8, "Invalid output size for 8 point transform");
+    T const even_1 = in[1] + in[2];
+    T const odd_1 = in[1] - in[2];
+    T const even_2 = in[3] + in[4];
+    T const odd_2 = in[3] - in[4];
+    T const even_half = in[5] + in[6];
+    T const odd_half = in[5] - in[6];
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < M; ++i) {
+      bool const even = i % 2 == 0;
+      out[i] = (even ? even_1 : odd_1) + (even ? even_2 : odd_2) * (1 << i) +
+               helpers::math::ratio(even ? even_half : odd_half, 1 << i);
+    }
+    out[0] += in[0];
+    out[M - 1] += in[7];
+  }
+};
+
+/**
+ * Compute the 2D filter transform G * filter * G^T of an R x S filter tile
+ * into an A x B transformed tile.
+ */
+template <typename T, int M, int N, int R, int S, typename FilterTileT,
+          typename TransformedTileT>
+inline SNN_ALWAYS_INLINE void transform_filter(FilterTileT const& filter,
+                                               TransformedTileT& transformed) {
+  constexpr int A = M + R - 1;
+  constexpr int B = N + S - 1;
+  T columns[A][S];
+  SNN_PRAGMA_UNROLL
+  for (int c = 0; c < S; ++c) {
+    T in[R];
+    T out[A];
+    SNN_PRAGMA_UNROLL
+    for (int r = 0; r < R; ++r) {
+      in[r] = filter.data(r, c);
+    }
+    Transform1D<A>::filter(in, out);
+    SNN_PRAGMA_UNROLL
+    for (int r = 0; r < A; ++r) {
+      columns[r][c] = out[r];
+    }
+  }
+  SNN_PRAGMA_UNROLL
+  for (int r = 0; r < A; ++r) {
+    T out[B];
+    Transform1D<B>::filter(columns[r], out);
+    SNN_PRAGMA_UNROLL
+    for (int c = 0; c < B; ++c) {
+      transformed.data(r, c) = out[c];
+    }
+  }
+}
+
+/**
+ * Compute the 2D input transform B^T * input * B of an A x B input tile.
+ */
+template <typename T, int M, int N, int R, int S, typename InputTileT,
+          typename TransformedTileT>
+inline SNN_ALWAYS_INLINE void transform_input(InputTileT const& input,
+                                              TransformedTileT& transformed) {
+  constexpr int A = M + R - 1;
+  constexpr int B = N + S - 1;
+  T columns[A][B];
+  SNN_PRAGMA_UNROLL
+  for (int c = 0; c < B; ++c) {
+    T in[A];
+    T out[A];
+    SNN_PRAGMA_UNROLL
+    for (int r = 0; r < A; ++r) {
+      in[r] = input.data(r, c);
+    }
+    Transform1D<A>::input(in, out);
+    SNN_PRAGMA_UNROLL
+    for (int r = 0; r < A; ++r) {
+      columns[r][c] = out[r];
+    }
+  }
+  SNN_PRAGMA_UNROLL
+  for (int r = 0; r < A; ++r) {
+    T out[B];
+    Transform1D<B>::input(columns[r], out);
+    SNN_PRAGMA_UNROLL
+    for (int c = 0; c < B; ++c) {
+      transformed.data(r, c) = out[c];
+    }
+  }
+}
+
+/**
+ * Compute the 2D output transform A^T * intermediate * A of an A x B
+ * intermediate tile into an M x N output tile.
+ */
+template <typename T, int M, int N, int R, int S, typename IntermediateTileT,
+          typename OutputTileT>
+inline SNN_ALWAYS_INLINE void transform_output(
+    IntermediateTileT const& intermediate, OutputTileT& output) {
+  constexpr int A = M + R - 1;
+  constexpr int B = N + S - 1;
+  T columns[M][B];
+  SNN_PRAGMA_UNROLL
+  for (int c = 0; c < B; ++c) {
+    T in[A];
+    T out[M];
+    SNN_PRAGMA_UNROLL
+    for (int r = 0; r < A; ++r) {
+      in[r] = intermediate.data(r, c);
+    }
+    Transform1D<A>::template output<M>(in, out);
+    SNN_PRAGMA_UNROLL
+    for (int r = 0; r < M; ++r) {
+      columns[r][c] = out[r];
+    }
+  }
+  SNN_PRAGMA_UNROLL
+  for (int r = 0; r < M; ++r) {
+    T out[N];
+    Transform1D<B>::template output<N>(columns[r], out);
+    SNN_PRAGMA_UNROLL
+    for (int c = 0; c < N; ++c) {
+      output.data(r, c) = out[c];
+    }
+  }
+}
+
+}  // namespace separable
+}  // namespace winograd
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_WINOGRAD_KERNELS_SEPARABLE_TRANSFORMS_H_
@@ -16,6 +16,8 @@
 #ifndef SYCLDNN_SRC_CONV2D_WINOGRAD_KERNELS_TILES_H_
 #define SYCLDNN_SRC_CONV2D_WINOGRAD_KERNELS_TILES_H_
 
+#include "sycldnn/format_type.h"
+
 #include "sycldnn/conv2d/conv_type.h"
 
 #include "src/helpers/register_tile.h"
@@ -33,6 +35,85 @@ struct SYCLOutputWindow {
   Index offset;
 };
 
+/**
+ * Offsets and strides of the tensors used in the Winograd transforms for a
+ * given data layout.
+ *
+ * The Winograd tiles are loaded and stored by stepping across the rows and
+ * columns of a tensor, so each layout provides the offset to the start of a
+ * tile along with the stride between adjacent columns.
+ */
+template <typename Layout>
+struct LayoutOffsets;
+
+/** Offsets into NHWC tensors and HWCF filters. */
+template <>
+struct LayoutOffsets<layout::NHWC> {
+  /** Offset of the given element of a tensor. */
+  template <typename Index>
+  static SNN_ALWAYS_INLINE Index offset(Index const batch, Index const row,
+                                        Index const n_rows, Index const col,
+                                        Index const n_cols,
+                                        Index const channel,
+                                        Index const n_channels) {
+    return ((batch * n_rows + row) * n_cols + col) * n_channels + channel;
+  }
+  /** Distance between adjacent columns of a tensor. */
+  template <typename Index>
+  static SNN_ALWAYS_INLINE Index col_stride(Index const n_channels) {
+    return n_channels;
+  }
+  /** Offset of the first filter value for a channel and feature. */
+  template <typename Index>
+  static SNN_ALWAYS_INLINE Index filter_offset(Index const channel,
+                                               Index const feature,
+                                               Index const /*n_channels*/,
+                                               Index const n_features,
+                                               Index const /*window_size*/) {
+    return channel * n_features + feature;
+  }
+  /** Distance between adjacent values in a filter window. */
+  template <typename Index>
+  static SNN_ALWAYS_INLINE Index filter_stride(Index const n_channels,
+                                               Index const n_features) {
+    return n_channels * n_features;
+  }
+};
+
+/** Offsets into NCHW tensors and FCHW filters. */
+template <>
+struct LayoutOffsets<layout::NCHW> {
+  /** \copydoc LayoutOffsets<layout::NHWC>::offset */
+  template <typename Index>
+  static SNN_ALWAYS_INLINE Index offset(Index const batch, Index const row,
+                                        Index const n_rows, Index const col,
+                                        Index const n_cols,
+                                        Index const channel,
+                                        Index const n_channels) {
+    return ((batch * n_channels + channel) * n_rows + row) * n_cols + col;
+  }
+  /** \copydoc LayoutOffsets<layout::NHWC>::col_stride */
+  template <typename Index>
+  static SNN_ALWAYS_INLINE Index col_stride(Index const /*n_channels*/) {
+    return 1;
+  }
+  /** \copydoc LayoutOffsets<layout::NHWC>::filter_offset */
+  template <typename Index>
+  static SNN_ALWAYS_INLINE Index filter_offset(Index const channel,
+                                               Index const feature,
+                                               Index const n_channels,
+                                               Index const /*n_features*/,
+                                               Index const window_size) {
+    return (feature * n_channels + channel) * window_size;
+  }
+  /** \copydoc LayoutOffsets<layout::NHWC>::filter_stride */
+  template <typename Index>
+  static SNN_ALWAYS_INLINE Index filter_stride(Index const /*n_channels*/,
+                                               Index const /*n_features*/) {
+    return 1;
+  }
+};
+
 template <typename T, int M, int N, int R, int S>
 struct InputTile final
     : public helpers::RegisterTile2D<T, M + R - 1, N + S - 1> {
@@ -44,23 +125,26 @@ struct InputTile final
    * Read the input data from the provided input array. The pointer is assumed
    * to be at the first value that should be read into the input tile.
    *
-   * The input is expected to be in the NHWC data format.
+   * The input is expected to be in the NHWC data format, unless the NCHW
+   * layout is given.
    *
    * NOTE: The template here allows different address space attributes to be
    * passed with the pointer, rather than specifying the pointer will be to
    * global memory or to local memory.
    */
   template <typename PtrT, cl::sycl::access::address_space Space,
-            typename Index>
+            typename Index, typename Layout = layout::NHWC>
   SNN_ALWAYS_INLINE InputTile(cl::sycl::multi_ptr<PtrT const, Space> input,
                               Index const batch, Index const rstart,
                               Index const n_rows, Index const cstart,
                               Index const n_cols, Index const channel,
-                              Index const n_channels)
+                              Index const n_channels,
+                              Layout /*layout*/ = Layout{})
       : helpers::RegisterTile2D<T, A, B>{} {
-    Index const offset =
-        ((batch * n_rows + rstart) * n_cols + cstart) * n_channels + channel;
-    input += offset;
+    using Offsets = LayoutOffsets<Layout>;
+    input += Offsets::offset(batch, rstart, n_rows, cstart, n_cols, channel,
+                             n_channels);
+    Index const col_stride = Offsets::col_stride(n_channels);
     Index row_idx = 0;
     SNN_PRAGMA_UNROLL
     for (int r = 0; r < A; ++r) {
@@ -71,10 +155,10 @@ struct InputTile final
           if (c >= -cstart && c < n_cols - cstart) {
             data(r, c) = helpers::io::Load<T>()(input, idx);
           }
-          idx += n_channels;
+          idx += col_stride;
         }
       }
-      row_idx += n_cols * n_channels;
+      row_idx += n_cols * col_stride;
     }
   }
 };
@@ -93,7 +177,8 @@ struct FilterTile<T, M, N, R, S, conv_type::Forward> final
    * Read the filter data from the provided input array. The pointer is assumed
    * to be at the start of the filter tensor.
    *
-   * The input is expected to be in (Height x Width x Channel x Feature) format.
+   * The input is expected to be in (Height x Width x Channel x Feature) format,
+   * or in (Feature x Channel x Height x Width) format for the NCHW layout.
    * The height of the filter (no. of rows) is expected to be R, and the width
    * (no. of cols) is S.
    *
@@ -102,16 +187,20 @@ struct FilterTile<T, M, N, R, S, conv_type::Forward> final
    * global memory or to local memory.
    */
   template <typename PtrT, cl::sycl::access::address_space Space,
-            typename Index>
+            typename Index, typename Layout = layout::NHWC>
   SNN_ALWAYS_INLINE FilterTile(cl::sycl::multi_ptr<PtrT const, Space> input,
                                Index const channel, Index const feature,
-                               Index const n_channels, Index const n_features) {
-    input += channel * n_features + feature;
+                               Index const n_channels, Index const n_features,
+                               Layout /*layout*/ = Layout{}) {
+    using Offsets = LayoutOffsets<Layout>;
+    input += Offsets::filter_offset(channel, feature, n_channels, n_features,
+                                    Index{R * S});
+    Index const stride = Offsets::filter_stride(n_channels, n_features);
     SNN_PRAGMA_UNROLL
     for (int r = 0; r < R; ++r) {
       SNN_PRAGMA_UNROLL
       for (int c = 0; c < S; ++c) {
-        Index idx = (r * S + c) * n_channels * n_features;
+        Index idx = (r * S + c) * stride;
         data(r, c) = helpers::io::Load<T>()(input, idx);
       }
     }
@@ -127,18 +216,23 @@ struct FilterTile<T, M, N, R, S, conv_type::InputBackprop> final
    * for use in backprop. The pointer is assumed to be at the start of the
    * filter tensor.
    *
-   * The input is expected to be in (Height x Width x Channel x Feature) format.
+   * The input is expected to be in (Height x Width x Channel x Feature) format,
+   * or in (Feature x Channel x Height x Width) format for the NCHW layout.
    *
    * NOTE: The template here allows different address space attributes to be
    * passed with the pointer, rather than specifying the pointer will be to
    * global memory or to local memory.
    */
   template <typename PtrT, cl::sycl::access::address_space Space,
-            typename Index>
+            typename Index, typename Layout = layout::NHWC>
   SNN_ALWAYS_INLINE FilterTile(cl::sycl::multi_ptr<PtrT const, Space> input,
                                Index const channel, Index const feature,
-                               Index const n_channels, Index const n_features) {
-    input += channel * n_features + feature;
+                               Index const n_channels, Index const n_features,
+                               Layout /*layout*/ = Layout{}) {
+    using Offsets = LayoutOffsets<Layout>;
+    input += Offsets::filter_offset(channel, feature, n_channels, n_features,
+                                    Index{R * S});
+    Index const stride = Offsets::filter_stride(n_channels, n_features);
     SNN_PRAGMA_UNROLL
     for (int r = 0; r < R; ++r) {
       SNN_PRAGMA_UNROLL
@@ -146,7 +240,7 @@ struct FilterTile<T, M, N, R, S, conv_type::InputBackprop> final
         // Here the transforms (R - 1 - r) and (S - 1 - c) mirror the filter
         // data. Note that the channel and feature dims were switched in the
         // kernel params.
-        Index idx = (r * S + c) * n_channels * n_features;
+        Index idx = (r * S + c) * stride;
         data(R - 1 - r, S - 1 - c) = helpers::io::Load<T>()(input, idx);
       }
     }
@@ -160,7 +254,9 @@ struct FilterTile<T, M, N, R, S, conv_type::FilterBackprop> final
   /**
    * Read the filter data from the provided input array.
    *
-   * The input is expected to be in (Batch x Height x Width x Feature) format.
+   * The input is expected to be in (Batch x Height x Width x Feature) format,
+   * where n_features gives the distance between adjacent columns. The NCHW
+   * layout is read by passing a column stride of 1.
    *
    * NOTE: The template here allows different address space attributes to be
    * passed with the pointer, rather than specifying the pointer will be to
@@ -351,7 +447,9 @@ struct OutputData {
   /**
    * Write the output tile to the correct output memory. The output pointer
    * should be at the start of the output buffer. The resulting output shape is
-   * NHWC.
+   * NHWC, where n_channels gives the distance between adjacent columns, so an
+   * NCHW output is written by passing a column stride of 1. The tile values
+   * are converted to the output type, which may be narrower than T.
    *
    * NOTE: The template here allows different address space attributes to be
    * passed with the pointer, rather than specifying the pointer will be to
@@ -367,14 +465,15 @@ struct OutputData {
     for (int r = 0; r < M && r < window.rsize; ++r) {
       for (int c = 0; c < N && c < window.csize; ++c) {
         Index idx = (r * n_cols + c) * n_channels;
-        helpers::io::Store<T>()(output, idx, tile.data(r, c));
+        helpers::io::Store<PtrT>()(output, idx,
+                                   static_cast<PtrT>(tile.data(r, c)));
       }
     }
   }
   /**
    * Write the output tile to the correct output memory. The output pointer
    * should be at the start of the output buffer. The resulting output shape is
-   * HWCF.
+   * HWCF, or FCHW for the NCHW layout.
    *
    * The filter has size M x N when run in FilterBackprop mode, so we don't need
    * to check the bounds for writing to the output.
@@ -384,15 +483,19 @@ struct OutputData {
    * global memory or to local memory.
    */
   template <bool accumulate_output, typename PtrT,
-            cl::sycl::access::address_space Space, typename Index>
+            cl::sycl::access::address_space Space, typename Index,
+            typename Layout = layout::NHWC>
   static SNN_ALWAYS_INLINE void write_filter_output(
       cl::sycl::multi_ptr<PtrT, Space> output, Index const channel,
       Index const feature, Index const n_channels, Index const n_features,
-      OutputTile<T, M, N, R, S> const& tile) {
-    output += channel * n_features + feature;
+      OutputTile<T, M, N, R, S> const& tile, Layout /*layout*/ = Layout{}) {
+    using Offsets = LayoutOffsets<Layout>;
+    output += Offsets::filter_offset(channel, feature, n_channels, n_features,
+                                     Index{M * N});
+    Index const stride = Offsets::filter_stride(n_channels, n_features);
     for (int r = 0; r < M; ++r) {
       for (int c = 0; c < N; ++c) {
-        Index idx = (r * N + c) * n_channels * n_features;
+        Index idx = (r * N + c) * stride;
         auto out_data = tile.data(r, c);
         if (accumulate_output) {
           out_data += helpers::io::Load<T>()(output, idx);
@@ -16,6 +16,7 @@
 #ifndef SYCLDNN_SRC_CONV2D_WINOGRAD_KERNELS_TILES_IMPL_H_
 #define SYCLDNN_SRC_CONV2D_WINOGRAD_KERNELS_TILES_IMPL_H_
 
+#include "src/conv2d/winograd/kernels/separable_transforms.h"
 #include "src/conv2d/winograd/kernels/tiles.h"
 
 #include "src/helpers/math.h"
@@ -1362,6 +1363,118 @@ struct OutputTile<T, 4, 4, 3, 3> final : public BaseOutputTile<T, 4, 4, 3, 3> {
   }
 };
 
+/*
+ * The transforms for the following tiles are computed separably, see
+ * separable_transforms.h.
+ */
+template <typename T>
+struct TransformedFilterTile<T, 6, 6, 3, 3> final
+    : public BaseTransformedFilterTile<T, 6, 6, 3, 3> {
+  using BaseTransformedFilterTile<T, 6, 6, 3, 3>::data;
+
+  template <typename ConvType>
+  SNN_ALWAYS_INLINE explicit TransformedFilterTile(
+      FilterTile<T, 6, 6, 3, 3, ConvType> const& filter)
+      : BaseTransformedFilterTile<T, 6, 6, 3, 3>{} {
+    separable::transform_filter<T, 6, 6, 3, 3>(filter, *this);
+  }
+};
+
+template <typename T>
+struct TransformedInputTile<T, 6, 6, 3, 3> final
+    : public BaseTransformedInputTile<T, 6, 6, 3, 3> {
+  using BaseTransformedInputTile<T, 6, 6, 3, 3>::data;
+
+  SNN_ALWAYS_INLINE explicit TransformedInputTile(
+      InputTile<T, 6, 6, 3, 3> const& input)
+      : BaseTransformedInputTile<T, 6, 6, 3, 3>{} {
+    separable::transform_input<T, 6, 6, 3, 3>(input, *this);
+  }
+};
+
+template <typename T>
+struct OutputTile<T, 6, 6, 3, 3> final : public BaseOutputTile<T, 6, 6, 3, 3> {
+  using BaseOutputTile<T, 6, 6, 3, 3>::data;
+
+  SNN_ALWAYS_INLINE explicit OutputTile(
+      IntermediateTile<T, 6, 6, 3, 3> const& inter)
+      : BaseOutputTile<T, 6, 6, 3, 3>{} {
+    separable::transform_output<T, 6, 6, 3, 3>(inter, *this);
+  }
+};
+
+template <typename T>
+struct TransformedFilterTile<T, 2, 2, 5, 5> final
+    : public BaseTransformedFilterTile<T, 2, 2, 5, 5> {
+  using BaseTransformedFilterTile<T, 2, 2, 5, 5>::data;
+
+  template <typename ConvType>
+  SNN_ALWAYS_INLINE explicit TransformedFilterTile(
+      FilterTile<T, 2, 2, 5, 5, ConvType> const& filter)
+      : BaseTransformedFilterTile<T, 2, 2, 5, 5>{} {
+    separable::transform_filter<T, 2, 2, 5, 5>(filter, *this);
+  }
+};
+
+template <typename T>
+struct TransformedInputTile<T, 2, 2, 5, 5> final
+    : public BaseTransformedInputTile<T, 2, 2, 5, 5> {
+  using BaseTransformedInputTile<T, 2, 2, 5, 5>::data;
+
+  SNN_ALWAYS_INLINE explicit TransformedInputTile(
+      InputTile<T, 2, 2, 5, 5> const& input)
+      : BaseTransformedInputTile<T, 2, 2, 5, 5>{} {
+    separable::transform_input<T, 2, 2, 5, 5>(input, *this);
+  }
+};
+
+template <typename T>
+struct OutputTile<T, 2, 2, 5, 5> final : public BaseOutputTile<T, 2, 2, 5, 5> {
+  using BaseOutputTile<T, 2, 2, 5, 5>::data;
+
+  SNN_ALWAYS_INLINE explicit OutputTile(
+      IntermediateTile<T, 2, 2, 5, 5> const& inter)
+      : BaseOutputTile<T, 2, 2, 5, 5>{} {
+    separable::transform_output<T, 2, 2, 5, 5>(inter, *this);
+  }
+};
+
+template <typename T>
+struct TransformedFilterTile<T, 4, 4, 5, 5> final
+    : public BaseTransformedFilterTile<T, 4, 4, 5, 5> {
+  using BaseTransformedFilterTile<T, 4, 4, 5, 5>::data;
+
+  template <typename ConvType>
+  SNN_ALWAYS_INLINE explicit TransformedFilterTile(
+      FilterTile<T, 4, 4, 5, 5, ConvType> const& filter)
+      : BaseTransformedFilterTile<T, 4, 4, 5, 5>{} {
+    separable::transform_filter<T, 4, 4, 5, 5>(filter, *this);
+  }
+};
+
+template <typename T>
+struct TransformedInputTile<T, 4, 4, 5, 5> final
+    : public BaseTransformedInputTile<T, 4, 4, 5, 5> {
+  using BaseTransformedInputTile<T, 4, 4, 5, 5>::data;
+
+  SNN_ALWAYS_INLINE explicit TransformedInputTile(
+      InputTile<T, 4, 4, 5, 5> const& input)
+      : BaseTransformedInputTile<T, 4, 4, 5, 5>{} {
+    separable::transform_input<T, 4, 4, 5, 5>(input, *this);
+  }
+};
+
+template <typename T>
+struct OutputTile<T, 4, 4, 5, 5> final : public BaseOutputTile<T, 4, 4, 5, 5> {
+  using BaseOutputTile<T, 4, 4, 5, 5>::data;
+
+  SNN_ALWAYS_INLINE explicit OutputTile(
+      IntermediateTile<T, 4, 4, 5, 5> const& inter)
+      : BaseOutputTile<T, 4, 4, 5, 5>{} {
+    separable::transform_output<T, 4, 4, 5, 5>(inter, *this);
+  }
+};
+
 }  // namespace winograd
 }  // namespace internal
 }  // namespace conv2d
@@ -15,6 +15,10 @@
  */
 #include "sycldnn/internal/conv2d/winograd/launch_filter_transform.h"
 
+#include "sycldnn/data_format.h"
+#include "sycldnn/filter_format.h"
+#include "sycldnn/format_type.h"
+
 #include "sycldnn/conv2d/conv_type.h"
 
 #include "src/conv2d/winograd/queue_filter_transform.h"
@@ -26,13 +30,40 @@ namespace conv2d {
 namespace internal {
 namespace winograd {
 
+namespace {
+
+/** Check whether the filter to transform is in the FCHW format. */
+template <typename ConvType>
+bool is_fchw_filter(Conv2DParams const& params) {
+  return params.filter_format == FilterFormat::FCHW;
+}
+
+/**
+ * The filter backprop transforms the output of the convolution, which is in
+ * the same format as the input.
+ */
+template <>
+bool is_fchw_filter<conv_type::FilterBackprop>(Conv2DParams const& params) {
+  return params.input_format == DataFormat::NCHW;
+}
+
+}  // namespace
+
 template <typename T, typename ConvType, int M, int N, int R, int S>
 SNNStatus launch_filter_transform(BaseMemObject<T const>& input,
                                   BaseMemObject<T>& transform,
                                   Conv2DParams const& params,
                                   TileInfo const& tile_info,
                                   cl::sycl::queue& queue) {
-  return queue_filter_transform<T, int, ConvType, M, N, R, S>(
+  if (is_fchw_filter<ConvType>(params)) {
+#ifdef SNN_ENABLE_NCHW
+    return queue_filter_transform<T, int, ConvType, M, N, R, S, layout::NCHW>(
+        input, transform, params, tile_info, queue);
+#else
+    return StatusCode::InvalidAlgorithm;
+#endif  // SNN_ENABLE_NCHW
+  }
+  return queue_filter_transform<T, int, ConvType, M, N, R, S, layout::NHWC>(
       input, transform, params, tile_info, queue);
 }
 
@@ -44,12 +75,18 @@ SNNStatus launch_filter_transform(BaseMemObject<T const>& input,
       cl::sycl::queue& queue);
 
 #define INSTANTIATE_FOR_TYPE(DTYPE)                                  \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 6, 6, 3, 3)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 4, 4, 3, 3)        \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 4, 4, 5, 5)        \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 2, 5, 5)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 3, 3, 3, 3)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 2, 3, 3)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 1, 2, 1, 3)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 1, 3, 1)        \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 6, 6, 3, 3)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 4, 4, 3, 3)  \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 4, 4, 5, 5)  \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 2, 2, 5, 5)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 3, 3, 3, 3)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 2, 2, 3, 3)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 1, 2, 1, 3)  \
@@ -15,6 +15,9 @@
  */
 #include "sycldnn/internal/conv2d/winograd/launch_input_transform.h"
 
+#include "sycldnn/data_format.h"
+#include "sycldnn/format_type.h"
+
 #include "sycldnn/conv2d/conv_type.h"
 
 #include "src/conv2d/winograd/queue_input_transform.h"
@@ -36,6 +39,17 @@ SNNStatus launch_input_transform(BaseMemObject<T const>& input,
                                  Conv2DParams const& params,
                                  TileInfo const& tile_info,
                                  cl::sycl::queue& queue) {
+  if (params.input_format == DataFormat::NCHW) {
+#ifdef SNN_ENABLE_NCHW
+    // The channels are not contiguous in NCHW tensors, so the tiles are loaded
+    // one channel at a time.
+    return queue_input_transform<T, int, ConvType, M, N, R, S, 1,
+                                 layout::NCHW>(input, transform, params,
+                                               tile_info, queue);
+#else
+    return StatusCode::InvalidAlgorithm;
+#endif  // SNN_ENABLE_NCHW
+  }
   // The larger input tiles when M is 4 use too many registers if vectorisation
   // is used, which causes performance of the transform kernel to be around half
   // what it is without vectorisation. As we don't currently have a better way
@@ -43,14 +57,17 @@ SNNStatus launch_input_transform(BaseMemObject<T const>& input,
   // vectorisation in this case.
   // TODO(jwlawson): Provide better vector size customisation
   if (M != 4 && can_use_vector(params, 4)) {
-    return queue_input_transform<T, int, ConvType, M, N, R, S, 4>(
-        input, transform, params, tile_info, queue);
+    return queue_input_transform<T, int, ConvType, M, N, R, S, 4,
+                                 layout::NHWC>(input, transform, params,
+                                               tile_info, queue);
   } else if (M != 4 && can_use_vector(params, 2)) {
-    return queue_input_transform<T, int, ConvType, M, N, R, S, 2>(
-        input, transform, params, tile_info, queue);
+    return queue_input_transform<T, int, ConvType, M, N, R, S, 2,
+                                 layout::NHWC>(input, transform, params,
+                                               tile_info, queue);
   } else {
-    return queue_input_transform<T, int, ConvType, M, N, R, S, 1>(
-        input, transform, params, tile_info, queue);
+    return queue_input_transform<T, int, ConvType, M, N, R, S, 1,
+                                 layout::NHWC>(input, transform, params,
+                                               tile_info, queue);
   }
 }
 
@@ -62,12 +79,18 @@ SNNStatus launch_input_transform(BaseMemObject<T const>& input,
       cl::sycl::queue& queue);
 
 #define INSTANTIATE_FOR_TYPE(DTYPE)                                  \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 6, 6, 3, 3)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 4, 4, 3, 3)        \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 4, 4, 5, 5)        \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 2, 5, 5)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 3, 3, 3, 3)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 2, 3, 3)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 1, 3, 1)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 1, 2, 1, 3)        \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 6, 6, 3, 3)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 4, 4, 3, 3)  \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 4, 4, 5, 5)  \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 2, 2, 5, 5)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 3, 3, 3, 3)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 2, 2, 3, 3)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 2, 1, 3, 1)  \
@@ -15,6 +15,9 @@
  */
 #include "sycldnn/internal/conv2d/winograd/launch_output_transform.h"
 
+#include "sycldnn/data_format.h"
+#include "sycldnn/format_type.h"
+
 #include "sycldnn/conv2d/conv_type.h"
 
 #include "src/conv2d/winograd/queue_output_transform.h"
@@ -31,26 +34,46 @@ template <typename T, typename ConvType, int M, int N, int R, int S,
 SNNStatus launch_output_transform(BaseMemObject<T const>& intermediate,
                                   BaseMemObject<T>& output,
                                   Conv2DParams const& params,
+                                  EpilogueMem<T> const& epilogue,
                                   TileInfo const& tile_info,
                                   cl::sycl::queue& queue) {
-  return queue_output_transform<T, int, ConvType, M, N, R, S, Accumulate>(
-      intermediate, output, params, tile_info, queue);
+  // The filter backprop writes a filter, which is in the FCHW format when the
+  // input is NCHW.
+  if (params.input_format == DataFormat::NCHW) {
+#ifdef SNN_ENABLE_NCHW
+    return queue_output_transform<T, int, ConvType, M, N, R, S, Accumulate,
+                                  layout::NCHW>(intermediate, output, params,
+                                                epilogue, tile_info, queue);
+#else
+    return StatusCode::InvalidAlgorithm;
+#endif  // SNN_ENABLE_NCHW
+  }
+  return queue_output_transform<T, int, ConvType, M, N, R, S, Accumulate,
+                                layout::NHWC>(intermediate, output, params,
+                                              epilogue, tile_info, queue);
 }
 
-#define INSTANTIATE_LAUNCHER(DTYPE, CTYPE, M, N, R, S, ACC)      \
-  template SNN_EXPORT SNNStatus                                  \
-  launch_output_transform<DTYPE, CTYPE, M, N, R, S, ACC>(        \
-      BaseMemObject<DTYPE const> & intermediate,                 \
-      BaseMemObject<DTYPE> & output, Conv2DParams const& params, \
-      TileInfo const& tile_info, cl::sycl::queue& queue);
+#define INSTANTIATE_LAUNCHER(DTYPE, CTYPE, M, N, R, S, ACC)          \
+  template SNN_EXPORT SNNStatus                                      \
+  launch_output_transform<DTYPE, CTYPE, M, N, R, S, ACC>(            \
+      BaseMemObject<DTYPE const> & intermediate,                     \
+      BaseMemObject<DTYPE> & output, Conv2DParams const& params,     \
+      EpilogueMem<DTYPE> const& epilogue, TileInfo const& tile_info, \
+      cl::sycl::queue& queue);
 
 #define INSTANTIATE_FOR_TYPE(DTYPE)                                         \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 6, 6, 3, 3, false)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 4, 4, 3, 3, false)        \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 4, 4, 5, 5, false)        \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 2, 5, 5, false)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 3, 3, 3, 3, false)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 2, 3, 3, false)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 1, 2, 1, 3, false)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 1, 3, 1, false)        \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 6, 6, 3, 3, false)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 4, 4, 3, 3, false)  \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 4, 4, 5, 5, false)  \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 2, 2, 5, 5, false)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 3, 3, 3, 3, false)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 2, 2, 3, 3, false)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 1, 2, 1, 3, false)  \
@@ -57,13 +57,13 @@ inline cl::sycl::range<1> get_thread_range<conv_type::FilterBackprop>(
 }  // namespace
 
 template <typename T, typename Index, typename ConvType, int M, int N, int R,
-          int S>
+          int S, typename Layout>
 SNNStatus queue_filter_transform(BaseMemObject<T const>& filter_mem,
                                  BaseMemObject<T>& transform_mem,
                                  Conv2DParams const& params,
                                  TileInfo const& tile_info,
                                  cl::sycl::queue& queue) {
-  using Functor = ExtractFilterTiles<T, Index, M, N, R, S, ConvType>;
+  using Functor = ExtractFilterTiles<T, Index, M, N, R, S, ConvType, Layout>;
 
   auto event = queue.submit([&](cl::sycl::handler& cgh) {
     auto filter = filter_mem.read_accessor(cgh);
@@ -30,7 +30,7 @@ namespace internal {
 namespace winograd {
 
 template <typename T, typename Index, typename ConvType, int M, int N, int R,
-          int S, int ChannelVector>
+          int S, int ChannelVector, typename Layout>
 SNNStatus queue_input_transform(BaseMemObject<T const>& input,
                                 BaseMemObject<T>& in_transform,
                                 Conv2DParams const& params,
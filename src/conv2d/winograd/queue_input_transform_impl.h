@@ -47,14 +47,14 @@ inline cl::sycl::range<1> get_thread_range(Conv2DParams const& params,
 }  // namespace
 
 template <typename T, typename Index, typename ConvType, int M, int N, int R,
-          int S, int ChannelVector>
+          int S, int ChannelVector, typename Layout>
 SNNStatus queue_input_transform(BaseMemObject<T const>& input_mem,
                                 BaseMemObject<T>& transform_mem,
                                 Conv2DParams const& params,
                                 TileInfo const& tile_info,
                                 cl::sycl::queue& queue) {
   using Functor =
-      ExtractInputTiles<T, Index, ChannelVector, M, N, R, S, ConvType>;
+      ExtractInputTiles<T, Index, ChannelVector, M, N, R, S, ConvType, Layout>;
 
   auto event = queue.submit([&](cl::sycl::handler& cgh) {
     auto input = input_mem.read_accessor(cgh);
@@ -20,6 +20,7 @@
 #include "sycldnn/status.h"
 
 #include "sycldnn/conv2d/params.h"
+#include "sycldnn/internal/conv2d/epilogue.h"
 #include "sycldnn/internal/conv2d/winograd/tile_info.h"
 
 #include <CL/sycl.hpp>
@@ -30,10 +31,11 @@ namespace internal {
 namespace winograd {
 
 template <typename T, typename Index, typename ConvType, int M, int N, int R,
-          int S, bool Accumulate>
+          int S, bool Accumulate, typename Layout>
 SNNStatus queue_output_transform(BaseMemObject<T const>& intermediate,
                                  BaseMemObject<T>& output,
                                  Conv2DParams const& kernel_params,
+                                 EpilogueMem<T> const& epilogue,
                                  TileInfo const& tile_info,
                                  cl::sycl::queue& queue);
 
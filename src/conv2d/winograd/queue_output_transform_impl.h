@@ -56,23 +56,55 @@ inline cl::sycl::range<1> get_thread_range<conv_type::FilterBackprop>(
   return cl::sycl::range<1>{n_threads};
 }
 
+/**
+ * Construct an output transform functor for a forward or input backprop
+ * convolution, which applies the epilogue to the output.
+ */
+template <typename Functor, typename T, typename ConvType>
+Functor make_output_functor(ConvType, Conv2DParams const& params,
+                            TileInfo const& tile_info,
+                            ReadAccessor<T const> const& intermediate,
+                            WriteAccessor<T> const& output,
+                            EpilogueMem<T> const& epilogue,
+                            cl::sycl::handler& cgh) {
+  return {params, tile_info, intermediate, output,
+          epilogue::make_epilogue(epilogue, cgh)};
+}
+
+/**
+ * Construct an output transform functor for a filter backprop convolution,
+ * which has no epilogue.
+ */
+template <typename Functor, typename T>
+Functor make_output_functor(conv_type::FilterBackprop,
+                            Conv2DParams const& params,
+                            TileInfo const& tile_info,
+                            ReadAccessor<T const> const& intermediate,
+                            WriteAccessor<T> const& output,
+                            EpilogueMem<T> const& /*epilogue*/,
+                            cl::sycl::handler& /*cgh*/) {
+  return {params, tile_info, intermediate, output};
+}
+
 }  // namespace
 
 template <typename T, typename Index, typename ConvType, int M, int N, int R,
-          int S, bool Accumulate>
+          int S, bool Accumulate, typename Layout>
 SNNStatus queue_output_transform(BaseMemObject<T const>& intermediate_mem,
                                  BaseMemObject<T>& output_mem,
                                  Conv2DParams const& params,
+                                 EpilogueMem<T> const& epilogue,
                                  TileInfo const& tile_info,
                                  cl::sycl::queue& queue) {
   using Functor =
-      ExtractOutputTiles<T, Index, M, N, R, S, ConvType, Accumulate>;
+      ExtractOutputTiles<T, Index, M, N, R, S, ConvType, Accumulate, Layout>;
 
   auto event = queue.submit([&](cl::sycl::handler& cgh) {
     auto intermediate = intermediate_mem.read_accessor(cgh);
     auto output = output_mem.write_accessor(cgh);
     auto range = get_thread_range<ConvType>(params, tile_info);
-    Functor conv{params, tile_info, intermediate, output};
+    auto conv = make_output_functor<Functor>(
+        ConvType{}, params, tile_info, intermediate, output, epilogue, cgh);
 
     cgh.parallel_for(range, conv);
   });
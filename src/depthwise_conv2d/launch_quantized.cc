@@ -0,0 +1,105 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/internal/depthwise_conv2d/launch.h"
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+
+#include "sycldnn/depthwise_conv2d/params.h"
+#include "sycldnn/depthwise_conv2d/sizes.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "sycldnn/quantize/params.h"
+
+#include "src/depthwise_conv2d/quantized_kernels.h"
+
+#include <CL/sycl.hpp>
+
+#include <stddef.h>
+#include <cstdint>
+#include <limits>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace depthwise_conv2d {
+namespace internal {
+namespace {
+
+template <typename Index>
+SNNStatus queue_quantized_kernel(
+    BaseMemObject<int8_t const>& input, BaseMemObject<int8_t const>& filter,
+    BaseMemObject<int32_t const>& bias, BaseMemObject<float const>& scales,
+    BaseMemObject<int32_t const>& zero_points, BaseMemObject<int8_t>& output,
+    DepthwiseConv2DParams const& params,
+    quantize::RequantizeParams const& requantize_params, Index output_size,
+    cl::sycl::queue& queue) {
+  using Functor = QuantizedDepthwiseConv2D<Index>;
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input_acc = input.read_accessor(cgh);
+    auto filter_acc = filter.read_accessor(cgh);
+    auto bias_acc = bias.read_accessor(cgh);
+    auto scale_acc = scales.read_accessor(cgh);
+    auto zero_point_acc = zero_points.read_accessor(cgh);
+    auto output_acc = output.write_accessor(cgh);
+
+    Functor conv(output_size, params, requantize_params, input_acc, filter_acc,
+                 bias_acc, scale_acc, zero_point_acc, output_acc);
+    size_t const n_threads =
+        helpers::round_up_to_nearest_multiple(output_size, 64);
+
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, conv);
+  });
+
+  return {event, StatusCode::OK};
+}
+
+}  // namespace
+
+SNNStatus launch_quantized(
+    BaseMemObject<int8_t const>& input, BaseMemObject<int8_t const>& filter,
+    BaseMemObject<int32_t const>& bias, BaseMemObject<float const>& scales,
+    BaseMemObject<int32_t const>& zero_points, BaseMemObject<int8_t>& output,
+    DepthwiseConv2DParams const& params,
+    quantize::RequantizeParams const& requantize_params,
+    cl::sycl::queue& queue) {
+  auto conv_sizes = get_sizes<conv2d::conv_type::Forward>(params);
+  size_t output_size = conv_sizes.output_size;
+  size_t input_size = conv_sizes.input_size;
+  if (output_size > std::numeric_limits<int32_t>::max() ||
+      input_size > std::numeric_limits<int32_t>::max()) {
+#ifdef SNN_USE_INT64
+    return queue_quantized_kernel<int64_t>(
+        input, filter, bias, scales, zero_points, output, params,
+        requantize_params, static_cast<int64_t>(output_size), queue);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return queue_quantized_kernel<int32_t>(
+        input, filter, bias, scales, zero_points, output, params,
+        requantize_params, static_cast<int32_t>(output_size), queue);
+  }
+}
+
+}  // namespace internal
+}  // namespace depthwise_conv2d
+}  // namespace sycldnn
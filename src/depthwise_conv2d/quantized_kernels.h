@@ -0,0 +1,144 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_DEPTHWISE_CONV2D_QUANTIZED_KERNELS_H_
+#define SYCLDNN_SRC_DEPTHWISE_CONV2D_QUANTIZED_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/helpers/macros.h"
+
+#include "sycldnn/depthwise_conv2d/params.h"
+#include "sycldnn/quantize/params.h"
+
+#include "src/helpers/tensor_index.h"
+#include "src/helpers/vector_io.h"
+#include "src/helpers/window_index.h"
+#include "src/quantize/requantize.h"
+
+#include <cstdint>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace depthwise_conv2d {
+namespace internal {
+
+/**
+ * Int8 quantized forward depthwise convolution, computing one output value per
+ * thread with an int32 accumulator.
+ */
+template <typename Index>
+struct QuantizedDepthwiseConv2D {
+  using LoadData = helpers::io::Load<int8_t>;
+  using LoadInt = helpers::io::Load<int32_t>;
+  using LoadScale = helpers::io::Load<float>;
+  using Store = helpers::io::Store<int8_t>;
+
+  QuantizedDepthwiseConv2D(Index n_elems, DepthwiseConv2DParams const& params,
+                           quantize::RequantizeParams const& requantize_params,
+                           ReadAccessor<int8_t const> const& input,
+                           ReadAccessor<int8_t const> const& filter,
+                           ReadAccessor<int32_t const> const& bias,
+                           ReadAccessor<float const> const& scales,
+                           ReadAccessor<int32_t const> const& zero_points,
+                           WriteAccessor<int8_t> const& output)
+      : n_elems_{n_elems},
+        features_{params.channels * params.channel_multiplier},
+        p_{params},
+        q_{requantize_params},
+        input_accessor_{input},
+        filter_accessor_{filter},
+        bias_accessor_{bias},
+        scale_accessor_{scales},
+        zero_point_accessor_{zero_points},
+        output_accessor_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) {
+    Index const index = item.get_id(0);
+
+    if (index < n_elems_) {
+      auto const input_data = input_accessor_.get_pointer();
+      auto const filter_data = filter_accessor_.get_pointer();
+
+      auto const tensor_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten4d(
+              index, p_.out_rows, p_.out_rows, p_.out_cols, p_.out_cols,
+              features_, features_);
+      Index const feature = tensor_idx.s3;
+      Index const col_idx = tensor_idx.s2;
+      Index const row_idx = tensor_idx.s1;
+      Index const batch_idx = tensor_idx.s0;
+      Index const channel = feature / p_.channel_multiplier;
+
+      Index const rstart =
+          helpers::in_window_from_output(row_idx, p_.stride_rows, p_.pad_rows)
+              .window_start;
+      Index const cstart =
+          helpers::in_window_from_output(col_idx, p_.stride_cols, p_.pad_cols)
+              .window_start;
+
+      int32_t acc = LoadInt()(bias_accessor_.get_pointer(), feature);
+      Index const input_batch_offset =
+          batch_idx * p_.in_rows * p_.in_cols * p_.channels + channel;
+      for (Index i = 0; i < p_.window_rows; ++i) {
+        Index const row = rstart + i;
+        if (row >= 0 && row < p_.in_rows) {
+          for (Index j = 0; j < p_.window_cols; ++j) {
+            Index const col = cstart + j;
+            if (col >= 0 && col < p_.in_cols) {
+              Index const input_offset =
+                  input_batch_offset + (row * p_.in_cols + col) * p_.channels;
+              Index const filter_offset =
+                  (i * p_.window_cols + j) * features_ + feature;
+              int32_t const in_val =
+                  static_cast<int32_t>(LoadData()(input_data, input_offset)) -
+                  q_.input_zero_point;
+              int32_t const fil_val =
+                  static_cast<int32_t>(LoadData()(filter_data, filter_offset)) -
+                  q_.filter_zero_point;
+              acc += in_val * fil_val;
+            }
+          }  // col loop
+        }
+      }  // row loop
+
+      auto const scale = LoadScale()(scale_accessor_.get_pointer(), feature);
+      auto const zero_point =
+          LoadInt()(zero_point_accessor_.get_pointer(), feature);
+      auto output_data = output_accessor_.get_pointer();
+      Store()(output_data, index,
+              quantize::internal::requantize(acc, scale, zero_point,
+                                             q_.activation_min,
+                                             q_.activation_max));
+    }
+  }
+
+ private:
+  Index const n_elems_;
+  Index const features_;
+  DepthwiseConv2DParams const p_;
+  quantize::RequantizeParams const q_;
+  ReadAccessor<int8_t const> const input_accessor_;
+  ReadAccessor<int8_t const> const filter_accessor_;
+  ReadAccessor<int32_t const> const bias_accessor_;
+  ReadAccessor<float const> const scale_accessor_;
+  ReadAccessor<int32_t const> const zero_point_accessor_;
+  WriteAccessor<int8_t> output_accessor_;
+};
+
+}  // namespace internal
+}  // namespace depthwise_conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_DEPTHWISE_CONV2D_QUANTIZED_KERNELS_H_
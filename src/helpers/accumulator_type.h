@@ -0,0 +1,91 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_HELPERS_ACCUMULATOR_TYPE_H_
+#define SYCLDNN_SRC_HELPERS_ACCUMULATOR_TYPE_H_
+
+#include "sycldnn/helpers/macros.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace helpers {
+/**
+ * Data type used to accumulate values of type T in a kernel.
+ *
+ * Half precision tensors are stored as half, but long sums of half values lose
+ * precision quickly, so they are accumulated in single precision.
+ */
+template <typename T>
+struct AccumulatorType {
+  using type = T;
+};
+#ifdef SNN_USE_HALF
+/** Accumulate half precision values in single precision. */
+template <>
+struct AccumulatorType<cl::sycl::half> {
+  using type = float;
+};
+#endif  // SNN_USE_HALF
+
+/** Accumulator type for SYCL vectors, accumulating each element. */
+template <typename T, int N>
+struct AccumulatorType<cl::sycl::vec<T, N>> {
+  using type = cl::sycl::vec<typename AccumulatorType<T>::type, N>;
+};
+
+namespace internal {
+
+/** Convert a scalar value to another scalar type. */
+template <typename To, typename From>
+struct Convert {
+  static To SNN_ALWAYS_INLINE apply(From const& value) {
+    return static_cast<To>(value);
+  }
+};
+
+/** Convert each element of a SYCL vector to a different element type. */
+template <typename To, typename From, int N>
+struct Convert<cl::sycl::vec<To, N>, cl::sycl::vec<From, N>> {
+  static cl::sycl::vec<To, N> SNN_ALWAYS_INLINE
+  apply(cl::sycl::vec<From, N> const& value) {
+    return value.template convert<To>();
+  }
+};
+
+/** No conversion is needed when the types already match. */
+template <typename T, int N>
+struct Convert<cl::sycl::vec<T, N>, cl::sycl::vec<T, N>> {
+  static cl::sycl::vec<T, N> SNN_ALWAYS_INLINE
+  apply(cl::sycl::vec<T, N> const& value) {
+    return value;
+  }
+};
+
+}  // namespace internal
+
+/**
+ * Convert a scalar or SYCL vector to a type with the same number of elements
+ * but a different element type, such as between a storage type and its
+ * accumulator type.
+ */
+template <typename To, typename From>
+inline SNN_ALWAYS_INLINE To convert(From const& value) {
+  return internal::Convert<To, From>::apply(value);
+}
+
+}  // namespace helpers
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_HELPERS_ACCUMULATOR_TYPE_H_
@@ -18,6 +18,8 @@
 
 #include "sycldnn/helpers/macros.h"
 
+#include <cstdint>
+
 #include <CL/sycl.hpp>
 
 namespace sycldnn {
@@ -50,6 +52,22 @@ inline SNN_ALWAYS_INLINE cl::sycl::vec<T, Dim> mad(
   return cl::sycl::mad(a, b, c);
 }
 
+/**
+ * SYCL only provides mad() for floating point types, so int32 accumulators, as
+ * used in quantized kernels, use a separate multiply and add.
+ */
+inline SNN_ALWAYS_INLINE int32_t mad(int32_t a, int32_t b, int32_t c) {
+  return a * b + c;
+}
+
+/** Overload for int32 vectors, which have no mad() function. */
+template <int Dim>
+inline SNN_ALWAYS_INLINE cl::sycl::vec<int32_t, Dim> mad(
+    cl::sycl::vec<int32_t, Dim> const& a, cl::sycl::vec<int32_t, Dim> const& b,
+    cl::sycl::vec<int32_t, Dim> const& c) {
+  return a * b + c;
+}
+
 template <typename T>
 inline SNN_ALWAYS_INLINE T dot(T a, T b) {
   return a * b;
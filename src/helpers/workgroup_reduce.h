@@ -59,6 +59,27 @@ struct Sum {
   }
 };
 
+struct Max {
+  template <typename T>
+  SNN_ALWAYS_INLINE T operator()(T lhs, T rhs) {
+    return cl::sycl::max(lhs, rhs);
+  }
+};
+
+struct Min {
+  template <typename T>
+  SNN_ALWAYS_INLINE T operator()(T lhs, T rhs) {
+    return cl::sycl::min(lhs, rhs);
+  }
+};
+
+struct Product {
+  template <typename T>
+  SNN_ALWAYS_INLINE T operator()(T lhs, T rhs) {
+    return lhs * rhs;
+  }
+};
+
 /**
  * Reduce a value across the workgroup.
  *
@@ -114,6 +135,23 @@ workgroup_reduce(DataType value, cl::sycl::nd_item<Dimensions> item,
   return value;
 }
 
+/**
+ * Broadcast a value from the first work item to the whole workgroup, using
+ * the first element of the local workspace.
+ */
+template <typename T, cl::sycl::access::address_space Space>
+inline SNN_ALWAYS_INLINE T broadcast_from_first(
+    T value, cl::sycl::nd_item<1> item,
+    cl::sycl::multi_ptr<T, Space> workspace) {
+  if (item.get_local_id(0) == 0) {
+    workspace[0] = value;
+  }
+  item.barrier(cl::sycl::access::fence_space::local_space);
+  value = workspace[0];
+  item.barrier(cl::sycl::access::fence_space::local_space);
+  return value;
+}
+
 }  // namespace reduce
 }  // namespace helpers
 }  // namespace sycldnn
@@ -16,6 +16,7 @@
 #ifndef SYCLDNN_SRC_MATMUL_BLOCKS_H_
 #define SYCLDNN_SRC_MATMUL_BLOCKS_H_
 
+#include "src/helpers/accumulator_type.h"
 #include "src/helpers/math.h"
 #include "src/helpers/register_tile.h"
 #include "src/helpers/vector_element.h"
@@ -147,6 +148,21 @@ load(cl::sycl::multi_ptr<T const, Space> input, Index ld) {
   return output;
 }
 
+/**
+ * Convert each element of a block to a different data type, such as between
+ * the storage type and the accumulator type.
+ */
+template <typename U, typename T, int Rows, int Cols>
+static VectorBlock<U, Rows, Cols> SNN_ALWAYS_INLINE
+convert_block(VectorBlock<T, Rows, Cols> const& input) {
+  using VectorType = typename VectorBlock<U, Rows, Cols>::VectorType;
+  VectorBlock<U, Rows, Cols> output;
+  for (int row = 0; row < Rows; ++row) {
+    output.data(row) = helpers::convert<VectorType>(input.data(row));
+  }
+  return output;
+}
+
 template <typename T, int Rows, int Cols>
 static void SNN_ALWAYS_INLINE scalar_multiply(VectorBlock<T, Rows, Cols>& block,
                                               T val) {
@@ -157,6 +173,26 @@ static void SNN_ALWAYS_INLINE scalar_multiply(VectorBlock<T, Rows, Cols>& block,
   }
 }
 
+/**
+ * Subtract a scalar from each element of a block which lies inside both masks,
+ * and set the elements outside the masks to zero. Quantized kernels use this
+ * to remove the zero point from each value, so that values outside the
+ * matrices contribute nothing to the accumulator.
+ */
+template <int Rows, int Cols, typename T>
+static void SNN_ALWAYS_INLINE masked_scalar_subtract(
+    VectorBlock<T, Rows, Cols>& block, T val, std::array<bool, Rows> row_mask,
+    std::array<bool, Cols> col_mask) {
+  namespace vec_elem = helpers::vector_element;
+  for (int row = 0; row < Rows; ++row) {
+    for (int col = 0; col < Cols; ++col) {
+      T const elem = vec_elem::get(block.data(row), col);
+      vec_elem::set(block.data(row), col,
+                    row_mask[row] && col_mask[col] ? elem - val : T{0});
+    }
+  }
+}
+
 template <typename T, int Rows, int Cols, int Acc>
 static void SNN_ALWAYS_INLINE block_mmacc(
     VectorBlock<T, Rows, Acc> const& lhs, VectorBlock<T, Acc, Cols> const& rhs,
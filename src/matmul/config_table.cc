@@ -0,0 +1,139 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/matmul/config_table.h"
+
+#include "sycldnn/matmul/config.h"
+
+#include "sycldnn/internal/helpers/device_file_name.h"
+#include "sycldnn/internal/matmul/launch.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/export.h"
+
+/**
+ * \file
+ * Implementation of the persistent matmul configuration table.
+ *
+ * Each line of a table file holds one entry, formed of a key describing the
+ * transposes and matrix sizes followed by the six values of the configuration.
+ */
+
+namespace {
+
+char const* const table_header = "# SYCL-DNN matmul config table v1";
+
+std::string make_key(bool transpose_lhs, bool transpose_rhs, int batches,
+                     int m, int k, int n) {
+  std::ostringstream key;
+  key << transpose_lhs << transpose_rhs << ':' << batches << ',' << m << ','
+      << k << ',' << n;
+  return key.str();
+}
+
+}  // namespace
+
+namespace sycldnn {
+namespace matmul {
+
+MatmulConfigTable::MatmulConfigTable(std::string file_path)
+    : file_path_{std::move(file_path)} {
+  load();
+}
+
+bool MatmulConfigTable::lookup(bool transpose_lhs, bool transpose_rhs,
+                               int batches, int m, int k, int n,
+                               MatmulConfig& config) const {
+  auto it =
+      entries_.find(make_key(transpose_lhs, transpose_rhs, batches, m, k, n));
+  if (it == entries_.end()) {
+    return false;
+  }
+  config = it->second;
+  return true;
+}
+
+void MatmulConfigTable::insert(bool transpose_lhs, bool transpose_rhs,
+                               int batches, int m, int k, int n,
+                               MatmulConfig const& config) {
+  entries_[make_key(transpose_lhs, transpose_rhs, batches, m, k, n)] = config;
+}
+
+MatmulConfig MatmulConfigTable::select(bool transpose_lhs, bool transpose_rhs,
+                                       int batches, int m, int k,
+                                       int n) const {
+  MatmulConfig config;
+  if (lookup(transpose_lhs, transpose_rhs, batches, m, k, n, config)) {
+    return config;
+  }
+  return internal::get_default_config(batches, m, k, n);
+}
+
+void MatmulConfigTable::load() {
+  if (file_path_.empty()) {
+    return;
+  }
+  std::ifstream file{file_path_};
+  if (!file) {
+    return;
+  }
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream entry{line};
+    std::string key;
+    MatmulConfig config;
+    // Skip any malformed entries, they will fall back to the heuristic.
+    if (entry >> key >> config.row_tile >> config.acc_tile >>
+        config.col_tile >> config.wg_rows >> config.wg_cols >>
+        config.wg_batch) {
+      entries_[key] = config;
+    }
+  }
+}
+
+bool MatmulConfigTable::save() const {
+  if (file_path_.empty()) {
+    return false;
+  }
+  std::ofstream file{file_path_, std::ios::trunc};
+  if (!file) {
+    return false;
+  }
+  file << table_header << '\n';
+  for (auto const& entry : entries_) {
+    auto const& config = entry.second;
+    file << entry.first << ' ' << config.row_tile << ' ' << config.acc_tile
+         << ' ' << config.col_tile << ' ' << config.wg_rows << ' '
+         << config.wg_cols << ' ' << config.wg_batch << '\n';
+  }
+  return static_cast<bool>(file);
+}
+
+std::string MatmulConfigTable::file_name_for(cl::sycl::device const& device) {
+  return sycldnn::internal::helpers::device_file_name("snn_matmul", device,
+                                                      ".tuning");
+}
+
+}  // namespace matmul
+}  // namespace sycldnn
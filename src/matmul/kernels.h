@@ -19,13 +19,24 @@
 #include "sycldnn/accessor_types.h"
 #include "sycldnn/status.h"
 
+#include "src/helpers/accumulator_type.h"
+
 #include "src/matmul/blocks.h"
 
 namespace sycldnn {
 namespace matmul {
+/**
+ * Batched matrix multiply kernel.
+ *
+ * The tiles are loaded from memory as T, but the products are accumulated in
+ * the accumulator type of T, so half precision matrices are multiplied with
+ * single precision accumulation and only rounded to half when stored.
+ */
 template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
           int RowTile, int AccTile, int ColTile, bool CheckBounds>
 struct MatmulKernel {
+  using Acc = typename helpers::AccumulatorType<T>::type;
+
   MatmulKernel(ReadAccessor<T const> const& lhs,
                ReadAccessor<T const> const& rhs,
                ReadWriteAccessor<T> const& output, Index batches, Index m,
@@ -44,7 +55,9 @@ struct MatmulKernel {
     Index row = item.get_global_id(1) * RowTile;
     Index col = item.get_global_id(2) * ColTile;
 
-    if (row < m_ && col < n_) {
+    // The batch dimension is rounded up to a multiple of the work-group size,
+    // so may extend past the number of batches.
+    if (batch < batches_ && row < m_ && col < n_) {
       auto lhs_ptr = lhs_.get_pointer() + batch * m_ * k_;
       auto rhs_ptr = rhs_.get_pointer() + batch * k_ * n_;
       auto out_ptr = output_.get_pointer() + batch * m_ * n_;
@@ -73,7 +86,7 @@ struct MatmulKernel {
       bool const internal_row_block = valid_row[RowTile - 1];
       bool const internal_col_block = valid_col[ColTile - 1];
 
-      auto out_block = VectorBlock<T, RowTile, ColTile>{};
+      auto out_block = VectorBlock<Acc, RowTile, ColTile>{};
       if (beta_ != static_cast<T>(0)) {
         // Convert out_ptr from multi_ptr<T> to multi_ptr<T const>
         auto const_out_ptr =
@@ -81,18 +94,18 @@ struct MatmulKernel {
                                 cl::sycl::access::address_space::global_space>{
                 out_ptr.get()};
 
-        out_block = load_block<RowTile, ColTile>(const_out_ptr, n_, valid_row,
-                                                 valid_col);
-        scalar_multiply(out_block, beta_);
+        out_block = convert_block<Acc>(load_block<RowTile, ColTile>(
+            const_out_ptr, n_, valid_row, valid_col));
+        scalar_multiply(out_block, static_cast<Acc>(beta_));
       }
       Index acc_idx = 0;
 
       if (!CheckBounds || (internal_row_block && internal_col_block)) {
         for (; acc_idx < k_ - AccTile + 1; acc_idx += AccTile) {
-          auto lhs_block =
-              load<RowTile, AccTile, TransposeLHS>(lhs_ptr, lhs_ld);
-          auto rhs_block =
-              load<AccTile, ColTile, TransposeRHS>(rhs_ptr, rhs_ld);
+          auto lhs_block = convert_block<Acc>(
+              load<RowTile, AccTile, TransposeLHS>(lhs_ptr, lhs_ld));
+          auto rhs_block = convert_block<Acc>(
+              load<AccTile, ColTile, TransposeRHS>(rhs_ptr, rhs_ld));
           block_mmacc(lhs_block, rhs_block, out_block);
           lhs_ptr += lhs_step;
           rhs_ptr += rhs_step;
@@ -102,10 +115,12 @@ struct MatmulKernel {
       if (CheckBounds) {
         auto accumulate_block =
             [&](std::array<bool, AccTile> const& valid_acc) {
-              auto lhs_block = load<RowTile, AccTile, TransposeLHS>(
-                  lhs_ptr, lhs_ld, valid_row, valid_acc);
-              auto rhs_block = load<AccTile, ColTile, TransposeRHS>(
-                  rhs_ptr, rhs_ld, valid_acc, valid_col);
+              auto lhs_block =
+                  convert_block<Acc>(load<RowTile, AccTile, TransposeLHS>(
+                      lhs_ptr, lhs_ld, valid_row, valid_acc));
+              auto rhs_block =
+                  convert_block<Acc>(load<AccTile, ColTile, TransposeRHS>(
+                      rhs_ptr, rhs_ld, valid_acc, valid_col));
               block_mmacc(lhs_block, rhs_block, out_block);
               lhs_ptr += lhs_step;
               rhs_ptr += rhs_step;
@@ -126,9 +141,10 @@ struct MatmulKernel {
         }
       }
 
+      auto const result = convert_block<T>(out_block);
       (!CheckBounds || (internal_row_block && internal_col_block))
-          ? store_block<RowTile, ColTile>(out_block, out_ptr, out_ld)
-          : store_block<RowTile, ColTile>(out_block, out_ptr, out_ld, valid_row,
+          ? store_block<RowTile, ColTile>(result, out_ptr, out_ld)
+          : store_block<RowTile, ColTile>(result, out_ptr, out_ld, valid_row,
                                           valid_col);
     }
   }
@@ -17,7 +17,16 @@
 
 #include "sycldnn/mem_object.h"
 
+#include "sycldnn/helpers/macros.h"
+#include "sycldnn/helpers/ratio.h"
+#include "sycldnn/matmul/config.h"
+
 #include "src/matmul/queue_kernel.h"
+#include "src/matmul/queue_local_mem_kernel.h"
+#include "src/matmul/queue_split_k_kernel.h"
+
+#include <algorithm>
+#include <vector>
 
 namespace sycldnn {
 namespace matmul {
@@ -41,6 +50,59 @@ SNNStatus launch_with_tiles(BaseMemObject<T const>& lhs,
                 wg_cols, wg_batch);
 }
 
+/**
+ * The tile sizes compiled into the library, given as (row_tile, acc_tile,
+ * col_tile). Each entry must also be instantiated in src/matmul/CMakeLists.txt.
+ */
+#define MATMUL_TILE_MENU(MACRO) \
+  MACRO(1, 1, 1)                \
+  MACRO(1, 4, 4)                \
+  MACRO(4, 4, 1)                \
+  MACRO(2, 4, 2)                \
+  MACRO(4, 4, 4)                \
+  MACRO(4, 8, 4)                \
+  MACRO(8, 4, 8)
+
+/** The work-group shapes used with each tile size, as (rows, cols, batch). */
+#define MATMUL_WORKGROUP_MENU(MACRO) \
+  MACRO(8, 4, 1)                     \
+  MACRO(8, 8, 1)                     \
+  MACRO(16, 16, 1)                   \
+  MACRO(1, 64, 1)                    \
+  MACRO(64, 1, 1)                    \
+  MACRO(1, 1, 64)
+
+// The tile sizes and work-group shape used by the local memory kernel. These
+// must match the values instantiated in src/matmul/CMakeLists.txt.
+constexpr int local_mem_row_tile = 4;
+constexpr int local_mem_col_tile = 4;
+constexpr int local_mem_wg_rows = 8;
+constexpr int local_mem_wg_cols = 8;
+constexpr int local_mem_acc_tile = 16;
+
+// The number of elements of local memory required by the local memory kernel,
+// matching LocalMemMatmulKernel::LocalSize.
+constexpr size_t local_mem_elements =
+    2 * (local_mem_wg_rows * local_mem_row_tile * local_mem_acc_tile +
+         local_mem_acc_tile * local_mem_wg_cols * local_mem_col_tile);
+
+// Check whether the device can run the local memory kernel.
+template <typename T>
+bool device_supports_local_mem_kernel(cl::sycl::device const& device) {
+  size_t const max_wg_size =
+      device.get_info<cl::sycl::info::device::max_work_group_size>();
+  size_t const local_mem_size =
+      device.get_info<cl::sycl::info::device::local_mem_size>();
+  return max_wg_size >= local_mem_wg_rows * local_mem_wg_cols &&
+         local_mem_size >= local_mem_elements * sizeof(T);
+}
+
+// The tile sizes used by the split-K kernel. These must match the values
+// instantiated in src/matmul/CMakeLists.txt.
+constexpr int split_k_row_tile = 4;
+constexpr int split_k_acc_tile = 4;
+constexpr int split_k_col_tile = 4;
+
 }  // namespace
 
 // Launch the matrix multiply kernel for the passed parameters.
@@ -48,21 +110,187 @@ template <typename T, bool TransposeLHS, bool TransposeRHS>
 SNNStatus launch(BaseMemObject<T const>& lhs, BaseMemObject<T const>& rhs,
                  BaseMemObject<T>& output, int batches, int m, int k, int n,
                  T beta, cl::sycl::queue& queue) {
-  return launch_with_tiles<T, TransposeLHS, TransposeRHS, 4, 4, 4>(
-      lhs, rhs, output, batches, m, k, n, beta, queue, 8, 4, 1);
+  auto const config = get_default_config(batches, m, k, n);
+  return launch<T, TransposeLHS, TransposeRHS>(lhs, rhs, output, batches, m, k,
+                                               n, beta, config, queue);
 }
 
+// Launch the matrix multiply kernel using the given tile sizes.
+template <typename T, bool TransposeLHS, bool TransposeRHS>
+SNNStatus launch(BaseMemObject<T const>& lhs, BaseMemObject<T const>& rhs,
+                 BaseMemObject<T>& output, int batches, int m, int k, int n,
+                 T beta, MatmulConfig const& config, cl::sycl::queue& queue) {
+  size_t const wg_rows = config.wg_rows;
+  size_t const wg_cols = config.wg_cols;
+  size_t const wg_batch = config.wg_batch;
+#define LAUNCH_IF_MATCH(tile_row, tile_acc, tile_col)                         \
+  if (config.row_tile == tile_row && config.acc_tile == tile_acc &&           \
+      config.col_tile == tile_col) {                                          \
+    return launch_with_tiles<T, TransposeLHS, TransposeRHS, tile_row,         \
+                             tile_acc, tile_col>(lhs, rhs, output, batches, m, \
+                                                 k, n, beta, queue, wg_rows,   \
+                                                 wg_cols, wg_batch);           \
+  }
+
+  MATMUL_TILE_MENU(LAUNCH_IF_MATCH)
+
+#undef LAUNCH_IF_MATCH
+
+  return StatusCode::InvalidAlgorithm;
+}
+
+std::vector<MatmulConfig> get_configs() {
+  std::vector<MatmulConfig> configs;
+#define ADD_WORKGROUP(wg_rows, wg_cols, wg_batch) \
+  configs.push_back(                              \
+      MatmulConfig{row_tile, acc_tile, col_tile, wg_rows, wg_cols, wg_batch});
+#define ADD_TILE(tile_row, tile_acc, tile_col) \
+  {                                            \
+    int const row_tile = tile_row;             \
+    int const acc_tile = tile_acc;             \
+    int const col_tile = tile_col;             \
+    MATMUL_WORKGROUP_MENU(ADD_WORKGROUP)       \
+  }
+
+  MATMUL_TILE_MENU(ADD_TILE)
+
+#undef ADD_TILE
+#undef ADD_WORKGROUP
+  return configs;
+}
+
+MatmulConfig get_default_config(int batches, int m, int k, int n) {
+  SNN_UNUSED_VAR(batches)
+  // Very small matrices are best spread across the batch dimension, with each
+  // work item computing a single output value.
+  if (m < 4 && n < 4) {
+    return MatmulConfig{1, 1, 1, 1, 1, 64};
+  }
+  // Skinny matrices, such as a fully connected layer with a batch of one,
+  // have too few rows (or columns) to fill a tile, so spread the work-group
+  // along the other dimension.
+  if (m < 4) {
+    return MatmulConfig{1, 4, 4, 1, 64, 1};
+  }
+  if (n < 4) {
+    return MatmulConfig{4, 4, 1, 64, 1, 1};
+  }
+  int const min_dim = std::min(m, n);
+  if (min_dim < 32) {
+    return MatmulConfig{2, 4, 2, 8, 8, 1};
+  }
+  // Larger tiles give more reuse of loaded values, but reduce the number of
+  // work items, so are only used when the output is large enough to keep the
+  // device busy.
+  if (min_dim >= 1024 && k >= 64) {
+    return MatmulConfig{8, 4, 8, 8, 8, 1};
+  }
+  if (min_dim >= 256 && k >= 64) {
+    return MatmulConfig{4, 8, 4, 8, 8, 1};
+  }
+  return MatmulConfig{4, 4, 4, 8, 4, 1};
+}
+
+// Launch the matrix multiply kernel which stages panels in local memory.
+template <typename T, bool TransposeLHS, bool TransposeRHS>
+SNNStatus launch_local_mem(BaseMemObject<T const>& lhs,
+                           BaseMemObject<T const>& rhs,
+                           BaseMemObject<T>& output, int batches, int m, int k,
+                           int n, T beta, cl::sycl::queue& queue) {
+  if (!device_supports_local_mem_kernel<T>(queue.get_device())) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  return queue_local_mem_kernel<T, int, TransposeLHS, TransposeRHS,
+                                local_mem_row_tile, local_mem_col_tile,
+                                local_mem_wg_rows, local_mem_wg_cols,
+                                local_mem_acc_tile>(lhs, rhs, output, batches,
+                                                    m, k, n, beta, queue);
+}
+
+template <typename T>
+bool use_local_mem_kernel(cl::sycl::device const& device, int batches, int m,
+                          int k, int n) {
+  SNN_UNUSED_VAR(batches)
+  // Devices without dedicated local memory emulate it in global memory, so
+  // staging the panels only adds extra copies and barriers.
+  cl::sycl::info::local_mem_type const local_mem_type =
+      device.get_info<cl::sycl::info::device::local_mem_type>();
+  if (local_mem_type != cl::sycl::info::local_mem_type::local ||
+      !device_supports_local_mem_kernel<T>(device)) {
+    return false;
+  }
+  // Each work-group computes a 32x32 block of the output from panels of 16
+  // values, so smaller matrices leave most of the work-group idle.
+  int const block_rows = local_mem_wg_rows * local_mem_row_tile;
+  int const block_cols = local_mem_wg_cols * local_mem_col_tile;
+  return m >= block_rows && n >= block_cols && k >= local_mem_acc_tile;
+}
+
+// Launch the split-K kernel followed by the sum over the slices.
+template <typename T, bool TransposeLHS, bool TransposeRHS>
+SNNStatus launch_split_k(
+    BaseMemObject<T const>& lhs, BaseMemObject<T const>& rhs,
+    BaseMemObject<T>& output,
+    BaseMemObject<typename PartialType<T>::type>& workspace, int batches,
+    int m, int k, int n, int n_splits, T beta, cl::sycl::queue& queue) {
+  if (n_splits == 1) {
+    return launch<T, TransposeLHS, TransposeRHS>(lhs, rhs, output, batches, m,
+                                                 k, n, beta, queue);
+  }
+  return queue_split_k_kernel<T, int, TransposeLHS, TransposeRHS,
+                              split_k_row_tile, split_k_acc_tile,
+                              split_k_col_tile>(lhs, rhs, output, workspace,
+                                                batches, m, k, n, n_splits,
+                                                beta, queue);
+}
+
+int get_split_k_count(int batches, int m, int k, int n) {
+  // Enough work items to occupy a large device, and the minimum number of
+  // accumulation values each slice should handle so that the extra workspace
+  // traffic and reduction remain small compared to the matrix multiply.
+  constexpr int target_threads = 16384;
+  constexpr int min_split_size = 256;
+  constexpr int max_splits = 64;
+  int const output_threads =
+      batches * helpers::round_ratio_up_above_zero(m, split_k_row_tile) *
+      helpers::round_ratio_up_above_zero(n, split_k_col_tile);
+  if (output_threads >= target_threads / 4 || k < 2 * min_split_size) {
+    return 1;
+  }
+  int const n_splits = std::min({target_threads / output_threads,
+                                 k / min_split_size, max_splits});
+  return std::max(n_splits, 1);
+}
+
+#undef MATMUL_WORKGROUP_MENU
+#undef MATMUL_TILE_MENU
+
 #define INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS)                                \
   template SNN_EXPORT SNNStatus launch<DTYPE, TLHS, TRHS>(                     \
       BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE const> & filter, \
       BaseMemObject<DTYPE> & output, int batches, int m, int k, int n,         \
-      DTYPE beta, cl::sycl::queue& queue);
+      DTYPE beta, cl::sycl::queue& queue);                                     \
+  template SNN_EXPORT SNNStatus launch<DTYPE, TLHS, TRHS>(                     \
+      BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE const> & filter, \
+      BaseMemObject<DTYPE> & output, int batches, int m, int k, int n,         \
+      DTYPE beta, MatmulConfig const& config, cl::sycl::queue& queue);         \
+  template SNN_EXPORT SNNStatus launch_local_mem<DTYPE, TLHS, TRHS>(           \
+      BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE const> & filter, \
+      BaseMemObject<DTYPE> & output, int batches, int m, int k, int n,         \
+      DTYPE beta, cl::sycl::queue& queue);                                     \
+  template SNN_EXPORT SNNStatus launch_split_k<DTYPE, TLHS, TRHS>(             \
+      BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE const> & filter, \
+      BaseMemObject<DTYPE> & output,                                           \
+      BaseMemObject<PartialType<DTYPE>::type> & workspace, int batches, int m, \
+      int k, int n, int n_splits, DTYPE beta, cl::sycl::queue& queue);
 
-#define INSTANTIATE_FOR_TYPE(DTYPE)        \
-  INSTANTIATE_LAUNCHER(DTYPE, true, true)  \
-  INSTANTIATE_LAUNCHER(DTYPE, false, true) \
-  INSTANTIATE_LAUNCHER(DTYPE, true, false) \
-  INSTANTIATE_LAUNCHER(DTYPE, false, false)
+#define INSTANTIATE_FOR_TYPE(DTYPE)                     \
+  INSTANTIATE_LAUNCHER(DTYPE, true, true)               \
+  INSTANTIATE_LAUNCHER(DTYPE, false, true)              \
+  INSTANTIATE_LAUNCHER(DTYPE, true, false)              \
+  INSTANTIATE_LAUNCHER(DTYPE, false, false)             \
+  template SNN_EXPORT bool use_local_mem_kernel<DTYPE>( \
+      cl::sycl::device const& device, int batches, int m, int k, int n);
 
 INSTANTIATE_FOR_TYPE(float);
 
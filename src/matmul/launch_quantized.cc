@@ -0,0 +1,105 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/helpers/macros.h"
+#include "sycldnn/helpers/ratio.h"
+
+#include "sycldnn/quantize/params.h"
+
+#include "sycldnn/internal/matmul/launch.h"
+
+#include "src/matmul/quantized_kernels.h"
+#include "src/quantize/requantize.h"
+
+#include <CL/sycl.hpp>
+
+#include <stddef.h>
+#include <cstdint>
+#include <limits>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+template <bool TransposeLHS, bool TransposeRHS>
+SNNStatus launch_quantized(
+    BaseMemObject<int8_t const>& lhs, BaseMemObject<int8_t const>& rhs,
+    BaseMemObject<int32_t const>& bias, BaseMemObject<float const>& scales,
+    BaseMemObject<int32_t const>& zero_points, BaseMemObject<int8_t>& output,
+    int batches, int m, int k, int n,
+    quantize::RequantizeParams const& requantize_params,
+    cl::sycl::queue& queue) {
+  SNN_VALIDATE_PARAM(k <= quantize::internal::max_accumulation_size,
+                     "The int32 accumulators can overflow for k above 2^15.");
+  size_t const lhs_size = static_cast<size_t>(batches) * m * k;
+  size_t const rhs_size = static_cast<size_t>(batches) * k * n;
+  size_t const out_size = static_cast<size_t>(batches) * m * n;
+  size_t const max_index = std::numeric_limits<int32_t>::max();
+  if (lhs_size > max_index || rhs_size > max_index || out_size > max_index) {
+    return StatusCode::IndexExceeded;
+  }
+  constexpr int RowTile = 4;
+  constexpr int AccTile = 4;
+  constexpr int ColTile = 4;
+  using Kernel = QuantizedMatmulKernel<int32_t, TransposeLHS, TransposeRHS,
+                                       RowTile, AccTile, ColTile>;
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto lhs_acc = lhs.read_accessor(cgh);
+    auto rhs_acc = rhs.read_accessor(cgh);
+    auto bias_acc = bias.read_accessor(cgh);
+    auto scale_acc = scales.read_accessor(cgh);
+    auto zero_point_acc = zero_points.read_accessor(cgh);
+    auto out_acc = output.write_accessor(cgh);
+
+    Kernel kernel(lhs_acc, rhs_acc, bias_acc, scale_acc, zero_point_acc,
+                  out_acc, m, k, n, requantize_params);
+    size_t const n_row_threads = helpers::round_ratio_up(m, RowTile);
+    size_t const n_col_threads = helpers::round_ratio_up(n, ColTile);
+
+    cgh.parallel_for(
+        cl::sycl::range<3>{static_cast<size_t>(batches), n_row_threads,
+                           n_col_threads},
+        kernel);
+  });
+
+  return {event, StatusCode::OK};
+}
+
+#define INSTANTIATE_LAUNCHER(TRANS_LHS, TRANS_RHS)                          \
+  template SNN_EXPORT SNNStatus launch_quantized<TRANS_LHS, TRANS_RHS>(     \
+      BaseMemObject<int8_t const> & lhs, BaseMemObject<int8_t const> & rhs, \
+      BaseMemObject<int32_t const> & bias,                                  \
+      BaseMemObject<float const> & scales,                                  \
+      BaseMemObject<int32_t const> & zero_points,                           \
+      BaseMemObject<int8_t> & output, int batches, int m, int k, int n,     \
+      quantize::RequantizeParams const& requantize_params,                  \
+      cl::sycl::queue& queue)
+
+INSTANTIATE_LAUNCHER(false, false);
+INSTANTIATE_LAUNCHER(true, false);
+INSTANTIATE_LAUNCHER(false, true);
+INSTANTIATE_LAUNCHER(true, true);
+
+#undef INSTANTIATE_LAUNCHER
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
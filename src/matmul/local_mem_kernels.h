@@ -0,0 +1,222 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_LOCAL_MEM_KERNELS_H_
+#define SYCLDNN_SRC_MATMUL_LOCAL_MEM_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/helpers/macros.h"
+#include "sycldnn/helpers/ratio.h"
+
+#include "src/helpers/accumulator_type.h"
+#include "src/helpers/math.h"
+#include "src/helpers/vector_io.h"
+
+namespace sycldnn {
+namespace matmul {
+
+/**
+ * Matrix multiply kernel which stages panels of the LHS and RHS matrices in
+ * local memory.
+ *
+ * Each work-group computes a [WgRows * RowTile, WgCols * ColTile] block of the
+ * output. The accumulation dimension is split into panels of AccTile values,
+ * and for each panel the work-group cooperatively loads the required LHS and
+ * RHS values into local memory, so that every value is read from global
+ * memory once per work-group rather than once per work item.
+ *
+ * The local memory holds two sets of panels, so that the next panel can be
+ * loaded while the current panel is used, requiring only a single barrier per
+ * panel.
+ *
+ * Each work item computes RowTile x ColTile outputs strided by the work-group
+ * size, so that neighbouring work items access neighbouring local and global
+ * memory addresses.
+ *
+ * The panels are held in local memory as T, and converted to the accumulator
+ * type of T when they are multiplied.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int ColTile, int WgRows, int WgCols, int AccTile>
+struct LocalMemMatmulKernel {
+  /** The number of output rows computed by each work-group. */
+  static constexpr int BlockRows = WgRows * RowTile;
+  /** The number of output columns computed by each work-group. */
+  static constexpr int BlockCols = WgCols * ColTile;
+  /** The number of LHS values in each panel. */
+  static constexpr int LhsPanelSize = BlockRows * AccTile;
+  /** The number of RHS values in each panel. */
+  static constexpr int RhsPanelSize = AccTile * BlockCols;
+  /** The number of values in one set of LHS and RHS panels. */
+  static constexpr int PanelSize = LhsPanelSize + RhsPanelSize;
+  /** The number of work items in each work-group. */
+  static constexpr int WorkgroupSize = WgRows * WgCols;
+  /** The number of local memory elements required by each work-group. */
+  static constexpr int LocalSize = 2 * PanelSize;
+  /** The type used to accumulate the output values. */
+  using Acc = typename helpers::AccumulatorType<T>::type;
+
+  LocalMemMatmulKernel(ReadAccessor<T const> const& lhs,
+                       ReadAccessor<T const> const& rhs,
+                       ReadWriteAccessor<T> const& output,
+                       LocalAccessor<T> const& local, Index m, Index k,
+                       Index n, T beta)
+      : lhs_{lhs},
+        rhs_{rhs},
+        output_{output},
+        local_{local},
+        m_{m},
+        k_{k},
+        n_{n},
+        beta_{beta} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<3> item) {
+    Index const batch = item.get_group(0);
+    Index const block_row = item.get_group(1) * BlockRows;
+    Index const block_col = item.get_group(2) * BlockCols;
+    Index const local_row = item.get_local_id(1);
+    Index const local_col = item.get_local_id(2);
+    Index const local_idx = local_row * WgCols + local_col;
+
+    auto lhs_ptr = lhs_.get_pointer() + batch * m_ * k_;
+    auto rhs_ptr = rhs_.get_pointer() + batch * k_ * n_;
+    auto out_ptr = output_.get_pointer() + batch * m_ * n_;
+
+    Acc out_block[RowTile][ColTile];
+    for (int i = 0; i < RowTile; ++i) {
+      for (int j = 0; j < ColTile; ++j) {
+        out_block[i][j] = Acc{0};
+      }
+    }
+
+    Index const n_panels = helpers::round_ratio_up_above_zero(k_, AccTile);
+    load_panels(lhs_ptr, rhs_ptr, 0, block_row, block_col, 0, local_idx);
+    item.barrier(cl::sycl::access::fence_space::local_space);
+
+    for (Index panel = 0; panel < n_panels; ++panel) {
+      Index const current = (panel % 2) * PanelSize;
+      if (panel + 1 < n_panels) {
+        // The other set of panels was last read before the barrier at the end
+        // of the previous iteration, so can safely be overwritten here.
+        Index const next = ((panel + 1) % 2) * PanelSize;
+        load_panels(lhs_ptr, rhs_ptr, next, block_row, block_col,
+                    (panel + 1) * AccTile, local_idx);
+      }
+      accumulate_panels(current, local_row, local_col, out_block);
+      item.barrier(cl::sycl::access::fence_space::local_space);
+    }
+
+    using Load = helpers::io::Load<T>;
+    using Store = helpers::io::Store<T>;
+    for (int i = 0; i < RowTile; ++i) {
+      Index const row = block_row + local_row + i * WgRows;
+      if (row < m_) {
+        for (int j = 0; j < ColTile; ++j) {
+          Index const col = block_col + local_col + j * WgCols;
+          if (col < n_) {
+            Index const out_idx = row * n_ + col;
+            Acc value = out_block[i][j];
+            if (beta_ != static_cast<T>(0)) {
+              value = helpers::math::mad(
+                  static_cast<Acc>(beta_),
+                  static_cast<Acc>(Load()(out_ptr, out_idx)), value);
+            }
+            Store()(out_ptr, out_idx, static_cast<T>(value));
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  /**
+   * Cooperatively load the LHS and RHS panels starting at acc_start into the
+   * local memory starting at panel_offset. Values outside the matrices are set
+   * to zero, so that the panels can always be used in full.
+   */
+  template <typename LhsPointer, typename RhsPointer>
+  void SNN_ALWAYS_INLINE load_panels(LhsPointer lhs_ptr, RhsPointer rhs_ptr,
+                                     Index panel_offset, Index block_row,
+                                     Index block_col, Index acc_start,
+                                     Index local_idx) {
+    using Load = helpers::io::Load<T>;
+    for (Index idx = local_idx; idx < LhsPanelSize; idx += WorkgroupSize) {
+      // Map consecutive work items to consecutive global addresses.
+      Index const row = TransposeLHS ? idx % BlockRows : idx / AccTile;
+      Index const acc = TransposeLHS ? idx / BlockRows : idx % AccTile;
+      Index const global_row = block_row + row;
+      Index const global_acc = acc_start + acc;
+      T value{0};
+      if (global_row < m_ && global_acc < k_) {
+        value = Load()(lhs_ptr, TransposeLHS ? global_acc * m_ + global_row
+                                             : global_row * k_ + global_acc);
+      }
+      local_[panel_offset + row * AccTile + acc] = value;
+    }
+    Index const rhs_offset = panel_offset + LhsPanelSize;
+    for (Index idx = local_idx; idx < RhsPanelSize; idx += WorkgroupSize) {
+      Index const acc = TransposeRHS ? idx % AccTile : idx / BlockCols;
+      Index const col = TransposeRHS ? idx / AccTile : idx % BlockCols;
+      Index const global_acc = acc_start + acc;
+      Index const global_col = block_col + col;
+      T value{0};
+      if (global_acc < k_ && global_col < n_) {
+        value = Load()(rhs_ptr, TransposeRHS ? global_col * k_ + global_acc
+                                             : global_acc * n_ + global_col);
+      }
+      local_[rhs_offset + acc * BlockCols + col] = value;
+    }
+  }
+
+  /** Accumulate the product of one set of panels into the output block. */
+  void SNN_ALWAYS_INLINE accumulate_panels(Index panel_offset, Index local_row,
+                                           Index local_col,
+                                           Acc (&out_block)[RowTile][ColTile]) {
+    Index const rhs_offset = panel_offset + LhsPanelSize;
+    for (int acc = 0; acc < AccTile; ++acc) {
+      Acc lhs_vals[RowTile];
+      for (int i = 0; i < RowTile; ++i) {
+        lhs_vals[i] =
+            local_[panel_offset + (local_row + i * WgRows) * AccTile + acc];
+      }
+      Acc rhs_vals[ColTile];
+      for (int j = 0; j < ColTile; ++j) {
+        rhs_vals[j] =
+            local_[rhs_offset + acc * BlockCols + local_col + j * WgCols];
+      }
+      for (int i = 0; i < RowTile; ++i) {
+        for (int j = 0; j < ColTile; ++j) {
+          out_block[i][j] =
+              helpers::math::mad(lhs_vals[i], rhs_vals[j], out_block[i][j]);
+        }
+      }
+    }
+  }
+
+  ReadAccessor<T const> lhs_;
+  ReadAccessor<T const> rhs_;
+  ReadWriteAccessor<T> output_;
+  LocalAccessor<T> local_;
+  Index const m_;
+  Index const k_;
+  Index const n_;
+  T const beta_;
+};
+
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_MATMUL_LOCAL_MEM_KERNELS_H_
@@ -0,0 +1,160 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_QUANTIZED_KERNELS_H_
+#define SYCLDNN_SRC_MATMUL_QUANTIZED_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/helpers/macros.h"
+
+#include "sycldnn/quantize/params.h"
+
+#include "src/helpers/vector_element.h"
+#include "src/helpers/vector_io.h"
+#include "src/matmul/blocks.h"
+#include "src/quantize/requantize.h"
+
+#include <array>
+#include <cstdint>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+/**
+ * Int8 quantized batched matrix multiply, computing a RowTile x ColTile block
+ * of the output per thread with int32 accumulators.
+ *
+ * The tiles are loaded with the same block helpers as the floating point
+ * matmul, then widened to int32 and offset by their zero points before being
+ * multiplied. Each product is at most 2^16 in magnitude, so the int32
+ * accumulators cannot overflow for k up to 2^15.
+ */
+template <typename Index, bool TransposeLHS, bool TransposeRHS, int RowTile,
+          int AccTile, int ColTile>
+class QuantizedMatmulKernel {
+  using AccBlock = VectorBlock<int32_t, RowTile, ColTile>;
+  using AccVector = typename AccBlock::VectorType;
+  using LoadScale = helpers::io::Load<float>;
+  using LoadInt = helpers::io::Load<int32_t>;
+  using Store = helpers::io::Store<int8_t>;
+
+  ReadAccessor<int8_t const> lhs_;
+  ReadAccessor<int8_t const> rhs_;
+  ReadAccessor<int32_t const> bias_;
+  ReadAccessor<float const> scales_;
+  ReadAccessor<int32_t const> zero_points_;
+  WriteAccessor<int8_t> output_;
+  Index const m_;
+  Index const k_;
+  Index const n_;
+  quantize::RequantizeParams const q_;
+
+ public:
+  QuantizedMatmulKernel(ReadAccessor<int8_t const> const& lhs,
+                        ReadAccessor<int8_t const> const& rhs,
+                        ReadAccessor<int32_t const> const& bias,
+                        ReadAccessor<float const> const& scales,
+                        ReadAccessor<int32_t const> const& zero_points,
+                        WriteAccessor<int8_t> const& output, Index const m,
+                        Index const k, Index const n,
+                        quantize::RequantizeParams const& requantize_params)
+      : lhs_{lhs},
+        rhs_{rhs},
+        bias_{bias},
+        scales_{scales},
+        zero_points_{zero_points},
+        output_{output},
+        m_{m},
+        k_{k},
+        n_{n},
+        q_{requantize_params} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<3> item) {
+    Index const batch = item.get_id(0);
+    Index const row = item.get_id(1) * RowTile;
+    Index const col = item.get_id(2) * ColTile;
+
+    auto lhs_ptr = lhs_.get_pointer() + batch * m_ * k_ +
+                   (TransposeLHS ? row : row * k_);
+    auto rhs_ptr = rhs_.get_pointer() + batch * k_ * n_ +
+                   (TransposeRHS ? col * k_ : col);
+    Index const lhs_ld = TransposeLHS ? m_ : k_;
+    Index const lhs_step = (TransposeLHS ? m_ : 1) * AccTile;
+    Index const rhs_ld = TransposeRHS ? k_ : n_;
+    Index const rhs_step = (TransposeRHS ? 1 : n_) * AccTile;
+
+    std::array<bool, RowTile> valid_row;
+    for (int i = 0; i < RowTile; ++i) {
+      valid_row[i] = row + i < m_;
+    }
+    std::array<bool, ColTile> valid_col;
+    for (int i = 0; i < ColTile; ++i) {
+      valid_col[i] = col + i < n_;
+    }
+
+    AccVector const bias =
+        load_row<AccVector, ColTile>(bias_.get_pointer() + col, valid_col);
+    AccBlock out_block;
+    for (int i = 0; i < RowTile; ++i) {
+      out_block.data(i) = bias;
+    }
+
+    for (Index acc_idx = 0; acc_idx < k_; acc_idx += AccTile) {
+      std::array<bool, AccTile> valid_acc;
+      for (int i = 0; i < AccTile; ++i) {
+        valid_acc[i] = acc_idx + i < k_;
+      }
+      auto lhs_block = convert_block<int32_t>(
+          load<RowTile, AccTile, TransposeLHS>(lhs_ptr, lhs_ld, valid_row,
+                                               valid_acc));
+      masked_scalar_subtract<RowTile, AccTile>(lhs_block, q_.input_zero_point,
+                                               valid_row, valid_acc);
+      auto rhs_block = convert_block<int32_t>(
+          load<AccTile, ColTile, TransposeRHS>(rhs_ptr, rhs_ld, valid_acc,
+                                               valid_col));
+      masked_scalar_subtract<AccTile, ColTile>(
+          rhs_block, q_.filter_zero_point, valid_acc, valid_col);
+      block_mmacc(lhs_block, rhs_block, out_block);
+      lhs_ptr += lhs_step;
+      rhs_ptr += rhs_step;
+    }
+
+    namespace vec_elem = helpers::vector_element;
+    auto output = output_.get_pointer() + (batch * m_ + row) * n_ + col;
+    for (int j = 0; j < ColTile; ++j) {
+      if (valid_col[j]) {
+        auto const scale = LoadScale()(scales_.get_pointer(), col + j);
+        auto const zero_point =
+            LoadInt()(zero_points_.get_pointer(), col + j);
+        for (int i = 0; i < RowTile; ++i) {
+          if (valid_row[i]) {
+            Store()(output, i * n_ + j,
+                    quantize::internal::requantize(
+                        vec_elem::get(out_block.data(i), j), scale,
+                        zero_point, q_.activation_min, q_.activation_max));
+          }
+        }
+      }
+    }
+  }
+};
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_MATMUL_QUANTIZED_KERNELS_H_
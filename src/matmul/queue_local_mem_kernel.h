@@ -13,27 +13,29 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#ifndef SYCLDNN_SRC_MATMUL_QUEUE_LOCAL_MEM_KERNEL_H_
+#define SYCLDNN_SRC_MATMUL_QUEUE_LOCAL_MEM_KERNEL_H_
 
-#ifndef SYCLDNN_SRC_VARIANCE_QUEUE_BATCHNORM_H
-#define SYCLDNN_SRC_VARIANCE_QUEUE_BATCHNORM_H
-
-#include "sycldnn/batchnorm/params.h"
 #include "sycldnn/mem_object.h"
-
-#include <CL/sycl.hpp>
 #include "sycldnn/status.h"
 
 namespace sycldnn {
-namespace batchnorm {
+namespace matmul {
 namespace internal {
 
-template <typename T, typename Index, int VectorWidth>
-SNNStatus queue_variance(BaseMemObject<T const>& input,
-                         BaseMemObject<T const>& current_mean,
-                         BaseMemObject<T>& current_variance,
-                         BatchNormParams const& params, cl::sycl::queue& queue);
+/**
+ * Add a matrix multiply kernel which stages its inputs in local memory to the
+ * provided SYCL queue.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int ColTile, int WgRows, int WgCols, int AccTile>
+SNNStatus queue_local_mem_kernel(BaseMemObject<T const>& lhs,
+                                 BaseMemObject<T const>& rhs,
+                                 BaseMemObject<T>& output, int batches, int m,
+                                 int k, int n, T beta, cl::sycl::queue& queue);
+
 }  // namespace internal
-}  // namespace batchnorm
+}  // namespace matmul
 }  // namespace sycldnn
 
-#endif  // SYCLDNN_SRC_VARIANCE_QUEUE_BATCHNORM_H
+#endif  // SYCLDNN_SRC_MATMUL_QUEUE_LOCAL_MEM_KERNEL_H_
@@ -0,0 +1,45 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_QUEUE_SPLIT_K_KERNEL_H_
+#define SYCLDNN_SRC_MATMUL_QUEUE_SPLIT_K_KERNEL_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/internal/matmul/launch.h"
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+/**
+ * Add a kernel computing the partial matrix products over slices of the
+ * accumulation dimension to the provided SYCL queue, followed by a kernel
+ * summing the partial products into the output.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile>
+SNNStatus queue_split_k_kernel(
+    BaseMemObject<T const>& lhs, BaseMemObject<T const>& rhs,
+    BaseMemObject<T>& output,
+    BaseMemObject<typename PartialType<T>::type>& workspace, int batches,
+    int m, int k, int n, int n_splits, T beta, cl::sycl::queue& queue);
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_MATMUL_QUEUE_SPLIT_K_KERNEL_H_
@@ -0,0 +1,78 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_QUEUE_SPLIT_K_KERNEL_IMPL_H_
+#define SYCLDNN_SRC_MATMUL_QUEUE_SPLIT_K_KERNEL_IMPL_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "src/matmul/queue_split_k_kernel.h"
+#include "src/matmul/split_k_kernels.h"
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile>
+SNNStatus queue_split_k_kernel(
+    BaseMemObject<T const>& lhs_mem, BaseMemObject<T const>& rhs_mem,
+    BaseMemObject<T>& output_mem,
+    BaseMemObject<typename PartialType<T>::type>& workspace_mem, int batches,
+    int m, int k, int n, int n_splits, T beta, cl::sycl::queue& queue) {
+  Index const split_size = helpers::round_ratio_up_above_zero(k, n_splits);
+  size_t const n_split_threads = n_splits * batches;
+  size_t const n_row_threads = helpers::round_ratio_up_above_zero(m, RowTile);
+  size_t const n_col_threads = helpers::round_ratio_up_above_zero(n, ColTile);
+
+  auto partial_event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto lhs = lhs_mem.read_accessor(cgh);
+    auto rhs = rhs_mem.read_accessor(cgh);
+    auto output = output_mem.read_accessor(cgh);
+    auto workspace = workspace_mem.write_accessor(cgh);
+
+    using Functor = SplitKMatmulKernel<T, Index, TransposeLHS, TransposeRHS,
+                                       RowTile, AccTile, ColTile>;
+
+    Functor functor{lhs, rhs, output,     workspace, batches,
+                    m,   k,   n,      split_size, beta};
+
+    cgh.parallel_for(
+        cl::sycl::range<3>{n_split_threads, n_row_threads, n_col_threads},
+        functor);
+  });
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto workspace = workspace_mem.read_accessor(cgh);
+    auto output = output_mem.write_accessor(cgh);
+
+    using Functor = SplitKFinalizeKernel<T, Index>;
+
+    Index const output_size = batches * m * n;
+    Functor functor{workspace, output, output_size, n_splits};
+
+    cgh.parallel_for(cl::sycl::range<1>{static_cast<size_t>(output_size)},
+                     functor);
+  });
+  SNNStatus status{partial_event, StatusCode::OK};
+  return status.append(event);
+}
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_MATMUL_QUEUE_SPLIT_K_KERNEL_IMPL_H_
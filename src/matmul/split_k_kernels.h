@@ -0,0 +1,182 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_SPLIT_K_KERNELS_H_
+#define SYCLDNN_SRC_MATMUL_SPLIT_K_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/status.h"
+
+#include "src/matmul/blocks.h"
+
+namespace sycldnn {
+namespace matmul {
+
+/**
+ * Matrix multiply kernel which computes the partial product over one slice of
+ * the accumulation dimension.
+ *
+ * The accumulation dimension is split into n_splits slices of split_size
+ * values, and each slice's partial product is written to a separate
+ * [batches, m, n] block of the workspace. The first slice also includes beta
+ * times the original output, so that the final result is given by summing
+ * the partial products over all slices.
+ *
+ * The partial products are stored in the accumulator type, so that they are
+ * only rounded to T once they have been summed by SplitKFinalizeKernel.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile>
+struct SplitKMatmulKernel {
+  using Accumulator = typename helpers::AccumulatorType<T>::type;
+
+  SplitKMatmulKernel(ReadAccessor<T const> const& lhs,
+                     ReadAccessor<T const> const& rhs,
+                     ReadAccessor<T> const& output,
+                     WriteAccessor<Accumulator> const& workspace,
+                     Index batches, Index m, Index k, Index n,
+                     Index split_size, T beta)
+      : lhs_{lhs},
+        rhs_{rhs},
+        output_{output},
+        workspace_{workspace},
+        batches_{batches},
+        m_{m},
+        k_{k},
+        n_{n},
+        split_size_{split_size},
+        beta_{beta} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<3> item) {
+    Index const split = item.get_id(0) / batches_;
+    Index const batch = item.get_id(0) % batches_;
+    Index const row = item.get_id(1) * RowTile;
+    Index const col = item.get_id(2) * ColTile;
+
+    Index const acc_start = split * split_size_;
+    Index const acc_end = cl::sycl::min(k_, acc_start + split_size_);
+
+    auto lhs_ptr = lhs_.get_pointer() + batch * m_ * k_;
+    auto rhs_ptr = rhs_.get_pointer() + batch * k_ * n_;
+    auto out_ptr = output_.get_pointer() + batch * m_ * n_;
+    auto ws_ptr = workspace_.get_pointer() + item.get_id(0) * m_ * n_;
+
+    auto const lhs_ld = TransposeLHS ? m_ : k_;
+    auto const lhs_step = (TransposeLHS ? m_ : 1) * AccTile;
+    auto const rhs_ld = TransposeRHS ? k_ : n_;
+    auto const rhs_step = (TransposeRHS ? 1 : n_) * AccTile;
+    auto const out_ld = n_;
+
+    lhs_ptr += TransposeLHS ? acc_start * m_ + row : k_ * row + acc_start;
+    rhs_ptr += TransposeRHS ? col * k_ + acc_start : acc_start * n_ + col;
+    out_ptr += out_ld * row + col;
+    ws_ptr += out_ld * row + col;
+
+    std::array<bool, RowTile> valid_row;
+    for (int i = 0; i < RowTile; ++i) {
+      valid_row[i] = row + i < m_;
+    }
+    std::array<bool, ColTile> valid_col;
+    for (int i = 0; i < ColTile; ++i) {
+      valid_col[i] = col + i < n_;
+    }
+
+    auto out_block = VectorBlock<Accumulator, RowTile, ColTile>{};
+    if (split == 0 && beta_ != static_cast<T>(0)) {
+      // Convert out_ptr from multi_ptr<T> to multi_ptr<T const>
+      auto const_out_ptr =
+          cl::sycl::multi_ptr<T const,
+                              cl::sycl::access::address_space::global_space>{
+              out_ptr.get()};
+      out_block = convert_block<Accumulator>(load_block<RowTile, ColTile>(
+          const_out_ptr, out_ld, valid_row, valid_col));
+      scalar_multiply(out_block, static_cast<Accumulator>(beta_));
+    }
+
+    for (Index acc_idx = acc_start; acc_idx < acc_end; acc_idx += AccTile) {
+      std::array<bool, AccTile> valid_acc;
+      for (int i = 0; i < AccTile; ++i) {
+        valid_acc[i] = acc_idx + i < acc_end;
+      }
+      auto lhs_block = convert_block<Accumulator>(
+          load<RowTile, AccTile, TransposeLHS>(lhs_ptr, lhs_ld, valid_row,
+                                               valid_acc));
+      auto rhs_block = convert_block<Accumulator>(
+          load<AccTile, ColTile, TransposeRHS>(rhs_ptr, rhs_ld, valid_acc,
+                                               valid_col));
+      block_mmacc(lhs_block, rhs_block, out_block);
+      lhs_ptr += lhs_step;
+      rhs_ptr += rhs_step;
+    }
+
+    store_block<RowTile, ColTile>(out_block, ws_ptr, out_ld, valid_row,
+                                  valid_col);
+  }
+
+ private:
+  ReadAccessor<T const> lhs_;
+  ReadAccessor<T const> rhs_;
+  ReadAccessor<T> output_;
+  WriteAccessor<Accumulator> workspace_;
+  Index const batches_;
+  Index const m_;
+  Index const k_;
+  Index const n_;
+  Index const split_size_;
+  T const beta_;
+};
+
+/**
+ * Kernel which sums the partial products written by SplitKMatmulKernel into
+ * the output, using a single work item per output value.
+ *
+ * The partial products are summed in the accumulator type and only the final
+ * sum is converted to T.
+ */
+template <typename T, typename Index>
+struct SplitKFinalizeKernel {
+  using Accumulator = typename helpers::AccumulatorType<T>::type;
+
+  SplitKFinalizeKernel(ReadAccessor<Accumulator> const& workspace,
+                       WriteAccessor<T> const& output, Index output_size,
+                       Index n_splits)
+      : workspace_{workspace},
+        output_{output},
+        output_size_{output_size},
+        n_splits_{n_splits} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) {
+    Index const idx = item.get_id(0);
+
+    const auto workspace = workspace_.get_pointer().get();
+    auto output = output_.get_pointer().get();
+
+    Accumulator sum = workspace[idx];
+    for (Index split = 1; split < n_splits_; ++split) {
+      sum += workspace[split * output_size_ + idx];
+    }
+    output[idx] = static_cast<T>(sum);
+  }
+
+ private:
+  ReadAccessor<Accumulator> workspace_;
+  WriteAccessor<T> output_;
+  Index const output_size_;
+  Index const n_splits_;
+};
+
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_MATMUL_SPLIT_K_KERNELS_H_
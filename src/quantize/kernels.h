@@ -0,0 +1,128 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_QUANTIZE_KERNELS_H_
+#define SYCLDNN_SRC_QUANTIZE_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "src/helpers/vector_io.h"
+#include "src/quantize/requantize.h"
+
+#include <cstdint>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace quantize {
+namespace internal {
+
+template <typename T, typename Index>
+class QuantizeOp {
+  using LoadData = helpers::io::Load<T>;
+  using LoadScale = helpers::io::Load<float>;
+  using LoadZeroPoint = helpers::io::Load<int32_t>;
+  using Store = helpers::io::Store<int8_t>;
+
+  ReadAccessor<T const> input_;
+  ReadAccessor<float const> scales_;
+  ReadAccessor<int32_t const> zero_points_;
+  WriteAccessor<int8_t> output_;
+  Index const n_items_;
+  Index const n_channels_;
+
+ public:
+  SNN_ALWAYS_INLINE void operator()(cl::sycl::item<1> item) {
+    Index idx = item.get_id(0);
+
+    if (idx < n_items_) {
+      auto const input = input_.get_pointer();
+      auto const scales = scales_.get_pointer();
+      auto const zero_points = zero_points_.get_pointer();
+      auto output = output_.get_pointer();
+
+      Index const channel = idx % n_channels_;
+      auto const value = static_cast<float>(LoadData()(input, idx));
+      Store()(output, idx,
+              round_and_saturate(value / LoadScale()(scales, channel),
+                                 LoadZeroPoint()(zero_points, channel),
+                                 quantized_min, quantized_max));
+    }
+  }
+
+  QuantizeOp(ReadAccessor<T const> input, ReadAccessor<float const> scales,
+             ReadAccessor<int32_t const> zero_points,
+             WriteAccessor<int8_t> output, Index const num_items,
+             Index const num_channels)
+      : input_(input),
+        scales_(scales),
+        zero_points_(zero_points),
+        output_(output),
+        n_items_(num_items),
+        n_channels_(num_channels) {}
+};
+
+template <typename T, typename Index>
+class DequantizeOp {
+  using LoadData = helpers::io::Load<int8_t>;
+  using LoadScale = helpers::io::Load<float>;
+  using LoadZeroPoint = helpers::io::Load<int32_t>;
+  using Store = helpers::io::Store<T>;
+
+  ReadAccessor<int8_t const> input_;
+  ReadAccessor<float const> scales_;
+  ReadAccessor<int32_t const> zero_points_;
+  WriteAccessor<T> output_;
+  Index const n_items_;
+  Index const n_channels_;
+
+ public:
+  SNN_ALWAYS_INLINE void operator()(cl::sycl::item<1> item) {
+    Index idx = item.get_id(0);
+
+    if (idx < n_items_) {
+      auto const input = input_.get_pointer();
+      auto const scales = scales_.get_pointer();
+      auto const zero_points = zero_points_.get_pointer();
+      auto output = output_.get_pointer();
+
+      Index const channel = idx % n_channels_;
+      int32_t const value = static_cast<int32_t>(LoadData()(input, idx)) -
+                            LoadZeroPoint()(zero_points, channel);
+      Store()(output, idx,
+              static_cast<T>(static_cast<float>(value) *
+                             LoadScale()(scales, channel)));
+    }
+  }
+
+  DequantizeOp(ReadAccessor<int8_t const> input,
+               ReadAccessor<float const> scales,
+               ReadAccessor<int32_t const> zero_points,
+               WriteAccessor<T> output, Index const num_items,
+               Index const num_channels)
+      : input_(input),
+        scales_(scales),
+        zero_points_(zero_points),
+        output_(output),
+        n_items_(num_items),
+        n_channels_(num_channels) {}
+};
+
+}  // namespace internal
+}  // namespace quantize
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_QUANTIZE_KERNELS_H_
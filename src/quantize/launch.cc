@@ -0,0 +1,107 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "sycldnn/quantize/params.h"
+
+#include "src/quantize/kernels.h"
+#include "sycldnn/internal/quantize/launch.h"
+
+#include <cstdint>
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace quantize {
+namespace internal {
+
+template <typename T>
+SNNStatus launch_quantize(BaseMemObject<T const>& input,
+                          BaseMemObject<float const>& scales,
+                          BaseMemObject<int32_t const>& zero_points,
+                          BaseMemObject<int8_t>& output,
+                          QuantizeParams const& params,
+                          cl::sycl::queue& queue) {
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input_acc = input.read_accessor(cgh);
+    auto scales_acc = scales.read_accessor(cgh);
+    auto zero_points_acc = zero_points.read_accessor(cgh);
+    auto output_acc = output.write_accessor(cgh);
+    QuantizeOp<T, int32_t> op{input_acc,  scales_acc,  zero_points_acc,
+                              output_acc, params.size, params.channels};
+    size_t const n_threads =
+        helpers::round_up_to_nearest_multiple(params.size, 64);
+
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, op);
+  });
+
+  return {event, StatusCode::OK};
+}
+
+template <typename T>
+SNNStatus launch_dequantize(BaseMemObject<int8_t const>& input,
+                            BaseMemObject<float const>& scales,
+                            BaseMemObject<int32_t const>& zero_points,
+                            BaseMemObject<T>& output,
+                            QuantizeParams const& params,
+                            cl::sycl::queue& queue) {
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input_acc = input.read_accessor(cgh);
+    auto scales_acc = scales.read_accessor(cgh);
+    auto zero_points_acc = zero_points.read_accessor(cgh);
+    auto output_acc = output.write_accessor(cgh);
+    DequantizeOp<T, int32_t> op{input_acc,  scales_acc,  zero_points_acc,
+                                output_acc, params.size, params.channels};
+    size_t const n_threads =
+        helpers::round_up_to_nearest_multiple(params.size, 64);
+
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, op);
+  });
+
+  return {event, StatusCode::OK};
+}
+
+#define INSTANTIATE_LAUNCH(DTYPE)                                              \
+  template SNN_EXPORT SNNStatus launch_quantize<DTYPE>(                        \
+      BaseMemObject<DTYPE const> & input, BaseMemObject<float const> & scales, \
+      BaseMemObject<int32_t const> & zero_points,                              \
+      BaseMemObject<int8_t> & output, QuantizeParams const& params,            \
+      cl::sycl::queue& queue);                                                 \
+  template SNN_EXPORT SNNStatus launch_dequantize<DTYPE>(                      \
+      BaseMemObject<int8_t const> & input,                                     \
+      BaseMemObject<float const> & scales,                                     \
+      BaseMemObject<int32_t const> & zero_points,                              \
+      BaseMemObject<DTYPE> & output, QuantizeParams const& params,             \
+      cl::sycl::queue& queue)
+
+INSTANTIATE_LAUNCH(float);
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_LAUNCH(cl::sycl::half);
+#endif
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_LAUNCH(double);
+#endif
+
+}  // namespace internal
+}  // namespace quantize
+}  // namespace sycldnn
@@ -0,0 +1,74 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_QUANTIZE_REQUANTIZE_H_
+#define SYCLDNN_SRC_QUANTIZE_REQUANTIZE_H_
+
+#include "sycldnn/helpers/macros.h"
+#include "sycldnn/helpers/minmax.h"
+
+#include <cstdint>
+
+#include <CL/sycl.hpp>
+
+/**
+ * \file
+ * Contains the device helpers used to convert between real values, int32
+ * accumulators and int8 quantized values.
+ */
+
+namespace sycldnn {
+namespace quantize {
+namespace internal {
+
+/** The smallest value representable in int8. */
+constexpr int32_t quantized_min = -128;
+
+/** The largest value representable in int8. */
+constexpr int32_t quantized_max = 127;
+
+/**
+ * The largest accumulation size supported by the int32 accumulators. Each
+ * product of two int8 values offset by their zero points is at most 2^16 in
+ * magnitude, so up to 2^15 of them can be summed without overflow.
+ */
+constexpr int32_t max_accumulation_size = 1 << 15;
+
+/**
+ * Round a scaled value to the nearest integer, offset it by the zero point and
+ * saturate it to the range [min, max].
+ */
+inline SNN_ALWAYS_INLINE int8_t round_and_saturate(float value,
+                                                   int32_t zero_point,
+                                                   int32_t min, int32_t max) {
+  auto rounded = static_cast<int32_t>(cl::sycl::rint(value)) + zero_point;
+  return static_cast<int8_t>(helpers::min(helpers::max(rounded, min), max));
+}
+
+/**
+ * Requantize an int32 accumulator to int8 using the combined scale of the
+ * inputs and output.
+ */
+inline SNN_ALWAYS_INLINE int8_t requantize(int32_t acc, float scale,
+                                           int32_t zero_point, int32_t min,
+                                           int32_t max) {
+  return round_and_saturate(static_cast<float>(acc) * scale, zero_point, min,
+                            max);
+}
+
+}  // namespace internal
+}  // namespace quantize
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_QUANTIZE_REQUANTIZE_H_
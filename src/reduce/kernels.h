@@ -20,36 +20,198 @@
 #include "sycldnn/reduce/operators.h"
 #include "sycldnn/status.h"
 
+#include "sycldnn/helpers/macros.h"
+
+#include "src/helpers/accumulator_type.h"
+#include "src/helpers/workgroup_reduce.h"
+
+#include <cstdint>
+#include <limits>
+
+#include <CL/sycl.hpp>
+
 namespace sycldnn {
 namespace reduce {
 
 namespace internal {
 
+/**
+ * Accumulates the values of the outer dimension for one output.
+ *
+ * Each reducer provides reduce() to accumulate a value, workgroup_reduce() to
+ * combine the partial results held by all work items in a workgroup into the
+ * first work item, store() to write its partial result to a workspace, merge()
+ * to combine a partial result from the workspace, and finalize() to compute
+ * the output value. Partial results which take more than one value store them
+ * `stride` elements apart.
+ */
 template <typename T, typename Index, typename Op>
 struct Reducer;
 
-template <typename T, typename Index>
-struct Reducer<T, Index, Add> {
-  Reducer() : res_(0) {}
+/**
+ * Base for reducers which hold a single running value, where partial results
+ * are combined using Combine.
+ */
+template <typename T, typename Index, typename Combine>
+struct ScalarReducer {
+  explicit ScalarReducer(T init) : res_(init) {}
 
-  void reduce(T x) { res_ += x; }
+  template <typename Scratch>
+  void workgroup_reduce(cl::sycl::nd_item<1> item, Scratch scratch) {
+    res_ = helpers::reduce::workgroup_reduce<Combine, Index>(res_, item,
+                                                             scratch);
+  }
 
-  T finalize(Index) { return res_; }
+  void store(T* partial, Index /*stride*/) const { partial[0] = res_; }
 
- private:
+  void merge(T const* partial, Index /*stride*/) {
+    res_ = Combine{}(res_, partial[0]);
+  }
+
+ protected:
   T res_;
 };
 
 template <typename T, typename Index>
-struct Reducer<T, Index, Mean> {
-  Reducer() : res_(0) {}
+struct Reducer<T, Index, Add>
+    : public ScalarReducer<T, Index, helpers::reduce::Sum> {
+  Reducer() : ScalarReducer<T, Index, helpers::reduce::Sum>(0) {}
+
+  void reduce(T x) { this->res_ += x; }
+
+  T finalize(Index) { return this->res_; }
+};
+
+template <typename T, typename Index>
+struct Reducer<T, Index, Mean>
+    : public ScalarReducer<T, Index, helpers::reduce::Sum> {
+  Reducer() : ScalarReducer<T, Index, helpers::reduce::Sum>(0) {}
+
+  void reduce(T x) { this->res_ += x; }
+
+  T finalize(Index outer_size) { return this->res_ / outer_size; }
+};
+
+template <typename T, typename Index>
+struct Reducer<T, Index, Max>
+    : public ScalarReducer<T, Index, helpers::reduce::Max> {
+  Reducer()
+      : ScalarReducer<T, Index, helpers::reduce::Max>(
+            std::numeric_limits<T>::lowest()) {}
+
+  void reduce(T x) { this->res_ = cl::sycl::max(this->res_, x); }
+
+  T finalize(Index) { return this->res_; }
+};
+
+template <typename T, typename Index>
+struct Reducer<T, Index, Min>
+    : public ScalarReducer<T, Index, helpers::reduce::Min> {
+  Reducer()
+      : ScalarReducer<T, Index, helpers::reduce::Min>(
+            std::numeric_limits<T>::max()) {}
 
-  void reduce(T x) { res_ += x; }
+  void reduce(T x) { this->res_ = cl::sycl::min(this->res_, x); }
 
-  T finalize(Index outer_size) { return res_ / outer_size; }
+  T finalize(Index) { return this->res_; }
+};
+
+template <typename T, typename Index>
+struct Reducer<T, Index, Prod>
+    : public ScalarReducer<T, Index, helpers::reduce::Product> {
+  Reducer() : ScalarReducer<T, Index, helpers::reduce::Product>(1) {}
+
+  void reduce(T x) { this->res_ *= x; }
+
+  T finalize(Index) { return this->res_; }
+};
+
+template <typename T, typename Index>
+struct Reducer<T, Index, SumOfSquares>
+    : public ScalarReducer<T, Index, helpers::reduce::Sum> {
+  Reducer() : ScalarReducer<T, Index, helpers::reduce::Sum>(0) {}
+
+  void reduce(T x) { this->res_ += x * x; }
+
+  T finalize(Index) { return this->res_; }
+};
+
+template <typename T, typename Index>
+struct Reducer<T, Index, L2Norm>
+    : public ScalarReducer<T, Index, helpers::reduce::Sum> {
+  Reducer() : ScalarReducer<T, Index, helpers::reduce::Sum>(0) {}
+
+  void reduce(T x) { this->res_ += x * x; }
+
+  T finalize(Index) { return cl::sycl::sqrt(this->res_); }
+};
+
+/**
+ * Tracks the largest value seen along with the sum of exponentials relative to
+ * that value. The sum is rescaled whenever the maximum changes, so the
+ * exponentials never overflow.
+ */
+template <typename T, typename Index>
+struct Reducer<T, Index, LogSumExp> {
+  Reducer() : max_(std::numeric_limits<T>::lowest()), sum_(0) {}
+
+  void reduce(T x) {
+    T const new_max = cl::sycl::max(max_, x);
+    sum_ = sum_ * cl::sycl::exp(max_ - new_max) + cl::sycl::exp(x - new_max);
+    max_ = new_max;
+  }
+
+  template <typename Scratch>
+  void workgroup_reduce(cl::sycl::nd_item<1> item, Scratch scratch) {
+    T total_max =
+        helpers::reduce::workgroup_reduce<helpers::reduce::Max, Index>(
+            max_, item, scratch);
+    total_max = helpers::reduce::broadcast_from_first(total_max, item, scratch);
+    sum_ *= cl::sycl::exp(max_ - total_max);
+    max_ = total_max;
+    sum_ = helpers::reduce::workgroup_reduce<helpers::reduce::Sum, Index>(
+        sum_, item, scratch);
+  }
+
+  void store(T* partial, Index stride) const {
+    partial[0] = max_;
+    partial[stride] = sum_;
+  }
+
+  void merge(T const* partial, Index stride) {
+    T const other_max = partial[0];
+    T const new_max = cl::sycl::max(max_, other_max);
+    sum_ = sum_ * cl::sycl::exp(max_ - new_max) +
+           partial[stride] * cl::sycl::exp(other_max - new_max);
+    max_ = new_max;
+  }
+
+  T finalize(Index) { return max_ + cl::sycl::log(sum_); }
 
  private:
-  T res_;
+  T max_;
+  T sum_;
+};
+
+/**
+ * Accumulates the index of the best value seen in the outer dimension, where
+ * ties are resolved in favour of the lowest index.
+ */
+template <typename T, typename Index, typename Op>
+struct ArgReducer;
+
+template <typename T, typename Index>
+struct ArgReducer<T, Index, ArgMax> {
+  static bool better(T lhs, T rhs) { return lhs > rhs; }
+
+  static T initial_value() { return std::numeric_limits<T>::lowest(); }
+};
+
+template <typename T, typename Index>
+struct ArgReducer<T, Index, ArgMin> {
+  static bool better(T lhs, T rhs) { return lhs < rhs; }
+
+  static T initial_value() { return std::numeric_limits<T>::max(); }
 };
 
 }  // namespace internal
@@ -57,6 +219,8 @@ struct Reducer<T, Index, Mean> {
 // TODO: Optimize and specialize kernel for certain sizes
 template <typename T, typename Index, typename Op>
 struct ReduceKernel {
+  using Accumulator = typename helpers::AccumulatorType<T>::type;
+
   ReduceKernel(ReadAccessor<T const> const& input,
                WriteAccessor<T> const& output, Index batches, Index outer,
                Index inner)
@@ -72,21 +236,433 @@ struct ReduceKernel {
 
     const auto input = input_.get_pointer().get();
     auto output = output_.get_pointer().get();
-    internal::Reducer<T, Index, Op> reducer;
+    internal::Reducer<Accumulator, Index, Op> reducer;
 
     const auto input_n = input + batch * outer_ * inner_ + inner;
     for (Index i = 0; i < outer_; ++i) {
-      reducer.reduce(input_n[i * inner_]);
+      reducer.reduce(static_cast<Accumulator>(input_n[i * inner_]));
+    }
+    output[batch * inner_ + inner] = static_cast<T>(reducer.finalize(outer_));
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  WriteAccessor<T> output_;
+  Index const batches_;
+  Index const outer_;
+  Index const inner_;
+};
+
+/**
+ * Reduce kernel which splits the outer dimension of each output into n_splits
+ * slices, and writes the partial result of each slice to the workspace.
+ *
+ * The slices are interleaved, so slice s reduces the outer indices s,
+ * s + n_splits, s + 2 * n_splits and so on. Work items are ordered with the
+ * inner index varying fastest, then the slice, so adjacent work items read
+ * adjacent values of the input whatever the inner size.
+ *
+ * Every slice must contain at least one value, so n_splits must not be larger
+ * than the outer size.
+ */
+template <typename T, typename Index, typename Op>
+struct PartialReduceKernel {
+  using Accumulator = typename helpers::AccumulatorType<T>::type;
+
+  PartialReduceKernel(ReadAccessor<T const> const& input,
+                      WriteAccessor<Accumulator> const& workspace,
+                      Index batches, Index outer, Index inner, Index n_splits)
+      : input_{input},
+        workspace_{workspace},
+        batches_{batches},
+        outer_{outer},
+        inner_{inner},
+        n_splits_{n_splits} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<2> item) {
+    Index const batch = item.get_id(0);
+    Index const slice_inner = item.get_id(1);
+    Index const slice = slice_inner / inner_;
+    Index const slice_stride = n_splits_ * inner_;
+
+    const auto input = input_.get_pointer().get();
+    auto workspace = workspace_.get_pointer().get();
+    internal::Reducer<Accumulator, Index, Op> reducer;
+
+    const auto input_n = input + batch * outer_ * inner_ + slice_inner;
+    Index offset = 0;
+    for (Index i = slice; i < outer_; i += n_splits_) {
+      reducer.reduce(static_cast<Accumulator>(input_n[offset]));
+      offset += slice_stride;
+    }
+    reducer.store(workspace + batch * slice_stride + slice_inner,
+                  batches_ * slice_stride);
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  WriteAccessor<Accumulator> workspace_;
+  Index const batches_;
+  Index const outer_;
+  Index const inner_;
+  Index const n_splits_;
+};
+
+/**
+ * Reduce kernel which splits the outer dimension of each output into n_splits
+ * slices in the same way as PartialReduceKernel, but reduces each slice
+ * across a whole workgroup rather than in a single work item.
+ *
+ * This is used when the inner size is one and there are only a few outputs,
+ * where a work item per slice cannot occupy the device without splitting into
+ * more slices than FinalizeReduceKernel can combine cheaply. The outer
+ * dimension is split into blocks of workgroup size consecutive values, and
+ * slice s holds the blocks s, s + n_splits, s + 2 * n_splits and so on, so
+ * adjacent work items read adjacent values of the input. The work items
+ * combine their partial results with a tree reduction in local memory, and
+ * the first writes the partial result of the slice to the workspace.
+ *
+ * Assumes that the inner size is one, that the workgroup size is a power of
+ * two, and that the scratch space holds at least one element per work item.
+ */
+template <typename T, typename Index, typename Op>
+struct WorkgroupPartialReduceKernel {
+  using Accumulator = typename helpers::AccumulatorType<T>::type;
+
+  WorkgroupPartialReduceKernel(ReadAccessor<T const> const& input,
+                               LocalAccessor<Accumulator> const& scratch,
+                               WriteAccessor<Accumulator> const& workspace,
+                               Index batches, Index outer, Index n_splits)
+      : input_{input},
+        scratch_{scratch},
+        workspace_{workspace},
+        batches_{batches},
+        outer_{outer},
+        n_splits_{n_splits} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<1> item) {
+    Index const partial_idx = item.get_group(0);
+    Index const batch = partial_idx / n_splits_;
+    Index const slice = partial_idx % n_splits_;
+    Index const local_id = item.get_local_id(0);
+    Index const local_range = item.get_local_range(0);
+    Index const block_stride = n_splits_ * local_range;
+
+    const auto input = input_.get_pointer().get();
+    auto workspace = workspace_.get_pointer().get();
+    internal::Reducer<Accumulator, Index, Op> reducer;
+
+    const auto input_n = input + batch * outer_;
+    for (Index i = slice * local_range + local_id; i < outer_;
+         i += block_stride) {
+      reducer.reduce(static_cast<Accumulator>(input_n[i]));
+    }
+
+    // The reduction has to be outside any conditional, to ensure that all
+    // threads reach the barriers used in the reduction.
+    reducer.workgroup_reduce(item, scratch_.get_pointer());
+    if (local_id == 0) {
+      reducer.store(workspace + partial_idx, batches_ * n_splits_);
     }
-    output[batch * inner_ + inner] = reducer.finalize(outer_);
   }
 
  private:
   ReadAccessor<T const> input_;
+  LocalAccessor<Accumulator> scratch_;
+  WriteAccessor<Accumulator> workspace_;
+  Index const batches_;
+  Index const outer_;
+  Index const n_splits_;
+};
+
+/**
+ * Reduce kernel which combines the partial results written by
+ * PartialReduceKernel or WorkgroupPartialReduceKernel into the output, using a
+ * single work item per output.
+ * Adjacent work items read adjacent partial results.
+ */
+template <typename T, typename Index, typename Op>
+struct FinalizeReduceKernel {
+  using Accumulator = typename helpers::AccumulatorType<T>::type;
+
+  FinalizeReduceKernel(ReadAccessor<Accumulator> const& workspace,
+                       WriteAccessor<T> const& output, Index batches,
+                       Index outer, Index inner, Index n_splits)
+      : workspace_{workspace},
+        output_{output},
+        batches_{batches},
+        outer_{outer},
+        inner_{inner},
+        n_splits_{n_splits} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<2> item) {
+    Index const batch = item.get_id(0);
+    Index const inner = item.get_id(1);
+    Index const slice_stride = n_splits_ * inner_;
+
+    const auto workspace = workspace_.get_pointer().get();
+    auto output = output_.get_pointer().get();
+    internal::Reducer<Accumulator, Index, Op> reducer;
+
+    const auto partial_n = workspace + batch * slice_stride + inner;
+    for (Index i = 0; i < n_splits_; ++i) {
+      reducer.merge(partial_n + i * inner_, batches_ * slice_stride);
+    }
+    output[batch * inner_ + inner] = static_cast<T>(reducer.finalize(outer_));
+  }
+
+ private:
+  ReadAccessor<Accumulator> workspace_;
   WriteAccessor<T> output_;
   Index const batches_;
   Index const outer_;
   Index const inner_;
+  Index const n_splits_;
+};
+
+/**
+ * Reduce kernel which computes the index in the outer dimension of the best
+ * value for each output, using a single work item per output.
+ */
+template <typename T, typename Index, typename Op>
+struct ArgReduceKernel {
+  using Accumulator = typename helpers::AccumulatorType<T>::type;
+  using ArgReducer = internal::ArgReducer<Accumulator, Index, Op>;
+
+  ArgReduceKernel(ReadAccessor<T const> const& input,
+                  WriteAccessor<int32_t> const& output, Index outer,
+                  Index inner)
+      : input_{input}, output_{output}, outer_{outer}, inner_{inner} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<2> item) {
+    Index batch = item.get_id(0);
+    Index inner = item.get_id(1);
+
+    const auto input = input_.get_pointer().get();
+    auto output = output_.get_pointer().get();
+
+    const auto input_n = input + batch * outer_ * inner_ + inner;
+    auto best = static_cast<Accumulator>(input_n[0]);
+    Index best_idx = 0;
+    for (Index i = 1; i < outer_; ++i) {
+      auto const value = static_cast<Accumulator>(input_n[i * inner_]);
+      if (ArgReducer::better(value, best)) {
+        best = value;
+        best_idx = i;
+      }
+    }
+    output[batch * inner_ + inner] = static_cast<int32_t>(best_idx);
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  WriteAccessor<int32_t> output_;
+  Index const outer_;
+  Index const inner_;
+};
+
+/**
+ * Reduce kernel which finds the best value and its index in each slice of the
+ * outer dimension, splitting the outer dimension and ordering the work items
+ * in the same way as PartialReduceKernel.
+ */
+template <typename T, typename Index, typename Op>
+struct PartialArgReduceKernel {
+  using Accumulator = typename helpers::AccumulatorType<T>::type;
+  using ArgReducer = internal::ArgReducer<Accumulator, Index, Op>;
+
+  PartialArgReduceKernel(ReadAccessor<T const> const& input,
+                         WriteAccessor<Accumulator> const& value_workspace,
+                         WriteAccessor<int32_t> const& index_workspace,
+                         Index outer, Index inner, Index n_splits)
+      : input_{input},
+        value_workspace_{value_workspace},
+        index_workspace_{index_workspace},
+        outer_{outer},
+        inner_{inner},
+        n_splits_{n_splits} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<2> item) {
+    Index const batch = item.get_id(0);
+    Index const slice_inner = item.get_id(1);
+    Index const slice = slice_inner / inner_;
+    Index const slice_stride = n_splits_ * inner_;
+
+    const auto input = input_.get_pointer().get();
+    auto value_workspace = value_workspace_.get_pointer().get();
+    auto index_workspace = index_workspace_.get_pointer().get();
+
+    // The indices in a slice increase, so only a strictly better value
+    // replaces the best so far.
+    const auto input_n = input + batch * outer_ * inner_ + slice_inner;
+    auto best = static_cast<Accumulator>(input_n[0]);
+    Index best_idx = slice;
+    Index offset = slice_stride;
+    for (Index i = slice + n_splits_; i < outer_; i += n_splits_) {
+      auto const value = static_cast<Accumulator>(input_n[offset]);
+      if (ArgReducer::better(value, best)) {
+        best = value;
+        best_idx = i;
+      }
+      offset += slice_stride;
+    }
+    Index const partial_idx = batch * slice_stride + slice_inner;
+    value_workspace[partial_idx] = best;
+    index_workspace[partial_idx] = static_cast<int32_t>(best_idx);
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  WriteAccessor<Accumulator> value_workspace_;
+  WriteAccessor<int32_t> index_workspace_;
+  Index const outer_;
+  Index const inner_;
+  Index const n_splits_;
+};
+
+/**
+ * Reduce kernel which finds the best value and its index in each slice of the
+ * outer dimension, splitting the outer dimension and reducing each slice
+ * across a workgroup in the same way as WorkgroupPartialReduceKernel.
+ *
+ * Each work item finds the best value in its part of the slice, then the
+ * values and indices are combined with a tree reduction in local memory,
+ * keeping the lowest index on ties.
+ *
+ * Assumes that the inner size is one, that the workgroup size is a power of
+ * two, and that both scratch spaces hold at least one element per work item.
+ */
+template <typename T, typename Index, typename Op>
+struct WorkgroupPartialArgReduceKernel {
+  using Accumulator = typename helpers::AccumulatorType<T>::type;
+  using ArgReducer = internal::ArgReducer<Accumulator, Index, Op>;
+
+  WorkgroupPartialArgReduceKernel(
+      ReadAccessor<T const> const& input,
+      LocalAccessor<Accumulator> const& value_scratch,
+      LocalAccessor<Index> const& index_scratch,
+      WriteAccessor<Accumulator> const& value_workspace,
+      WriteAccessor<int32_t> const& index_workspace, Index outer,
+      Index n_splits)
+      : input_{input},
+        value_scratch_{value_scratch},
+        index_scratch_{index_scratch},
+        value_workspace_{value_workspace},
+        index_workspace_{index_workspace},
+        outer_{outer},
+        n_splits_{n_splits} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<1> item) {
+    Index const partial_idx = item.get_group(0);
+    Index const batch = partial_idx / n_splits_;
+    Index const slice = partial_idx % n_splits_;
+    Index const local_id = item.get_local_id(0);
+    Index const local_range = item.get_local_range(0);
+    Index const block_stride = n_splits_ * local_range;
+
+    const auto input = input_.get_pointer().get();
+    auto value_workspace = value_workspace_.get_pointer().get();
+    auto index_workspace = index_workspace_.get_pointer().get();
+
+    // The indices seen by a work item increase, so only a strictly better
+    // value replaces the best so far. Work items with no values use an index
+    // past the end, so they never win a tie against a real value.
+    const auto input_n = input + batch * outer_;
+    Accumulator best = ArgReducer::initial_value();
+    Index best_idx = outer_;
+    for (Index i = slice * local_range + local_id; i < outer_;
+         i += block_stride) {
+      auto const value = static_cast<Accumulator>(input_n[i]);
+      if (ArgReducer::better(value, best) || best_idx == outer_) {
+        best = value;
+        best_idx = i;
+      }
+    }
+
+    value_scratch_[local_id] = best;
+    index_scratch_[local_id] = best_idx;
+    item.barrier(cl::sycl::access::fence_space::local_space);
+    for (Index stride = local_range / 2; stride > 0; stride /= 2) {
+      if (local_id < stride) {
+        Accumulator const other = value_scratch_[local_id + stride];
+        Index const other_idx = index_scratch_[local_id + stride];
+        if (ArgReducer::better(other, best) ||
+            (other == best && other_idx < best_idx)) {
+          best = other;
+          best_idx = other_idx;
+          value_scratch_[local_id] = best;
+          index_scratch_[local_id] = best_idx;
+        }
+      }
+      item.barrier(cl::sycl::access::fence_space::local_space);
+    }
+
+    if (local_id == 0) {
+      value_workspace[partial_idx] = best;
+      index_workspace[partial_idx] = static_cast<int32_t>(best_idx);
+    }
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  LocalAccessor<Accumulator> value_scratch_;
+  LocalAccessor<Index> index_scratch_;
+  WriteAccessor<Accumulator> value_workspace_;
+  WriteAccessor<int32_t> index_workspace_;
+  Index const outer_;
+  Index const n_splits_;
+};
+
+/**
+ * Reduce kernel which combines the best values and indices written by
+ * PartialArgReduceKernel or WorkgroupPartialArgReduceKernel into the output
+ * index, using a single work item per output. Ties between slices are
+ * resolved in favour of the lowest index.
+ */
+template <typename T, typename Index, typename Op>
+struct FinalizeArgReduceKernel {
+  using Accumulator = typename helpers::AccumulatorType<T>::type;
+  using ArgReducer = internal::ArgReducer<Accumulator, Index, Op>;
+
+  FinalizeArgReduceKernel(ReadAccessor<Accumulator> const& value_workspace,
+                          ReadAccessor<int32_t> const& index_workspace,
+                          WriteAccessor<int32_t> const& output, Index inner,
+                          Index n_splits)
+      : value_workspace_{value_workspace},
+        index_workspace_{index_workspace},
+        output_{output},
+        inner_{inner},
+        n_splits_{n_splits} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<2> item) {
+    Index const batch = item.get_id(0);
+    Index const inner = item.get_id(1);
+
+    const auto value_workspace = value_workspace_.get_pointer().get();
+    const auto index_workspace = index_workspace_.get_pointer().get();
+    auto output = output_.get_pointer().get();
+
+    Index const partial_n = batch * n_splits_ * inner_ + inner;
+    Accumulator best = value_workspace[partial_n];
+    int32_t best_idx = index_workspace[partial_n];
+    for (Index i = 1; i < n_splits_; ++i) {
+      Accumulator const value = value_workspace[partial_n + i * inner_];
+      int32_t const idx = index_workspace[partial_n + i * inner_];
+      if (ArgReducer::better(value, best) ||
+          (value == best && idx < best_idx)) {
+        best = value;
+        best_idx = idx;
+      }
+    }
+    output[batch * inner_ + inner] = best_idx;
+  }
+
+ private:
+  ReadAccessor<Accumulator> value_workspace_;
+  ReadAccessor<int32_t> index_workspace_;
+  WriteAccessor<int32_t> output_;
+  Index const inner_;
+  Index const n_splits_;
 };
 
 }  // namespace reduce
@@ -20,25 +20,172 @@
 
 #include "src/reduce/queue_reduction.h"
 
+#include <algorithm>
+#include <cstddef>
+
 namespace sycldnn {
 namespace reduce {
 namespace internal {
 
-// Launch the reduce kernel for the passed parameters.
+namespace {
+
+// With at least this many outputs there are enough work items for the serial
+// kernel to fill a device, and it reads the input in a coalesced order.
+constexpr int min_serial_outputs = 4096;
+
+// Enough work items to occupy a large device when splitting the outer
+// dimension.
+constexpr int target_threads = 16384;
+
+// Each slice reduces at least this many values, so that writing and combining
+// the partial results stays cheap compared to reading the input.
+constexpr int min_split_size = 32;
+
+// The partial results of each output are combined serially, so limit how many
+// there are.
+constexpr int max_splits = 512;
+
+// Largest workgroup used to reduce a slice of the outer dimension.
+constexpr int max_workgroup_size = 256;
+
+/**
+ * Whether to reduce each slice of the outer dimension across a workgroup
+ * rather than in a single work item.
+ *
+ * With fewer outputs than target_threads / max_splits, a work item per slice
+ * cannot occupy the device. When the inner size is one a workgroup can read
+ * consecutive values of the input instead, as long as the outer dimension is
+ * long enough to give each workgroup slice min_split_size values per work
+ * item.
+ */
+bool use_workgroup_slices(int batches, int outer, int inner) {
+  return inner == 1 && batches * max_splits < target_threads &&
+         outer >= 2 * max_workgroup_size * min_split_size;
+}
+
+/**
+ * Get the power of two workgroup size used to reduce each slice of the outer
+ * dimension.
+ */
+size_t get_slice_workgroup_size(cl::sycl::queue& queue) {
+  size_t const device_max_size =
+      queue.get_device()
+          .get_info<cl::sycl::info::device::max_work_group_size>();
+  size_t const max_size =
+      std::min(device_max_size, static_cast<size_t>(max_workgroup_size));
+  size_t workgroup_size = 1;
+  while (workgroup_size * 2 <= max_size) {
+    workgroup_size *= 2;
+  }
+  return workgroup_size;
+}
+
+}  // namespace
+
+int get_split_count(int batches, int outer, int inner) {
+  int const n_outputs = batches * inner;
+  if (n_outputs >= min_serial_outputs || outer < 2 * min_split_size) {
+    return 1;
+  }
+  int const slice_threads =
+      use_workgroup_slices(batches, outer, inner) ? max_workgroup_size : 1;
+  int const n_splits =
+      std::min({target_threads / (n_outputs * slice_threads),
+                outer / (min_split_size * slice_threads), max_splits});
+  return std::max(n_splits, 1);
+}
+
+// Launch the reduce kernel for the passed parameters, using a work item per
+// output.
 template <typename T, typename Op>
 SNNStatus launch(BaseMemObject<T const>& input, BaseMemObject<T>& output,
                  int batches, int outer, int inner, cl::sycl::queue& queue) {
   return queue_kernel<T, int, Op>(input, output, batches, outer, inner, queue);
 }
 
+// Launch the reduce kernels which split the outer dimension into slices,
+// followed by the kernel combining the partial results of the slices. Each
+// slice is reduced across a workgroup when there are only a few outputs.
+template <typename T, typename Op>
+SNNStatus launch_split(BaseMemObject<T const>& input,
+                       BaseMemObject<typename PartialType<T>::type>& workspace,
+                       BaseMemObject<T>& output, int batches, int outer,
+                       int inner, int n_splits, cl::sycl::queue& queue) {
+  if (n_splits == 1) {
+    return launch<T, Op>(input, output, batches, outer, inner, queue);
+  }
+  if (use_workgroup_slices(batches, outer, inner)) {
+    return queue_workgroup_split_kernel<T, int, Op>(
+        input, workspace, output, batches, outer, n_splits,
+        get_slice_workgroup_size(queue), queue);
+  }
+  return queue_split_kernel<T, int, Op>(input, workspace, output, batches,
+                                        outer, inner, n_splits, queue);
+}
+
+// Launch the index reduce kernel for the passed parameters, using a work item
+// per output.
+template <typename T, typename Op>
+SNNStatus launch_arg(BaseMemObject<T const>& input,
+                     BaseMemObject<int32_t>& output, int batches, int outer,
+                     int inner, cl::sycl::queue& queue) {
+  return queue_arg_kernel<T, int, Op>(input, output, batches, outer, inner,
+                                      queue);
+}
+
+// Launch the index reduce kernels which split the outer dimension into slices,
+// in the same way as the value reductions.
+template <typename T, typename Op>
+SNNStatus launch_arg_split(
+    BaseMemObject<T const>& input,
+    BaseMemObject<typename PartialType<T>::type>& value_workspace,
+    BaseMemObject<int32_t>& index_workspace, BaseMemObject<int32_t>& output,
+    int batches, int outer, int inner, int n_splits, cl::sycl::queue& queue) {
+  if (n_splits == 1) {
+    return launch_arg<T, Op>(input, output, batches, outer, inner, queue);
+  }
+  if (use_workgroup_slices(batches, outer, inner)) {
+    return queue_workgroup_split_arg_kernel<T, int, Op>(
+        input, value_workspace, index_workspace, output, batches, outer,
+        n_splits, get_slice_workgroup_size(queue), queue);
+  }
+  return queue_split_arg_kernel<T, int, Op>(input, value_workspace,
+                                            index_workspace, output, batches,
+                                            outer, inner, n_splits, queue);
+}
+
 #define INSTANTIATE_LAUNCHER(DTYPE, OP)                                  \
   template SNN_EXPORT SNNStatus launch<DTYPE, OP>(                       \
       BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE> & output, \
-      int batches, int outer, int inner, cl::sycl::queue& queue);
+      int batches, int outer, int inner, cl::sycl::queue& queue);        \
+  template SNN_EXPORT SNNStatus launch_split<DTYPE, OP>(                 \
+      BaseMemObject<DTYPE const> & input,                                \
+      BaseMemObject<PartialType<DTYPE>::type> & workspace,               \
+      BaseMemObject<DTYPE> & output, int batches, int outer, int inner,  \
+      int n_splits, cl::sycl::queue& queue);
+
+#define INSTANTIATE_ARG_LAUNCHER(DTYPE, OP)                                \
+  template SNN_EXPORT SNNStatus launch_arg<DTYPE, OP>(                     \
+      BaseMemObject<DTYPE const> & input, BaseMemObject<int32_t> & output, \
+      int batches, int outer, int inner, cl::sycl::queue& queue);          \
+  template SNN_EXPORT SNNStatus launch_arg_split<DTYPE, OP>(               \
+      BaseMemObject<DTYPE const> & input,                                  \
+      BaseMemObject<PartialType<DTYPE>::type> & value_workspace,           \
+      BaseMemObject<int32_t> & index_workspace,                            \
+      BaseMemObject<int32_t> & output, int batches, int outer, int inner,  \
+      int n_splits, cl::sycl::queue& queue);
 
-#define INSTANTIATE_FOR_TYPE(DTYPE) \
-  INSTANTIATE_LAUNCHER(DTYPE, Add)  \
-  INSTANTIATE_LAUNCHER(DTYPE, Mean)
+#define INSTANTIATE_FOR_TYPE(DTYPE)         \
+  INSTANTIATE_LAUNCHER(DTYPE, Add)          \
+  INSTANTIATE_LAUNCHER(DTYPE, Mean)         \
+  INSTANTIATE_LAUNCHER(DTYPE, Max)          \
+  INSTANTIATE_LAUNCHER(DTYPE, Min)          \
+  INSTANTIATE_LAUNCHER(DTYPE, Prod)         \
+  INSTANTIATE_LAUNCHER(DTYPE, SumOfSquares) \
+  INSTANTIATE_LAUNCHER(DTYPE, L2Norm)       \
+  INSTANTIATE_LAUNCHER(DTYPE, LogSumExp)    \
+  INSTANTIATE_ARG_LAUNCHER(DTYPE, ArgMax)   \
+  INSTANTIATE_ARG_LAUNCHER(DTYPE, ArgMin)
 
 INSTANTIATE_FOR_TYPE(float);
 
@@ -51,6 +198,7 @@ INSTANTIATE_FOR_TYPE(cl::sycl::half);
 #endif  // SNN_USE_HALF
 
 #undef INSTANTIATE_FOR_TYPE
+#undef INSTANTIATE_ARG_LAUNCHER
 #undef INSTANTIATE_LAUNCHER
 
 }  // namespace internal
@@ -19,6 +19,11 @@
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
+#include "sycldnn/internal/reduce/launch.h"
+
+#include <cstddef>
+#include <cstdint>
+
 namespace sycldnn {
 namespace reduce {
 namespace internal {
@@ -29,6 +34,66 @@ SNNStatus queue_kernel(BaseMemObject<T const>& input, BaseMemObject<T>& output,
                        int batches, int outer, int inner,
                        cl::sycl::queue& queue);
 
+/**
+ * Add a pair of reduce kernels to the provided SYCL queue, which split the
+ * outer dimension of each output into n_splits slices. The first kernel writes
+ * the partial result of each slice to the workspace, and the second combines
+ * the partial results into the output.
+ */
+template <typename T, typename Index, typename Op>
+SNNStatus queue_split_kernel(
+    BaseMemObject<T const>& input,
+    BaseMemObject<typename PartialType<T>::type>& workspace,
+    BaseMemObject<T>& output, int batches, int outer, int inner, int n_splits,
+    cl::sycl::queue& queue);
+
+/**
+ * Add a pair of reduce kernels to the provided SYCL queue in the same way as
+ * queue_split_kernel, for an inner size of one, where each slice is reduced
+ * across a workgroup of the given power of two size.
+ */
+template <typename T, typename Index, typename Op>
+SNNStatus queue_workgroup_split_kernel(
+    BaseMemObject<T const>& input,
+    BaseMemObject<typename PartialType<T>::type>& workspace,
+    BaseMemObject<T>& output, int batches, int outer, int n_splits,
+    size_t workgroup_size, cl::sycl::queue& queue);
+
+/**
+ * Add a reduce kernel which computes the index of the best value for each
+ * output to the provided SYCL queue.
+ */
+template <typename T, typename Index, typename Op>
+SNNStatus queue_arg_kernel(BaseMemObject<T const>& input,
+                           BaseMemObject<int32_t>& output, int batches,
+                           int outer, int inner, cl::sycl::queue& queue);
+
+/**
+ * Add a pair of reduce kernels which compute the index of the best value for
+ * each output to the provided SYCL queue, splitting the outer dimension in the
+ * same way as queue_split_kernel.
+ */
+template <typename T, typename Index, typename Op>
+SNNStatus queue_split_arg_kernel(
+    BaseMemObject<T const>& input,
+    BaseMemObject<typename PartialType<T>::type>& value_workspace,
+    BaseMemObject<int32_t>& index_workspace, BaseMemObject<int32_t>& output,
+    int batches, int outer, int inner, int n_splits, cl::sycl::queue& queue);
+
+/**
+ * Add a pair of reduce kernels which compute the index of the best value for
+ * each output to the provided SYCL queue in the same way as
+ * queue_split_arg_kernel, for an inner size of one, where each slice is
+ * reduced across a workgroup of the given power of two size.
+ */
+template <typename T, typename Index, typename Op>
+SNNStatus queue_workgroup_split_arg_kernel(
+    BaseMemObject<T const>& input,
+    BaseMemObject<typename PartialType<T>::type>& value_workspace,
+    BaseMemObject<int32_t>& index_workspace, BaseMemObject<int32_t>& output,
+    int batches, int outer, int n_splits, size_t workgroup_size,
+    cl::sycl::queue& queue);
+
 }  // namespace internal
 }  // namespace reduce
 }  // namespace sycldnn
@@ -43,6 +43,172 @@ SNNStatus queue_kernel(BaseMemObject<T const>& input_mem,
   return {event, StatusCode::OK};
 }
 
+template <typename T, typename Index, typename Op>
+SNNStatus queue_split_kernel(
+    BaseMemObject<T const>& input_mem,
+    BaseMemObject<typename PartialType<T>::type>& workspace_mem,
+    BaseMemObject<T>& output_mem, int batches, int outer, int inner,
+    int n_splits, cl::sycl::queue& queue) {
+  auto partial_event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = input_mem.read_accessor(cgh);
+    auto workspace = workspace_mem.write_accessor(cgh);
+
+    using Functor = PartialReduceKernel<T, Index, Op>;
+
+    Functor functor{input, workspace, batches, outer, inner, n_splits};
+
+    cgh.parallel_for(cl::sycl::range<2>(batches, n_splits * inner), functor);
+  });
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto workspace = workspace_mem.read_accessor(cgh);
+    auto output = output_mem.write_accessor(cgh);
+
+    using Functor = FinalizeReduceKernel<T, Index, Op>;
+
+    Functor functor{workspace, output, batches, outer, inner, n_splits};
+
+    cgh.parallel_for(cl::sycl::range<2>(batches, inner), functor);
+  });
+  SNNStatus status{partial_event, StatusCode::OK};
+  return status.append(event);
+}
+
+template <typename T, typename Index, typename Op>
+SNNStatus queue_workgroup_split_kernel(
+    BaseMemObject<T const>& input_mem,
+    BaseMemObject<typename PartialType<T>::type>& workspace_mem,
+    BaseMemObject<T>& output_mem, int batches, int outer, int n_splits,
+    size_t workgroup_size, cl::sycl::queue& queue) {
+  int const inner = 1;
+  auto partial_event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = input_mem.read_accessor(cgh);
+    auto workspace = workspace_mem.write_accessor(cgh);
+
+    using Functor = WorkgroupPartialReduceKernel<T, Index, Op>;
+    using Accumulator = typename Functor::Accumulator;
+    LocalAccessor<Accumulator> scratch{cl::sycl::range<1>{workgroup_size},
+                                       cgh};
+
+    Functor functor{input, scratch, workspace, batches, outer, n_splits};
+
+    size_t const n_partials = static_cast<size_t>(batches) * n_splits;
+    cgh.parallel_for(
+        cl::sycl::nd_range<1>{cl::sycl::range<1>{n_partials * workgroup_size},
+                              cl::sycl::range<1>{workgroup_size}},
+        functor);
+  });
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto workspace = workspace_mem.read_accessor(cgh);
+    auto output = output_mem.write_accessor(cgh);
+
+    using Functor = FinalizeReduceKernel<T, Index, Op>;
+
+    Functor functor{workspace, output, batches, outer, inner, n_splits};
+
+    cgh.parallel_for(cl::sycl::range<2>(batches, inner), functor);
+  });
+  SNNStatus status{partial_event, StatusCode::OK};
+  return status.append(event);
+}
+
+template <typename T, typename Index, typename Op>
+SNNStatus queue_arg_kernel(BaseMemObject<T const>& input_mem,
+                           BaseMemObject<int32_t>& output_mem, int batches,
+                           int outer, int inner, cl::sycl::queue& queue) {
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = input_mem.read_accessor(cgh);
+    auto output = output_mem.write_accessor(cgh);
+
+    using Functor = ArgReduceKernel<T, Index, Op>;
+
+    Functor functor{input, output, outer, inner};
+
+    cgh.parallel_for(cl::sycl::range<2>(batches, inner), functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, typename Index, typename Op>
+SNNStatus queue_split_arg_kernel(
+    BaseMemObject<T const>& input_mem,
+    BaseMemObject<typename PartialType<T>::type>& value_workspace_mem,
+    BaseMemObject<int32_t>& index_workspace_mem,
+    BaseMemObject<int32_t>& output_mem, int batches, int outer, int inner,
+    int n_splits, cl::sycl::queue& queue) {
+  auto partial_event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = input_mem.read_accessor(cgh);
+    auto value_workspace = value_workspace_mem.write_accessor(cgh);
+    auto index_workspace = index_workspace_mem.write_accessor(cgh);
+
+    using Functor = PartialArgReduceKernel<T, Index, Op>;
+
+    Functor functor{input, value_workspace, index_workspace, outer, inner,
+                    n_splits};
+
+    cgh.parallel_for(cl::sycl::range<2>(batches, n_splits * inner), functor);
+  });
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto value_workspace = value_workspace_mem.read_accessor(cgh);
+    auto index_workspace = index_workspace_mem.read_accessor(cgh);
+    auto output = output_mem.write_accessor(cgh);
+
+    using Functor = FinalizeArgReduceKernel<T, Index, Op>;
+
+    Functor functor{value_workspace, index_workspace, output, inner,
+                    n_splits};
+
+    cgh.parallel_for(cl::sycl::range<2>(batches, inner), functor);
+  });
+  SNNStatus status{partial_event, StatusCode::OK};
+  return status.append(event);
+}
+
+template <typename T, typename Index, typename Op>
+SNNStatus queue_workgroup_split_arg_kernel(
+    BaseMemObject<T const>& input_mem,
+    BaseMemObject<typename PartialType<T>::type>& value_workspace_mem,
+    BaseMemObject<int32_t>& index_workspace_mem,
+    BaseMemObject<int32_t>& output_mem, int batches, int outer, int n_splits,
+    size_t workgroup_size, cl::sycl::queue& queue) {
+  int const inner = 1;
+  auto partial_event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input = input_mem.read_accessor(cgh);
+    auto value_workspace = value_workspace_mem.write_accessor(cgh);
+    auto index_workspace = index_workspace_mem.write_accessor(cgh);
+
+    using Functor = WorkgroupPartialArgReduceKernel<T, Index, Op>;
+    using Accumulator = typename Functor::Accumulator;
+    LocalAccessor<Accumulator> value_scratch{
+        cl::sycl::range<1>{workgroup_size}, cgh};
+    LocalAccessor<Index> index_scratch{cl::sycl::range<1>{workgroup_size},
+                                       cgh};
+
+    Functor functor{input,           value_scratch, index_scratch,
+                    value_workspace, index_workspace, outer,
+                    n_splits};
+
+    size_t const n_partials = static_cast<size_t>(batches) * n_splits;
+    cgh.parallel_for(
+        cl::sycl::nd_range<1>{cl::sycl::range<1>{n_partials * workgroup_size},
+                              cl::sycl::range<1>{workgroup_size}},
+        functor);
+  });
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto value_workspace = value_workspace_mem.read_accessor(cgh);
+    auto index_workspace = index_workspace_mem.read_accessor(cgh);
+    auto output = output_mem.write_accessor(cgh);
+
+    using Functor = FinalizeArgReduceKernel<T, Index, Op>;
+
+    Functor functor{value_workspace, index_workspace, output, inner,
+                    n_splits};
+
+    cgh.parallel_for(cl::sycl::range<2>(batches, inner), functor);
+  });
+  SNNStatus status{partial_event, StatusCode::OK};
+  return status.append(event);
+}
+
 }  // namespace internal
 }  // namespace reduce
 }  // namespace sycldnn
@@ -0,0 +1,184 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_SOFTMAX_KERNELS_H_
+#define SYCLDNN_SRC_SOFTMAX_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "src/helpers/accumulator_type.h"
+#include "src/helpers/vector_io.h"
+#include "src/helpers/workgroup_reduce.h"
+
+#include <limits>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace softmax {
+namespace internal {
+
+/**
+ * Softmax along the innermost dimension, computed by one workgroup per row.
+ *
+ * Each work item makes a single pass over its part of the row, tracking the
+ * largest value seen and the sum of exponentials relative to that value. The
+ * sum is rescaled whenever the maximum changes, so the exponentials never
+ * overflow. The workgroup then reduces the maxima and the rescaled sums, and
+ * the normalised outputs are written in a second pass over the row.
+ *
+ * Assumes that the workgroup size is a power of two, and that the workspace
+ * holds at least one element per work item.
+ */
+template <typename T, typename Index>
+struct SoftmaxForwardKernel {
+  using Accumulator = typename helpers::AccumulatorType<T>::type;
+  using Load = helpers::io::Load<T>;
+  using Store = helpers::io::Store<T>;
+
+  SoftmaxForwardKernel(ReadAccessor<T const> const& input,
+                       LocalAccessor<Accumulator> const& workspace,
+                       WriteAccessor<T> const& output, Index channels)
+      : input_{input},
+        workspace_{workspace},
+        output_{output},
+        channels_{channels} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<1> item) {
+    Index const row_offset = item.get_group(0) * channels_;
+    Index const local_id = item.get_local_id(0);
+    Index const local_range = item.get_local_range(0);
+    auto const input = input_.get_pointer();
+    auto output = output_.get_pointer();
+    auto workspace = workspace_.get_pointer();
+
+    Accumulator max = std::numeric_limits<Accumulator>::lowest();
+    Accumulator sum{0};
+    for (Index c = local_id; c < channels_; c += local_range) {
+      auto const value =
+          static_cast<Accumulator>(Load()(input, row_offset + c));
+      if (value > max) {
+        sum = sum * cl::sycl::exp(max - value) + Accumulator{1};
+        max = value;
+      } else {
+        sum += cl::sycl::exp(value - max);
+      }
+    }
+
+    // The reductions have to be outside any conditional, to ensure that all
+    // threads reach the barriers used in the reduction.
+    auto row_max =
+        helpers::reduce::workgroup_reduce<helpers::reduce::Max, Index>(
+            max, item, workspace);
+    row_max = helpers::reduce::broadcast_from_first(row_max, item, workspace);
+
+    sum *= cl::sycl::exp(max - row_max);
+    auto row_sum =
+        helpers::reduce::workgroup_reduce<helpers::reduce::Sum, Index>(
+            sum, item, workspace);
+    row_sum = helpers::reduce::broadcast_from_first(row_sum, item, workspace);
+
+    for (Index c = local_id; c < channels_; c += local_range) {
+      auto const value =
+          static_cast<Accumulator>(Load()(input, row_offset + c));
+      Store()(output, row_offset + c,
+              static_cast<T>(cl::sycl::exp(value - row_max) / row_sum));
+    }
+  }
+
+ private:
+  ReadAccessor<T const> input_;
+  LocalAccessor<Accumulator> workspace_;
+  WriteAccessor<T> output_;
+  Index const channels_;
+};
+
+/**
+ * Gradient of a softmax along the innermost dimension, computed by one
+ * workgroup per row.
+ *
+ * Given the softmax output y and the gradient dy with respect to it, the
+ * gradient with respect to the softmax input is y * (dy - sum(dy * y)). The
+ * workgroup reduces the sum over the row, then each work item writes its part
+ * of the output, so no intermediate tensors are needed.
+ *
+ * Assumes that the workgroup size is a power of two, and that the workspace
+ * holds at least one element per work item.
+ */
+template <typename T, typename Index>
+struct SoftmaxGradientKernel {
+  using Accumulator = typename helpers::AccumulatorType<T>::type;
+  using Load = helpers::io::Load<T>;
+  using Store = helpers::io::Store<T>;
+
+  SoftmaxGradientKernel(ReadAccessor<T const> const& output,
+                        ReadAccessor<T const> const& gradient,
+                        LocalAccessor<Accumulator> const& workspace,
+                        WriteAccessor<T> const& input_backprop, Index channels)
+      : output_{output},
+        gradient_{gradient},
+        workspace_{workspace},
+        input_backprop_{input_backprop},
+        channels_{channels} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<1> item) {
+    Index const row_offset = item.get_group(0) * channels_;
+    Index const local_id = item.get_local_id(0);
+    Index const local_range = item.get_local_range(0);
+    auto const output = output_.get_pointer();
+    auto const gradient = gradient_.get_pointer();
+    auto input_backprop = input_backprop_.get_pointer();
+    auto workspace = workspace_.get_pointer();
+
+    Accumulator sum{0};
+    for (Index c = local_id; c < channels_; c += local_range) {
+      auto const value =
+          static_cast<Accumulator>(Load()(output, row_offset + c));
+      auto const grad =
+          static_cast<Accumulator>(Load()(gradient, row_offset + c));
+      sum += value * grad;
+    }
+
+    // The reduction has to be outside any conditional, to ensure that all
+    // threads reach the barriers used in the reduction.
+    auto row_sum =
+        helpers::reduce::workgroup_reduce<helpers::reduce::Sum, Index>(
+            sum, item, workspace);
+    row_sum = helpers::reduce::broadcast_from_first(row_sum, item, workspace);
+
+    for (Index c = local_id; c < channels_; c += local_range) {
+      auto const value =
+          static_cast<Accumulator>(Load()(output, row_offset + c));
+      auto const grad =
+          static_cast<Accumulator>(Load()(gradient, row_offset + c));
+      Store()(input_backprop, row_offset + c,
+              static_cast<T>(value * (grad - row_sum)));
+    }
+  }
+
+ private:
+  ReadAccessor<T const> output_;
+  ReadAccessor<T const> gradient_;
+  LocalAccessor<Accumulator> workspace_;
+  WriteAccessor<T> input_backprop_;
+  Index const channels_;
+};
+
+}  // namespace internal
+}  // namespace softmax
+}  // namespace sycldnn
+#endif  // SYCLDNN_SRC_SOFTMAX_KERNELS_H_
@@ -0,0 +1,136 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/internal/softmax/launch.h"
+
+#include "src/softmax/kernels.h"
+
+#include <algorithm>
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace softmax {
+namespace internal {
+
+namespace {
+
+// Largest workgroup used to reduce a single row. Longer rows are strided over
+// by the work items, so larger workgroups just leave more items idle at the
+// barriers.
+constexpr size_t max_row_workgroup_size = 256;
+
+/**
+ * Get the power of two workgroup size used to reduce rows of the given length.
+ */
+size_t get_row_workgroup_size(int channels, cl::sycl::queue& queue) {
+  size_t const device_max_size =
+      queue.get_device()
+          .get_info<cl::sycl::info::device::max_work_group_size>();
+  size_t const max_size = std::min(device_max_size, max_row_workgroup_size);
+  size_t workgroup_size = 1;
+  while (workgroup_size < static_cast<size_t>(channels) &&
+         workgroup_size * 2 <= max_size) {
+    workgroup_size *= 2;
+  }
+  return workgroup_size;
+}
+
+}  // namespace
+
+template <typename T>
+SNNStatus launch_softmax_forward(BaseMemObject<T const>& input,
+                                 BaseMemObject<T>& output, int n_rows,
+                                 int channels, cl::sycl::queue& queue) {
+  using Kernel = SoftmaxForwardKernel<T, int>;
+  using Accumulator = typename Kernel::Accumulator;
+  size_t const workgroup_size = get_row_workgroup_size(channels, queue);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto input_acc = input.read_accessor(cgh);
+    auto output_acc = output.write_accessor(cgh);
+    LocalAccessor<Accumulator> workspace{cl::sycl::range<1>{workgroup_size},
+                                         cgh};
+    Kernel kernel{input_acc, workspace, output_acc, channels};
+
+    cgh.parallel_for(
+        cl::sycl::nd_range<1>{
+            cl::sycl::range<1>{static_cast<size_t>(n_rows) * workgroup_size},
+            cl::sycl::range<1>{workgroup_size}},
+        kernel);
+  });
+
+  return {event, StatusCode::OK};
+}
+
+template <typename T>
+SNNStatus launch_softmax_gradient(BaseMemObject<T const>& output,
+                                  BaseMemObject<T const>& gradient,
+                                  BaseMemObject<T>& input_backprop,
+                                  int n_rows, int channels,
+                                  cl::sycl::queue& queue) {
+  using Kernel = SoftmaxGradientKernel<T, int>;
+  using Accumulator = typename Kernel::Accumulator;
+  size_t const workgroup_size = get_row_workgroup_size(channels, queue);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    auto output_acc = output.read_accessor(cgh);
+    auto gradient_acc = gradient.read_accessor(cgh);
+    auto input_backprop_acc = input_backprop.write_accessor(cgh);
+    LocalAccessor<Accumulator> workspace{cl::sycl::range<1>{workgroup_size},
+                                         cgh};
+    Kernel kernel{output_acc, gradient_acc, workspace, input_backprop_acc,
+                  channels};
+
+    cgh.parallel_for(
+        cl::sycl::nd_range<1>{
+            cl::sycl::range<1>{static_cast<size_t>(n_rows) * workgroup_size},
+            cl::sycl::range<1>{workgroup_size}},
+        kernel);
+  });
+
+  return {event, StatusCode::OK};
+}
+
+#define INSTANTIATE_LAUNCH(DTYPE)                                        \
+  template SNN_EXPORT SNNStatus launch_softmax_forward<DTYPE>(           \
+      BaseMemObject<DTYPE const> & input, BaseMemObject<DTYPE> & output, \
+      int n_rows, int channels, cl::sycl::queue& queue);                 \
+  template SNN_EXPORT SNNStatus launch_softmax_gradient<DTYPE>(          \
+      BaseMemObject<DTYPE const> & output,                               \
+      BaseMemObject<DTYPE const> & gradient,                             \
+      BaseMemObject<DTYPE> & input_backprop, int n_rows, int channels,   \
+      cl::sycl::queue& queue)
+
+INSTANTIATE_LAUNCH(float);
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_LAUNCH(cl::sycl::half);
+#endif
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_LAUNCH(double);
+#endif
+
+#undef INSTANTIATE_LAUNCH
+
+}  // namespace internal
+}  // namespace softmax
+}  // namespace sycldnn
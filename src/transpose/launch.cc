@@ -52,9 +52,16 @@ struct Transposer<T, Index, 1> {
                              std::vector<int> const& /*permutation*/,
                              cl::sycl::queue& queue) {
     auto event = queue.submit([&](cl::sycl::handler& cgh) {
-      auto input = input_mem.read_accessor(cgh).get_accessor();
-      auto output = output_mem.write_accessor(cgh).get_accessor();
-      cgh.copy(input, output);
+      auto input = input_mem.read_accessor(cgh);
+      auto output = output_mem.write_accessor(cgh);
+#ifdef SNN_USE_USM
+      if (input.is_usm()) {
+        cgh.memcpy(output.get_usm_pointer(), input.get_usm_pointer(),
+                   output.get_extent() * sizeof(T));
+        return;
+      }
+#endif  // SNN_USE_USM
+      cgh.copy(input.get_accessor(), output.get_accessor());
     });
     return {event, StatusCode::OK};
   }
@@ -19,6 +19,10 @@
 
 #include "src/backend/snn_backend_provider.h"
 
+#ifdef SNN_USE_USM
+#include "src/backend/usm_backend_provider.h"
+#endif  // SNN_USE_USM
+
 #if defined(SNN_TEST_EIGEN) || defined(SNN_TEST_EIGEN_MATMULS)
 #include <unsupported/Eigen/CXX11/Tensor>
 
@@ -0,0 +1,232 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/padding_mode.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/backend/buffer_pool.h"
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "sycldnn/conv2d/selector/constant_selector.h"
+
+#include "sycldnn/helpers/padding.h"
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "sycldnn/matmul/launch.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Backend = sycldnn::backend::SNNBackend;
+using BufferPool = sycldnn::backend::BufferPool;
+
+struct BufferPoolTest : public BackendTestFixture<Backend> {
+ protected:
+  BufferPoolTest()
+      : pool_{std::make_shared<BufferPool>()},
+        pooled_backend_{provider_.get_backend().get_queue(), pool_} {}
+
+  std::shared_ptr<BufferPool> pool_;
+  Backend pooled_backend_;
+};
+
+TEST_F(BufferPoolTest, BucketSizes) {
+  EXPECT_EQ(256u, BufferPool::bucket_size(0));
+  EXPECT_EQ(256u, BufferPool::bucket_size(1));
+  EXPECT_EQ(256u, BufferPool::bucket_size(256));
+  EXPECT_EQ(512u, BufferPool::bucket_size(257));
+  EXPECT_EQ(4096u, BufferPool::bucket_size(3000));
+}
+
+TEST_F(BufferPoolTest, ReuseReturnedBuffer) {
+  auto first = pooled_backend_.allocate<float>(100);
+  auto stats = pool_->get_stats();
+  EXPECT_EQ(0u, stats.hits);
+  EXPECT_EQ(1u, stats.misses);
+  EXPECT_EQ(512u, stats.bytes_in_use);
+  EXPECT_EQ(0u, stats.bytes_cached);
+
+  pooled_backend_.deallocate(first);
+  stats = pool_->get_stats();
+  EXPECT_EQ(0u, stats.bytes_in_use);
+  EXPECT_EQ(512u, stats.bytes_cached);
+
+  auto second = pooled_backend_.allocate<float>(120);
+  stats = pool_->get_stats();
+  EXPECT_EQ(1u, stats.hits);
+  EXPECT_EQ(1u, stats.misses);
+  EXPECT_EQ(512u, stats.bytes_in_use);
+  EXPECT_EQ(0u, stats.bytes_cached);
+  EXPECT_EQ(512u, stats.peak_bytes);
+  pooled_backend_.deallocate(second);
+}
+
+TEST_F(BufferPoolTest, ReuseAcrossDataTypes) {
+  pooled_backend_.deallocate(pooled_backend_.allocate<float>(64));
+  auto ptr = pooled_backend_.allocate<int8_t>(200);
+  EXPECT_EQ(256u, ptr.get_buffer().get_count());
+  auto stats = pool_->get_stats();
+  EXPECT_EQ(1u, stats.hits);
+  EXPECT_EQ(1u, stats.misses);
+  pooled_backend_.deallocate(ptr);
+}
+
+TEST_F(BufferPoolTest, DifferentBucketsDoNotShare) {
+  auto small = pooled_backend_.allocate<float>(10);
+  auto large = pooled_backend_.allocate<float>(1000);
+  pooled_backend_.deallocate(small);
+  pooled_backend_.deallocate(large);
+  auto stats = pool_->get_stats();
+  EXPECT_EQ(2u, stats.misses);
+  EXPECT_EQ(256u + 4096u, stats.bytes_cached);
+  EXPECT_EQ(256u + 4096u, stats.peak_bytes);
+
+  pool_->clear();
+  stats = pool_->get_stats();
+  EXPECT_EQ(0u, stats.bytes_cached);
+  EXPECT_EQ(256u + 4096u, stats.peak_bytes);
+
+  pooled_backend_.deallocate(pooled_backend_.allocate<float>(10));
+  EXPECT_EQ(3u, pool_->get_stats().misses);
+}
+
+TEST_F(BufferPoolTest, Im2colWorkspaceReused) {
+  using Forward = sycldnn::conv2d::conv_type::Forward;
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 4;
+  params.features = 8;
+  params.batch = 2;
+  params.in_rows = 7;
+  params.in_cols = 9;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params = sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::SAME);
+  auto sizes = sycldnn::conv2d::get_sizes<Forward>(params);
+
+  auto& provider = this->provider_;
+  std::vector<float> input = iota_initialised_data(sizes.input_size, 16.f);
+  std::vector<float> filter = iota_initialised_data(sizes.filter_size, 8.f);
+  std::vector<float> first(sizes.output_size);
+  std::vector<float> second(sizes.output_size);
+  auto inp_gpu = provider.get_initialised_device_memory(input.size(), input);
+  auto fil_gpu = provider.get_initialised_device_memory(filter.size(), filter);
+  auto first_gpu = provider.get_initialised_device_memory(first.size(), first);
+  auto second_gpu =
+      provider.get_initialised_device_memory(second.size(), second);
+  SNN_ON_SCOPE_EXIT {
+    provider.deallocate_ptr(inp_gpu);
+    provider.deallocate_ptr(fil_gpu);
+    provider.deallocate_ptr(first_gpu);
+    provider.deallocate_ptr(second_gpu);
+  };
+
+  sycldnn::conv2d::ConstantSelector<sycldnn::conv2d::Algorithm::Im2col>
+      selector{};
+  auto status = sycldnn::conv2d::launch<float, Forward>(
+      inp_gpu, fil_gpu, first_gpu, params, selector, pooled_backend_);
+  ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+  auto stats = pool_->get_stats();
+  EXPECT_EQ(0u, stats.bytes_in_use);
+  size_t const misses = stats.misses;
+  EXPECT_LT(0u, misses);
+
+  status = sycldnn::conv2d::launch<float, Forward>(
+      inp_gpu, fil_gpu, second_gpu, params, selector, pooled_backend_);
+  ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+  status.event.wait_and_throw();
+  stats = pool_->get_stats();
+  EXPECT_EQ(misses, stats.misses);
+  EXPECT_LE(misses, stats.hits);
+
+  provider.copy_device_data_to_host(first.size(), first_gpu, first);
+  provider.copy_device_data_to_host(second.size(), second_gpu, second);
+  for (size_t i = 0; i < first.size(); ++i) {
+    SCOPED_TRACE("Element: " + std::to_string(i));
+    EXPECT_EQ(first[i], second[i]);
+  }
+}
+
+TEST_F(BufferPoolTest, OnlyPooledBackendDeallocatesAsync) {
+  EXPECT_FALSE(this->provider_.get_backend().deallocate_is_async());
+  EXPECT_TRUE(pooled_backend_.deallocate_is_async());
+}
+
+TEST_F(BufferPoolTest, SplitKWorkspaceReused) {
+  // A small output with a long accumulation dimension uses split-K.
+  int const m = 8;
+  int const k = 4096;
+  int const n = 8;
+  ASSERT_LT(1, sycldnn::matmul::get_split_k_count(1, m, k, n));
+
+  auto& provider = this->provider_;
+  std::vector<float> lhs = iota_initialised_data(m * k, 8.f);
+  std::vector<float> rhs = iota_initialised_data(k * n, 8.f);
+  std::vector<float> first(m * n);
+  std::vector<float> second(m * n);
+  auto lhs_gpu = provider.get_initialised_device_memory(lhs.size(), lhs);
+  auto rhs_gpu = provider.get_initialised_device_memory(rhs.size(), rhs);
+  auto first_gpu = provider.get_initialised_device_memory(first.size(), first);
+  auto second_gpu =
+      provider.get_initialised_device_memory(second.size(), second);
+  SNN_ON_SCOPE_EXIT {
+    provider.deallocate_ptr(lhs_gpu);
+    provider.deallocate_ptr(rhs_gpu);
+    provider.deallocate_ptr(first_gpu);
+    provider.deallocate_ptr(second_gpu);
+  };
+
+  using ConstPointer = Backend::internal_pointer_type<float const>;
+  ConstPointer lhs_ptr = pooled_backend_.to_internal_pointer(lhs_gpu);
+  ConstPointer rhs_ptr = pooled_backend_.to_internal_pointer(rhs_gpu);
+
+  pooled_backend_.matmul<false, false>(lhs_ptr, rhs_ptr, first_gpu, 0.f, m, k,
+                                       n);
+  auto stats = pool_->get_stats();
+  EXPECT_EQ(0u, stats.bytes_in_use);
+  EXPECT_EQ(1u, stats.misses);
+
+  auto event = pooled_backend_.matmul<false, false>(lhs_ptr, rhs_ptr,
+                                                    second_gpu, 0.f, m, k, n);
+  event.wait_and_throw();
+  stats = pool_->get_stats();
+  EXPECT_EQ(1u, stats.misses);
+  EXPECT_EQ(1u, stats.hits);
+
+  provider.copy_device_data_to_host(first.size(), first_gpu, first);
+  provider.copy_device_data_to_host(second.size(), second_gpu, second);
+  for (size_t i = 0; i < first.size(); ++i) {
+    SCOPED_TRACE("Element: " + std::to_string(i));
+    EXPECT_EQ(first[i], second[i]);
+  }
+}
+
+}  // namespace
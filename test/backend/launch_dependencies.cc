@@ -0,0 +1,151 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/status.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "sycldnn/conv2d/selector/winograd_selector.h"
+
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "sycldnn/internal/helpers/scoped_dependencies.h"
+
+#include "sycldnn/pointwise/direction.h"
+#include "sycldnn/pointwise/launch.h"
+#include "sycldnn/pointwise/operators.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace {
+
+using Backend = sycldnn::backend::SNNBackend;
+using Forward = sycldnn::conv2d::conv_type::Forward;
+
+struct LaunchDependenciesTest : public BackendTestFixture<Backend> {};
+
+TEST_F(LaunchDependenciesTest, ScopedDependenciesAreRestored) {
+  auto& backend = provider_.get_backend();
+  std::vector<cl::sycl::event> const outer{cl::sycl::event{}};
+  backend.set_dependencies(outer);
+  {
+    sycldnn::internal::helpers::ScopedDependencies<Backend> scoped{
+        backend, {cl::sycl::event{}, cl::sycl::event{}}};
+#if SNN_HAS_DEPENDS_ON
+    EXPECT_EQ(3u, backend.get_dependencies().size());
+#else
+    EXPECT_EQ(1u, backend.get_dependencies().size());
+#endif
+  }
+  EXPECT_EQ(1u, backend.get_dependencies().size());
+  backend.set_dependencies({});
+}
+
+TEST_F(LaunchDependenciesTest, WinogradReturnsAllEvents) {
+  sycldnn::conv2d::Conv2DParams params{};
+  params.channels = 2;
+  params.features = 2;
+  params.batch = 1;
+  params.in_rows = 4;
+  params.in_cols = 4;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 2;
+  params.out_cols = 2;
+  params.pad_rows = 0;
+  params.pad_cols = 0;
+  auto const sizes = sycldnn::conv2d::get_sizes<Forward>(params);
+
+  auto& provider = provider_;
+  std::vector<float> input = iota_initialised_data(sizes.input_size, 4.f);
+  std::vector<float> filter = iota_initialised_data(sizes.filter_size, 4.f);
+  std::vector<float> output(sizes.output_size);
+  auto inp_gpu =
+      provider.get_initialised_device_memory(sizes.input_size, input);
+  auto fil_gpu =
+      provider.get_initialised_device_memory(sizes.filter_size, filter);
+  auto out_gpu =
+      provider.get_initialised_device_memory(sizes.output_size, output);
+  SNN_ON_SCOPE_EXIT {
+    provider.deallocate_ptr(inp_gpu);
+    provider.deallocate_ptr(fil_gpu);
+    provider.deallocate_ptr(out_gpu);
+  };
+
+  sycldnn::conv2d::WinogradSelector selector;
+  auto status = sycldnn::conv2d::launch<float, Forward>(
+      inp_gpu, fil_gpu, out_gpu, params, selector, provider.get_backend());
+  ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+  // Filter transform, input transform, matmul and output transform.
+  ASSERT_LE(4u, status.events.size());
+  cl::sycl::event::wait_and_throw(status.events);
+}
+
+TEST_F(LaunchDependenciesTest, ChainedPointwiseLaunches) {
+  using Forward = sycldnn::pointwise::Forward;
+  size_t const size = 64;
+  auto& provider = provider_;
+  std::vector<float> input = iota_initialised_signed_data<float>(size);
+  for (auto& value : input) {
+    value /= 4.f;
+  }
+  std::vector<float> intermediate(size);
+  std::vector<float> output(size);
+  auto inp_gpu = provider.get_initialised_device_memory(size, input);
+  auto mid_gpu = provider.get_initialised_device_memory(size, intermediate);
+  auto out_gpu = provider.get_initialised_device_memory(size, output);
+  SNN_ON_SCOPE_EXIT {
+    provider.deallocate_ptr(inp_gpu);
+    provider.deallocate_ptr(mid_gpu);
+    provider.deallocate_ptr(out_gpu);
+  };
+
+  auto& backend = provider.get_backend();
+  auto first =
+      sycldnn::pointwise::launch<float, sycldnn::pointwise::Relu, Forward>(
+          inp_gpu, mid_gpu, size, backend);
+  ASSERT_EQ(sycldnn::StatusCode::OK, first.status);
+  auto second =
+      sycldnn::pointwise::launch<float, sycldnn::pointwise::Floor, Forward>(
+          mid_gpu, out_gpu, size, backend, first.events);
+  ASSERT_EQ(sycldnn::StatusCode::OK, second.status);
+  EXPECT_TRUE(backend.get_dependencies().empty());
+  second.event.wait_and_throw();
+
+  provider.copy_device_data_to_host(size, out_gpu, output);
+  for (size_t i = 0; i < size; ++i) {
+    SCOPED_TRACE("Element: " + std::to_string(i));
+    float const relu = input[i] > 0.f ? input[i] : 0.f;
+    EXPECT_EQ(std::floor(relu), output[i]);
+  }
+}
+
+}  // namespace
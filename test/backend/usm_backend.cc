@@ -0,0 +1,173 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/padding_mode.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/backend/usm_backend.h"
+
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "sycldnn/conv2d/selector/constant_selector.h"
+
+#include "sycldnn/helpers/padding.h"
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "sycldnn/pointwise/launch.h"
+#include "sycldnn/pointwise/operators.h"
+
+#include "sycldnn/transpose/launch.h"
+
+#include "src/backend/snn_backend_provider.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Algorithm = sycldnn::conv2d::Algorithm;
+using Forward = sycldnn::conv2d::conv_type::Forward;
+
+struct USMBackendTest
+    : public BackendTestFixture<sycldnn::backend::USMBackend> {
+ protected:
+  /**
+   * Compute a convolution using the USM backend and compare against the same
+   * convolution computed using the buffer based SNNBackend.
+   */
+  template <Algorithm Algo>
+  void test_conv(sycldnn::conv2d::Conv2DParams const& params) {
+    auto sizes = sycldnn::conv2d::get_sizes<Forward>(params);
+    std::vector<float> input = iota_initialised_data(sizes.input_size, 16.f);
+    std::vector<float> filter = iota_initialised_data(sizes.filter_size, 8.f);
+    std::vector<float> output(sizes.output_size);
+    std::vector<float> exp_output(sizes.output_size);
+    sycldnn::conv2d::ConstantSelector<Algo> selector{};
+
+    auto& provider = this->provider_;
+    auto inp_usm = provider.get_initialised_device_memory(input.size(), input);
+    auto fil_usm =
+        provider.get_initialised_device_memory(filter.size(), filter);
+    auto out_usm =
+        provider.get_initialised_device_memory(output.size(), output);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(inp_usm);
+      provider.deallocate_ptr(fil_usm);
+      provider.deallocate_ptr(out_usm);
+    };
+    auto status = sycldnn::conv2d::launch<float, Forward>(
+        inp_usm, fil_usm, out_usm, params, selector, provider.get_backend());
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+    provider.copy_device_data_to_host(output.size(), out_usm, output);
+
+    auto& buffer_provider = buffer_provider_;
+    auto inp_gpu =
+        buffer_provider.get_initialised_device_memory(input.size(), input);
+    auto fil_gpu =
+        buffer_provider.get_initialised_device_memory(filter.size(), filter);
+    auto out_gpu = buffer_provider.get_initialised_device_memory(
+        exp_output.size(), exp_output);
+    status = sycldnn::conv2d::launch<float, Forward>(
+        inp_gpu, fil_gpu, out_gpu, params, selector,
+        buffer_provider.get_backend());
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+    buffer_provider.copy_device_data_to_host(exp_output.size(), out_gpu,
+                                             exp_output);
+
+    for (size_t i = 0; i < output.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL(exp_output[i], output[i], 10u);
+    }
+  }
+
+  sycldnn::backend::BackendProvider<sycldnn::backend::SNNBackend>
+      buffer_provider_;
+};
+
+sycldnn::conv2d::Conv2DParams get_params() {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 8;
+  params.features = 16;
+  params.batch = 2;
+  params.in_rows = 9;
+  params.in_cols = 7;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  return sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::SAME);
+}
+
+TEST_F(USMBackendTest, DirectConv2D) {
+  this->test_conv<Algorithm::Direct>(get_params());
+}
+TEST_F(USMBackendTest, Im2colConv2D) {
+  this->test_conv<Algorithm::Im2col>(get_params());
+}
+TEST_F(USMBackendTest, WinogradConv2D) {
+  this->test_conv<Algorithm::Winograd>(get_params());
+}
+
+TEST_F(USMBackendTest, ChainedPointwiseAndTranspose) {
+  std::vector<float> input = iota_initialised_data(48, 16.f);
+  std::for_each(begin(input), end(input), [](float& val) { val -= 8; });
+  std::vector<float> relu(input.size());
+  std::vector<float> copied(input.size());
+
+  auto& provider = this->provider_;
+  auto& backend = provider.get_backend();
+  auto inp_usm = provider.get_initialised_device_memory(input.size(), input);
+  auto relu_usm = provider.get_initialised_device_memory(relu.size(), relu);
+  auto copied_usm =
+      provider.get_initialised_device_memory(copied.size(), copied);
+  SNN_ON_SCOPE_EXIT {
+    provider.deallocate_ptr(inp_usm);
+    provider.deallocate_ptr(relu_usm);
+    provider.deallocate_ptr(copied_usm);
+  };
+
+  auto status = sycldnn::pointwise::launch<float, sycldnn::pointwise::Relu,
+                                           sycldnn::pointwise::Forward>(
+      inp_usm, relu_usm, input.size(), backend);
+  ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+  backend.set_dependencies({status.event});
+  status = sycldnn::transpose::launch<float>(
+      relu_usm, copied_usm, {static_cast<int>(input.size())}, {0}, backend);
+  ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+  backend.set_dependencies({});
+  status.event.wait_and_throw();
+
+  provider.copy_device_data_to_host(copied.size(), copied_usm, copied);
+  for (size_t i = 0; i < input.size(); ++i) {
+    SCOPED_TRACE("Element: " + std::to_string(i));
+    EXPECT_EQ(std::max(input[i], 0.f), copied[i]);
+  }
+}
+
+}  // namespace
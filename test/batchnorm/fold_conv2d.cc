@@ -0,0 +1,180 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/filter_format.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/batchnorm/fold.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+#include "test/types/cartesian_product.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <cmath>
+#include <vector>
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Backends = sycldnn::types::AllBackendTypes;
+
+using TypeBackendPairs =
+    sycldnn::types::CartesianProduct<DataTypeList, Backends>::type;
+
+using GTestTypePairs = sycldnn::types::ToGTestTypes<TypeBackendPairs>::type;
+
+namespace {
+
+sycldnn::conv2d::Conv2DParams get_fold_params(
+    int channels, int features, int window, int groups,
+    sycldnn::FilterFormat filter_format) {
+  sycldnn::conv2d::Conv2DParams params{};
+  params.channels = channels;
+  params.features = features;
+  params.batch = 1;
+  params.in_rows = window;
+  params.in_cols = window;
+  params.window_rows = window;
+  params.window_cols = window;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 1;
+  params.out_cols = 1;
+  params.pad_rows = 0;
+  params.pad_cols = 0;
+  params.groups = groups;
+  params.filter_format = filter_format;
+  return params;
+}
+
+}  // namespace
+
+template <typename Pair>
+struct BatchNormFoldConv2D
+    : public BackendTestFixture<typename Pair::SecondType> {
+  using DataType = typename Pair::FirstType;
+
+  void test_fold(sycldnn::conv2d::Conv2DParams const& params, bool use_bias) {
+    auto const filter_size =
+        sycldnn::conv2d::get_sizes<sycldnn::conv2d::conv_type::Forward>(params)
+            .filter_size;
+    size_t const n_features = params.features;
+    float const epsilon = 0.001f;
+
+    auto filter = iota_initialised_data<DataType>(filter_size, 9);
+    auto bias = iota_initialised_data<DataType>(n_features, 5);
+    auto beta = iota_initialised_data<DataType>(n_features, 3);
+    auto gamma = iota_initialised_data<DataType>(n_features, 4);
+    auto mean = iota_initialised_data<DataType>(n_features, 2);
+    auto variance = iota_initialised_data<DataType>(n_features, 7);
+    std::vector<DataType> folded_filter(filter_size);
+    std::vector<DataType> folded_bias(n_features);
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    auto filter_gpu =
+        provider.get_initialised_device_memory(filter_size, filter);
+    auto bias_gpu = provider.get_initialised_device_memory(n_features, bias);
+    auto beta_gpu = provider.get_initialised_device_memory(n_features, beta);
+    auto gamma_gpu = provider.get_initialised_device_memory(n_features, gamma);
+    auto mean_gpu = provider.get_initialised_device_memory(n_features, mean);
+    auto variance_gpu =
+        provider.get_initialised_device_memory(n_features, variance);
+    auto folded_filter_gpu =
+        provider.get_initialised_device_memory(filter_size, folded_filter);
+    auto folded_bias_gpu =
+        provider.get_initialised_device_memory(n_features, folded_bias);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(filter_gpu);
+      provider.deallocate_ptr(bias_gpu);
+      provider.deallocate_ptr(beta_gpu);
+      provider.deallocate_ptr(gamma_gpu);
+      provider.deallocate_ptr(mean_gpu);
+      provider.deallocate_ptr(variance_gpu);
+      provider.deallocate_ptr(folded_filter_gpu);
+      provider.deallocate_ptr(folded_bias_gpu);
+    };
+
+    sycldnn::SNNStatus status;
+    if (use_bias) {
+      status = sycldnn::batchnorm::fold_into_conv2d<DataType>(
+          filter_gpu, bias_gpu, beta_gpu, gamma_gpu, mean_gpu, variance_gpu,
+          folded_filter_gpu, folded_bias_gpu, params, epsilon, backend);
+    } else {
+      status = sycldnn::batchnorm::fold_into_conv2d<DataType>(
+          filter_gpu, beta_gpu, gamma_gpu, mean_gpu, variance_gpu,
+          folded_filter_gpu, folded_bias_gpu, params, epsilon, backend);
+    }
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(filter_size, folded_filter_gpu,
+                                      folded_filter);
+    provider.copy_device_data_to_host(n_features, folded_bias_gpu,
+                                      folded_bias);
+
+    std::vector<DataType> scale(n_features);
+    for (size_t f = 0; f < n_features; ++f) {
+      scale[f] = gamma[f] / std::sqrt(variance[f] + epsilon);
+    }
+    size_t const per_feature = filter_size / n_features;
+    bool const is_fchw = params.filter_format == sycldnn::FilterFormat::FCHW;
+    for (size_t i = 0; i < filter_size; ++i) {
+      SCOPED_TRACE("Filter element: " + std::to_string(i));
+      size_t const feature = is_fchw ? i / per_feature : i % n_features;
+      DataType expected = filter[i] * scale[feature];
+      SNN_ALMOST_EQUAL_EPS(expected, folded_filter[i], 10u, 1e-5);
+    }
+    for (size_t f = 0; f < n_features; ++f) {
+      SCOPED_TRACE("Bias element: " + std::to_string(f));
+      DataType bias_val = use_bias ? bias[f] : DataType{0};
+      DataType expected = (bias_val - mean[f]) * scale[f] + beta[f];
+      SNN_ALMOST_EQUAL_EPS(expected, folded_bias[f], 10u, 1e-5);
+    }
+  }
+};
+TYPED_TEST_CASE(BatchNormFoldConv2D, GTestTypePairs);
+
+TYPED_TEST(BatchNormFoldConv2D, HWCF_3x3) {
+  auto params = get_fold_params(4, 6, 3, 1, sycldnn::FilterFormat::HWCF);
+  this->test_fold(params, true);
+}
+TYPED_TEST(BatchNormFoldConv2D, HWCF_3x3_NoBias) {
+  auto params = get_fold_params(4, 6, 3, 1, sycldnn::FilterFormat::HWCF);
+  this->test_fold(params, false);
+}
+TYPED_TEST(BatchNormFoldConv2D, HWCF_1x1_Grouped) {
+  auto params = get_fold_params(8, 4, 1, 2, sycldnn::FilterFormat::HWCF);
+  this->test_fold(params, true);
+}
+TYPED_TEST(BatchNormFoldConv2D, FCHW_3x3) {
+  auto params = get_fold_params(3, 5, 3, 1, sycldnn::FilterFormat::FCHW);
+  this->test_fold(params, true);
+}
+TYPED_TEST(BatchNormFoldConv2D, FCHW_3x3_Grouped_NoBias) {
+  auto params = get_fold_params(6, 4, 3, 2, sycldnn::FilterFormat::FCHW);
+  this->test_fold(params, false);
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/data_format.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/batchnorm/direction.h"
+#include "sycldnn/batchnorm/launch.h"
+#include "sycldnn/batchnorm/operation.h"
+#include "sycldnn/batchnorm/params.h"
+#include "sycldnn/batchnorm/workspace_size.h"
+
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/batchnorm/batchnorm_fixture.h"
+#include "test/helpers/float_comparison.h"
+#include "test/types/cartesian_product.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+#include "test/types/type_list.h"
+
+#include <cmath>
+#include <vector>
+
+// Half precision cannot represent small deviations from a large mean, so these
+// tests only use single and double precision.
+#ifdef SNN_USE_DOUBLE
+using DataTypeList = sycldnn::types::TypeList<float, double>;
+#else
+using DataTypeList = sycldnn::types::TypeList<float>;
+#endif  // SNN_USE_DOUBLE
+using Backends = sycldnn::types::AllBackendTypes;
+
+using TypeBackendPairs =
+    sycldnn::types::CartesianProduct<DataTypeList, Backends>::type;
+
+using GTestTypePairs = sycldnn::types::ToGTestTypes<TypeBackendPairs>::type;
+
+/**
+ * Check the batch statistics computed in forward training for an input with a
+ * large mean and a small variance.
+ *
+ * Computing the variance from the sum of squares cancels catastrophically for
+ * such an input, whereas the Welford updates and the pairwise combination of
+ * slices should match a double precision reference.
+ */
+template <typename Pair>
+struct BatchNormTrainingStatistics
+    : public BackendTestFixture<typename Pair::SecondType> {
+  using DataType = typename Pair::FirstType;
+  using Backend = typename Pair::SecondType;
+
+  void test_statistics(std::array<int, 4> const& in_shape,
+                       bool use_workspace = false) {
+    auto const params = getBatchNormParams(in_shape, sycldnn::DataFormat::NHWC);
+    size_t const channels = params.channels;
+    size_t const n_positions = params.batch * params.rows * params.cols;
+    size_t const size = n_positions * channels;
+
+    // Offsets are multiples of 1/16, which are exact at this magnitude.
+    double const offset = 10000.;
+    std::vector<DataType> input(size);
+    for (size_t i = 0; i < size; ++i) {
+      input[i] = static_cast<DataType>(
+          offset + static_cast<double>(static_cast<int>(i * 37 % 31) - 15) /
+                       16.);
+    }
+
+    std::vector<double> exp_mean(channels, 0.);
+    std::vector<double> exp_variance(channels, 0.);
+    for (size_t c = 0; c < channels; ++c) {
+      for (size_t p = 0; p < n_positions; ++p) {
+        exp_mean[c] += input[p * channels + c];
+      }
+      exp_mean[c] /= n_positions;
+      for (size_t p = 0; p < n_positions; ++p) {
+        double const diff = input[p * channels + c] - exp_mean[c];
+        exp_variance[c] += diff * diff;
+      }
+      exp_variance[c] /= n_positions;
+    }
+
+    std::vector<DataType> beta(channels, 0.f);
+    std::vector<DataType> gamma(channels, 1.f);
+    std::vector<DataType> zeros(channels, 0.f);
+    std::vector<DataType> running_mean(channels);
+    std::vector<DataType> running_variance(channels);
+    std::vector<DataType> output(size);
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    auto inp_gpu = provider.get_initialised_device_memory(size, input);
+    auto beta_gpu = provider.get_initialised_device_memory(channels, beta);
+    auto gamma_gpu = provider.get_initialised_device_memory(channels, gamma);
+    auto input_mean_gpu =
+        provider.get_initialised_device_memory(channels, zeros);
+    auto input_variance_gpu =
+        provider.get_initialised_device_memory(channels, zeros);
+    auto running_mean_gpu =
+        provider.get_initialised_device_memory(channels, running_mean);
+    auto running_variance_gpu =
+        provider.get_initialised_device_memory(channels, running_variance);
+    auto out_gpu = provider.get_initialised_device_memory(size, output);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(beta_gpu);
+      provider.deallocate_ptr(gamma_gpu);
+      provider.deallocate_ptr(input_mean_gpu);
+      provider.deallocate_ptr(input_variance_gpu);
+      provider.deallocate_ptr(running_mean_gpu);
+      provider.deallocate_ptr(running_variance_gpu);
+      provider.deallocate_ptr(out_gpu);
+    };
+
+    // The workspace must stay allocated until the kernels have completed.
+    sycldnn::SNNStatus status;
+    if (use_workspace) {
+      size_t const workspace_size =
+          sycldnn::batchnorm::query_training_workspace_size(params);
+      std::vector<DataType> workspace(workspace_size);
+      auto workspace_gpu =
+          provider.get_initialised_device_memory(workspace_size, workspace);
+      SNN_ON_SCOPE_EXIT { provider.deallocate_ptr(workspace_gpu); };
+
+      status =
+          sycldnn::batchnorm::launch_forward<DataType, Backend,
+                                             sycldnn::batchnorm::Forward,
+                                             sycldnn::batchnorm::Training>(
+              inp_gpu, beta_gpu, gamma_gpu, input_mean_gpu,
+              input_variance_gpu, running_mean_gpu, running_variance_gpu,
+              out_gpu, workspace_gpu, workspace_size, params, backend);
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+    } else {
+      status =
+          sycldnn::batchnorm::launch_forward<DataType, Backend,
+                                             sycldnn::batchnorm::Forward,
+                                             sycldnn::batchnorm::Training>(
+              inp_gpu, beta_gpu, gamma_gpu, input_mean_gpu,
+              input_variance_gpu, running_mean_gpu, running_variance_gpu,
+              out_gpu, params, backend);
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+    }
+
+    provider.copy_device_data_to_host(channels, running_mean_gpu,
+                                      running_mean);
+    provider.copy_device_data_to_host(channels, running_variance_gpu,
+                                      running_variance);
+    provider.copy_device_data_to_host(size, out_gpu, output);
+
+    // The input mean and variance are zero, so the running statistics are the
+    // batch statistics scaled by (1 - momentum).
+    double const batch_weight = 1. - params.momentum;
+    for (size_t c = 0; c < channels; ++c) {
+      SCOPED_TRACE("Channel: " + std::to_string(c));
+      SNN_ALMOST_EQUAL_EPS(static_cast<DataType>(exp_mean[c] * batch_weight),
+                           running_mean[c], 10u, 1e-3 * batch_weight);
+      SNN_ALMOST_EQUAL_EPS(
+          static_cast<DataType>(exp_variance[c] * batch_weight),
+          running_variance[c], 10u, 5e-4 * batch_weight);
+    }
+    for (size_t i = 0; i < size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      size_t const c = i % channels;
+      double const expected = (input[i] - exp_mean[c]) /
+                              std::sqrt(exp_variance[c] + params.epsilon);
+      SNN_ALMOST_EQUAL_EPS(static_cast<DataType>(expected), output[i], 10u,
+                           5e-3);
+    }
+  }
+};
+TYPED_TEST_CASE(BatchNormTrainingStatistics, GTestTypePairs);
+
+TYPED_TEST(BatchNormTrainingStatistics, SingleSlice) {
+  this->test_statistics({{1, 1, 31, 1}});
+}
+TYPED_TEST(BatchNormTrainingStatistics, ManySlices) {
+  this->test_statistics({{4, 16, 16, 8}});
+}
+TYPED_TEST(BatchNormTrainingStatistics, UnevenSlices) {
+  this->test_statistics({{3, 17, 19, 5}});
+}
+TYPED_TEST(BatchNormTrainingStatistics, ProvidedWorkspace) {
+  this->test_statistics({{3, 17, 19, 6}}, true);
+}
@@ -0,0 +1,261 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/selector/auto_tuning_selector.h"
+#include "sycldnn/conv2d/selector/tuning_cache.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "src/backend/snn_backend_provider.h"
+#include "sycldnn/backend/snn_backend.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace {
+using Backend = sycldnn::backend::SNNBackend;
+using BackendProvider = sycldnn::backend::BackendProvider<Backend>;
+using ConvType = sycldnn::conv2d::conv_type::Forward;
+using Algorithm = sycldnn::conv2d::Algorithm;
+
+sycldnn::conv2d::Conv2DParams get_3x3_params() {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 8;
+  params.features = 16;
+  params.batch = 2;
+  params.in_rows = 14;
+  params.in_cols = 14;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 14;
+  params.out_cols = 14;
+  params.pad_rows = 1;
+  params.pad_cols = 1;
+  params.dilation_rows = 1;
+  params.dilation_cols = 1;
+  return params;
+}
+}  // namespace
+
+TEST(AutoTuningSelectorTest, SelectsApplicableAlgorithm) {
+  BackendProvider provider;
+  auto& backend = provider.get_backend();
+  sycldnn::conv2d::AutoTuningSelector<float, Backend> selector{backend};
+
+  auto params = get_3x3_params();
+  auto algo = selector.select<ConvType>(params);
+  EXPECT_TRUE(
+      sycldnn::conv2d::internal::can_use_algorithm<ConvType>(params, algo));
+  EXPECT_EQ(1u, selector.get_cache().size());
+
+  // A second selection should be served from the cache.
+  EXPECT_EQ(algo, selector.select<ConvType>(params));
+  EXPECT_EQ(1u, selector.get_cache().size());
+
+  auto sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+  std::vector<float> input(sizes.input_size, 1.f);
+  std::vector<float> filter(sizes.filter_size, 1.f);
+  std::vector<float> output(sizes.output_size);
+  auto input_gpu =
+      provider.get_initialised_device_memory(sizes.input_size, input);
+  auto filter_gpu =
+      provider.get_initialised_device_memory(sizes.filter_size, filter);
+  auto output_gpu =
+      provider.get_initialised_device_memory(sizes.output_size, output);
+  auto status = sycldnn::conv2d::launch<float, ConvType>(
+      input_gpu, filter_gpu, output_gpu, params, selector, backend);
+  ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+  status.event.wait_and_throw();
+}
+
+TEST(AutoTuningSelectorTest, MatmulRequiresUnpadded1x1) {
+  auto params = get_3x3_params();
+  params.window_rows = 1;
+  params.window_cols = 1;
+  EXPECT_FALSE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Matmul));
+  params.pad_rows = 0;
+  params.pad_cols = 0;
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Matmul));
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Direct));
+}
+
+TEST(AutoTuningSelectorTest, ImplicitGemmRequiresNHWC) {
+  auto params = get_3x3_params();
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::ImplicitGemm));
+  params.input_format = sycldnn::DataFormat::NCHW;
+  EXPECT_FALSE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::ImplicitGemm));
+}
+
+TEST(AutoTuningSelectorTest, NCHWSupportsWinogradAndTiledForward) {
+  auto params = get_3x3_params();
+  params.input_format = sycldnn::DataFormat::NCHW;
+  params.filter_format = sycldnn::FilterFormat::FCHW;
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Direct));
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Im2col));
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Tiled));
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Winograd));
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::WinogradLarge));
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<
+              sycldnn::conv2d::conv_type::InputBackprop>(
+      params, Algorithm::WinogradLarge));
+  EXPECT_FALSE(sycldnn::conv2d::internal::can_use_algorithm<
+               sycldnn::conv2d::conv_type::InputBackprop>(params,
+                                                          Algorithm::Tiled));
+  params.dilation_rows = 2;
+  params.dilation_cols = 2;
+  EXPECT_FALSE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Tiled));
+  params.dilation_rows = 1;
+  params.dilation_cols = 1;
+  params.window_rows = 1;
+  params.window_cols = 1;
+  params.pad_rows = 0;
+  params.pad_cols = 0;
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Matmul));
+  params.groups = 2;
+  EXPECT_FALSE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Im2col));
+}
+
+TEST(AutoTuningSelectorTest, Winograd5x5IsNotUsedForFilterBackprop) {
+  auto params = get_3x3_params();
+  params.window_rows = 5;
+  params.window_cols = 5;
+  params.pad_rows = 2;
+  params.pad_cols = 2;
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Winograd));
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::WinogradLarge));
+  using FilterBackprop = sycldnn::conv2d::conv_type::FilterBackprop;
+  EXPECT_FALSE(sycldnn::conv2d::internal::can_use_algorithm<FilterBackprop>(
+      params, Algorithm::Winograd));
+  EXPECT_FALSE(sycldnn::conv2d::internal::can_use_algorithm<FilterBackprop>(
+      params, Algorithm::WinogradLarge));
+}
+
+TEST(AutoTuningSelectorTest, DilationUsesDirectIm2colAndTiled) {
+  auto params = get_3x3_params();
+  params.dilation_rows = 2;
+  params.dilation_cols = 2;
+  params.pad_rows = 2;
+  params.pad_cols = 2;
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Direct));
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Im2col));
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Tiled));
+  EXPECT_FALSE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::WinogradLarge));
+  EXPECT_FALSE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::ImplicitGemm));
+  using InputBackprop = sycldnn::conv2d::conv_type::InputBackprop;
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<InputBackprop>(
+      params, Algorithm::Direct));
+  EXPECT_FALSE(sycldnn::conv2d::internal::can_use_algorithm<InputBackprop>(
+      params, Algorithm::Tiled));
+  using FilterBackprop = sycldnn::conv2d::conv_type::FilterBackprop;
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<FilterBackprop>(
+      params, Algorithm::Direct));
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<FilterBackprop>(
+      params, Algorithm::Im2col));
+  params.stride_rows = 2;
+  params.stride_cols = 2;
+  EXPECT_FALSE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Tiled));
+}
+
+TEST(AutoTuningSelectorTest, GroupsUseDirectTiledAndIm2col) {
+  auto params = get_3x3_params();
+  params.groups = 2;
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Direct));
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Im2col));
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::Tiled));
+  EXPECT_FALSE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::WinogradLarge));
+  EXPECT_FALSE(sycldnn::conv2d::internal::can_use_algorithm<ConvType>(
+      params, Algorithm::ImplicitGemm));
+  using InputBackprop = sycldnn::conv2d::conv_type::InputBackprop;
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<InputBackprop>(
+      params, Algorithm::Direct));
+  EXPECT_TRUE(sycldnn::conv2d::internal::can_use_algorithm<InputBackprop>(
+      params, Algorithm::Tiled));
+  EXPECT_FALSE(sycldnn::conv2d::internal::can_use_algorithm<InputBackprop>(
+      params, Algorithm::Im2col));
+  using FilterBackprop = sycldnn::conv2d::conv_type::FilterBackprop;
+  EXPECT_FALSE(sycldnn::conv2d::internal::can_use_algorithm<FilterBackprop>(
+      params, Algorithm::Tiled));
+}
+
+TEST(TuningCacheTest, SaveAndReload) {
+  cl::sycl::queue q;
+  auto file_name =
+      sycldnn::conv2d::TuningCache::file_name_for(q.get_device());
+  EXPECT_EQ(std::string::npos, file_name.find('/'));
+  EXPECT_EQ(std::string::npos, file_name.find(' '));
+
+  auto params = get_3x3_params();
+  {
+    sycldnn::conv2d::TuningCache cache{file_name};
+    cache.insert<ConvType>(params, Algorithm::WinogradLarge);
+    cache.insert<sycldnn::conv2d::conv_type::InputBackprop>(params,
+                                                            Algorithm::Im2col);
+    ASSERT_TRUE(cache.save());
+  }
+  sycldnn::conv2d::TuningCache reloaded{file_name};
+  std::remove(file_name.c_str());
+
+  Algorithm algo;
+  ASSERT_EQ(2u, reloaded.size());
+  ASSERT_TRUE(reloaded.lookup<ConvType>(params, algo));
+  EXPECT_EQ(Algorithm::WinogradLarge, algo);
+  ASSERT_TRUE(
+      reloaded.lookup<sycldnn::conv2d::conv_type::InputBackprop>(params, algo));
+  EXPECT_EQ(Algorithm::Im2col, algo);
+  EXPECT_FALSE(
+      reloaded.lookup<sycldnn::conv2d::conv_type::FilterBackprop>(params, algo));
+
+  params.batch = 4;
+  EXPECT_FALSE(reloaded.lookup<ConvType>(params, algo));
+}
+
+TEST(TuningCacheTest, InMemoryCacheDoesNotSave) {
+  sycldnn::conv2d::TuningCache cache;
+  cache.insert<ConvType>(get_3x3_params(), Algorithm::Direct);
+  EXPECT_EQ(1u, cache.size());
+  EXPECT_FALSE(cache.save());
+}
@@ -87,3 +87,121 @@ TEST(DefaultSelectorTest, GetValidSelectionFor5x5s2) {
   params.dilation_cols = 1;
   check_conv_launch_successful(params);
 }
+
+TEST(DefaultSelectorTest, GetValidSelectionFor5x5s1) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 8;
+  params.features = 16;
+  params.batch = 2;
+  params.in_rows = 30;
+  params.in_cols = 30;
+  params.window_rows = 5;
+  params.window_cols = 5;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 30;
+  params.out_cols = 30;
+  params.pad_rows = 2;
+  params.pad_cols = 2;
+  params.dilation_rows = 1;
+  params.dilation_cols = 1;
+  check_conv_launch_successful(params);
+}
+
+TEST(DefaultSelectorTest, GetValidSelectionForSmall5x5s1) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 8;
+  params.features = 16;
+  params.batch = 2;
+  params.in_rows = 6;
+  params.in_cols = 6;
+  params.window_rows = 5;
+  params.window_cols = 5;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 2;
+  params.out_cols = 2;
+  params.pad_rows = 0;
+  params.pad_cols = 0;
+  params.dilation_rows = 1;
+  params.dilation_cols = 1;
+  check_conv_launch_successful(params);
+}
+
+TEST(DefaultSelectorTest, GetValidSelectionForDilated3x3s1) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 8;
+  params.features = 16;
+  params.batch = 2;
+  params.in_rows = 30;
+  params.in_cols = 30;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 30;
+  params.out_cols = 30;
+  params.pad_rows = 2;
+  params.pad_cols = 2;
+  params.dilation_rows = 2;
+  params.dilation_cols = 2;
+  check_conv_launch_successful(params);
+
+  cl::sycl::queue q;
+  auto selector = sycldnn::conv2d::get_default_selector(q.get_device());
+  EXPECT_EQ(sycldnn::conv2d::Algorithm::Tiled,
+            selector->select<sycldnn::conv2d::conv_type::Forward>(params));
+  EXPECT_NE(sycldnn::conv2d::Algorithm::NotSupported,
+            selector->select<sycldnn::conv2d::conv_type::InputBackprop>(
+                params));
+  EXPECT_NE(sycldnn::conv2d::Algorithm::NotSupported,
+            selector->select<sycldnn::conv2d::conv_type::FilterBackprop>(
+                params));
+}
+
+TEST(DefaultSelectorTest, GetValidSelectionForGrouped3x3s1) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 8;
+  params.features = 16;
+  params.batch = 2;
+  params.in_rows = 30;
+  params.in_cols = 30;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 30;
+  params.out_cols = 30;
+  params.pad_rows = 1;
+  params.pad_cols = 1;
+  params.groups = 4;
+  check_conv_launch_successful(params);
+
+  cl::sycl::queue q;
+  auto selector = sycldnn::conv2d::get_default_selector(q.get_device());
+  EXPECT_EQ(sycldnn::conv2d::Algorithm::Tiled,
+            selector->select<sycldnn::conv2d::conv_type::Forward>(params));
+  EXPECT_EQ(sycldnn::conv2d::Algorithm::Tiled,
+            selector->select<sycldnn::conv2d::conv_type::InputBackprop>(
+                params));
+}
+
+TEST(DefaultSelectorTest, GetValidSelectionForNCHW3x3s1) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 8;
+  params.features = 16;
+  params.batch = 2;
+  params.in_rows = 30;
+  params.in_cols = 30;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 30;
+  params.out_cols = 30;
+  params.pad_rows = 1;
+  params.pad_cols = 1;
+  params.input_format = sycldnn::DataFormat::NCHW;
+  params.filter_format = sycldnn::FilterFormat::FCHW;
+  check_conv_launch_successful(params);
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/padding_mode.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/epilogue_params.h"
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "sycldnn/conv2d/selector/constant_selector.h"
+#include "sycldnn/conv2d/selector/direct_selector.h"
+
+#include "sycldnn/helpers/padding.h"
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+
+#include <stddef.h>
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace {
+
+using Activation = sycldnn::conv2d::Activation;
+using Algorithm = sycldnn::conv2d::Algorithm;
+using EpilogueParams = sycldnn::conv2d::EpilogueParams;
+using Forward = sycldnn::conv2d::conv_type::Forward;
+
+struct EpilogueConv2D
+    : public BackendTestFixture<sycldnn::backend::SNNBackend> {
+  using DataType = float;
+
+ protected:
+  /**
+   * Compute a convolution with the given algorithm and epilogue, and compare
+   * against an unfused Direct convolution followed by the epilogue computed on
+   * the host.
+   */
+  template <Algorithm Algo>
+  void test_epilogue(sycldnn::conv2d::Conv2DParams const& params,
+                     EpilogueParams const& epilogue) {
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto conv_sizes = sycldnn::conv2d::get_sizes<Forward>(params);
+
+    std::vector<DataType> input = iota_initialised_data(
+        conv_sizes.input_size, static_cast<DataType>(2048));
+    std::for_each(begin(input), end(input), [](DataType& val) { val /= 1000; });
+    std::vector<DataType> filter = iota_initialised_data(
+        conv_sizes.filter_size, static_cast<DataType>(2048));
+    std::for_each(begin(filter), end(filter),
+                  [](DataType& val) { val = (val - 1024) / 1000; });
+    std::vector<DataType> bias(params.features);
+    for (size_t i = 0; i < bias.size(); ++i) {
+      bias[i] = static_cast<DataType>(i % 5) - 2;
+    }
+    std::vector<DataType> residual = iota_initialised_data(
+        conv_sizes.output_size, static_cast<DataType>(128));
+    std::for_each(begin(residual), end(residual),
+                  [](DataType& val) { val = (val - 64) / 16; });
+    std::vector<DataType> exp_output(conv_sizes.output_size);
+    std::vector<DataType> output(conv_sizes.output_size);
+
+    auto inp_gpu =
+        provider.get_initialised_device_memory(conv_sizes.input_size, input);
+    auto fil_gpu =
+        provider.get_initialised_device_memory(conv_sizes.filter_size, filter);
+    auto bias_gpu = provider.get_initialised_device_memory(bias.size(), bias);
+    auto res_gpu = provider.get_initialised_device_memory(
+        conv_sizes.output_size, residual);
+    auto exp_out_gpu = provider.get_initialised_device_memory(
+        conv_sizes.output_size, exp_output);
+    auto out_gpu =
+        provider.get_initialised_device_memory(conv_sizes.output_size, output);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(fil_gpu);
+      provider.deallocate_ptr(bias_gpu);
+      provider.deallocate_ptr(res_gpu);
+      provider.deallocate_ptr(exp_out_gpu);
+      provider.deallocate_ptr(out_gpu);
+    };
+
+    sycldnn::conv2d::DirectSelector direct_selector{};
+    auto status = sycldnn::conv2d::launch<DataType, Forward>(
+        inp_gpu, fil_gpu, exp_out_gpu, params, direct_selector, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    sycldnn::conv2d::ConstantSelector<Algo> selector{};
+    status = sycldnn::conv2d::launch<DataType, Forward>(
+        inp_gpu, fil_gpu, out_gpu, bias_gpu, res_gpu, params, epilogue,
+        selector, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(conv_sizes.output_size, exp_out_gpu,
+                                      exp_output);
+    provider.copy_device_data_to_host(conv_sizes.output_size, out_gpu, output);
+    for (size_t i = 0; i < exp_output.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      DataType expected = exp_output[i];
+      if (epilogue.bias) {
+        expected += bias[i % params.features];
+      }
+      if (epilogue.residual) {
+        expected += residual[i];
+      }
+      expected = apply_activation(epilogue.activation, expected);
+      SNN_ALMOST_EQUAL(expected, output[i], 512u);
+    }
+  }
+
+ private:
+  static DataType apply_activation(Activation activation, DataType value) {
+    switch (activation) {
+      case Activation::Relu:
+        return std::max<DataType>(value, 0);
+      case Activation::Relu6:
+        return std::min<DataType>(std::max<DataType>(value, 0), 6);
+      case Activation::Tanh:
+        return std::tanh(value);
+      case Activation::None:
+      default:
+        return value;
+    }
+  }
+};
+
+sycldnn::conv2d::Conv2DParams get_params(int window) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 8;
+  params.features = 16;
+  params.batch = 2;
+  params.in_rows = 9;
+  params.in_cols = 7;
+  params.window_rows = window;
+  params.window_cols = window;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  return sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::SAME);
+}
+
+EpilogueParams get_epilogue(bool bias, bool residual, Activation activation) {
+  EpilogueParams epilogue;
+  epilogue.bias = bias;
+  epilogue.residual = residual;
+  epilogue.activation = activation;
+  return epilogue;
+}
+
+TEST_F(EpilogueConv2D, DirectBiasRelu) {
+  this->test_epilogue<Algorithm::Direct>(
+      get_params(3), get_epilogue(true, false, Activation::Relu));
+}
+TEST_F(EpilogueConv2D, DirectBiasResidualRelu6) {
+  this->test_epilogue<Algorithm::Direct>(
+      get_params(3), get_epilogue(true, true, Activation::Relu6));
+}
+TEST_F(EpilogueConv2D, TiledBiasResidualRelu) {
+  this->test_epilogue<Algorithm::Tiled>(
+      get_params(3), get_epilogue(true, true, Activation::Relu));
+}
+TEST_F(EpilogueConv2D, TiledResidualTanh) {
+  this->test_epilogue<Algorithm::Tiled>(
+      get_params(3), get_epilogue(false, true, Activation::Tanh));
+}
+TEST_F(EpilogueConv2D, WinogradBiasResidualRelu) {
+  this->test_epilogue<Algorithm::Winograd>(
+      get_params(3), get_epilogue(true, true, Activation::Relu));
+}
+TEST_F(EpilogueConv2D, WinogradLargeBiasRelu6) {
+  this->test_epilogue<Algorithm::WinogradLarge>(
+      get_params(3), get_epilogue(true, false, Activation::Relu6));
+}
+TEST_F(EpilogueConv2D, Im2colBiasResidualRelu) {
+  this->test_epilogue<Algorithm::Im2col>(
+      get_params(3), get_epilogue(true, true, Activation::Relu));
+}
+TEST_F(EpilogueConv2D, MatmulBiasTanh) {
+  this->test_epilogue<Algorithm::Matmul>(
+      get_params(1), get_epilogue(true, false, Activation::Tanh));
+}
+TEST_F(EpilogueConv2D, ImplicitGemmBiasResidualRelu) {
+  this->test_epilogue<Algorithm::ImplicitGemm>(
+      get_params(3), get_epilogue(true, true, Activation::Relu));
+}
+TEST_F(EpilogueConv2D, IdentityEpilogue) {
+  this->test_epilogue<Algorithm::Im2col>(
+      get_params(3), get_epilogue(false, false, Activation::None));
+}
+
+}  // namespace
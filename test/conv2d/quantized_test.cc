@@ -0,0 +1,242 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/padding_mode.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/launch_quantized.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "sycldnn/helpers/padding.h"
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "sycldnn/quantize/params.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/helpers/requantize.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Forward = sycldnn::conv2d::conv_type::Forward;
+
+struct QuantizedConv2D
+    : public BackendTestFixture<sycldnn::backend::SNNBackend> {
+ protected:
+  /**
+   * Compute an int8 convolution and compare against a host reference which
+   * accumulates in int32 and requantizes each feature. When a status other
+   * than OK is expected the launch is only checked to fail with it.
+   */
+  void test_conv(sycldnn::conv2d::Conv2DParams const& params,
+                 sycldnn::quantize::RequantizeParams const& requantize_params,
+                 sycldnn::StatusCode expected_status =
+                     sycldnn::StatusCode::OK) {
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto conv_sizes = sycldnn::conv2d::get_sizes<Forward>(params);
+
+    std::vector<int8_t> input(conv_sizes.input_size);
+    for (size_t i = 0; i < input.size(); ++i) {
+      input[i] = static_cast<int8_t>(static_cast<int>(i * 37 % 255) - 128);
+    }
+    std::vector<int8_t> filter(conv_sizes.filter_size);
+    for (size_t i = 0; i < filter.size(); ++i) {
+      filter[i] = static_cast<int8_t>(static_cast<int>(i * 53 % 255) - 128);
+    }
+    std::vector<int32_t> bias(params.features);
+    std::vector<float> scales(params.features);
+    std::vector<int32_t> zero_points(params.features);
+    for (int f = 0; f < params.features; ++f) {
+      bias[f] = f * 300 - 1000;
+      scales[f] = f % 2 == 0 ? 1.f / 1024 : 1.f / 4096;
+      zero_points[f] = f % 7 - 3;
+    }
+    std::vector<int8_t> output(conv_sizes.output_size);
+    std::vector<int8_t> exp_output =
+        reference_conv(params, requantize_params, input, filter, bias, scales,
+                       zero_points);
+
+    auto inp_gpu =
+        provider.get_initialised_device_memory(conv_sizes.input_size, input);
+    auto fil_gpu =
+        provider.get_initialised_device_memory(conv_sizes.filter_size, filter);
+    auto bias_gpu = provider.get_initialised_device_memory(bias.size(), bias);
+    auto scale_gpu =
+        provider.get_initialised_device_memory(scales.size(), scales);
+    auto zero_point_gpu =
+        provider.get_initialised_device_memory(zero_points.size(), zero_points);
+    auto out_gpu =
+        provider.get_initialised_device_memory(conv_sizes.output_size, output);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(fil_gpu);
+      provider.deallocate_ptr(bias_gpu);
+      provider.deallocate_ptr(scale_gpu);
+      provider.deallocate_ptr(zero_point_gpu);
+      provider.deallocate_ptr(out_gpu);
+    };
+
+    auto status = sycldnn::conv2d::launch_quantized(
+        inp_gpu, fil_gpu, bias_gpu, scale_gpu, zero_point_gpu, out_gpu, params,
+        requantize_params, backend);
+    ASSERT_EQ(expected_status, status.status);
+    if (expected_status != sycldnn::StatusCode::OK) {
+      return;
+    }
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(conv_sizes.output_size, out_gpu, output);
+    for (size_t i = 0; i < exp_output.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_EQ(exp_output[i], output[i]);
+    }
+  }
+
+ private:
+  static std::vector<int8_t> reference_conv(
+      sycldnn::conv2d::Conv2DParams const& params,
+      sycldnn::quantize::RequantizeParams const& requantize_params,
+      std::vector<int8_t> const& input, std::vector<int8_t> const& filter,
+      std::vector<int32_t> const& bias, std::vector<float> const& scales,
+      std::vector<int32_t> const& zero_points) {
+    int const group_channels = params.channels / params.groups;
+    int const group_features = params.features / params.groups;
+    std::vector<int8_t> output(params.batch * params.out_rows *
+                               params.out_cols * params.features);
+    size_t out_idx = 0;
+    for (int b = 0; b < params.batch; ++b) {
+      for (int row = 0; row < params.out_rows; ++row) {
+        for (int col = 0; col < params.out_cols; ++col) {
+          for (int f = 0; f < params.features; ++f) {
+            int const group = f / group_features;
+            int32_t acc = bias[f];
+            for (int i = 0; i < params.window_rows; ++i) {
+              int const in_row = row * params.stride_rows - params.pad_rows +
+                                 i * params.dilation_rows;
+              if (in_row < 0 || in_row >= params.in_rows) {
+                continue;
+              }
+              for (int j = 0; j < params.window_cols; ++j) {
+                int const in_col = col * params.stride_cols -
+                                   params.pad_cols + j * params.dilation_cols;
+                if (in_col < 0 || in_col >= params.in_cols) {
+                  continue;
+                }
+                for (int c = 0; c < group_channels; ++c) {
+                  int const in_idx =
+                      ((b * params.in_rows + in_row) * params.in_cols +
+                       in_col) *
+                          params.channels +
+                      group * group_channels + c;
+                  int const fil_idx =
+                      ((i * params.window_cols + j) * group_channels + c) *
+                          params.features +
+                      f;
+                  acc +=
+                      (input[in_idx] - requantize_params.input_zero_point) *
+                      (filter[fil_idx] - requantize_params.filter_zero_point);
+                }
+              }
+            }
+            output[out_idx++] = reference_requantize(
+                acc, scales[f], zero_points[f],
+                requantize_params.activation_min,
+                requantize_params.activation_max);
+          }
+        }
+      }
+    }
+    return output;
+  }
+};
+
+sycldnn::conv2d::Conv2DParams get_params(int window, int stride,
+                                         int dilation = 1, int groups = 1) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 8;
+  params.features = 12;
+  params.batch = 2;
+  params.in_rows = 9;
+  params.in_cols = 7;
+  params.window_rows = window;
+  params.window_cols = window;
+  params.stride_rows = stride;
+  params.stride_cols = stride;
+  params.dilation_rows = dilation;
+  params.dilation_cols = dilation;
+  params.groups = groups;
+  return sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::SAME);
+}
+
+TEST_F(QuantizedConv2D, Window3Stride1) {
+  this->test_conv(get_params(3, 1), {});
+}
+TEST_F(QuantizedConv2D, Window3Stride2) {
+  this->test_conv(get_params(3, 2), {});
+}
+TEST_F(QuantizedConv2D, Window1Stride1) {
+  this->test_conv(get_params(1, 1), {});
+}
+TEST_F(QuantizedConv2D, Window5Stride1) {
+  this->test_conv(get_params(5, 1), {});
+}
+TEST_F(QuantizedConv2D, Window3Dilation2) {
+  this->test_conv(get_params(3, 1, 2), {});
+}
+TEST_F(QuantizedConv2D, Window3Groups4) {
+  this->test_conv(get_params(3, 1, 1, 4), {});
+}
+TEST_F(QuantizedConv2D, ZeroPointsRelu) {
+  sycldnn::quantize::RequantizeParams requantize_params;
+  requantize_params.input_zero_point = 5;
+  requantize_params.filter_zero_point = -2;
+  requantize_params.activation_min = 0;
+  this->test_conv(get_params(3, 1), requantize_params);
+}
+TEST_F(QuantizedConv2D, LargestAccumulation) {
+  // 2 * 2 * 8192 values in each window is exactly the int32 limit.
+  auto params = get_params(2, 1);
+  params.channels = 8192;
+  params.features = 3;
+  params.batch = 1;
+  params.in_rows = 3;
+  params.in_cols = 2;
+  this->test_conv(sycldnn::helpers::add_padding_to(
+                      params, sycldnn::PaddingMode::VALID),
+                  {});
+}
+TEST_F(QuantizedConv2D, AccumulationTooLarge) {
+  auto params = get_params(3, 1);
+  params.channels = 4096;
+  params.features = 1;
+  params.batch = 1;
+  params.in_rows = 3;
+  params.in_cols = 3;
+  this->test_conv(sycldnn::helpers::add_padding_to(
+                      params, sycldnn::PaddingMode::VALID),
+                  {}, sycldnn::StatusCode::InvalidParameter);
+}
+
+}  // namespace
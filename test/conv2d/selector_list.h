@@ -20,6 +20,7 @@
 
 #include "sycldnn/conv2d/selector/direct_selector.h"
 #include "sycldnn/conv2d/selector/im2col_selector.h"
+#include "sycldnn/conv2d/selector/implicit_gemm_selector.h"
 #include "sycldnn/conv2d/selector/matmul_selector.h"
 #include "sycldnn/conv2d/selector/tiled_selector.h"
 #include "sycldnn/conv2d/selector/winograd_selector.h"
@@ -30,7 +31,7 @@ namespace types {
 using SelectorList = sycldnn::types::TypeList<
     sycldnn::conv2d::DirectSelector, sycldnn::conv2d::TiledSelector,
     sycldnn::conv2d::Im2colSelector, sycldnn::conv2d::WinogradSelector,
-    sycldnn::conv2d::MatmulSelector>;
+    sycldnn::conv2d::MatmulSelector, sycldnn::conv2d::ImplicitGemmSelector>;
 
 }  // namespace types
 }  // namespace sycldnn
@@ -109,6 +109,84 @@ sycldnn::conv2d::Conv2DParams get_1x1_params() {
   params.dilation_cols = 1;
   return params;
 }
+sycldnn::conv2d::Conv2DParams get_3x3_dilation2_params() {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 1;
+  params.features = 1;
+  params.batch = 1;
+  params.in_rows = 4;
+  params.in_cols = 4;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 4;
+  params.out_cols = 4;
+  params.pad_rows = 2;
+  params.pad_cols = 2;
+  params.dilation_rows = 2;
+  params.dilation_cols = 2;
+  return params;
+}
+sycldnn::conv2d::Conv2DParams get_3x3_stride2_dilation2_params() {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 1;
+  params.features = 1;
+  params.batch = 1;
+  params.in_rows = 5;
+  params.in_cols = 5;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 2;
+  params.stride_cols = 2;
+  params.out_rows = 3;
+  params.out_cols = 3;
+  params.pad_rows = 2;
+  params.pad_cols = 2;
+  params.dilation_rows = 2;
+  params.dilation_cols = 2;
+  return params;
+}
+sycldnn::conv2d::Conv2DParams get_grouped_1x1_params() {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 4;
+  params.features = 4;
+  params.batch = 1;
+  params.in_rows = 2;
+  params.in_cols = 2;
+  params.window_rows = 1;
+  params.window_cols = 1;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 2;
+  params.out_cols = 2;
+  params.pad_rows = 0;
+  params.pad_cols = 0;
+  params.dilation_rows = 1;
+  params.dilation_cols = 1;
+  params.groups = 2;
+  return params;
+}
+sycldnn::conv2d::Conv2DParams get_grouped_3x3_params() {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 2;
+  params.features = 2;
+  params.batch = 1;
+  params.in_rows = 3;
+  params.in_cols = 3;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 3;
+  params.out_cols = 3;
+  params.pad_rows = 1;
+  params.pad_cols = 1;
+  params.dilation_rows = 1;
+  params.dilation_cols = 1;
+  params.groups = 2;
+  return params;
+}
 /**
  * Input:  1  2  3  4    Filter:  1  2  3
  *         5  6  7  8             4  5  6
@@ -265,3 +343,148 @@ TYPED_TEST(BasicConvolutionTest, FilterBackprop1x1) {
   this->template test_conv<sycldnn::conv2d::conv_type::FilterBackprop>(exp,
                                                                        params);
 }
+/*
+ * Input:  1  2  3  4    Filter:  1  2  3
+ *         5  6  7  8             4  5  6
+ *         9 10 11 12             7  8  9
+ *        13 14 15 16
+ *
+ * With dilation 2 and padding 2 the top left output uses the filter values
+ * 5, 6, 8 and 9 with the inputs 1, 3, 9 and 11, giving 5+18+72+99.
+ */
+TYPED_TEST(BasicConvolutionTest, Dilated3x3) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {194, 222, 170, 194, 306, 334, 266, 290,
+                               122, 138, 98,  110, 186, 202, 146, 158};
+  auto params = get_3x3_dilation2_params();
+  this->template test_conv<sycldnn::conv2d::conv_type::Forward>(exp, params);
+}
+/*
+ * Input:  1  2  3  4  5    Filter:  1  2  3
+ *         6  7  8  9 10             4  5  6
+ *        11 12 13 14 15             7  8  9
+ *        16 17 18 19 20
+ *        21 22 23 24 25
+ *
+ * The centre output uses every other input in each direction, giving
+ * 1x1+2x3+3x5+4x11+5x13+6x15+7x21+8x23+9x25.
+ */
+TYPED_TEST(BasicConvolutionTest, Dilated3x3Stride2) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {228, 365, 248, 519, 777, 501, 304, 431, 260};
+  auto params = get_3x3_stride2_dilation2_params();
+  this->template test_conv<sycldnn::conv2d::conv_type::Forward>(exp, params);
+}
+TYPED_TEST(BasicConvolutionTest, InputBackpropDilated3x3) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {46,  58,  70,  86,  94,  106, 134, 150,
+                               118, 142, 142, 170, 214, 238, 254, 282};
+  auto params = get_3x3_dilation2_params();
+  this->template test_conv<sycldnn::conv2d::conv_type::InputBackprop>(exp,
+                                                                      params);
+}
+/*
+ * Input:  1  2  3    Filter:  1  2  3
+ *         4  5  6             4  5  6
+ *         7  8  9             7  8  9
+ *
+ * With stride 2 and dilation 2 only the inputs with even row and column
+ * indices receive any gradient.
+ */
+TYPED_TEST(BasicConvolutionTest, InputBackpropDilated3x3Stride2) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {26,  0, 56,  0, 54,  0, 0, 0,   0, 0,
+                               84,  0, 165, 0, 144, 0, 0, 0,   0, 0,
+                               134, 0, 236, 0, 186};
+  auto params = get_3x3_stride2_dilation2_params();
+  this->template test_conv<sycldnn::conv2d::conv_type::InputBackprop>(exp,
+                                                                      params);
+}
+/*
+ * Input:  1  2  3  4    Output:  1  2  3  4
+ *         5  6  7  8             5  6  7  8
+ *         9 10 11 12             9 10 11 12
+ *        13 14 15 16            13 14 15 16
+ *
+ * The centre filter value sees every input, so is the sum of the squares. The
+ * corner values only see the inputs at even or odd indices in each direction,
+ * e.g. the top left is 1x11+2x12+5x15+6x16.
+ */
+TYPED_TEST(BasicConvolutionTest, FilterBackpropDilated3x3) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {206, 492, 270, 732, 1496, 732, 270, 492, 206};
+  auto params = get_3x3_dilation2_params();
+  this->template test_conv<sycldnn::conv2d::conv_type::FilterBackprop>(exp,
+                                                                       params);
+}
+/*
+ * The 3x3 output gradient is the same as the filter in the forward
+ * Dilated3x3Stride2 test, and the filter gradient is the forward convolution
+ * with the roles of the filter and output swapped, so the result matches the
+ * forward output.
+ */
+TYPED_TEST(BasicConvolutionTest, FilterBackpropDilated3x3Stride2) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {228, 365, 248, 519, 777, 501, 304, 431, 260};
+  auto params = get_3x3_stride2_dilation2_params();
+  this->template test_conv<sycldnn::conv2d::conv_type::FilterBackprop>(exp,
+                                                                       params);
+}
+/*
+ * Input:  1  2  3  4    Filter:  1  2  3  4
+ *         5  6  7  8             5  6  7  8
+ *         ...
+ *
+ * The first two features only use the first two channels, and the last two
+ * features only use the last two channels, so the first output pixel is
+ * 1x1+2x5, 1x2+2x6, 3x3+4x7, 3x4+4x8.
+ */
+TYPED_TEST(BasicConvolutionTest, Grouped1x1) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {11, 14, 37,  44,  35, 46,  77,  92,
+                               59, 78, 117, 140, 83, 110, 157, 188};
+  auto params = get_grouped_1x1_params();
+  this->template test_conv<sycldnn::conv2d::conv_type::Forward>(exp, params);
+}
+/*
+ * With one channel and one feature in each group, each feature is a 3x3
+ * convolution of the corresponding input channel.
+ */
+TYPED_TEST(BasicConvolutionTest, Grouped3x3) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {300,  376, 502, 616, 348, 424, 630, 744, 969,
+                               1140, 630, 744, 348, 424, 502, 616, 300, 376};
+  auto params = get_grouped_3x3_params();
+  this->template test_conv<sycldnn::conv2d::conv_type::Forward>(exp, params);
+}
+TYPED_TEST(BasicConvolutionTest, InputBackpropGrouped1x1) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {5,  17,  25, 53,  17, 61,  53,  113,
+                               29, 105, 81, 173, 41, 149, 109, 233};
+  auto params = get_grouped_1x1_params();
+  this->template test_conv<sycldnn::conv2d::conv_type::InputBackprop>(exp,
+                                                                      params);
+}
+TYPED_TEST(BasicConvolutionTest, InputBackpropGrouped3x3) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {60,  104, 146, 224, 156, 216, 234, 336, 489,
+                               660, 450, 576, 444, 536, 794, 944, 636, 744};
+  auto params = get_grouped_3x3_params();
+  this->template test_conv<sycldnn::conv2d::conv_type::InputBackprop>(exp,
+                                                                      params);
+}
+TYPED_TEST(BasicConvolutionTest, FilterBackpropGrouped1x1) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {276, 304, 404, 440, 304, 336, 440, 480};
+  auto params = get_grouped_1x1_params();
+  this->template test_conv<sycldnn::conv2d::conv_type::FilterBackprop>(exp,
+                                                                       params);
+}
+TYPED_TEST(BasicConvolutionTest, FilterBackpropGrouped3x3) {
+  using DataType = typename TestFixture::DataType;
+  std::vector<DataType> exp = {300,  376, 502, 616, 348, 424, 630, 744, 969,
+                               1140, 630, 744, 348, 424, 502, 616, 300, 376};
+  auto params = get_grouped_3x3_params();
+  this->template test_conv<sycldnn::conv2d::conv_type::FilterBackprop>(exp,
+                                                                       params);
+}
@@ -0,0 +1,296 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/data_format.h"
+#include "sycldnn/filter_format.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/conv2d/tiled_config.h"
+#include "sycldnn/conv2d/tiled_tuner.h"
+
+#include "sycldnn/conv2d/launch.h"
+
+#include "sycldnn/conv2d/implementation/tiled.h"
+
+#include "sycldnn/conv2d/selector/direct_selector.h"
+
+#include "src/backend/snn_backend_provider.h"
+#include "sycldnn/backend/snn_backend.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+using Backend = sycldnn::backend::SNNBackend;
+using BackendProvider = sycldnn::backend::BackendProvider<Backend>;
+namespace conv_type = sycldnn::conv2d::conv_type;
+
+sycldnn::conv2d::Conv2DParams get_params(int window, int stride,
+                                         int dilation = 1, int groups = 1) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 8;
+  params.features = 16;
+  params.batch = 2;
+  params.in_rows = 14;
+  params.in_cols = 14;
+  params.window_rows = window;
+  params.window_cols = window;
+  params.stride_rows = stride;
+  params.stride_cols = stride;
+  params.out_rows = 14 / stride;
+  params.out_cols = 14 / stride;
+  params.pad_rows = window / 2 * dilation;
+  params.pad_cols = window / 2 * dilation;
+  params.dilation_rows = dilation;
+  params.dilation_cols = dilation;
+  params.groups = groups;
+  return params;
+}
+
+// Small values which are exactly representable, so that the only differences
+// between algorithms come from the order of accumulation.
+std::vector<float> get_data(size_t size) {
+  std::vector<float> data(size);
+  for (size_t i = 0; i < size; ++i) {
+    data[i] = static_cast<float>(static_cast<int>(i % 13) - 6) / 8.f;
+  }
+  return data;
+}
+
+sycldnn::conv2d::Conv2DParams to_nchw(sycldnn::conv2d::Conv2DParams params) {
+  params.input_format = sycldnn::DataFormat::NCHW;
+  params.filter_format = sycldnn::FilterFormat::FCHW;
+  return params;
+}
+
+// Run every tile configuration in the library menu for the given convolution
+// and check that each one matches the direct algorithm.
+template <typename ConvType>
+void check_configs_match_direct(sycldnn::conv2d::Conv2DParams const& params) {
+  BackendProvider provider;
+  auto& backend = provider.get_backend();
+
+  auto sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+  auto input_gpu = provider.get_initialised_device_memory(
+      sizes.input_size, get_data(sizes.input_size));
+  auto filter_gpu = provider.get_initialised_device_memory(
+      sizes.filter_size, get_data(sizes.filter_size));
+  auto output_gpu = provider.get_initialised_device_memory(
+      sizes.output_size, std::vector<float>(sizes.output_size));
+
+  sycldnn::conv2d::DirectSelector direct;
+  auto status = sycldnn::conv2d::launch<float, ConvType>(
+      input_gpu, filter_gpu, output_gpu, params, direct, backend);
+  ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+  std::vector<float> expected;
+  provider.copy_device_data_to_host(sizes.output_size, output_gpu, expected);
+
+  auto configs = sycldnn::conv2d::get_tiled_configs<ConvType>(params);
+  ASSERT_FALSE(configs.empty());
+  for (auto const& config : configs) {
+    SCOPED_TRACE(::testing::Message()
+                 << "window " << params.window_rows << ", stride "
+                 << params.stride_rows << ", dilation " << params.dilation_rows
+                 << ", groups " << params.groups << ", nchw "
+                 << (params.input_format == sycldnn::DataFormat::NCHW)
+                 << ", tile "
+                 << config.tile_rows << "x" << config.tile_cols
+                 << ", vectors " << config.channel_vector_width << "x"
+                 << config.feature_vector_width);
+    auto zeroed = provider.get_initialised_device_memory(
+        sizes.output_size, std::vector<float>(sizes.output_size));
+    status = sycldnn::conv2d::launch_tiled<float, ConvType>(
+        input_gpu, filter_gpu, zeroed, params, config, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    std::vector<float> output;
+    provider.copy_device_data_to_host(sizes.output_size, zeroed, output);
+    for (size_t i = 0; i < expected.size(); ++i) {
+      float tolerance = 1e-4f * std::max(1.f, std::abs(expected[i]));
+      ASSERT_NEAR(expected[i], output[i], tolerance) << "at element " << i;
+    }
+  }
+}
+
+template <typename ConvType>
+void check_configs_match_direct(int window, int stride, int dilation = 1,
+                                int groups = 1) {
+  check_configs_match_direct<ConvType>(
+      get_params(window, stride, dilation, groups));
+}
+}  // namespace
+
+TEST(TiledConfigTest, ConfigsAvailableForSupportedWindows) {
+  for (int window : {1, 3, 5}) {
+    for (int stride : {1, 2}) {
+      auto params = get_params(window, stride);
+      EXPECT_FALSE(
+          sycldnn::conv2d::get_tiled_configs<conv_type::Forward>(params)
+              .empty());
+      EXPECT_FALSE(
+          sycldnn::conv2d::get_tiled_configs<conv_type::InputBackprop>(params)
+              .empty());
+      EXPECT_TRUE(
+          sycldnn::conv2d::get_tiled_configs<conv_type::FilterBackprop>(params)
+              .empty());
+    }
+  }
+  EXPECT_TRUE(sycldnn::conv2d::get_tiled_configs<conv_type::Forward>(
+                  get_params(7, 1))
+                  .empty());
+}
+
+TEST(TiledConfigTest, VectorWidthsMustDivideFeatures) {
+  auto params = get_params(3, 1);
+  params.features = 6;
+  auto configs = sycldnn::conv2d::get_tiled_configs<conv_type::Forward>(params);
+  ASSERT_FALSE(configs.empty());
+  for (auto const& config : configs) {
+    EXPECT_EQ(0, params.features % config.feature_vector_width);
+  }
+}
+
+TEST(TiledConfigTest, ForwardConfigsMatchDirect) {
+  for (int window : {1, 3, 5}) {
+    for (int stride : {1, 2}) {
+      check_configs_match_direct<conv_type::Forward>(window, stride);
+    }
+  }
+}
+
+TEST(TiledConfigTest, DilatedForwardConfigsMatchDirect) {
+  for (int window : {3, 5}) {
+    for (int dilation : {2, 3}) {
+      check_configs_match_direct<conv_type::Forward>(window, 1, dilation);
+    }
+  }
+}
+
+TEST(TiledConfigTest, GroupedConfigsMatchDirect) {
+  for (int groups : {2, 8}) {
+    for (int window : {1, 3}) {
+      for (int stride : {1, 2}) {
+        check_configs_match_direct<conv_type::Forward>(window, stride, 1,
+                                                       groups);
+        check_configs_match_direct<conv_type::InputBackprop>(window, stride, 1,
+                                                             groups);
+      }
+    }
+  }
+}
+
+TEST(TiledConfigTest, VectorWidthsMustDivideGroups) {
+  auto params = get_params(3, 1, 1, 4);
+  auto configs = sycldnn::conv2d::get_tiled_configs<conv_type::Forward>(params);
+  ASSERT_FALSE(configs.empty());
+  for (auto const& config : configs) {
+    EXPECT_EQ(0, (params.channels / params.groups) %
+                     config.channel_vector_width);
+    EXPECT_EQ(0, (params.features / params.groups) %
+                     config.feature_vector_width);
+  }
+}
+
+TEST(TiledConfigTest, DilationRequiresForwardWithUnitStride) {
+  EXPECT_FALSE(sycldnn::conv2d::get_tiled_configs<conv_type::Forward>(
+                   get_params(3, 1, 2))
+                   .empty());
+  EXPECT_TRUE(sycldnn::conv2d::get_tiled_configs<conv_type::Forward>(
+                  get_params(3, 2, 2))
+                  .empty());
+  EXPECT_TRUE(sycldnn::conv2d::get_tiled_configs<conv_type::InputBackprop>(
+                  get_params(3, 1, 2))
+                  .empty());
+}
+
+TEST(TiledConfigTest, InputBackpropConfigsMatchDirect) {
+  for (int window : {1, 3, 5}) {
+    for (int stride : {1, 2}) {
+      check_configs_match_direct<conv_type::InputBackprop>(window, stride);
+    }
+  }
+}
+
+TEST(TiledConfigTest, NCHWForwardConfigsMatchDirect) {
+  for (int window : {1, 3, 5}) {
+    for (int stride : {1, 2}) {
+      check_configs_match_direct<conv_type::Forward>(
+          to_nchw(get_params(window, stride)));
+    }
+  }
+  check_configs_match_direct<conv_type::Forward>(
+      to_nchw(get_params(3, 1, 1, 2)));
+}
+
+TEST(TiledConfigTest, NCHWOnlySupportsUndilatedForward) {
+  EXPECT_TRUE(sycldnn::conv2d::get_tiled_configs<conv_type::Forward>(
+                  to_nchw(get_params(3, 1, 2)))
+                  .empty());
+  EXPECT_TRUE(sycldnn::conv2d::get_tiled_configs<conv_type::InputBackprop>(
+                  to_nchw(get_params(3, 1)))
+                  .empty());
+}
+
+TEST(TiledTunerTest, TunedConfigCanBeLaunched) {
+  using ConvType = conv_type::Forward;
+  BackendProvider provider;
+  auto& backend = provider.get_backend();
+
+  auto params = get_params(3, 1);
+  auto sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+  std::vector<float> input(sizes.input_size, 1.f);
+  std::vector<float> filter(sizes.filter_size, 1.f);
+  std::vector<float> output(sizes.output_size);
+  auto input_gpu =
+      provider.get_initialised_device_memory(sizes.input_size, input);
+  auto filter_gpu =
+      provider.get_initialised_device_memory(sizes.filter_size, filter);
+  auto output_gpu =
+      provider.get_initialised_device_memory(sizes.output_size, output);
+
+  auto result = sycldnn::conv2d::tune_tiled<float, ConvType>(
+      input_gpu, filter_gpu, output_gpu, params, backend, 1);
+  ASSERT_EQ(sycldnn::StatusCode::OK, result.status);
+  EXPECT_GT(result.seconds, 0.);
+
+  auto status = sycldnn::conv2d::launch_tiled<float, ConvType>(
+      input_gpu, filter_gpu, output_gpu, params, result.config, backend);
+  ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+  status.event.wait_and_throw();
+}
+
+TEST(TiledTunerTest, UnavailableConfigIsRejected) {
+  using ConvType = conv_type::Forward;
+  BackendProvider provider;
+  auto& backend = provider.get_backend();
+
+  auto params = get_params(3, 1);
+  auto sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+  auto input_gpu = provider.get_initialised_device_memory(
+      sizes.input_size, std::vector<float>(sizes.input_size));
+  auto filter_gpu = provider.get_initialised_device_memory(
+      sizes.filter_size, std::vector<float>(sizes.filter_size));
+  auto output_gpu = provider.get_initialised_device_memory(
+      sizes.output_size, std::vector<float>(sizes.output_size));
+
+  sycldnn::conv2d::TiledConfig config{7, 7, 1, 1};
+  auto status = sycldnn::conv2d::launch_tiled<float, ConvType>(
+      input_gpu, filter_gpu, output_gpu, params, config, backend);
+  EXPECT_EQ(sycldnn::StatusCode::InvalidAlgorithm, status.status);
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/padding_mode.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/conv2d/transformed_filter.h"
+
+#include "sycldnn/conv2d/selector/direct_selector.h"
+
+#include "sycldnn/helpers/padding.h"
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+
+#include <stddef.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace {
+
+using Algorithm = sycldnn::conv2d::Algorithm;
+
+template <typename ConvType>
+struct TransformedFilterConv2D
+    : public BackendTestFixture<sycldnn::backend::SNNBackend> {
+  using DataType = float;
+  using Backend = sycldnn::backend::SNNBackend;
+  using TransformedFilter =
+      sycldnn::conv2d::TransformedFilter<DataType, ConvType, Backend>;
+
+ protected:
+  /**
+   * Transform the filter once for the given algorithm, then use it to compute
+   * convolutions with a range of batch sizes, comparing each against the
+   * Direct convolution.
+   */
+  void test_conv(sycldnn::conv2d::Conv2DParams params, Algorithm algo) {
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    size_t transform_size =
+        sycldnn::conv2d::query_transformed_filter_size<ConvType>(params, algo);
+    ASSERT_LT(0u, transform_size);
+
+    auto filter_size =
+        sycldnn::conv2d::get_sizes<ConvType>(params).filter_size;
+    std::vector<DataType> filter =
+        iota_initialised_data(filter_size, static_cast<DataType>(2048));
+    std::for_each(begin(filter), end(filter),
+                  [](DataType& val) { val /= 1000; });
+    std::vector<DataType> transform(transform_size);
+
+    auto fil_gpu = provider.get_initialised_device_memory(filter_size, filter);
+    auto trans_gpu =
+        provider.get_initialised_device_memory(transform_size, transform);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(fil_gpu);
+      provider.deallocate_ptr(trans_gpu);
+    };
+
+    TransformedFilter transformed{trans_gpu, params, algo};
+    auto status = sycldnn::conv2d::transform_filter<DataType, ConvType>(
+        fil_gpu, transformed, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    for (int batch : {1, 3}) {
+      SCOPED_TRACE("Batch: " + std::to_string(batch));
+      params.batch = batch;
+      compare_to_direct(params, fil_gpu, transformed);
+    }
+  }
+
+ private:
+  template <typename Pointer>
+  void compare_to_direct(sycldnn::conv2d::Conv2DParams const& params,
+                         Pointer fil_gpu,
+                         TransformedFilter const& transformed) {
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto conv_sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+
+    std::vector<DataType> input = iota_initialised_data(
+        conv_sizes.input_size, static_cast<DataType>(2048));
+    std::for_each(begin(input), end(input), [](DataType& val) { val /= 1000; });
+    std::vector<DataType> exp_output(conv_sizes.output_size);
+    std::vector<DataType> output(conv_sizes.output_size);
+
+    auto inp_gpu =
+        provider.get_initialised_device_memory(conv_sizes.input_size, input);
+    auto exp_out_gpu = provider.get_initialised_device_memory(
+        conv_sizes.output_size, exp_output);
+    auto out_gpu =
+        provider.get_initialised_device_memory(conv_sizes.output_size, output);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(exp_out_gpu);
+      provider.deallocate_ptr(out_gpu);
+    };
+
+    sycldnn::conv2d::DirectSelector direct_selector{};
+    auto status = sycldnn::conv2d::launch<DataType, ConvType>(
+        inp_gpu, fil_gpu, exp_out_gpu, params, direct_selector, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    status = sycldnn::conv2d::launch<DataType, ConvType>(
+        inp_gpu, transformed, out_gpu, params, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(conv_sizes.output_size, exp_out_gpu,
+                                      exp_output);
+    provider.copy_device_data_to_host(conv_sizes.output_size, out_gpu, output);
+    for (size_t i = 0; i < exp_output.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL(exp_output[i], output[i], 512u);
+    }
+  }
+};
+
+sycldnn::conv2d::Conv2DParams get_params(int window_rows, int window_cols) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 8;
+  params.features = 16;
+  params.batch = 1;
+  params.in_rows = 13;
+  params.in_cols = 11;
+  params.window_rows = window_rows;
+  params.window_cols = window_cols;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  return sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::SAME);
+}
+
+using ConvTypes =
+    ::testing::Types<sycldnn::conv2d::conv_type::Forward,
+                     sycldnn::conv2d::conv_type::InputBackprop>;
+TYPED_TEST_SUITE(TransformedFilterConv2D, ConvTypes);
+
+TYPED_TEST(TransformedFilterConv2D, Winograd3x3) {
+  this->test_conv(get_params(3, 3), Algorithm::Winograd);
+}
+TYPED_TEST(TransformedFilterConv2D, Winograd3x1) {
+  this->test_conv(get_params(3, 1), Algorithm::Winograd);
+}
+TYPED_TEST(TransformedFilterConv2D, Winograd1x3) {
+  this->test_conv(get_params(1, 3), Algorithm::Winograd);
+}
+TYPED_TEST(TransformedFilterConv2D, WinogradLarge3x3) {
+  this->test_conv(get_params(3, 3), Algorithm::WinogradLarge);
+}
+
+TEST(TransformedFilterSizeTest, Im2colOnlyTransformsInputBackprop) {
+  auto params = get_params(3, 3);
+  EXPECT_EQ(0u, sycldnn::conv2d::query_transformed_filter_size<
+                    sycldnn::conv2d::conv_type::Forward>(params,
+                                                         Algorithm::Im2col));
+  EXPECT_EQ(9u * 8u * 16u,
+            sycldnn::conv2d::query_transformed_filter_size<
+                sycldnn::conv2d::conv_type::InputBackprop>(params,
+                                                           Algorithm::Im2col));
+  EXPECT_EQ(0u, sycldnn::conv2d::query_transformed_filter_size<
+                    sycldnn::conv2d::conv_type::Forward>(params,
+                                                         Algorithm::Direct));
+}
+
+using InputBackpropTransformedFilter =
+    TransformedFilterConv2D<sycldnn::conv2d::conv_type::InputBackprop>;
+TEST_F(InputBackpropTransformedFilter, Im2col) {
+  this->test_conv(get_params(3, 3), Algorithm::Im2col);
+}
+TEST_F(InputBackpropTransformedFilter, Im2colStrided) {
+  auto params = get_params(3, 3);
+  params.stride_rows = 2;
+  params.stride_cols = 2;
+  params = sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::SAME);
+  this->test_conv(params, Algorithm::Im2col);
+}
+
+}  // namespace
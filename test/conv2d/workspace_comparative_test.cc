@@ -160,6 +160,20 @@ struct WorkspaceComparativeConv2D
       SNN_ALMOST_EQUAL(exp_output[i], output[i], 512u);
     }
   }
+
+  /**
+   * Run test_conv() only if the implementation specified by SelectorType
+   * supports the given convolution parameters.
+   */
+  void test_conv_if_supported(sycldnn::conv2d::Conv2DParams const& params,
+                              bool use_recommended_size) {
+    SelectorType selector{};
+    if (selector.template select<ConvType>(params) ==
+        sycldnn::conv2d::Algorithm::NotSupported) {
+      return;
+    }
+    test_conv(params, use_recommended_size);
+  }
 };
 
 using DataTypeList = sycldnn::types::KernelDataTypes;
@@ -265,6 +279,20 @@ sycldnn::conv2d::Conv2DParams vgg9_params() {
   return sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::SAME);
 }
 
+sycldnn::conv2d::Conv2DParams inception5x5_params() {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = channel_scale(32);
+  params.features = channel_scale(96);
+  params.batch = 4;
+  params.in_rows = image_scale(28);
+  params.in_cols = image_scale(28);
+  params.window_rows = 5;
+  params.window_cols = 5;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  return sycldnn::helpers::add_padding_to(params, sycldnn::PaddingMode::SAME);
+}
+
 }  // namespace
 
 TYPED_TEST(WorkspaceComparativeConv2D, Vgg1Required) {
@@ -306,3 +334,11 @@ TYPED_TEST(WorkspaceComparativeConv2D, Vgg8Recommended) {
 TYPED_TEST(WorkspaceComparativeConv2D, Vgg9Recommended) {
   this->test_conv(vgg9_params(), true);
 }
+
+TYPED_TEST(WorkspaceComparativeConv2D, Inception5x5Required) {
+  this->test_conv_if_supported(inception5x5_params(), false);
+}
+
+TYPED_TEST(WorkspaceComparativeConv2D, Inception5x5Recommended) {
+  this->test_conv_if_supported(inception5x5_params(), true);
+}
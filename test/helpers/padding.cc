@@ -29,20 +29,21 @@ struct PaddingTest : public ::testing::Test {
   void test_values(std::vector<Index> const& inputs, Index window, Index stride,
                    sycldnn::PaddingMode type,
                    std::vector<Index> const& expected_padding,
-                   std::vector<Index> const& expected_output) {
+                   std::vector<Index> const& expected_output,
+                   Index dilation = 1) {
     ASSERT_EQ(expected_padding.size(), inputs.size());
     ASSERT_EQ(expected_output.size(), inputs.size());
     for (size_t i = 0; i < inputs.size(); ++i) {
       SCOPED_TRACE("Element: " + std::to_string(i));
       test_single_value(inputs[i], window, stride, type, expected_padding[i],
-                        expected_output[i]);
+                        expected_output[i], dilation);
     }
   }
   void test_single_value(Index input, Index window, Index stride,
                          sycldnn::PaddingMode type, Index expected_padding,
-                         Index expected_output) {
-    auto padding =
-        sycldnn::helpers::calculate_padding(input, window, stride, type);
+                         Index expected_output, Index dilation = 1) {
+    auto padding = sycldnn::helpers::calculate_padding(input, window, stride,
+                                                       type, dilation);
     EXPECT_EQ(expected_padding, padding.padding);
     EXPECT_EQ(expected_output, padding.output);
   }
@@ -132,3 +133,33 @@ TYPED_TEST(PaddingTest, SameWindow3Stride3) {
   std::vector<TypeParam> exp_out = {1, 2, 2, 2, 3, 3, 3, 4};
   this->test_values(inputs, window, stride, type, exp_pad, exp_out);
 }
+TYPED_TEST(PaddingTest, ValidWindow3Stride1Dilation2) {
+  TypeParam window = 3;
+  TypeParam stride = 1;
+  TypeParam dilation = 2;
+  auto type = sycldnn::PaddingMode::VALID;
+  std::vector<TypeParam> inputs = {5, 6, 7, 8, 9, 10, 11, 12};
+  std::vector<TypeParam> exp_pad = {0, 0, 0, 0, 0, 0, 0, 0};
+  std::vector<TypeParam> exp_out = {1, 2, 3, 4, 5, 6, 7, 8};
+  this->test_values(inputs, window, stride, type, exp_pad, exp_out, dilation);
+}
+TYPED_TEST(PaddingTest, SameWindow3Stride1Dilation2) {
+  TypeParam window = 3;
+  TypeParam stride = 1;
+  TypeParam dilation = 2;
+  auto type = sycldnn::PaddingMode::SAME;
+  std::vector<TypeParam> inputs = {3, 4, 5, 6, 7, 8, 9, 10};
+  std::vector<TypeParam> exp_pad = {2, 2, 2, 2, 2, 2, 2, 2};
+  std::vector<TypeParam> exp_out = {3, 4, 5, 6, 7, 8, 9, 10};
+  this->test_values(inputs, window, stride, type, exp_pad, exp_out, dilation);
+}
+TYPED_TEST(PaddingTest, SameWindow3Stride2Dilation2) {
+  TypeParam window = 3;
+  TypeParam stride = 2;
+  TypeParam dilation = 2;
+  auto type = sycldnn::PaddingMode::SAME;
+  std::vector<TypeParam> inputs = {3, 4, 5, 6, 7, 8, 9, 10};
+  std::vector<TypeParam> exp_pad = {2, 1, 2, 1, 2, 1, 2, 1};
+  std::vector<TypeParam> exp_out = {2, 2, 3, 3, 4, 4, 5, 5};
+  this->test_values(inputs, window, stride, type, exp_pad, exp_out, dilation);
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_TEST_HELPERS_REQUANTIZE_H_
+#define SYCLDNN_TEST_HELPERS_REQUANTIZE_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+/**
+ * Host reference for the requantization of an int32 accumulator to int8, used
+ * to compute the expected results of quantized operations.
+ *
+ * Ties are rounded to even, matching the rounding used on the device.
+ */
+inline int8_t reference_requantize(int32_t acc, float scale,
+                                   int32_t zero_point, int32_t min = -128,
+                                   int32_t max = 127) {
+  auto const rounded =
+      static_cast<int32_t>(std::nearbyint(static_cast<float>(acc) * scale));
+  return static_cast<int8_t>(std::min(std::max(rounded + zero_point, min), max));
+}
+
+#endif  // SYCLDNN_TEST_HELPERS_REQUANTIZE_H_
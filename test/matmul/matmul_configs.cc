@@ -0,0 +1,151 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "sycldnn/matmul/config.h"
+#include "sycldnn/matmul/config_table.h"
+#include "sycldnn/matmul/launch.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+#include "test/matmul/reference_matmul.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+using Backend = sycldnn::backend::SNNBackend;
+using MatmulConfig = sycldnn::matmul::MatmulConfig;
+
+struct MatmulConfigTest : public BackendTestFixture<Backend> {
+ protected:
+  // Compare a matmul using the given config against a naive reference.
+  void check_config(MatmulConfig const& config, int batches, int m, int k,
+                    int n) {
+    std::vector<float> lhs = iota_initialised_data(batches * m * k, 8.f);
+    std::vector<float> rhs = iota_initialised_data(batches * k * n, 8.f);
+    std::vector<float> out(batches * m * n);
+
+    std::vector<float> exp =
+        reference_matmul<false, false>(lhs, rhs, out, batches, m, k, n, 0.f);
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto lhs_gpu = provider.get_initialised_device_memory(lhs.size(), lhs);
+    auto rhs_gpu = provider.get_initialised_device_memory(rhs.size(), rhs);
+    auto out_gpu = provider.get_initialised_device_memory(out.size(), out);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(lhs_gpu);
+      provider.deallocate_ptr(rhs_gpu);
+      provider.deallocate_ptr(out_gpu);
+    };
+
+    auto status = sycldnn::matmul::launch<float, false, false>(
+        lhs_gpu, rhs_gpu, out_gpu, batches, m, k, n, 0.f, config, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+    provider.copy_device_data_to_host(out.size(), out_gpu, out);
+
+    for (size_t i = 0; i < exp.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL(exp[i], out[i], 10u);
+    }
+  }
+};
+
+TEST_F(MatmulConfigTest, AllConfigsMatchReference) {
+  for (auto const& config : sycldnn::matmul::get_configs()) {
+    SCOPED_TRACE("Tiles: " + std::to_string(config.row_tile) + "x" +
+                 std::to_string(config.acc_tile) + "x" +
+                 std::to_string(config.col_tile) + " work-group: " +
+                 std::to_string(config.wg_rows) + "x" +
+                 std::to_string(config.wg_cols) + "x" +
+                 std::to_string(config.wg_batch));
+    // Sizes which are not a multiple of any tile exercise the bounds checks.
+    check_config(config, 2, 9, 11, 13);
+    check_config(config, 1, 16, 8, 8);
+  }
+}
+
+TEST_F(MatmulConfigTest, DefaultConfigsAreAvailable) {
+  auto const configs = sycldnn::matmul::get_configs();
+  auto const shapes = std::vector<std::vector<int>>{{1, 1, 1024, 1000},
+                                                    {1, 1000, 1024, 1},
+                                                    {64, 2, 16, 2},
+                                                    {1, 16, 64, 16},
+                                                    {1, 196, 64, 128},
+                                                    {1, 512, 512, 512},
+                                                    {1, 2048, 2048, 2048}};
+  for (auto const& shape : shapes) {
+    auto config = sycldnn::matmul::get_default_config(shape[0], shape[1],
+                                                      shape[2], shape[3]);
+    EXPECT_NE(configs.end(),
+              std::find(configs.begin(), configs.end(), config));
+  }
+  // A batch one fully connected layer should not tile the single row.
+  EXPECT_EQ(1, sycldnn::matmul::get_default_config(1, 1, 1024, 1000).row_tile);
+}
+
+TEST_F(MatmulConfigTest, UnavailableTileIsRejected) {
+  auto& provider = this->provider_;
+  auto& backend = provider.get_backend();
+  std::vector<float> data(16);
+  auto lhs_gpu = provider.get_initialised_device_memory(data.size(), data);
+  auto rhs_gpu = provider.get_initialised_device_memory(data.size(), data);
+  auto out_gpu = provider.get_initialised_device_memory(data.size(), data);
+  SNN_ON_SCOPE_EXIT {
+    provider.deallocate_ptr(lhs_gpu);
+    provider.deallocate_ptr(rhs_gpu);
+    provider.deallocate_ptr(out_gpu);
+  };
+  auto status = sycldnn::matmul::launch<float, false, false>(
+      lhs_gpu, rhs_gpu, out_gpu, 1, 4, 4, 4, 0.f,
+      MatmulConfig{3, 3, 3, 8, 4, 1}, backend);
+  EXPECT_EQ(sycldnn::StatusCode::InvalidAlgorithm, status.status);
+}
+
+TEST(MatmulConfigTableTest, SaveAndReload) {
+  cl::sycl::queue q;
+  auto file_name =
+      sycldnn::matmul::MatmulConfigTable::file_name_for(q.get_device());
+  EXPECT_EQ(std::string::npos, file_name.find('/'));
+
+  MatmulConfig const config{2, 4, 2, 1, 64, 1};
+  {
+    sycldnn::matmul::MatmulConfigTable table{file_name};
+    table.insert<false, true>(1, 1, 256, 1000, config);
+    ASSERT_TRUE(table.save());
+  }
+  sycldnn::matmul::MatmulConfigTable reloaded{file_name};
+  std::remove(file_name.c_str());
+
+  EXPECT_EQ(1u, reloaded.size());
+  MatmulConfig loaded;
+  ASSERT_TRUE((reloaded.lookup<false, true>(1, 1, 256, 1000, loaded)));
+  EXPECT_EQ(config, loaded);
+  EXPECT_FALSE((reloaded.lookup<false, false>(1, 1, 256, 1000, loaded)));
+
+  // Sizes which are not in the table fall back to the default heuristic.
+  EXPECT_EQ(sycldnn::matmul::get_default_config(1, 4, 4, 4),
+            (reloaded.select<false, false>(1, 4, 4, 4)));
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "sycldnn/matmul/launch.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+#include "test/matmul/reference_matmul.h"
+
+#include <string>
+#include <vector>
+
+using Backend = sycldnn::backend::SNNBackend;
+
+struct MatmulLocalMemTest : public BackendTestFixture<Backend> {
+ protected:
+  // Compare the local memory kernel against a naive reference.
+  template <bool TransposeLHS, bool TransposeRHS>
+  void check(int batches, int m, int k, int n, float beta) {
+    std::vector<float> lhs = iota_initialised_data(batches * m * k, 8.f);
+    std::vector<float> rhs = iota_initialised_data(batches * k * n, 8.f);
+    std::vector<float> out = iota_initialised_data(batches * m * n, 4.f);
+
+    std::vector<float> exp = reference_matmul<TransposeLHS, TransposeRHS>(
+        lhs, rhs, out, batches, m, k, n, beta);
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto lhs_gpu = provider.get_initialised_device_memory(lhs.size(), lhs);
+    auto rhs_gpu = provider.get_initialised_device_memory(rhs.size(), rhs);
+    auto out_gpu = provider.get_initialised_device_memory(out.size(), out);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(lhs_gpu);
+      provider.deallocate_ptr(rhs_gpu);
+      provider.deallocate_ptr(out_gpu);
+    };
+
+    auto status =
+        sycldnn::matmul::launch_local_mem<float, TransposeLHS, TransposeRHS>(
+            lhs_gpu, rhs_gpu, out_gpu, batches, m, k, n, beta, backend);
+    if (status.status == sycldnn::StatusCode::InvalidAlgorithm) {
+      // The device does not provide the resources needed by the kernel.
+      return;
+    }
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+    provider.copy_device_data_to_host(out.size(), out_gpu, out);
+
+    for (size_t i = 0; i < exp.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL(exp[i], out[i], 10u);
+    }
+  }
+
+  template <bool TransposeLHS, bool TransposeRHS>
+  void check_sizes() {
+    // Sizes smaller than one block, a multiple of the block and panel sizes,
+    // and sizes which leave partial blocks and panels.
+    check<TransposeLHS, TransposeRHS>(1, 5, 3, 7, 0.f);
+    check<TransposeLHS, TransposeRHS>(1, 32, 32, 32, 0.f);
+    check<TransposeLHS, TransposeRHS>(1, 64, 48, 96, 1.f);
+    check<TransposeLHS, TransposeRHS>(2, 37, 45, 19, 0.f);
+    check<TransposeLHS, TransposeRHS>(3, 33, 17, 65, 1.f);
+  }
+};
+
+TEST_F(MatmulLocalMemTest, NoTranspose) { check_sizes<false, false>(); }
+TEST_F(MatmulLocalMemTest, TransposeLHS) { check_sizes<true, false>(); }
+TEST_F(MatmulLocalMemTest, TransposeRHS) { check_sizes<false, true>(); }
+TEST_F(MatmulLocalMemTest, TransposeBoth) { check_sizes<true, true>(); }
+
+TEST_F(MatmulLocalMemTest, SmallMatricesUseDefaultKernel) {
+  auto device = this->provider_.get_backend().get_queue().get_device();
+  EXPECT_FALSE(sycldnn::matmul::use_local_mem_kernel<float>(device, 1, 1, 1024,
+                                                            1000));
+  EXPECT_FALSE(
+      sycldnn::matmul::use_local_mem_kernel<float>(device, 64, 2, 16, 2));
+}
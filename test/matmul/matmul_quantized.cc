@@ -0,0 +1,168 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/helpers/scope_exit.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/matmul/launch.h"
+#include "sycldnn/quantize/params.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/helpers/requantize.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using Backend = sycldnn::backend::SNNBackend;
+
+struct MatmulQuantizedTest : public BackendTestFixture<Backend> {
+ protected:
+  // Compare the int8 matmul against a reference which accumulates in int32
+  // and then requantizes each column.
+  template <bool TransposeLHS, bool TransposeRHS>
+  void check(int batches, int m, int k, int n,
+             sycldnn::quantize::RequantizeParams const& requantize_params) {
+    std::vector<int8_t> lhs(batches * m * k);
+    std::vector<int8_t> rhs(batches * k * n);
+    std::vector<int32_t> bias(n);
+    std::vector<float> scales(n);
+    std::vector<int32_t> zero_points(n);
+    std::vector<int8_t> out(batches * m * n);
+    for (size_t i = 0; i < lhs.size(); ++i) {
+      lhs[i] = static_cast<int8_t>(static_cast<int>(i * 37 % 255) - 128);
+    }
+    for (size_t i = 0; i < rhs.size(); ++i) {
+      rhs[i] = static_cast<int8_t>(static_cast<int>(i * 53 % 255) - 128);
+    }
+    for (int col = 0; col < n; ++col) {
+      bias[col] = col * 100 - 250;
+      scales[col] = col % 2 == 0 ? 1.f / 512 : 1.f / 2048;
+      zero_points[col] = col % 5 - 2;
+    }
+
+    std::vector<int8_t> exp(batches * m * n);
+    for (int b = 0; b < batches; ++b) {
+      for (int row = 0; row < m; ++row) {
+        for (int col = 0; col < n; ++col) {
+          int32_t value = bias[col];
+          for (int acc = 0; acc < k; ++acc) {
+            int const lhs_idx = TransposeLHS ? (b * k + acc) * m + row
+                                             : (b * m + row) * k + acc;
+            int const rhs_idx = TransposeRHS ? (b * n + col) * k + acc
+                                             : (b * k + acc) * n + col;
+            value += (lhs[lhs_idx] - requantize_params.input_zero_point) *
+                     (rhs[rhs_idx] - requantize_params.filter_zero_point);
+          }
+          exp[(b * m + row) * n + col] = reference_requantize(
+              value, scales[col], zero_points[col],
+              requantize_params.activation_min,
+              requantize_params.activation_max);
+        }
+      }
+    }
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto lhs_gpu = provider.get_initialised_device_memory(lhs.size(), lhs);
+    auto rhs_gpu = provider.get_initialised_device_memory(rhs.size(), rhs);
+    auto bias_gpu = provider.get_initialised_device_memory(n, bias);
+    auto scale_gpu = provider.get_initialised_device_memory(n, scales);
+    auto zero_point_gpu =
+        provider.get_initialised_device_memory(n, zero_points);
+    auto out_gpu = provider.get_initialised_device_memory(out.size(), out);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(lhs_gpu);
+      provider.deallocate_ptr(rhs_gpu);
+      provider.deallocate_ptr(bias_gpu);
+      provider.deallocate_ptr(scale_gpu);
+      provider.deallocate_ptr(zero_point_gpu);
+      provider.deallocate_ptr(out_gpu);
+    };
+
+    auto status =
+        sycldnn::matmul::launch_quantized<TransposeLHS, TransposeRHS>(
+            lhs_gpu, rhs_gpu, bias_gpu, scale_gpu, zero_point_gpu, out_gpu,
+            batches, m, k, n, requantize_params, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(out.size(), out_gpu, out);
+    for (size_t i = 0; i < exp.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_EQ(exp[i], out[i]);
+    }
+  }
+};
+
+TEST_F(MatmulQuantizedTest, NoTranspose) {
+  check<false, false>(1, 7, 19, 5, {});
+}
+TEST_F(MatmulQuantizedTest, TransposeLHS) {
+  check<true, false>(2, 6, 33, 9, {});
+}
+TEST_F(MatmulQuantizedTest, TransposeRHS) {
+  check<false, true>(3, 5, 17, 4, {});
+}
+TEST_F(MatmulQuantizedTest, TransposeBoth) {
+  check<true, true>(1, 11, 64, 13, {});
+}
+TEST_F(MatmulQuantizedTest, InputZeroPoints) {
+  sycldnn::quantize::RequantizeParams params;
+  params.input_zero_point = -7;
+  params.filter_zero_point = 3;
+  check<false, false>(2, 9, 27, 8, params);
+}
+TEST_F(MatmulQuantizedTest, ReluBounds) {
+  sycldnn::quantize::RequantizeParams params;
+  params.activation_min = 0;
+  params.activation_max = 100;
+  check<false, true>(1, 8, 40, 10, params);
+}
+TEST_F(MatmulQuantizedTest, LargestAccumulation) {
+  check<false, true>(1, 3, 1 << 15, 5, {});
+}
+TEST_F(MatmulQuantizedTest, AccumulationTooLarge) {
+  int const k = (1 << 15) + 1;
+  auto& provider = this->provider_;
+  auto& backend = provider.get_backend();
+  auto lhs_gpu =
+      provider.get_initialised_device_memory(k, std::vector<int8_t>(k));
+  auto rhs_gpu =
+      provider.get_initialised_device_memory(k, std::vector<int8_t>(k));
+  auto bias_gpu =
+      provider.get_initialised_device_memory(1, std::vector<int32_t>(1));
+  auto scale_gpu =
+      provider.get_initialised_device_memory(1, std::vector<float>(1, 1.f));
+  auto zero_point_gpu =
+      provider.get_initialised_device_memory(1, std::vector<int32_t>(1));
+  auto out_gpu =
+      provider.get_initialised_device_memory(1, std::vector<int8_t>(1));
+  SNN_ON_SCOPE_EXIT {
+    provider.deallocate_ptr(lhs_gpu);
+    provider.deallocate_ptr(rhs_gpu);
+    provider.deallocate_ptr(bias_gpu);
+    provider.deallocate_ptr(scale_gpu);
+    provider.deallocate_ptr(zero_point_gpu);
+    provider.deallocate_ptr(out_gpu);
+  };
+  auto status = sycldnn::matmul::launch_quantized<false, false>(
+      lhs_gpu, rhs_gpu, bias_gpu, scale_gpu, zero_point_gpu, out_gpu, 1, 1,
+      k, 1, {}, backend);
+  EXPECT_EQ(sycldnn::StatusCode::InvalidParameter, status.status);
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "sycldnn/matmul/launch.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/helpers/float_comparison.h"
+#include "test/matmul/reference_matmul.h"
+
+#include <string>
+#include <vector>
+
+using Backend = sycldnn::backend::SNNBackend;
+
+struct MatmulSplitKTest : public BackendTestFixture<Backend> {
+ protected:
+  // Compare the split-K matmul against a naive reference.
+  template <bool TransposeLHS, bool TransposeRHS>
+  void check(int batches, int m, int k, int n, int n_splits, float beta) {
+    std::vector<float> lhs = iota_initialised_data(batches * m * k, 8.f);
+    std::vector<float> rhs = iota_initialised_data(batches * k * n, 8.f);
+    std::vector<float> out = iota_initialised_data(batches * m * n, 4.f);
+    std::vector<float> workspace(
+        sycldnn::matmul::get_split_k_workspace_size(batches, m, n, n_splits));
+
+    std::vector<float> exp = reference_matmul<TransposeLHS, TransposeRHS>(
+        lhs, rhs, out, batches, m, k, n, beta);
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto lhs_gpu = provider.get_initialised_device_memory(lhs.size(), lhs);
+    auto rhs_gpu = provider.get_initialised_device_memory(rhs.size(), rhs);
+    auto out_gpu = provider.get_initialised_device_memory(out.size(), out);
+    auto ws_gpu =
+        provider.get_initialised_device_memory(workspace.size(), workspace);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(lhs_gpu);
+      provider.deallocate_ptr(rhs_gpu);
+      provider.deallocate_ptr(out_gpu);
+      provider.deallocate_ptr(ws_gpu);
+    };
+
+    auto status =
+        sycldnn::matmul::launch_split_k<float, TransposeLHS, TransposeRHS>(
+            lhs_gpu, rhs_gpu, out_gpu, ws_gpu, batches, m, k, n, beta,
+            n_splits, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+    provider.copy_device_data_to_host(out.size(), out_gpu, out);
+
+    for (size_t i = 0; i < exp.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL(exp[i], out[i], 10u);
+    }
+  }
+
+  template <bool TransposeLHS, bool TransposeRHS>
+  void check_sizes() {
+    // Splits which divide k exactly, splits which leave a partial final
+    // slice, and more splits than there are values to accumulate.
+    check<TransposeLHS, TransposeRHS>(1, 4, 64, 4, 4, 0.f);
+    check<TransposeLHS, TransposeRHS>(1, 5, 99, 3, 4, 1.f);
+    check<TransposeLHS, TransposeRHS>(3, 7, 50, 9, 3, 0.f);
+    check<TransposeLHS, TransposeRHS>(2, 3, 5, 2, 8, 1.f);
+    check<TransposeLHS, TransposeRHS>(1, 6, 17, 6, 1, 1.f);
+  }
+};
+
+TEST_F(MatmulSplitKTest, NoTranspose) { check_sizes<false, false>(); }
+TEST_F(MatmulSplitKTest, TransposeLHS) { check_sizes<true, false>(); }
+TEST_F(MatmulSplitKTest, TransposeRHS) { check_sizes<false, true>(); }
+TEST_F(MatmulSplitKTest, TransposeBoth) { check_sizes<true, true>(); }
+
+TEST(MatmulSplitKCountTest, OnlySplitsDeepSmallOutputs) {
+  // A 3x3x64x64 weight gradient accumulating over a large batch of images.
+  EXPECT_LT(1, sycldnn::matmul::get_split_k_count(1, 576, 32 * 56 * 56, 64));
+  // Large outputs already occupy the device.
+  EXPECT_EQ(1, sycldnn::matmul::get_split_k_count(1, 1024, 4096, 1024));
+  // Shallow accumulations are not worth splitting.
+  EXPECT_EQ(1, sycldnn::matmul::get_split_k_count(1, 16, 64, 16));
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_TEST_MATMUL_REFERENCE_MATMUL_H_
+#define SYCLDNN_TEST_MATMUL_REFERENCE_MATMUL_H_
+
+#include <vector>
+
+/**
+ * Compute a batched matrix multiply on the host:
+ * \code
+ *   output[b] = lhs[b] * rhs[b] + beta * output[b]
+ * \endcode
+ * where each matrix is row-major and lhs or rhs are transposed as given by
+ * the template parameters. Used as a naive reference for the matmul kernels.
+ *
+ * \param lhs     The [batches, m, k] LHS tensor, or [batches, k, m] if
+ *                transposed.
+ * \param rhs     The [batches, k, n] RHS tensor, or [batches, n, k] if
+ *                transposed.
+ * \param output  The [batches, m, n] output tensor, scaled by beta before the
+ *                products are added.
+ * \param batches The number of matrices in each tensor.
+ * \param m       The number of rows in the output.
+ * \param k       The size of the accumulation dimension.
+ * \param n       The number of columns in the output.
+ * \param beta    Scale multiplier for the original output values.
+ * \return The expected output tensor.
+ */
+template <bool TransposeLHS, bool TransposeRHS, typename T>
+std::vector<T> reference_matmul(std::vector<T> const& lhs,
+                                std::vector<T> const& rhs,
+                                std::vector<T> const& output, int batches,
+                                int m, int k, int n, T beta) {
+  std::vector<T> exp(output.begin(), output.begin() + batches * m * n);
+  for (int b = 0; b < batches; ++b) {
+    for (int row = 0; row < m; ++row) {
+      for (int col = 0; col < n; ++col) {
+        int const out_idx = (b * m + row) * n + col;
+        T value = beta * exp[out_idx];
+        for (int acc = 0; acc < k; ++acc) {
+          int const lhs_idx = TransposeLHS ? (b * k + acc) * m + row
+                                           : (b * m + row) * k + acc;
+          int const rhs_idx = TransposeRHS ? (b * n + col) * k + acc
+                                           : (b * k + acc) * n + col;
+          value += lhs[lhs_idx] * rhs[rhs_idx];
+        }
+        exp[out_idx] = value;
+      }
+    }
+  }
+  return exp;
+}
+
+#endif  // SYCLDNN_TEST_MATMUL_REFERENCE_MATMUL_H_
@@ -0,0 +1,117 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/helpers/scope_exit.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/quantize/launch.h"
+#include "sycldnn/quantize/params.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/gen/iota_initialised_data.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using Backend = sycldnn::backend::SNNBackend;
+
+struct QuantizeTest : public BackendTestFixture<Backend> {
+ protected:
+  // Quantize values spanning more than the int8 range, then dequantize them
+  // again, comparing both against a host reference.
+  void check(int size, std::vector<float> const& scales,
+             std::vector<int32_t> const& zero_points) {
+    int const channels = static_cast<int>(scales.size());
+    std::vector<float> input = iota_initialised_data(size, 20.f);
+    for (auto& value : input) {
+      value = (value - 10.f) * 7.3f;
+    }
+    std::vector<int8_t> quantized(size);
+    std::vector<float> dequantized(size);
+
+    std::vector<int8_t> exp_quantized(size);
+    std::vector<float> exp_dequantized(size);
+    for (int i = 0; i < size; ++i) {
+      int const c = i % channels;
+      auto const rounded =
+          static_cast<int32_t>(std::nearbyint(input[i] / scales[c]));
+      exp_quantized[i] = static_cast<int8_t>(
+          std::min(std::max(rounded + zero_points[c], -128), 127));
+      exp_dequantized[i] =
+          static_cast<float>(exp_quantized[i] - zero_points[c]) * scales[c];
+    }
+
+    sycldnn::quantize::QuantizeParams params;
+    params.size = size;
+    params.channels = channels;
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto input_gpu = provider.get_initialised_device_memory(size, input);
+    auto scale_gpu = provider.get_initialised_device_memory(channels, scales);
+    auto zero_point_gpu =
+        provider.get_initialised_device_memory(channels, zero_points);
+    auto quantized_gpu =
+        provider.get_initialised_device_memory(size, quantized);
+    auto dequantized_gpu =
+        provider.get_initialised_device_memory(size, dequantized);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(input_gpu);
+      provider.deallocate_ptr(scale_gpu);
+      provider.deallocate_ptr(zero_point_gpu);
+      provider.deallocate_ptr(quantized_gpu);
+      provider.deallocate_ptr(dequantized_gpu);
+    };
+
+    auto status = sycldnn::quantize::quantize<float>(
+        input_gpu, scale_gpu, zero_point_gpu, quantized_gpu, params, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status = sycldnn::quantize::dequantize<float>(
+        quantized_gpu, scale_gpu, zero_point_gpu, dequantized_gpu, params,
+        backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(size, quantized_gpu, quantized);
+    provider.copy_device_data_to_host(size, dequantized_gpu, dequantized);
+
+    for (int i = 0; i < size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_EQ(exp_quantized[i], quantized[i]);
+      EXPECT_EQ(exp_dequantized[i], dequantized[i]);
+    }
+  }
+};
+
+TEST_F(QuantizeTest, PerTensor) { check(97, {0.5f}, {3}); }
+TEST_F(QuantizeTest, PerTensorSymmetric) { check(64, {1.f}, {0}); }
+TEST_F(QuantizeTest, PerChannel) {
+  check(90, {0.5f, 2.f, 0.25f}, {0, -20, 7});
+}
+TEST_F(QuantizeTest, PerChannelLarge) {
+  std::vector<float> scales(16);
+  std::vector<int32_t> zero_points(16);
+  for (int i = 0; i < 16; ++i) {
+    scales[i] = std::ldexp(1.f, i % 4 - 2);
+    zero_points[i] = i * 3 - 24;
+  }
+  check(16 * 33, scales, zero_points);
+}
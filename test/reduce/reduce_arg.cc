@@ -0,0 +1,127 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "sycldnn/helpers/scope_exit.h"
+#include "sycldnn/reduce/launch.h"
+#include "sycldnn/reduce/operators.h"
+#include "test/backend/backend_test_fixture.h"
+#include "test/types/cartesian_product.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Backends = sycldnn::types::AllBackendTypes;
+
+using TypeBackendPairs =
+    sycldnn::types::CartesianProduct<DataTypeList, Backends>::type;
+
+using GTestTypePair = sycldnn::types::ToGTestTypes<TypeBackendPairs>::type;
+
+template <typename Pair, typename Op>
+struct ReduceArgFixture : public BackendTestFixture<typename Pair::SecondType> {
+  using DataType = typename Pair::FirstType;
+  using Backend = typename Pair::SecondType;
+
+ protected:
+  /**
+   * Run an index reduction over repeating values, so that every output has
+   * ties, and check that the first index of the best value is returned.
+   */
+  void run(int batches, int outer, int inner) {
+    static constexpr bool is_max =
+        std::is_same<Op, sycldnn::reduce::ArgMax>::value;
+    size_t input_size = batches * outer * inner;
+    size_t output_size = batches * inner;
+
+    std::vector<DataType> input_data(input_size);
+    for (size_t i = 0; i < input_size; ++i) {
+      input_data[i] = static_cast<DataType>(static_cast<float>(i * 7 % 13));
+    }
+    std::vector<int32_t> expected;
+    for (int b = 0; b < batches; ++b) {
+      for (int i = 0; i < inner; ++i) {
+        auto value_at = [&](int o) {
+          return static_cast<float>(input_data[(b * outer + o) * inner + i]);
+        };
+        int32_t best = 0;
+        for (int o = 1; o < outer; ++o) {
+          if (is_max ? value_at(o) > value_at(best)
+                     : value_at(o) < value_at(best)) {
+            best = o;
+          }
+        }
+        expected.push_back(best);
+      }
+    }
+    std::vector<int32_t> output_data(output_size, -1);
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    {
+      auto input_gpu =
+          provider.get_initialised_device_memory(input_size, input_data);
+      auto output_gpu =
+          provider.get_initialised_device_memory(output_size, output_data);
+      SNN_ON_SCOPE_EXIT {
+        provider.deallocate_ptr(input_gpu);
+        provider.deallocate_ptr(output_gpu);
+      };
+
+      auto status = sycldnn::reduce::launch_arg<DataType, Op>(
+          input_gpu, output_gpu, batches, outer, inner, backend);
+
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      provider.copy_device_data_to_host(output_size, output_gpu, output_data);
+    }
+
+    for (size_t i = 0; i < expected.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_EQ(expected[i], output_data[i]);
+    }
+  }
+};
+
+// The first shape of each operator is reduced by a single work item per
+// output, the others split the outer dimension of each output across several
+// work items, with ties between the slices. The shapes with an inner size of
+// one reduce each slice across a workgroup.
+
+template <typename Pair>
+using ReduceArgMax = ReduceArgFixture<Pair, sycldnn::reduce::ArgMax>;
+TYPED_TEST_SUITE(ReduceArgMax, GTestTypePair);
+TYPED_TEST(ReduceArgMax, Batch3Outer33Inner8) { this->run(3, 33, 8); }
+TYPED_TEST(ReduceArgMax, Batch2Outer513Inner3) { this->run(2, 513, 3); }
+TYPED_TEST(ReduceArgMax, Batch1Outer100000Inner1) { this->run(1, 100000, 1); }
+TYPED_TEST(ReduceArgMax, Batch3Outer20000Inner1) { this->run(3, 20000, 1); }
+
+template <typename Pair>
+using ReduceArgMin = ReduceArgFixture<Pair, sycldnn::reduce::ArgMin>;
+TYPED_TEST_SUITE(ReduceArgMin, GTestTypePair);
+TYPED_TEST(ReduceArgMin, Batch3Outer33Inner8) { this->run(3, 33, 8); }
+TYPED_TEST(ReduceArgMin, Batch2Outer513Inner3) { this->run(2, 513, 3); }
+TYPED_TEST(ReduceArgMin, Batch1Outer100000Inner1) { this->run(1, 100000, 1); }
+TYPED_TEST(ReduceArgMin, Batch3Outer20000Inner1) { this->run(3, 20000, 1); }
@@ -0,0 +1,221 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "sycldnn/helpers/scope_exit.h"
+#include "sycldnn/reduce/launch.h"
+#include "sycldnn/reduce/operators.h"
+#include "test/backend/backend_test_fixture.h"
+#include "test/types/cartesian_product.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Backends = sycldnn::types::AllBackendTypes;
+
+using TypeBackendPairs =
+    sycldnn::types::CartesianProduct<DataTypeList, Backends>::type;
+
+using GTestTypePair = sycldnn::types::ToGTestTypes<TypeBackendPairs>::type;
+
+namespace {
+
+template <typename Op>
+struct Reference;
+
+template <>
+struct Reference<sycldnn::reduce::Max> {
+  static double apply(std::vector<double> const& values) {
+    return *std::max_element(values.begin(), values.end());
+  }
+};
+
+template <>
+struct Reference<sycldnn::reduce::Min> {
+  static double apply(std::vector<double> const& values) {
+    return *std::min_element(values.begin(), values.end());
+  }
+};
+
+template <>
+struct Reference<sycldnn::reduce::Prod> {
+  static double apply(std::vector<double> const& values) {
+    double result = 1;
+    for (auto value : values) {
+      result *= value;
+    }
+    return result;
+  }
+};
+
+template <>
+struct Reference<sycldnn::reduce::SumOfSquares> {
+  static double apply(std::vector<double> const& values) {
+    double result = 0;
+    for (auto value : values) {
+      result += value * value;
+    }
+    return result;
+  }
+};
+
+template <>
+struct Reference<sycldnn::reduce::L2Norm> {
+  static double apply(std::vector<double> const& values) {
+    return std::sqrt(Reference<sycldnn::reduce::SumOfSquares>::apply(values));
+  }
+};
+
+template <>
+struct Reference<sycldnn::reduce::LogSumExp> {
+  static double apply(std::vector<double> const& values) {
+    double const max = *std::max_element(values.begin(), values.end());
+    double sum = 0;
+    for (auto value : values) {
+      sum += std::exp(value - max);
+    }
+    return max + std::log(sum);
+  }
+};
+
+}  // namespace
+
+template <typename Pair, typename Op>
+struct ReduceOperatorFixture
+    : public BackendTestFixture<typename Pair::SecondType> {
+  using DataType = typename Pair::FirstType;
+  using Backend = typename Pair::SecondType;
+
+ protected:
+  /**
+   * Run a reduction over values close to one, shifted by the given offset, and
+   * check the output against a reference computed in double precision.
+   */
+  void run(int batches, int outer, int inner, float offset = 0.f) {
+    size_t input_size = batches * outer * inner;
+    size_t output_size = batches * inner;
+
+    std::vector<DataType> input_data(input_size);
+    for (size_t i = 0; i < input_size; ++i) {
+      input_data[i] = static_cast<DataType>(
+          offset + 1.f + static_cast<float>(static_cast<int>(i * 7 % 13) - 6) /
+                             64.f);
+    }
+    std::vector<double> expected;
+    for (int b = 0; b < batches; ++b) {
+      for (int i = 0; i < inner; ++i) {
+        std::vector<double> values;
+        for (int o = 0; o < outer; ++o) {
+          values.push_back(static_cast<double>(
+              static_cast<float>(input_data[(b * outer + o) * inner + i])));
+        }
+        expected.push_back(Reference<Op>::apply(values));
+      }
+    }
+    std::vector<DataType> output_data(output_size);
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    {
+      auto input_gpu =
+          provider.get_initialised_device_memory(input_size, input_data);
+      auto output_gpu =
+          provider.get_initialised_device_memory(output_size, output_data);
+      SNN_ON_SCOPE_EXIT {
+        provider.deallocate_ptr(input_gpu);
+        provider.deallocate_ptr(output_gpu);
+      };
+
+      auto status = sycldnn::reduce::launch<DataType, Op>(
+          input_gpu, output_gpu, batches, outer, inner, backend);
+
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      provider.copy_device_data_to_host(output_size, output_gpu, output_data);
+    }
+
+    double const tolerance = sizeof(DataType) < sizeof(float) ? 1e-2 : 1e-4;
+    for (size_t i = 0; i < expected.size(); ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_NEAR(expected[i],
+                  static_cast<double>(static_cast<float>(output_data[i])),
+                  tolerance * (std::abs(expected[i]) + 1));
+    }
+  }
+};
+
+// The first shape of each operator is reduced by a single work item per
+// output, the second splits the outer dimension of each output across several
+// work items, and the third reduces each slice of the outer dimension across a
+// workgroup.
+
+template <typename Pair>
+using ReduceMax = ReduceOperatorFixture<Pair, sycldnn::reduce::Max>;
+TYPED_TEST_SUITE(ReduceMax, GTestTypePair);
+TYPED_TEST(ReduceMax, Batch3Outer6Inner8) { this->run(3, 6, 8); }
+TYPED_TEST(ReduceMax, Batch2Outer513Inner3) { this->run(2, 513, 3); }
+TYPED_TEST(ReduceMax, Batch2Outer20000Inner1) { this->run(2, 20000, 1); }
+
+template <typename Pair>
+using ReduceMin = ReduceOperatorFixture<Pair, sycldnn::reduce::Min>;
+TYPED_TEST_SUITE(ReduceMin, GTestTypePair);
+TYPED_TEST(ReduceMin, Batch3Outer6Inner8) { this->run(3, 6, 8); }
+TYPED_TEST(ReduceMin, Batch2Outer513Inner3) { this->run(2, 513, 3); }
+TYPED_TEST(ReduceMin, Batch2Outer20000Inner1) { this->run(2, 20000, 1); }
+
+template <typename Pair>
+using ReduceProd = ReduceOperatorFixture<Pair, sycldnn::reduce::Prod>;
+TYPED_TEST_SUITE(ReduceProd, GTestTypePair);
+TYPED_TEST(ReduceProd, Batch3Outer6Inner8) { this->run(3, 6, 8); }
+TYPED_TEST(ReduceProd, Batch2Outer513Inner3) { this->run(2, 513, 3); }
+TYPED_TEST(ReduceProd, Batch2Outer20000Inner1) { this->run(2, 20000, 1); }
+
+template <typename Pair>
+using ReduceSumOfSquares =
+    ReduceOperatorFixture<Pair, sycldnn::reduce::SumOfSquares>;
+TYPED_TEST_SUITE(ReduceSumOfSquares, GTestTypePair);
+TYPED_TEST(ReduceSumOfSquares, Batch3Outer6Inner8) { this->run(3, 6, 8); }
+TYPED_TEST(ReduceSumOfSquares, Batch2Outer513Inner3) { this->run(2, 513, 3); }
+TYPED_TEST(ReduceSumOfSquares, Batch2Outer20000Inner1) {
+  this->run(2, 20000, 1);
+}
+
+template <typename Pair>
+using ReduceL2Norm = ReduceOperatorFixture<Pair, sycldnn::reduce::L2Norm>;
+TYPED_TEST_SUITE(ReduceL2Norm, GTestTypePair);
+TYPED_TEST(ReduceL2Norm, Batch3Outer6Inner8) { this->run(3, 6, 8); }
+TYPED_TEST(ReduceL2Norm, Batch2Outer513Inner3) { this->run(2, 513, 3); }
+TYPED_TEST(ReduceL2Norm, Batch2Outer20000Inner1) { this->run(2, 20000, 1); }
+
+template <typename Pair>
+using ReduceLogSumExp =
+    ReduceOperatorFixture<Pair, sycldnn::reduce::LogSumExp>;
+TYPED_TEST_SUITE(ReduceLogSumExp, GTestTypePair);
+TYPED_TEST(ReduceLogSumExp, Batch3Outer6Inner8) { this->run(3, 6, 8); }
+TYPED_TEST(ReduceLogSumExp, Batch2Outer513Inner3) { this->run(2, 513, 3); }
+TYPED_TEST(ReduceLogSumExp, Batch2Outer20000Inner1) { this->run(2, 20000, 1); }
+TYPED_TEST(ReduceLogSumExp, LargeInputsDoNotOverflow) {
+  this->run(2, 513, 3, 1000.f);
+}
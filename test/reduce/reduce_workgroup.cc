@@ -0,0 +1,157 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "sycldnn/reduce/operators.h"
+#include "test/gen/iota_initialised_data.h"
+#include "test/reduce/fixture.h"
+#include "test/types/cartesian_product.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+// These shapes have few outputs and a long outer dimension, so the outer
+// dimension of each output is split across several work items before the
+// partial results are combined. With an inner size of one and a very long
+// outer dimension each slice is reduced across a workgroup.
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Backends = sycldnn::types::AllBackendTypes;
+
+using TypeBackendPairs =
+    sycldnn::types::CartesianProduct<DataTypeList, Backends>::type;
+
+using GTestTypePair = sycldnn::types::ToGTestTypes<TypeBackendPairs>::type;
+
+namespace {
+
+/**
+ * Compute the expected sum or mean over the outer dimension of the data
+ * generated by iota_initialised_data.
+ */
+template <typename DataType>
+std::vector<DataType> reference_reduce(int batches, int outer, int inner,
+                                       DataType max_val, bool mean) {
+  auto input = iota_initialised_data(
+      static_cast<size_t>(batches) * outer * inner, max_val);
+  std::vector<DataType> output;
+  for (int b = 0; b < batches; ++b) {
+    for (int i = 0; i < inner; ++i) {
+      double sum = 0;
+      for (int o = 0; o < outer; ++o) {
+        sum += static_cast<double>(input[(b * outer + o) * inner + i]);
+      }
+      if (mean) {
+        sum /= outer;
+      }
+      output.push_back(static_cast<DataType>(static_cast<float>(sum)));
+    }
+  }
+  return output;
+}
+
+}  // namespace
+
+template <typename Pair>
+using ReduceAddWorkgroup = ReduceFixture<Pair, sycldnn::reduce::Add>;
+TYPED_TEST_SUITE(ReduceAddWorkgroup, GTestTypePair);
+TYPED_TEST(ReduceAddWorkgroup, Batch1Outer1000Inner1) {
+  using DataType = typename TestFixture::DataType;
+  const int batches = 1;
+  const int outer = 1000;
+  const int inner = 1;
+  const DataType max_input_val = 4.0;
+  this->run(reference_reduce(batches, outer, inner, max_input_val, false),
+            batches, outer, inner, max_input_val);
+}
+TYPED_TEST(ReduceAddWorkgroup, Batch2Outer513Inner3) {
+  using DataType = typename TestFixture::DataType;
+  const int batches = 2;
+  const int outer = 513;
+  const int inner = 3;
+  const DataType max_input_val = 4.0;
+  this->run(reference_reduce(batches, outer, inner, max_input_val, false),
+            batches, outer, inner, max_input_val);
+}
+TYPED_TEST(ReduceAddWorkgroup, Batch1Outer32768Inner1) {
+  using DataType = typename TestFixture::DataType;
+  const int batches = 1;
+  const int outer = 32768;
+  const int inner = 1;
+  const DataType max_input_val = 1.0;
+  this->run(reference_reduce(batches, outer, inner, max_input_val, false),
+            batches, outer, inner, max_input_val);
+}
+TYPED_TEST(ReduceAddWorkgroup, Batch3Outer20000Inner1) {
+  using DataType = typename TestFixture::DataType;
+  const int batches = 3;
+  const int outer = 20000;
+  const int inner = 1;
+  const DataType max_input_val = 1.0;
+  this->run(reference_reduce(batches, outer, inner, max_input_val, false),
+            batches, outer, inner, max_input_val);
+}
+TYPED_TEST(ReduceAddWorkgroup, Batch1Outer64Inner16) {
+  using DataType = typename TestFixture::DataType;
+  const int batches = 1;
+  const int outer = 64;
+  const int inner = 16;
+  const DataType max_input_val = 4.0;
+  this->run(reference_reduce(batches, outer, inner, max_input_val, false),
+            batches, outer, inner, max_input_val);
+}
+
+template <typename Pair>
+using ReduceMeanWorkgroup = ReduceFixture<Pair, sycldnn::reduce::Mean>;
+TYPED_TEST_SUITE(ReduceMeanWorkgroup, GTestTypePair);
+TYPED_TEST(ReduceMeanWorkgroup, Batch1Outer1000Inner1) {
+  using DataType = typename TestFixture::DataType;
+  const int batches = 1;
+  const int outer = 1000;
+  const int inner = 1;
+  const DataType max_input_val = 4.0;
+  this->run(reference_reduce(batches, outer, inner, max_input_val, true),
+            batches, outer, inner, max_input_val);
+}
+TYPED_TEST(ReduceMeanWorkgroup, Batch1Outer1048576Inner1) {
+  using DataType = typename TestFixture::DataType;
+  const int batches = 1;
+  const int outer = 1048576;
+  const int inner = 1;
+  const DataType max_input_val = 1.0;
+  this->run(reference_reduce(batches, outer, inner, max_input_val, true),
+            batches, outer, inner, max_input_val);
+}
+TYPED_TEST(ReduceMeanWorkgroup, Batch2Outer513Inner3) {
+  using DataType = typename TestFixture::DataType;
+  const int batches = 2;
+  const int outer = 513;
+  const int inner = 3;
+  const DataType max_input_val = 4.0;
+  this->run(reference_reduce(batches, outer, inner, max_input_val, true),
+            batches, outer, inner, max_input_val);
+}
+TYPED_TEST(ReduceMeanWorkgroup, Batch4Outer3136Inner64) {
+  using DataType = typename TestFixture::DataType;
+  const int batches = 4;
+  const int outer = 3136;
+  const int inner = 64;
+  const DataType max_input_val = 4.0;
+  this->run(reference_reduce(batches, outer, inner, max_input_val, true),
+            batches, outer, inner, max_input_val);
+}
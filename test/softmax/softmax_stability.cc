@@ -0,0 +1,187 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/status.h"
+
+#include "sycldnn/backend/snn_backend.h"
+
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "sycldnn/softmax/direction.h"
+#include "sycldnn/softmax/launch.h"
+#include "sycldnn/softmax/params.h"
+
+#include "test/backend/backend_test_fixture.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct SoftmaxStability
+    : public BackendTestFixture<sycldnn::backend::SNNBackend> {
+ protected:
+  /**
+   * Run a forward softmax over rows of the given number of channels, and check
+   * the output against a reference computed in double precision.
+   */
+  void test_softmax(std::vector<float> const& input, int channels) {
+    sycldnn::softmax::SoftmaxParams params;
+    params.batch = static_cast<int>(input.size()) / channels;
+    params.rows = 1;
+    params.cols = 1;
+    params.channels = channels;
+    size_t const size = input.size();
+    size_t const workspace_size = params.batch;
+
+    std::vector<float> expected(size);
+    for (size_t row = 0; row < size; row += channels) {
+      auto const begin = input.begin() + row;
+      double const max = *std::max_element(begin, begin + channels);
+      double sum = 0;
+      for (int c = 0; c < channels; ++c) {
+        sum += std::exp(input[row + c] - max);
+      }
+      for (int c = 0; c < channels; ++c) {
+        expected[row + c] =
+            static_cast<float>(std::exp(input[row + c] - max) / sum);
+      }
+    }
+
+    auto& provider = provider_;
+    std::vector<float> workspace(workspace_size);
+    std::vector<float> output(size);
+    auto inp_gpu = provider.get_initialised_device_memory(size, input);
+    auto workspace_gpu =
+        provider.get_initialised_device_memory(workspace_size, workspace);
+    auto out_gpu = provider.get_initialised_device_memory(size, output);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(workspace_gpu);
+      provider.deallocate_ptr(out_gpu);
+    };
+
+    auto status = sycldnn::softmax::launch<float, sycldnn::softmax::Forward>(
+        inp_gpu, workspace_gpu, out_gpu, params, provider.get_backend());
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(size, out_gpu, output);
+    for (size_t i = 0; i < size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_NEAR(expected[i], output[i], 1e-5f * expected[i]);
+    }
+  }
+
+  /**
+   * Run a softmax gradient over rows of the given number of channels, and
+   * check the output against a reference computed in double precision.
+   */
+  void test_gradient(std::vector<float> const& softmax_output,
+                     std::vector<float> const& gradient, int channels) {
+    sycldnn::softmax::SoftmaxParams params;
+    params.batch = static_cast<int>(softmax_output.size()) / channels;
+    params.rows = 1;
+    params.cols = 1;
+    params.channels = channels;
+    size_t const size = softmax_output.size();
+    size_t const workspace_size = params.batch;
+
+    std::vector<float> expected(size);
+    for (size_t row = 0; row < size; row += channels) {
+      double sum = 0;
+      for (int c = 0; c < channels; ++c) {
+        sum += static_cast<double>(softmax_output[row + c]) * gradient[row + c];
+      }
+      for (int c = 0; c < channels; ++c) {
+        expected[row + c] = static_cast<float>(softmax_output[row + c] *
+                                               (gradient[row + c] - sum));
+      }
+    }
+
+    auto& provider = provider_;
+    std::vector<float> workspace(workspace_size);
+    std::vector<float> output(size);
+    auto inp_gpu = provider.get_initialised_device_memory(size, softmax_output);
+    auto grad_gpu = provider.get_initialised_device_memory(size, gradient);
+    auto workspace_gpu =
+        provider.get_initialised_device_memory(workspace_size, workspace);
+    auto out_gpu = provider.get_initialised_device_memory(size, output);
+    SNN_ON_SCOPE_EXIT {
+      provider.deallocate_ptr(inp_gpu);
+      provider.deallocate_ptr(grad_gpu);
+      provider.deallocate_ptr(workspace_gpu);
+      provider.deallocate_ptr(out_gpu);
+    };
+
+    auto status = sycldnn::softmax::launch<float, sycldnn::softmax::Gradient>(
+        inp_gpu, grad_gpu, workspace_gpu, out_gpu, params,
+        provider.get_backend());
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(size, out_gpu, output);
+    for (size_t i = 0; i < size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_NEAR(expected[i], output[i],
+                  1e-5f + 1e-4f * std::abs(expected[i]));
+    }
+  }
+};
+
+TEST_F(SoftmaxStability, LargeInputsDoNotOverflow) {
+  int const channels = 10;
+  std::vector<float> input(3 * channels);
+  for (size_t i = 0; i < input.size(); ++i) {
+    input[i] = 1000.f + static_cast<float>(i % channels);
+  }
+  test_softmax(input, channels);
+}
+
+TEST_F(SoftmaxStability, LargeNegativeInputs) {
+  int const channels = 10;
+  std::vector<float> input(3 * channels);
+  for (size_t i = 0; i < input.size(); ++i) {
+    input[i] = -1000.f - static_cast<float>(i % channels);
+  }
+  test_softmax(input, channels);
+}
+
+TEST_F(SoftmaxStability, RowsLongerThanWorkgroup) {
+  int const channels = 1000;
+  std::vector<float> input(2 * channels);
+  for (size_t i = 0; i < input.size(); ++i) {
+    input[i] = static_cast<float>((i * 7) % 23) / 4.f;
+  }
+  test_softmax(input, channels);
+}
+
+TEST_F(SoftmaxStability, GradientRowsLongerThanWorkgroup) {
+  int const channels = 1000;
+  std::vector<float> softmax_output(2 * channels);
+  std::vector<float> gradient(2 * channels);
+  for (size_t i = 0; i < softmax_output.size(); ++i) {
+    softmax_output[i] =
+        static_cast<float>(1 + (i * 7) % 23) / (12.f * channels);
+    gradient[i] = static_cast<float>((i * 5) % 11) - 5.f;
+  }
+  test_gradient(softmax_output, gradient, channels);
+}
+
+}  // namespace
@@ -0,0 +1,93 @@
+
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "tools/memory_plan.h"
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+using sycldnn::TensorLifetime;
+
+namespace {
+
+// Check that no two tensors which are live at the same time share memory, and
+// that every tensor fits in the arena at an aligned offset.
+void check_plan(std::vector<TensorLifetime> const& tensors,
+                std::vector<size_t> const& offsets, size_t arena_size,
+                size_t alignment) {
+  ASSERT_EQ(tensors.size(), offsets.size());
+  for (size_t i = 0; i < tensors.size(); ++i) {
+    SCOPED_TRACE("Tensor: " + std::to_string(i));
+    EXPECT_EQ(0u, offsets[i] % alignment);
+    EXPECT_LE(offsets[i] + tensors[i].size, arena_size);
+    for (size_t j = i + 1; j < tensors.size(); ++j) {
+      if (!sycldnn::lifetimes_overlap(tensors[i], tensors[j])) {
+        continue;
+      }
+      SCOPED_TRACE("Overlapping tensor: " + std::to_string(j));
+      bool const disjoint = offsets[i] + tensors[i].size <= offsets[j] ||
+                            offsets[j] + tensors[j].size <= offsets[i];
+      EXPECT_TRUE(disjoint);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(MemoryPlanTest, DisjointLifetimesReuseOffsets) {
+  std::vector<TensorLifetime> tensors = {{10, 0, 1}, {10, 2, 3}, {6, 4, 5}};
+  std::vector<size_t> offsets;
+  size_t arena_size = sycldnn::plan_tensor_offsets(tensors, 1, offsets);
+  check_plan(tensors, offsets, arena_size, 1);
+  EXPECT_EQ(10u, arena_size);
+  EXPECT_EQ((std::vector<size_t>{0, 0, 0}), offsets);
+}
+
+TEST(MemoryPlanTest, OverlappingLifetimesNeverAlias) {
+  // A chain of layers, each output used by the next layer, along with a skip
+  // connection which stays live across several layers.
+  std::vector<TensorLifetime> tensors = {{32, 0, 1}, {16, 1, 2}, {24, 0, 4},
+                                         {16, 2, 3}, {8, 3, 4},  {32, 4, 5}};
+  std::vector<size_t> offsets;
+  size_t arena_size = sycldnn::plan_tensor_offsets(tensors, 1, offsets);
+  check_plan(tensors, offsets, arena_size, 1);
+  // The peak is at the second layer, where the outputs of the first two layers
+  // are live alongside the skip tensor.
+  EXPECT_EQ(72u, arena_size);
+}
+
+TEST(MemoryPlanTest, OffsetsAreRoundedToAlignment) {
+  std::vector<TensorLifetime> tensors = {{10, 0, 1}, {5, 0, 1}, {3, 1, 2}};
+  std::vector<size_t> offsets;
+  size_t arena_size = sycldnn::plan_tensor_offsets(tensors, 8, offsets);
+  check_plan(tensors, offsets, arena_size, 8);
+  EXPECT_EQ((std::vector<size_t>{0, 16, 24}), offsets);
+  EXPECT_EQ(27u, arena_size);
+}
+
+TEST(MemoryPlanTest, LargestTensorsArePlacedFirst) {
+  std::vector<TensorLifetime> tensors = {
+      {4, 0, 0}, {16, 0, 0}, {8, 0, 0}, {8, 0, 0}};
+  std::vector<size_t> offsets;
+  size_t arena_size = sycldnn::plan_tensor_offsets(tensors, 1, offsets);
+  check_plan(tensors, offsets, arena_size, 1);
+  // Tensors of the same size keep their original order.
+  EXPECT_EQ((std::vector<size_t>{32, 0, 16, 24}), offsets);
+  EXPECT_EQ(36u, arena_size);
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_TOOLS_DATA_PARALLEL_NETWORK_H_
+#define SYCLDNN_TOOLS_DATA_PARALLEL_NETWORK_H_
+
+#include "tools/network.h"
+
+#include "sycldnn/status.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+
+// The part of the batch processed by one replica of a data parallel network
+struct BatchShard {
+  // Index of the shard, and of the queue it runs on
+  int index;
+  // Index in the full batch of the first image in the shard
+  int batch_offset;
+  // Number of images in the shard
+  int batch;
+};
+
+// Splits the devices available for running a network into the queues to run
+// shards on. A device which can be partitioned by NUMA domain, such as a
+// multi-socket CPU, gives one queue per domain, otherwise the device is used
+// as a whole.
+inline std::vector<cl::sycl::queue> make_shard_queues(
+    std::vector<cl::sycl::device> const& devices) {
+  std::vector<cl::sycl::queue> queues;
+  for (auto const& device : devices) {
+    std::vector<cl::sycl::device> sub_devices;
+    try {
+      sub_devices = device.create_sub_devices<
+          cl::sycl::info::partition_property::partition_by_affinity_domain>(
+          cl::sycl::info::partition_affinity_domain::numa);
+    } catch (cl::sycl::exception const&) {
+      // Partitioning is not supported by this device
+    }
+    if (sub_devices.size() < 2) {
+      sub_devices = {device};
+    }
+    for (auto const& sub_device : sub_devices) {
+      queues.emplace_back(sub_device);
+    }
+  }
+  return queues;
+}
+
+// Runs inference over a batch by splitting it between several queues, each
+// with its own replica of the network and its own copy of the weights. The
+// outputs of the replicas are gathered into a single host vector, in the same
+// order as the images in the batch.
+template <typename DType, typename Backend>
+class DataParallelNetwork {
+ public:
+  using NetworkType = Network<DType, Backend>;
+  // Adds the layers for one shard to the network, allocating and loading the
+  // weights, and the shard's images of the network input, through the backend
+  using Builder =
+      std::function<void(NetworkType&, Backend&, BatchShard const&)>;
+
+  // Builds a replica of the network for each queue, splitting the batch as
+  // evenly as possible. If the batch is smaller than the number of queues
+  // then only the first `batch` queues are used. The memory of each replica is
+  // planned once it is built, so the builder should not plan it.
+  DataParallelNetwork(std::vector<cl::sycl::queue> const& queues, int batch,
+                      Builder const& build, std::vector<DType>& output)
+      : shards_{}, output_{output} {
+    int const n_queues = static_cast<int>(queues.size());
+    int batch_offset = 0;
+    for (int i = 0; i < n_queues && batch_offset < batch; ++i) {
+      int shard_batch = batch / n_queues + (i < batch % n_queues ? 1 : 0);
+      shards_.emplace_back(new Shard{queues[i]});
+      auto& shard = *shards_.back();
+      build(shard.network, shard.backend, {i, batch_offset, shard_batch});
+      shard.network.plan_memory();
+      batch_offset += shard_batch;
+    }
+  }
+
+  // Runs each replica of the network on its own queue. The returned status
+  // holds the final event of every replica.
+  sycldnn::SNNStatus run() {
+    sycldnn::SNNStatus status;
+    for (auto& shard : shards_) {
+      status.append(shard->network.run());
+      if (status.status != sycldnn::StatusCode::OK) {
+        return status;
+      }
+    }
+    return status;
+  }
+
+  // Runs each replica, checking for exceptions after every layer, and
+  // gathers the outputs into the host vector
+  sycldnn::SNNStatus test() {
+    for (auto& shard : shards_) {
+      shard->network.test().event.wait_and_throw();
+    }
+    gather_output();
+    return sycldnn::StatusCode::OK;
+  }
+
+  // Runs every replica, then waits for all the outputs to be copied back to
+  // the host and gathers them into the host vector
+  sycldnn::SNNStatus run_and_gather() {
+    sycldnn::SNNStatus status = run();
+    if (status.status != sycldnn::StatusCode::OK) {
+      return status;
+    }
+    std::vector<cl::sycl::event> copies;
+    for (auto& shard : shards_) {
+      copies.push_back(shard->network.dump_network_output().event);
+    }
+    cl::sycl::event::wait_and_throw(copies);
+    gather_output();
+    return sycldnn::StatusCode::OK;
+  }
+
+  size_t get_num_shards() const { return shards_.size(); }
+
+  NetworkType& get_shard_network(size_t index) {
+    return shards_[index]->network;
+  }
+
+ private:
+  struct Shard {
+    Backend backend;
+    std::vector<DType> output;
+    NetworkType network;
+
+    explicit Shard(cl::sycl::queue const& queue)
+        : backend{queue}, output{}, network{backend, output} {}
+  };
+
+  // The batch is the outermost dimension of the network output, so the
+  // outputs of the shards are concatenated in order
+  void gather_output() {
+    output_.clear();
+    for (auto& shard : shards_) {
+      output_.insert(output_.end(), shard->output.begin(),
+                     shard->output.end());
+    }
+  }
+
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::vector<DType>& output_;
+};
+}  // namespace sycldnn
+#endif  // SYCLDNN_TOOLS_DATA_PARALLEL_NETWORK_H_
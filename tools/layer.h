@@ -13,7 +13,10 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#ifndef SYCLDNN_TOOLS_LAYER_H_
+#define SYCLDNN_TOOLS_LAYER_H_
 
+#include "sycldnn/conv2d/epilogue_params.h"
 #include "sycldnn/conv2d/launch.h"
 #include "sycldnn/conv2d/selector/default_selector.h"
 #include "sycldnn/conv2d/workspace_size.h"
@@ -38,9 +41,13 @@
 #include "sycldnn/softmax/launch.h"
 #include "sycldnn/softmax/sizes.h"
 
+#include "sycldnn/helpers/macros.h"
+
 #include "sycldnn/padding_mode.h"
 #include "sycldnn/status.h"
 
+#include <vector>
+
 #include <CL/sycl.hpp>
 
 namespace sycldnn {
@@ -57,6 +64,20 @@ struct Layer {
   virtual DeviceMem get_output() = 0;
   virtual size_t get_output_size() const = 0;
   virtual sycldnn::SNNStatus run() = 0;
+
+  // The pointers to tensors read and written by the layer, exposed so that the
+  // network can move activations into memory it has planned for them
+  virtual std::vector<DeviceMem*> get_input_pointers() = 0;
+  virtual DeviceMem* get_output_pointer() = 0;
+
+  // Whether the layer can write its output over its first input
+  virtual bool supports_in_place() const { return false; }
+
+  // Workspace used by the layer, which the network can share between layers
+  virtual size_t get_workspace_size() const { return 0; }
+  virtual void set_workspace(DeviceMem workspace) {
+    SNN_UNUSED_VAR(workspace)
+  }
 };
 
 template <typename DType, typename Backend>
@@ -90,12 +111,74 @@ struct ConvolutionLayer : Layer<DType, Backend> {
   DeviceMem get_output() override { return output_; }
   size_t get_output_size() const override { return sizes_.output_size; }
 
+  std::vector<DeviceMem*> get_input_pointers() override { return {&input_}; }
+  DeviceMem* get_output_pointer() override { return &output_; }
+
+  size_t get_workspace_size() const override { return workspace_size_; }
+  void set_workspace(DeviceMem workspace) override { workspace_ = workspace; }
+
   sycldnn::SNNStatus run() override {
     return sycldnn::conv2d::launch<DType, sycldnn::conv2d::conv_type::Forward>(
         input_, filter_, output_, params_, selector_, this->backend_,
         workspace_, workspace_size_);
   }
 };
+
+// Convolution with a bias, residual and activation applied as the output is
+// stored, rather than as separate layers
+template <typename DType, typename Backend>
+struct FusedConvolutionLayer : Layer<DType, Backend> {
+  using DeviceMem = typename Backend::template pointer_type<DType>;
+  sycldnn::conv2d::Conv2DParams params_;
+  sycldnn::conv2d::EpilogueParams epilogue_;
+  sycldnn::conv2d::ConvSizes sizes_;
+  DeviceMem input_;
+  DeviceMem filter_;
+  DeviceMem bias_;
+  DeviceMem residual_;
+  DeviceMem output_;
+  DeviceMem workspace_;
+  size_t workspace_size_;
+  sycldnn::conv2d::Selector& selector_;
+
+  FusedConvolutionLayer(sycldnn::conv2d::Conv2DParams const& params,
+                        sycldnn::conv2d::EpilogueParams const& epilogue,
+                        DeviceMem const input, DeviceMem const weights,
+                        DeviceMem const bias, DeviceMem const residual,
+                        DeviceMem output, DeviceMem workspace,
+                        size_t workspace_size, Backend& b,
+                        sycldnn::conv2d::Selector& selector)
+      : Layer<DType, Backend>(b),
+        params_{params},
+        epilogue_{epilogue},
+        sizes_{sycldnn::conv2d::get_sizes<sycldnn::conv2d::conv_type::Forward>(
+            params_)},
+        input_{input},
+        filter_{weights},
+        bias_{bias},
+        residual_{residual},
+        output_{output},
+        workspace_{workspace},
+        workspace_size_{workspace_size},
+        selector_{selector} {}
+
+  DeviceMem get_output() override { return output_; }
+  size_t get_output_size() const override { return sizes_.output_size; }
+
+  std::vector<DeviceMem*> get_input_pointers() override {
+    return {&input_, &residual_};
+  }
+  DeviceMem* get_output_pointer() override { return &output_; }
+
+  size_t get_workspace_size() const override { return workspace_size_; }
+  void set_workspace(DeviceMem workspace) override { workspace_ = workspace; }
+
+  sycldnn::SNNStatus run() override {
+    return sycldnn::conv2d::launch<DType, sycldnn::conv2d::conv_type::Forward>(
+        input_, filter_, output_, bias_, residual_, params_, epilogue_,
+        selector_, this->backend_, workspace_, workspace_size_);
+  }
+};
 template <typename DType, typename Backend>
 struct BiasAddLayer : Layer<DType, Backend> {
   using DeviceMem = typename Backend::template pointer_type<DType>;
@@ -116,6 +199,14 @@ struct BiasAddLayer : Layer<DType, Backend> {
   DeviceMem get_output() override { return output_; }
   size_t get_output_size() const override { return params_.lhs_items; }
 
+  // The biases are the residual activations when used for a residual add
+  std::vector<DeviceMem*> get_input_pointers() override {
+    return {&input_, &biases_};
+  }
+  DeviceMem* get_output_pointer() override { return &output_; }
+
+  bool supports_in_place() const override { return true; }
+
   sycldnn::SNNStatus run() override {
     return sycldnn::binaryop::launch<DType, sycldnn::binaryop::Add>(
         input_, biases_, output_, params_, this->backend_);
@@ -158,6 +249,9 @@ struct BatchNormLayer<DType, Backend, sycldnn::batchnorm::Training>
   DeviceMem get_output() override { return output_; }
   size_t get_output_size() const override { return sizes_.output_size; }
 
+  std::vector<DeviceMem*> get_input_pointers() override { return {&input_}; }
+  DeviceMem* get_output_pointer() override { return &output_; }
+
   sycldnn::SNNStatus run() override {
     return sycldnn::batchnorm::launch_forward<DType, Backend,
                                               sycldnn::batchnorm::Forward,
@@ -197,6 +291,9 @@ struct BatchNormLayer<DType, Backend, sycldnn::batchnorm::Frozen>
   DeviceMem get_output() override { return output_; }
   size_t get_output_size() const override { return sizes_.output_size; }
 
+  std::vector<DeviceMem*> get_input_pointers() override { return {&input_}; }
+  DeviceMem* get_output_pointer() override { return &output_; }
+
   sycldnn::SNNStatus run() override {
     return sycldnn::batchnorm::launch_forward<DType, Backend,
                                               sycldnn::batchnorm::Forward,
@@ -224,6 +321,11 @@ struct ActivationLayer : Layer<DType, Backend> {
   DeviceMem get_output() override { return output_; }
   size_t get_output_size() const override { return params_.size; }
 
+  std::vector<DeviceMem*> get_input_pointers() override { return {&input_}; }
+  DeviceMem* get_output_pointer() override { return &output_; }
+
+  bool supports_in_place() const override { return true; }
+
   sycldnn::SNNStatus run() override {
     return sycldnn::pointwise::launch<DType, ActivationType,
                                       sycldnn::pointwise::Forward>(
@@ -251,6 +353,9 @@ struct PoolingLayer : Layer<DType, Backend> {
   DeviceMem get_output() override { return output_; }
   size_t get_output_size() const override { return sizes_.output_size; }
 
+  std::vector<DeviceMem*> get_input_pointers() override { return {&input_}; }
+  DeviceMem* get_output_pointer() override { return &output_; }
+
   sycldnn::SNNStatus run() override {
     return sycldnn::pooling::launch<DType, PoolingType,
                                     sycldnn::pooling::Forward>(
@@ -275,7 +380,11 @@ struct FCLayer : Layer<DType, Backend> {
         output_{output} {}
 
   DeviceMem get_output() override { return output_; }
-  size_t get_output_size() const override { return params_.n; }
+  size_t get_output_size() const override { return params_.m * params_.n; }
+
+  std::vector<DeviceMem*> get_input_pointers() override { return {&input_}; }
+  DeviceMem* get_output_pointer() override { return &output_; }
+
   sycldnn::SNNStatus run() override {
     using ConstPointer = typename Backend::template pointer_type<DType const>;
     return {this->backend_.template matmul<false, false>(
@@ -307,9 +416,18 @@ struct SoftmaxLayer : Layer<DType, Backend> {
   DeviceMem get_output() override { return output_; }
   size_t get_output_size() const override { return sizes_.output_size; }
 
+  std::vector<DeviceMem*> get_input_pointers() override { return {&input_}; }
+  DeviceMem* get_output_pointer() override { return &output_; }
+
+  size_t get_workspace_size() const override {
+    return static_cast<size_t>(sizes_.workspace_size);
+  }
+  void set_workspace(DeviceMem workspace) override { workspace_ = workspace; }
+
   sycldnn::SNNStatus run() override {
     return sycldnn::softmax::launch<DType, sycldnn::softmax::Forward, Backend>(
         input_, workspace_, output_, params_, this->backend_);
   }
 };
 }  // namespace sycldnn
+#endif  // SYCLDNN_TOOLS_LAYER_H_
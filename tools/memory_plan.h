@@ -0,0 +1,90 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_TOOLS_MEMORY_PLAN_H_
+#define SYCLDNN_TOOLS_MEMORY_PLAN_H_
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace sycldnn {
+
+// The size of a tensor in elements, along with the indices of the first and
+// last layers which need the tensor to hold its value
+struct TensorLifetime {
+  size_t size;
+  size_t first;
+  size_t last;
+};
+
+// Checks whether two tensors need to hold their values at the same time
+inline bool lifetimes_overlap(TensorLifetime const& a,
+                              TensorLifetime const& b) {
+  return a.first <= b.last && b.first <= a.last;
+}
+
+// Assigns each tensor an offset into a single arena, such that no two tensors
+// with overlapping lifetimes overlap in memory. Offsets are multiples of the
+// given alignment. Returns the number of elements required for the arena.
+//
+// Tensors are placed largest first, each at the lowest offset which fits
+// between the tensors already placed that are live at the same time. This is
+// the usual greedy approach for static memory planning, and keeps the arena
+// close to the peak size of the live tensors in a feed forward network.
+inline size_t plan_tensor_offsets(std::vector<TensorLifetime> const& tensors,
+                                  size_t alignment,
+                                  std::vector<size_t>& offsets) {
+  auto round_up = [alignment](size_t value) {
+    return (value + alignment - 1) / alignment * alignment;
+  };
+  std::vector<size_t> order(tensors.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+    return tensors[lhs].size > tensors[rhs].size;
+  });
+
+  offsets.assign(tensors.size(), 0);
+  size_t arena_size = 0;
+  std::vector<size_t> placed;
+  for (auto idx : order) {
+    auto const& tensor = tensors[idx];
+    // The tensors already placed which are live at the same time as this one
+    std::vector<size_t> live;
+    for (auto other : placed) {
+      if (lifetimes_overlap(tensor, tensors[other])) {
+        live.push_back(other);
+      }
+    }
+    std::sort(live.begin(), live.end(), [&](size_t lhs, size_t rhs) {
+      return offsets[lhs] < offsets[rhs];
+    });
+
+    size_t offset = 0;
+    for (auto other : live) {
+      if (offset + tensor.size <= offsets[other]) {
+        break;
+      }
+      offset = std::max(offset, round_up(offsets[other] + tensors[other].size));
+    }
+    offsets[idx] = offset;
+    arena_size = std::max(arena_size, offset + tensor.size);
+    placed.push_back(idx);
+  }
+  return arena_size;
+}
+
+}  // namespace sycldnn
+#endif  // SYCLDNN_TOOLS_MEMORY_PLAN_H_
@@ -13,8 +13,16 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#ifndef SYCLDNN_TOOLS_NETWORK_H_
+#define SYCLDNN_TOOLS_NETWORK_H_
 
 #include "tools/layer.h"
+#include "tools/memory_plan.h"
+
+#include "sycldnn/batchnorm/fold.h"
+
+#include <algorithm>
+#include <vector>
 
 #include <CL/sycl.hpp>
 
@@ -22,16 +30,143 @@ namespace sycldnn {
 template <typename DType, typename Backend>
 class Network {
   using DeviceMem = typename Backend::template pointer_type<DType>;
+  using ConvLayer = ConvolutionLayer<DType, Backend>;
+  using BiasLayer = BiasAddLayer<DType, Backend>;
+  using FrozenBatchNormLayer =
+      BatchNormLayer<DType, Backend, sycldnn::batchnorm::Frozen>;
   std::vector<std::unique_ptr<Layer<DType, Backend>>> network_;
   std::vector<DType>& output_;
   Backend& backend_;
+  // The convolution, and optionally the bias-add that follows it, at the end
+  // of the network which a frozen batchnorm can be folded into
+  ConvLayer* foldable_conv_ = nullptr;
+  BiasLayer* foldable_bias_ = nullptr;
+
+  // Checks whether a bias-add adds a per-feature bias to the convolution output
+  static bool is_conv_bias(ConvLayer const& conv, BiasLayer const& bias) {
+    return bias.params_.lhs_items ==
+               static_cast<int>(conv.sizes_.output_size) &&
+           bias.params_.rhs_items == conv.params_.features;
+  }
+
+  // Checks whether a batchnorm normalises the features of the convolution
+  static bool is_conv_batchnorm(ConvLayer const& conv,
+                                FrozenBatchNormLayer const& batchnorm) {
+    auto const& conv_params = conv.params_;
+    auto const& bn_params = batchnorm.params_;
+    return conv_params.input_format == bn_params.input_format &&
+           bn_params.batch == conv_params.batch &&
+           bn_params.rows == conv_params.out_rows &&
+           bn_params.cols == conv_params.out_cols &&
+           bn_params.channels == conv_params.features;
+  }
+
+  // Replaces the foldable convolution and bias at the end of the network with
+  // a convolution using the batchnorm folded into its weights and bias. The
+  // batchnorm is only folded when it reads the output of the last foldable
+  // layer, and the folded convolution writes to the batchnorm output so that
+  // later layers read the normalised values.
+  bool fold_batchnorm(FrozenBatchNormLayer const& batchnorm) {
+    if (!foldable_conv_ || !is_conv_batchnorm(*foldable_conv_, batchnorm)) {
+      return false;
+    }
+    DeviceMem const& foldable_output =
+        foldable_bias_ ? foldable_bias_->output_ : foldable_conv_->output_;
+    if (!same_memory(batchnorm.input_, foldable_output)) {
+      return false;
+    }
+    auto& conv = *foldable_conv_;
+    DeviceMem filter =
+        backend_.template allocate<DType>(conv.sizes_.filter_size);
+    DeviceMem bias = backend_.template allocate<DType>(conv.params_.features);
+    sycldnn::SNNStatus status;
+    if (foldable_bias_) {
+      status = sycldnn::batchnorm::fold_into_conv2d<DType>(
+          conv.filter_, foldable_bias_->biases_, batchnorm.beta_,
+          batchnorm.gamma_, batchnorm.mean_, batchnorm.variance_, filter, bias,
+          conv.params_, batchnorm.params_.epsilon, backend_);
+    } else {
+      status = sycldnn::batchnorm::fold_into_conv2d<DType>(
+          conv.filter_, batchnorm.beta_, batchnorm.gamma_, batchnorm.mean_,
+          batchnorm.variance_, filter, bias, conv.params_,
+          batchnorm.params_.epsilon, backend_);
+    }
+    if (status.status != sycldnn::StatusCode::OK) {
+      return false;
+    }
+    sycldnn::conv2d::EpilogueParams epilogue;
+    epilogue.bias = true;
+    // The residual is disabled, so the input is passed in its place
+    auto fused = new FusedConvolutionLayer<DType, Backend>(
+        conv.params_, epilogue, conv.input_, filter, bias, conv.input_,
+        batchnorm.output_, conv.workspace_, conv.workspace_size_, backend_,
+        conv.selector_);
+    if (foldable_bias_) {
+      network_.pop_back();
+    }
+    network_.pop_back();
+    add_layer(fused);
+    return true;
+  }
+
+  // Checks whether two pointers refer to the same tensor
+  template <typename Pointer>
+  static bool same_memory(Pointer const& lhs, Pointer const& rhs) {
+    return lhs.get_buffer() == rhs.get_buffer() &&
+           lhs.get_offset() == rhs.get_offset();
+  }
+
+  template <typename T>
+  static bool same_memory(T* lhs, T* rhs) {
+    return lhs == rhs;
+  }
+
+  // Finds the layer which wrote the value read through the given pointer by
+  // layer `index`, or returns -1 if it is not the output of an earlier layer,
+  // as for the network input or layer weights
+  int find_producer(size_t index, DeviceMem const& input) {
+    for (size_t layer = index; layer-- > 0;) {
+      if (same_memory(input, *network_[layer]->get_output_pointer())) {
+        return static_cast<int>(layer);
+      }
+    }
+    return -1;
+  }
 
  public:
   Network(Backend& backend, std::vector<DType>& output)
       : network_{}, output_{output}, backend_{backend} {}
 
   // Layers are their own types, number of parameters differs between each
-  void add_layer(Layer<DType, Backend>* layer) { network_.emplace_back(layer); }
+  void add_layer(Layer<DType, Backend>* layer) {
+    network_.emplace_back(layer);
+    foldable_conv_ = nullptr;
+    foldable_bias_ = nullptr;
+  }
+
+  void add_layer(ConvLayer* layer) {
+    add_layer(static_cast<Layer<DType, Backend>*>(layer));
+    foldable_conv_ = layer;
+  }
+
+  void add_layer(BiasLayer* layer) {
+    auto conv = foldable_bias_ ? nullptr : foldable_conv_;
+    add_layer(static_cast<Layer<DType, Backend>*>(layer));
+    if (conv && is_conv_bias(*conv, *layer)) {
+      foldable_conv_ = conv;
+      foldable_bias_ = layer;
+    }
+  }
+
+  // Frozen batchnorm is only used for inference, so when it follows a
+  // convolution it is folded into the convolution weights and bias rather than
+  // run as a separate pass over the convolution output
+  void add_layer(FrozenBatchNormLayer* layer) {
+    std::unique_ptr<FrozenBatchNormLayer> batchnorm{layer};
+    if (!fold_batchnorm(*batchnorm)) {
+      add_layer(static_cast<Layer<DType, Backend>*>(batchnorm.release()));
+    }
+  }
 
   // Runs each layer, checks for exceptions after every layer
   sycldnn::SNNStatus test() {
@@ -43,10 +178,113 @@ class Network {
     return dump_network_output();
   }
 
+  // Moves the activations of all layers into a single arena, and shares one
+  // workspace between all layers which need one. This should be called once,
+  // after all layers have been added and before the network is first run.
+  //
+  // Each layer output is live from the layer writing it to the last layer
+  // reading it, so activations which are never live at the same time share
+  // memory. Elementwise layers write over their input if nothing else reads it
+  // afterwards. Returns the number of elements in the activation arena.
+  size_t plan_memory() {
+    auto const n_layers = network_.size();
+    if (n_layers == 0) {
+      return 0;
+    }
+    // The layer which wrote each input of each layer, or -1 for inputs which
+    // are not activations
+    std::vector<std::vector<int>> producers(n_layers);
+    // The last layer reading the output of each layer, where the network
+    // output is kept alive past the end of the network
+    std::vector<size_t> last_use(n_layers);
+    for (size_t layer = 0; layer < n_layers; ++layer) {
+      last_use[layer] = layer;
+      for (auto input : network_[layer]->get_input_pointers()) {
+        auto producer = find_producer(layer, *input);
+        producers[layer].push_back(producer);
+        if (producer >= 0) {
+          last_use[producer] = layer;
+        }
+      }
+    }
+    last_use.back() = n_layers;
+
+    // Layer outputs which share memory with an earlier output are grouped
+    // into a single tensor, either because the layer was constructed to
+    // write over one of its inputs, as for residual adds, or because it can
+    // be computed in place
+    std::vector<size_t> tensor_of(n_layers);
+    std::vector<TensorLifetime> tensors;
+    for (size_t layer = 0; layer < n_layers; ++layer) {
+      auto& current = *network_[layer];
+      auto inputs = current.get_input_pointers();
+      auto output_size = current.get_output_size();
+      int shared = -1;
+      for (size_t i = 0; i < inputs.size(); ++i) {
+        if (producers[layer][i] >= 0 &&
+            same_memory(*inputs[i], *current.get_output_pointer())) {
+          shared = producers[layer][i];
+          break;
+        }
+      }
+      if (shared < 0 && current.supports_in_place() && !inputs.empty() &&
+          producers[layer][0] >= 0) {
+        auto const& input = tensors[tensor_of[producers[layer][0]]];
+        if (input.last == layer && input.size == output_size) {
+          shared = producers[layer][0];
+        }
+      }
+      if (shared >= 0) {
+        tensor_of[layer] = tensor_of[shared];
+        auto& tensor = tensors[tensor_of[layer]];
+        tensor.size = std::max(tensor.size, output_size);
+        tensor.last = std::max(tensor.last, last_use[layer]);
+      } else {
+        tensor_of[layer] = tensors.size();
+        tensors.push_back({output_size, layer, last_use[layer]});
+      }
+    }
+
+    // Align tensors to 256 bytes, so that vector loads stay aligned
+    size_t const alignment = std::max<size_t>(256 / sizeof(DType), 1);
+    std::vector<size_t> offsets;
+    auto arena_size = plan_tensor_offsets(tensors, alignment, offsets);
+    DeviceMem arena = backend_.template allocate<DType>(arena_size);
+    for (size_t layer = 0; layer < n_layers; ++layer) {
+      auto& current = *network_[layer];
+      *current.get_output_pointer() = arena + offsets[tensor_of[layer]];
+      auto inputs = current.get_input_pointers();
+      for (size_t i = 0; i < inputs.size(); ++i) {
+        auto producer = producers[layer][i];
+        if (producer >= 0) {
+          *inputs[i] = arena + offsets[tensor_of[producer]];
+        }
+      }
+    }
+
+    // Layers are run one after another, so can all use the same workspace
+    size_t workspace_size = 0;
+    for (auto& layer : network_) {
+      workspace_size = std::max(workspace_size, layer->get_workspace_size());
+    }
+    if (workspace_size > 0) {
+      DeviceMem workspace = backend_.template allocate<DType>(workspace_size);
+      for (auto& layer : network_) {
+        if (layer->get_workspace_size() > 0) {
+          layer->set_workspace(workspace);
+        }
+      }
+    }
+    return arena_size;
+  }
+
   sycldnn::SNNStatus run() {
     sycldnn::SNNStatus status;
     for (auto& layer : network_) {
-      status = layer->run();
+      status.append(layer->run());
+      if (status.status != sycldnn::StatusCode::OK) {
+        return status;
+      }
     }
     return status;
   }
@@ -68,8 +306,9 @@ class Network {
 
     auto buf_out = out.get_buffer();
     auto event = backend_.get_queue().submit([&](cl::sycl::handler& cgh) {
-      auto acc_out =
-          buf_out.template get_access<cl::sycl::access::mode::read>(cgh);
+      // The output may be part of a larger buffer, so only access its range
+      auto acc_out = buf_out.template get_access<cl::sycl::access::mode::read>(
+          cgh, cl::sycl::range<1>{count}, cl::sycl::id<1>{out.get_offset()});
 
       cgh.copy(acc_out, output_.data());
     });
@@ -77,3 +316,4 @@ class Network {
   }
 };
 }  // namespace sycldnn
+#endif  // SYCLDNN_TOOLS_NETWORK_H_